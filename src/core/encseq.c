@@ -53,10 +53,12 @@
 #include "core/mathsupport_api.h"
 #include "core/md5_encoder_api.h"
 #include "core/minmax_api.h"
+#include "core/multithread_api.h"
 #include "core/progressbar.h"
 #include "core/sequence_buffer_fasta.h"
 #include "core/sequence_buffer_plain.h"
 #include "core/str_api.h"
+#include "core/thread_api.h"
 #include "core/timer_api.h"
 #include "core/types_api.h"
 #include "core/undef_api.h"
@@ -2058,6 +2060,35 @@ static GtEncseqReaderViatablesinfo *assignSWstate(GtEncseqReader *esr,
                                            : esr->ssptabstate;
 }
 
+/* Hands out the characters of the blocks delivered by
+   gt_sequence_buffer_next_block() one by one, without a function call per
+   character. */
+typedef struct {
+  const GtUchar *block;
+  const char *orig;
+  GtUword length,
+          pos;
+} GtEncseqBlockreader;
+
+#define GT_ENCSEQ_BLOCKREADER_INIT {NULL, NULL, 0, 0}
+
+static inline int gt_encseq_blockreader_next(GtEncseqBlockreader *br,
+                                             GtSequenceBuffer *fb,
+                                             GtUchar *cc, char *orig,
+                                             GtError *err)
+{
+  if (br->pos == br->length) {
+    int retval = gt_sequence_buffer_next_block(fb, &br->block, &br->orig,
+                                               &br->length, err);
+    if (retval != 1)
+      return retval;
+    br->pos = 0;
+  }
+  *cc = br->block[br->pos];
+  *orig = br->orig[br->pos++];
+  return 1;
+}
+
 #define GT_APPENDINT(V)          V##_uchar
 #define GT_SPECIALTABLETYPE      GtUchar
 #define GT_PAGENUM2OFFSET(P)     ((P) << 8)
@@ -2173,6 +2204,7 @@ static int fillViadirectaccess(GtEncseq *encseq,
   int retval;
   GtUchar cc;
   char orig;
+  GtEncseqBlockreader blockreader = GT_ENCSEQ_BLOCKREADER_INIT;
   GtSWtable_uint32 *exceptiontable = &(encseq->exceptiontable.st_uint32);
   gt_error_check(err);
 
@@ -2196,7 +2228,7 @@ static int fillViadirectaccess(GtEncseq *encseq,
                                encseq->totallength);
   encseq->hasplainseqptr = false;
   for (currentposition=0; /* Nothing */; currentposition++) {
-    retval = gt_sequence_buffer_next_with_original(fb, &cc, &orig, err);
+    retval = gt_encseq_blockreader_next(&blockreader, fb, &cc, &orig, err);
     if (retval == 1) {
       if (encseq->has_exceptiontable && cc != (GtUchar) GT_SEPARATOR) {
         if (orig == encseq->maxchars[cc]) {
@@ -2336,6 +2368,7 @@ static int fillViabytecompress(GtEncseq *encseq,
   unsigned int numofchars;
   GtUchar cc;
   char orig;
+  GtEncseqBlockreader blockreader = GT_ENCSEQ_BLOCKREADER_INIT;
   GtSWtable_uint32 *exceptiontable = &(encseq->exceptiontable.st_uint32);
   gt_error_check(err);
 
@@ -2358,7 +2391,7 @@ static int fillViabytecompress(GtEncseq *encseq,
     = bitpackarray_new(gt_alphabet_bits_per_symbol(encseq->alpha),
                        (BitOffset) encseq->totallength, true);
   for (currentposition=0; /* Nothing */; currentposition++) {
-    retval = gt_sequence_buffer_next_with_original(fb, &cc, &orig, err);
+    retval = gt_encseq_blockreader_next(&blockreader, fb, &cc, &orig, err);
     if (retval == 1) {
       if (encseq->has_exceptiontable && cc != (GtUchar) GT_SEPARATOR) {
         if (orig == encseq->maxchars[cc]) {
@@ -2525,6 +2558,7 @@ static int fillViaequallength(GtEncseq *encseq,
 {
   GtUchar cc;
   char orig;
+  GtEncseqBlockreader blockreader = GT_ENCSEQ_BLOCKREADER_INIT;
   GtUword pos,
                 fillexceptionrangeidx = 0,
                 mapposition = 0,
@@ -2553,7 +2587,7 @@ static int fillViaequallength(GtEncseq *encseq,
   }
   gt_assert(encseq->equallength.defined);
   for (pos=0; /* Nothing */; pos++) {
-    retval = gt_sequence_buffer_next_with_original(fb, &cc, &orig, err);
+    retval = gt_encseq_blockreader_next(&blockreader, fb, &cc, &orig, err);
     if (retval == 1) {
       if (encseq->has_exceptiontable && cc != (GtUchar) GT_SEPARATOR) {
         if (orig == encseq->maxchars[cc]) {
@@ -2748,6 +2782,7 @@ static int fillViabitaccess(GtEncseq *encseq,
   int retval;
   GtUchar cc;
   char orig;
+  GtEncseqBlockreader blockreader = GT_ENCSEQ_BLOCKREADER_INIT;
   GtSWtable_uint32 *exceptiontable = &(encseq->exceptiontable.st_uint32);
   DECLARESEQBUFFER(encseq->twobitencoding); /* in fillViabitaccess */
   gt_error_check(err);
@@ -2775,7 +2810,7 @@ static int fillViabitaccess(GtEncseq *encseq,
     GT_SETIBIT(encseq->specialbits, currentposition);
   }
   for (currentposition=0; /* Nothing */; currentposition++) {
-    retval = gt_sequence_buffer_next_with_original(fb, &cc, &orig, err);
+    retval = gt_encseq_blockreader_next(&blockreader, fb, &cc, &orig, err);
     if (retval == 1) {
       if (encseq->has_exceptiontable && cc != (GtUchar) GT_SEPARATOR) {
         if (orig == encseq->maxchars[cc]) {
@@ -5378,13 +5413,15 @@ static int countnumberofexceptionranges(const GtAlphabet *alpha,
   }
   if (!had_err) {
     int retval;
-    char cc;
+    char cc = 0;
     bool in_range = false;
-    GtUchar charcode;
+    GtUchar charcode = 0;
+    GtEncseqBlockreader blockreader = GT_ENCSEQ_BLOCKREADER_INIT;
 
     gt_sequence_buffer_set_symbolmap(fb, gt_alphabet_symbolmap(alpha));
     for (currentpos = 0; /* Nothing */; currentpos++) {
-      retval = gt_sequence_buffer_next_with_original(fb, &charcode, &cc, err);
+      retval = gt_encseq_blockreader_next(&blockreader, fb, &charcode, &cc,
+                                            err);
       if (retval > 0) {
         if (charcode != (GtUchar) GT_SEPARATOR) {
           if (cc != maxchars[charcode]) {
@@ -5418,6 +5455,433 @@ static int countnumberofexceptionranges(const GtAlphabet *alpha,
   return had_err;
 }
 
+/* The statistics of a single input file, which are gathered independently of
+   the other files by gt_encseq_filestats_thread_func() and then combined by
+   gt_encseq_filestats_merge(). The ranges of special characters at the end of
+   a file are not added to its distributions. When merging, they are joined
+   with the separator and the special range at the start of the next file. */
+typedef struct
+{
+  GtStrArray *filenametab;
+  GtSpecialcharinfo specialcharinfo;
+  Definedunsignedlong equallength;
+  GtDiscDistri *distspecialrangelength,
+               *distwildcardrangelength;
+  GtFilelengthvalues filelength;
+  GtUword totallength,
+          numofseparators,
+          minseqlen,
+          maxseqlen,
+          lengthoflastsequence,
+          longestdesc,
+          *characterdistribution,
+          *originaldistribution;
+  GtStr *desctab,
+        *md5tab;
+  GtError *err;
+  bool haserr;
+} GtEncseqFilestats;
+
+typedef struct
+{
+  GtEncseqFilestats *filestats;
+  GtUword numoffiles,
+          nextfile;
+  const GtAlphabet *alpha;
+  bool outoistab,
+       clip_desc;
+  GtMutex *mutex;
+} GtEncseqFilestatsInfo;
+
+static void gt_encseq_filestats_compute(GtEncseqFilestats *filestats,
+                                        const GtEncseqFilestatsInfo *info)
+{
+  GtSequenceBuffer *fb;
+  GtUchar charcode;
+  char cc;
+  const char *origblock;
+  const GtUchar *block;
+  int retval;
+  GtUword currentpos = 0,
+          blocklength,
+          blockpos,
+          lastspecialrangelength = 0,
+          lastwildcardrangelength = 0,
+          lastnonspecialrangelength = 0,
+          lengthofcurrentsequence = 0,
+          md5_blockcount = 0,
+          *numofseparators = &filestats->numofseparators,
+          *minseqlen = &filestats->minseqlen,
+          *maxseqlen = &filestats->maxseqlen,
+          *originaldistribution;
+  bool specialprefix = true, wildcardprefix = true, haserr = false,
+       plainformat = false, outoistab = info->outoistab;
+  GtSpecialcharinfo *specialcharinfo = &filestats->specialcharinfo;
+  Definedunsignedlong *equallength = &filestats->equallength;
+  GtDiscDistri *distspecialrangelength, *distwildcardrangelength;
+  GtDescBuffer *descqueue = NULL;
+  GtMD5Encoder *md5enc = NULL;
+  GtStr *desctab = filestats->desctab,
+        *md5tab = filestats->md5tab;
+  const GtStrArray *filenametab = filestats->filenametab;
+  const GtAlphabet *a = info->alpha;
+  GtError *err = filestats->err;
+  char *desc,
+       md5_blockbuf[64],
+       md5_outbuf[33];
+  unsigned char md5_output[16];
+  FILE *desfp = NULL, *sdsfp = NULL;
+
+  /* like when reading all files in one pass, the format of the first file
+     determines the format of all files */
+  fb = gt_sequence_buffer_fasta_new(filenametab);
+  if (desctab != NULL) {
+    descqueue = gt_desc_buffer_new();
+    if (info->clip_desc)
+      gt_desc_buffer_set_clip_at_whitespace(descqueue);
+    gt_sequence_buffer_set_desc_buffer(fb, descqueue);
+  }
+  if (md5tab != NULL)
+    md5enc = gt_md5_encoder_new();
+  distspecialrangelength = filestats->distspecialrangelength;
+  distwildcardrangelength = filestats->distwildcardrangelength;
+  originaldistribution = filestats->originaldistribution;
+  gt_sequence_buffer_set_symbolmap(fb, gt_alphabet_symbolmap(a));
+  gt_sequence_buffer_set_filelengthtab(fb, &filestats->filelength);
+  gt_sequence_buffer_set_chardisttab(fb, filestats->characterdistribution);
+  while (!haserr) {
+    retval = gt_sequence_buffer_next_block(fb, &block, &origblock,
+                                           &blocklength, err);
+    if (retval > 0) {
+      for (blockpos = 0; !haserr && blockpos < blocklength;
+           blockpos++, currentpos++) {
+        charcode = block[blockpos];
+        cc = origblock[blockpos];
+#define WITHEQUALLENGTH_DES_SSP
+#define WITHCOUNTMINMAX
+#define WITHORIGDIST
+#define WITHMD5TAB
+#define WITHDESCTAB
+#include "encseq_charproc.gen"
+#undef WITHMD5TAB
+#undef WITHDESCTAB
+      }
+    }
+    else {
+      if (retval == 0) {
+        /* the ranges at the end of the file are added when merging */
+        if (*maxseqlen == GT_UNDEF_UWORD
+              || lengthofcurrentsequence > *maxseqlen) {
+          *maxseqlen = lengthofcurrentsequence;
+        }
+        if (*minseqlen == GT_UNDEF_UWORD
+             || lengthofcurrentsequence < *minseqlen) {
+          *minseqlen = lengthofcurrentsequence;
+        }
+        if (lastnonspecialrangelength
+              > specialcharinfo->lengthoflongestnonspecial) {
+          specialcharinfo->lengthoflongestnonspecial
+            = lastnonspecialrangelength;
+        }
+        if (md5enc != NULL) {
+          gt_md5_encoder_add_block(md5enc, md5_blockbuf, md5_blockcount);
+          gt_md5_encoder_finish(md5enc, md5_output, md5_outbuf);
+          gt_str_append_cstr_nt(md5tab, md5_outbuf, (GtUword) 33);
+        }
+        if (equallength->defined) {
+          if (equallength->valueunsignedlong > 0) {
+            if (lengthofcurrentsequence != equallength->valueunsignedlong) {
+              equallength->defined = false;
+            }
+          }
+          else {
+            if (lengthofcurrentsequence == 0) {
+              gt_error_set(err, "sequence must not be empty");
+              haserr = true;
+            }
+            equallength->valueunsignedlong = lengthofcurrentsequence;
+          }
+        }
+        if (desctab != NULL) {
+          gt_str_append_cstr(desctab, gt_desc_buffer_get_next(descqueue));
+          gt_str_append_char(desctab, '\n');
+          filestats->longestdesc = gt_desc_buffer_max_length(descqueue);
+        }
+      }
+      else /* retval < 0 */ {
+        haserr = true;
+      }
+      break;
+    }
+  }
+  filestats->totallength = currentpos;
+  filestats->lengthoflastsequence = lengthofcurrentsequence;
+  specialcharinfo->lengthofspecialsuffix = lastspecialrangelength;
+  specialcharinfo->lengthofwildcardsuffix = lastwildcardrangelength;
+  filestats->haserr = haserr;
+  gt_md5_encoder_delete(md5enc);
+  gt_sequence_buffer_delete(fb);
+  gt_desc_buffer_delete(descqueue);
+}
+
+static void *gt_encseq_filestats_thread_func(void *data)
+{
+  GtEncseqFilestatsInfo *info = (GtEncseqFilestatsInfo *) data;
+
+  while (true) {
+    GtUword filenum;
+
+    gt_mutex_lock(info->mutex);
+    filenum = info->nextfile < info->numoffiles ? info->nextfile++
+                                                : GT_UWORD_MAX;
+    gt_mutex_unlock(info->mutex);
+    if (filenum == GT_UWORD_MAX)
+      break;
+    gt_encseq_filestats_compute(info->filestats + filenum, info);
+  }
+  return NULL;
+}
+
+static void gt_encseq_filestats_delete(GtEncseqFilestats *filestats,
+                                       GtUword numoffiles)
+{
+  GtUword idx;
+
+  if (filestats == NULL)
+    return;
+  for (idx = 0; idx < numoffiles; idx++) {
+    gt_str_array_delete(filestats[idx].filenametab);
+    gt_disc_distri_delete(filestats[idx].distspecialrangelength);
+    gt_disc_distri_delete(filestats[idx].distwildcardrangelength);
+    gt_free(filestats[idx].characterdistribution);
+    gt_free(filestats[idx].originaldistribution);
+    gt_str_delete(filestats[idx].desctab);
+    gt_str_delete(filestats[idx].md5tab);
+    gt_error_delete(filestats[idx].err);
+  }
+  gt_free(filestats);
+}
+
+/* Computes the statistics of each of the input files in <filenametab> in
+   parallel. Returns NULL if this is not possible because an input file does
+   not contain an ordinary character, ends with an empty sequence, or
+   produces an error. The caller then falls back to reading all input files
+   in one pass, which also reports such errors in the usual way. */
+static GtEncseqFilestats *gt_encseq_filestats_new(const GtStrArray
+                                                                   *filenametab,
+                                                  const GtAlphabet *alpha,
+                                                  bool outdestab,
+                                                  bool outmd5tab,
+                                                  bool outoistab,
+                                                  bool clip_desc)
+{
+  GtEncseqFilestatsInfo info;
+  GtSequenceBuffer *fb;
+  GtUword idx;
+  bool applicable;
+  GtError *err;
+
+  /* only FASTA files are read independently, as the readers of the other
+     formats separate the sequences of consecutive files differently */
+  err = gt_error_new();
+  fb = gt_sequence_buffer_new_guess_type(filenametab, err);
+  gt_error_delete(err);
+  applicable = fb != NULL &&
+               gt_sequence_buffer_has_class(fb,
+                                            gt_sequence_buffer_fasta_class());
+  gt_sequence_buffer_delete(fb);
+  if (!applicable)
+    return NULL;
+  info.numoffiles = gt_str_array_size(filenametab);
+  info.nextfile = 0;
+  info.alpha = alpha;
+  info.outoistab = outoistab;
+  info.clip_desc = clip_desc;
+  info.filestats = gt_calloc((size_t) info.numoffiles,
+                             sizeof (*info.filestats));
+  for (idx = 0; idx < info.numoffiles; idx++) {
+    GtEncseqFilestats *filestats = info.filestats + idx;
+
+    filestats->filenametab = gt_str_array_new();
+    gt_str_array_add_cstr(filestats->filenametab,
+                          gt_str_array_get(filenametab, idx));
+    filestats->equallength.defined = true;
+    filestats->minseqlen = filestats->maxseqlen = GT_UNDEF_UWORD;
+    filestats->distspecialrangelength = gt_disc_distri_new();
+    filestats->distwildcardrangelength = gt_disc_distri_new();
+    filestats->characterdistribution
+      = gt_calloc((size_t) gt_alphabet_num_of_chars(alpha), sizeof (GtUword));
+    filestats->originaldistribution
+      = gt_calloc((size_t) UCHAR_MAX, sizeof (GtUword));
+    filestats->desctab = outdestab ? gt_str_new() : NULL;
+    filestats->md5tab = outmd5tab ? gt_str_new() : NULL;
+    filestats->err = gt_error_new();
+  }
+  info.mutex = gt_mutex_new();
+  err = gt_error_new();
+  if (gt_multithread(gt_encseq_filestats_thread_func, &info, err) != 0)
+    applicable = false;
+  gt_error_delete(err);
+  gt_mutex_delete(info.mutex);
+  for (idx = 0; applicable && idx < info.numoffiles; idx++) {
+    const GtEncseqFilestats *filestats = info.filestats + idx;
+
+    if (filestats->haserr
+          || filestats->specialcharinfo.specialcharacters
+               == filestats->totallength
+          || filestats->lengthoflastsequence == 0) {
+      applicable = false;
+    }
+  }
+  if (!applicable) {
+    gt_encseq_filestats_delete(info.filestats, info.numoffiles);
+    return NULL;
+  }
+  return info.filestats;
+}
+
+typedef struct
+{
+  GtDiscDistri *dist;
+  GtUword skipkey;
+} GtEncseqFilestatsDistInfo;
+
+/* adds the distribution of a file to the combined distribution, omitting one
+   occurrence of <skipkey> */
+static void gt_encseq_filestats_add_dist(GtUword key, GtUint64 value,
+                                         void *data)
+{
+  GtEncseqFilestatsDistInfo *distinfo = (GtEncseqFilestatsDistInfo *) data;
+
+  if (key == distinfo->skipkey) {
+    distinfo->skipkey = 0;
+    value--;
+  }
+  if (value > 0)
+    gt_disc_distri_add_multi(distinfo->dist, key, value);
+}
+
+/* Combines the statistics of the input files as if the files had been read
+   in one pass and writes the descriptions and the MD5 fingerprints. Stores
+   the length of the special and wildcard ranges at the end of the input, the
+   length of the last sequence and the maximum length of a description
+   (including the terminating '\0'). Returns the total length of the input. */
+static GtUword gt_encseq_filestats_merge(const GtEncseqFilestats *filestats,
+                                         GtUword numoffiles,
+                                         unsigned int numofchars,
+                                         GtSpecialcharinfo *specialcharinfo,
+                                         Definedunsignedlong *equallength,
+                                         GtFilelengthvalues *filelengthtab,
+                                         GtUword *characterdistribution,
+                                         GtUword *originaldistribution,
+                                         GtDiscDistri *distspecialrangelength,
+                                         GtDiscDistri *distwildcardrangelength,
+                                         GtUword *numofseparators,
+                                         GtUword *minseqlen,
+                                         GtUword *maxseqlen,
+                                         GtUword *lastspecialrangelength,
+                                         GtUword *lastwildcardrangelength,
+                                         GtUword *lengthofcurrentsequence,
+                                         GtUword *longestdesc,
+                                         FILE *desfp,
+                                         FILE *sdsfp,
+                                         FILE *md5fp)
+{
+  GtUword idx, charidx, totallength = 0;
+
+  *longestdesc = 0;
+  for (idx = 0; idx < numoffiles; idx++) {
+    const GtEncseqFilestats *current = filestats + idx;
+    const GtSpecialcharinfo *currentinfo = &current->specialcharinfo;
+    GtEncseqFilestatsDistInfo distinfo;
+
+    distinfo.dist = distspecialrangelength;
+    distinfo.skipkey = 0;
+    if (idx == 0) {
+      specialcharinfo->lengthofspecialprefix
+        = currentinfo->lengthofspecialprefix;
+      specialcharinfo->lengthofwildcardprefix
+        = currentinfo->lengthofwildcardprefix;
+      *equallength = current->equallength;
+    }
+    else {
+      /* the separator joins the special range at the end of the previous
+         file with the special range at the start of this file */
+      gt_disc_distri_add(distspecialrangelength,
+                         *lastspecialrangelength + 1
+                           + currentinfo->lengthofspecialprefix);
+      if (*lastwildcardrangelength > 0)
+        gt_disc_distri_add(distwildcardrangelength, *lastwildcardrangelength);
+      distinfo.skipkey = currentinfo->lengthofspecialprefix;
+      if (equallength->defined
+            && (!current->equallength.defined
+                || current->equallength.valueunsignedlong
+                     != equallength->valueunsignedlong)) {
+        equallength->defined = false;
+      }
+      totallength++;
+      (*numofseparators)++;
+      specialcharinfo->specialcharacters++;
+    }
+    gt_disc_distri_foreach(current->distspecialrangelength,
+                           gt_encseq_filestats_add_dist, &distinfo);
+    distinfo.dist = distwildcardrangelength;
+    distinfo.skipkey = 0;
+    gt_disc_distri_foreach(current->distwildcardrangelength,
+                           gt_encseq_filestats_add_dist, &distinfo);
+    *lastspecialrangelength = currentinfo->lengthofspecialsuffix;
+    *lastwildcardrangelength = currentinfo->lengthofwildcardsuffix;
+    *lengthofcurrentsequence = current->lengthoflastsequence;
+    totallength += current->totallength;
+    *numofseparators += current->numofseparators;
+    specialcharinfo->specialcharacters += currentinfo->specialcharacters;
+    specialcharinfo->wildcards += currentinfo->wildcards;
+    if (currentinfo->lengthoflongestnonspecial
+          > specialcharinfo->lengthoflongestnonspecial) {
+      specialcharinfo->lengthoflongestnonspecial
+        = currentinfo->lengthoflongestnonspecial;
+    }
+    if (*maxseqlen == GT_UNDEF_UWORD || current->maxseqlen > *maxseqlen)
+      *maxseqlen = current->maxseqlen;
+    if (*minseqlen == GT_UNDEF_UWORD || current->minseqlen < *minseqlen)
+      *minseqlen = current->minseqlen;
+    filelengthtab[idx] = current->filelength;
+    for (charidx = 0; charidx < (GtUword) numofchars; charidx++)
+      characterdistribution[charidx] += current->characterdistribution[charidx];
+    for (charidx = 0; charidx < (GtUword) UCHAR_MAX; charidx++)
+      originaldistribution[charidx] += current->originaldistribution[charidx];
+    if (md5fp != NULL) {
+      gt_xfwrite(gt_str_get_mem(current->md5tab), sizeof (char),
+                 (size_t) gt_str_length(current->md5tab), md5fp);
+    }
+    if (desfp != NULL) {
+      const char *desc = gt_str_get(current->desctab),
+                 *descend = desc + gt_str_length(current->desctab);
+
+      while (desc < descend) {
+        const char *newline = memchr(desc, '\n', (size_t) (descend - desc));
+
+        gt_assert(newline != NULL);
+        gt_xfwrite(desc, sizeof (char), (size_t) (newline - desc), desfp);
+        /* there is no offset for the end of the last description */
+        if (sdsfp != NULL && (idx < numoffiles - 1 || newline + 1 < descend)) {
+          GtUword desoffset = (GtUword) ftello(desfp);
+          gt_xfwrite(&desoffset, sizeof desoffset, (size_t) 1, sdsfp);
+        }
+        gt_xfputc((int) '\n', desfp);
+        desc = newline + 1;
+      }
+      if (current->longestdesc > *longestdesc)
+        *longestdesc = current->longestdesc;
+    }
+  }
+  if (*lastspecialrangelength > 0)
+    gt_disc_distri_add(distspecialrangelength, *lastspecialrangelength);
+  if (*lastwildcardrangelength > 0)
+    gt_disc_distri_add(distwildcardrangelength, *lastwildcardrangelength);
+  return totallength;
+}
+
 static int gt_inputfiles2sequencekeyvalues(const char *indexname,
                                            GtUword *totallength,
                                            GtSpecialcharinfo *specialcharinfo,
@@ -5456,6 +5920,7 @@ static int gt_inputfiles2sequencekeyvalues(const char *indexname,
                 lastwildcardrangelength = 0,
                 lastnonspecialrangelength = 0,
                 lengthofcurrentsequence = 0,
+                longestdesc = 0,
                 lengthofalphadef,
                 *originaldistribution = NULL,
                 md5_blockcount = 0;
@@ -5463,6 +5928,7 @@ static int gt_inputfiles2sequencekeyvalues(const char *indexname,
   GtDiscDistri *distspecialrangelength = NULL, *distwildcardrangelength = NULL;
   GtDescBuffer *descqueue = NULL;
   GtMD5Encoder *md5enc = NULL;
+  GtEncseqFilestats *filestats = NULL;
   char *desc,
        md5_blockbuf[64],
        md5_outbuf[33];
@@ -5479,6 +5945,17 @@ static int gt_inputfiles2sequencekeyvalues(const char *indexname,
   specialcharinfo->lengthofwildcardprefix = 0;
   specialcharinfo->lengthofwildcardsuffix = 0;
 
+#if defined (_LP64) || defined (_WIN64)
+  /* with multiple threads, the input files are read independently */
+  if (gt_jobs > 1U && !plainformat && gt_str_array_size(filenametab) > 1UL) {
+    filestats = gt_encseq_filestats_new(filenametab, alpha, outdestab,
+                                        outmd5tab, outoistab, clip_desc);
+    if (filestats != NULL) {
+      gt_logger_log(logger, "computed statistics of " GT_WU " input files "
+                    "independently", gt_str_array_size(filenametab));
+    }
+  }
+#endif
   if (plainformat) {
     fb = gt_sequence_buffer_plain_new(filenametab);
     equallength->defined = false;
@@ -5508,6 +5985,9 @@ static int gt_inputfiles2sequencekeyvalues(const char *indexname,
   }
   if (!haserr) {
     char cc;
+    const char *origblock;
+    const GtUchar *block;
+    GtUword blocklength, blockpos;
     const GtAlphabet *a = alpha;
     gt_sequence_buffer_set_symbolmap(fb, gt_alphabet_symbolmap(alpha));
     *filelengthtab = gt_calloc((size_t) gt_str_array_size(filenametab),
@@ -5520,26 +6000,32 @@ static int gt_inputfiles2sequencekeyvalues(const char *indexname,
     distwildcardrangelength = gt_disc_distri_new();
     originaldistribution = gt_calloc((size_t) UCHAR_MAX,
                                      sizeof (GtUword));
-    if (md5fp != NULL)
+    if (md5fp != NULL && filestats == NULL)
       md5enc = gt_md5_encoder_new();
-    for (currentpos = 0; !haserr; currentpos++) {
+    for (currentpos = 0; !haserr && filestats == NULL; /* Nothing */) {
+      retval = gt_sequence_buffer_next_block(fb, &block, &origblock,
+                                             &blocklength, err);
+      if (retval > 0) {
+        for (blockpos = 0; !haserr && blockpos < blocklength;
+             blockpos++, currentpos++) {
 #if !(defined (_LP64) || defined (_WIN64))
 #define MAXSFXLENFOR32BIT 4294000000UL
-      if (currentpos > MAXSFXLENFOR32BIT) {
-        gt_error_set(err, "input sequence must not be longer than " GT_WU,
-                     MAXSFXLENFOR32BIT);
-        haserr = true;
-        break;
-      }
+          if (currentpos > MAXSFXLENFOR32BIT) {
+            gt_error_set(err, "input sequence must not be longer than " GT_WU,
+                         MAXSFXLENFOR32BIT);
+            haserr = true;
+            break;
+          }
 #endif
-      retval = gt_sequence_buffer_next_with_original(fb, &charcode, &cc, err);
-      if (retval > 0) {
+          charcode = block[blockpos];
+          cc = origblock[blockpos];
 #define WITHEQUALLENGTH_DES_SSP
 #define WITHOISTAB
 #define WITHCOUNTMINMAX
 #define WITHORIGDIST
 #define WITHMD5FP
 #include "encseq_charproc.gen"
+        }
       }
       else {
         if (retval == 0) {
@@ -5593,6 +6079,28 @@ static int gt_inputfiles2sequencekeyvalues(const char *indexname,
       }
     }
     gt_md5_encoder_delete(md5enc);
+    if (filestats != NULL) {
+      currentpos = gt_encseq_filestats_merge(filestats,
+                                             gt_str_array_size(filenametab),
+                                             gt_alphabet_num_of_chars(alpha),
+                                             specialcharinfo,
+                                             equallength,
+                                             *filelengthtab,
+                                             characterdistribution,
+                                             originaldistribution,
+                                             distspecialrangelength,
+                                             distwildcardrangelength,
+                                             numofseparators,
+                                             minseqlen,
+                                             maxseqlen,
+                                             &lastspecialrangelength,
+                                             &lastwildcardrangelength,
+                                             &lengthofcurrentsequence,
+                                             &longestdesc,
+                                             desfp,
+                                             sdsfp,
+                                             md5fp);
+    }
   }
   if (!haserr) {
     alphabet_to_key_values(alpha, NULL, &lengthofalphadef, NULL,
@@ -5611,12 +6119,14 @@ static int gt_inputfiles2sequencekeyvalues(const char *indexname,
   }
   if (!haserr) {
     if (desfp != NULL) {
-      GtUword longestdesc,
-                    fin = ~0UL;
-      desc = (char*) gt_desc_buffer_get_next(descqueue);
-      longestdesc = gt_desc_buffer_max_length(descqueue) - 1;
-      gt_xfputs(desc, desfp);
-      gt_xfputc((int) '\n', desfp);
+      GtUword fin = ~0UL;
+      if (filestats == NULL) {
+        desc = (char*) gt_desc_buffer_get_next(descqueue);
+        longestdesc = gt_desc_buffer_max_length(descqueue);
+        gt_xfputs(desc, desfp);
+        gt_xfputc((int) '\n', desfp);
+      }
+      longestdesc--;
       gt_xfwrite_one(&longestdesc, desfp);
       gt_xfwrite_one(&fin, desfp); /* to ensure that there is no \n in new-style
                                       .des files */
@@ -5666,6 +6176,7 @@ static int gt_inputfiles2sequencekeyvalues(const char *indexname,
   gt_fa_xfclose(md5fp);
   gt_sequence_buffer_delete(fb);
   gt_desc_buffer_delete(descqueue);
+  gt_encseq_filestats_delete(filestats, gt_str_array_size(filenametab));
 #ifndef NDEBUG
   gt_GtSpecialcharinfo_check(specialcharinfo, *numofseparators);
 #endif
@@ -45,7 +45,8 @@ static int gt_fasta_reader_fsm_run(GtFastaReader *fasta_reader,
                                    void *data, GtError *err)
 {
   GtFastaReaderFSM *fr = gt_fasta_reader_fsm_cast(fasta_reader);
-  unsigned char cc;
+  unsigned char cc, buf[BUFSIZ];
+  size_t buflen, bufpos;
   GtFastaReaderState state = EXPECTING_SEPARATOR;
   GtUword sequence_length = 0, line_counter = 1;
   GtStr *description, *sequence;
@@ -65,83 +66,89 @@ static int gt_fasta_reader_fsm_run(GtFastaReader *fasta_reader,
   if (fr->sequence_file)
     gt_file_xrewind(fr->sequence_file);
 
-  /* reading */
-  while (!had_err && gt_file_xread(fr->sequence_file, &cc, 1) != 0) {
-    switch (state) {
-      case EXPECTING_SEPARATOR:
-        if (cc != GT_FASTA_SEPARATOR) {
-          gt_error_set(err,
-                    "the first character of fasta file \"%s\" has to be '%c'",
-                    gt_str_get(fr->sequence_filename), GT_FASTA_SEPARATOR);
-          had_err = -1;
-        }
-        else
-          state = READING_DESCRIPTION;
-        break;
-      case READING_DESCRIPTION:
-        if (cc == '\n') {
-          if (proc_description) {
-            had_err = proc_description(gt_str_get(description),
-                                       gt_str_length(description), data, err);
-            if (!had_err)
-              gt_str_reset(description);
-          }
-          if (!had_err) {
-            sequence_length = 0;
-            line_counter++;
-            state = READING_SEQUENCE_AFTER_NEWLINE;
-          }
-        }
-        else if (proc_description && cc != '\r')
-          gt_str_append_char(description, cc);
-        break;
-      case READING_SEQUENCE_AFTER_NEWLINE:
-        if (cc == GT_FASTA_SEPARATOR) {
-          if (!sequence_length) {
-            gt_assert(line_counter);
-            gt_error_set(err, "empty sequence after description given in line "
-                              ""GT_WU"", line_counter - 1);
+  /* reading, one buffer at a time */
+  while (!had_err &&
+         (buflen = gt_file_xread(fr->sequence_file, buf, sizeof buf)) != 0) {
+    for (bufpos = 0; !had_err && bufpos < buflen; bufpos++) {
+      cc = buf[bufpos];
+      switch (state) {
+        case EXPECTING_SEPARATOR:
+          if (cc != GT_FASTA_SEPARATOR) {
+            gt_error_set(err,
+                      "the first character of fasta file \"%s\" has to be '%c'",
+                      gt_str_get(fr->sequence_filename), GT_FASTA_SEPARATOR);
             had_err = -1;
-            break;
           }
-          else {
-            if (proc_sequence_part) {
-              gt_assert(gt_str_length(sequence));
-              had_err = proc_sequence_part(gt_str_get(sequence),
-                                           gt_str_length(sequence), data, err);
-            }
-            if (had_err)
-              break;
-            gt_str_reset(sequence);
-            if (proc_sequence_length)
-              had_err = proc_sequence_length(sequence_length, data, err);
-            if (had_err)
-              break;
+          else
             state = READING_DESCRIPTION;
-            continue;
+          break;
+        case READING_DESCRIPTION:
+          if (cc == '\n') {
+            if (proc_description) {
+              had_err = proc_description(gt_str_get(description),
+                                         gt_str_length(description), data, err);
+              if (!had_err)
+                gt_str_reset(description);
+            }
+            if (!had_err) {
+              sequence_length = 0;
+              line_counter++;
+              state = READING_SEQUENCE_AFTER_NEWLINE;
+            }
           }
-        }
-        /*@fallthrough@*/
-      case READING_SEQUENCE:
-        if (cc == '\n') {
-          line_counter++;
-          state = READING_SEQUENCE_AFTER_NEWLINE;
-        }
-        else {
-          sequence_length++;
-          if (proc_sequence_part) {
-            if (gt_str_length(sequence) == BUFSIZ) {
-              had_err = proc_sequence_part(gt_str_get(sequence),
-                                           gt_str_length(sequence), data, err);
+          else if (proc_description && cc != '\r')
+            gt_str_append_char(description, cc);
+          break;
+        case READING_SEQUENCE_AFTER_NEWLINE:
+          if (cc == GT_FASTA_SEPARATOR) {
+            if (!sequence_length) {
+              gt_assert(line_counter);
+              gt_error_set(err, "empty sequence after description given in "
+                                "line "GT_WU"", line_counter - 1);
+              had_err = -1;
+              break;
+            }
+            else {
+              if (proc_sequence_part) {
+                gt_assert(gt_str_length(sequence));
+                had_err = proc_sequence_part(gt_str_get(sequence),
+                                             gt_str_length(sequence), data,
+                                             err);
+              }
               if (had_err)
                 break;
               gt_str_reset(sequence);
+              if (proc_sequence_length)
+                had_err = proc_sequence_length(sequence_length, data, err);
+              if (had_err)
+                break;
+              state = READING_DESCRIPTION;
+              continue;
             }
-            if (cc != ' ' && cc != '\r')
-              gt_str_append_char(sequence, cc);
           }
-        }
-        break;
+          /*@fallthrough@*/
+        case READING_SEQUENCE:
+          if (cc == '\n') {
+            line_counter++;
+            state = READING_SEQUENCE_AFTER_NEWLINE;
+          }
+          else {
+            sequence_length++;
+            if (proc_sequence_part) {
+              if (gt_str_length(sequence) == BUFSIZ) {
+                had_err = proc_sequence_part(gt_str_get(sequence),
+                                             gt_str_length(sequence), data,
+                                             err);
+                if (had_err)
+                  break;
+                gt_str_reset(sequence);
+              }
+              if (cc != ' ' && cc != '\r')
+                gt_str_append_char(sequence, cc);
+            }
+          }
+          break;
+      }
     }
   }
 
@@ -22,6 +22,7 @@
 #include "core/ma_api.h"
 #include "core/mathsupport_api.h"
 #include "core/minmax_api.h"
+#include "core/msort.h"
 #include "core/range_api.h"
 #include "core/str_api.h"
 #include "core/unused_api.h"
@@ -169,7 +170,8 @@ static void interval_tree_find_all_internal(GtIntervalTree *it,
   /* recursively search left and right subtrees */
   if (x->left != it->nil && low <= x->left->max)
     interval_tree_find_all_internal(it, x->left, func, low, high, data);
-  if (x->right != it->nil && low <= x->right->max)
+  /* the intervals in the right subtree do not start before <x> */
+  if (x->right != it->nil && low <= x->right->max && x->low <= high)
     interval_tree_find_all_internal(it, x->right, func, low, high, data);
 }
 
@@ -501,6 +503,285 @@ void gt_interval_tree_remove(GtIntervalTree *it, GtIntervalTreeNode *z)
   it->size--;
 }
 
+typedef struct {
+  GtUword low, high, max;
+  void *data;
+} GtIntervalTreeStaticEntry;
+
+struct GtIntervalTreeStatic {
+  GtIntervalTreeStaticEntry *entries;
+  GtUword nof_entries,
+          allocated,
+          nof_sorted; /* length of the prefix of <entries> sorted by <low> */
+  bool built;
+  GtFree free_func;
+};
+
+GtIntervalTreeStatic* gt_interval_tree_static_new(GtFree func)
+{
+  GtIntervalTreeStatic *its;
+  its = gt_calloc(1, sizeof (GtIntervalTreeStatic));
+  its->free_func = func;
+  its->built = true;
+  return its;
+}
+
+void gt_interval_tree_static_add(GtIntervalTreeStatic *its, void *data,
+                                 GtUword low, GtUword high)
+{
+  GtIntervalTreeStaticEntry *entry;
+  gt_assert(its && low <= high);
+  if (its->nof_entries == its->allocated) {
+    its->allocated = its->allocated * 1.2 + 16;
+    its->entries = gt_realloc(its->entries,
+                              sizeof (GtIntervalTreeStaticEntry)
+                              * its->allocated);
+  }
+  entry = its->entries + its->nof_entries++;
+  entry->low = low;
+  entry->high = high;
+  entry->max = high;
+  entry->data = data;
+  its->built = false;
+}
+
+bool gt_interval_tree_static_remove(GtIntervalTreeStatic *its, void *data,
+                                    GtUword low, GtUword high)
+{
+  GtUword idx = 0, left = 0, right = its->nof_sorted;
+  gt_assert(its);
+
+  /* find the first sorted entry starting at <low> */
+  while (left < right) {
+    GtUword mid = left + (right - left) / 2;
+    if (its->entries[mid].low < low)
+      left = mid + 1;
+    else
+      right = mid;
+  }
+  for (idx = left; idx < its->nof_sorted && its->entries[idx].low == low;
+       idx++) {
+    if (its->entries[idx].data == data && its->entries[idx].high == high)
+      break;
+  }
+  if (idx == its->nof_sorted || its->entries[idx].low != low) {
+    /* search the entries added since the last build */
+    for (idx = its->nof_sorted; idx < its->nof_entries; idx++) {
+      if (its->entries[idx].data == data && its->entries[idx].low == low &&
+          its->entries[idx].high == high)
+        break;
+    }
+    if (idx == its->nof_entries)
+      return false;
+  }
+  if (its->free_func && data)
+    its->free_func(data);
+  memmove(its->entries + idx, its->entries + idx + 1,
+          sizeof (GtIntervalTreeStaticEntry) * (its->nof_entries - idx - 1));
+  if (idx < its->nof_sorted)
+    its->nof_sorted--;
+  its->nof_entries--;
+  its->built = false;
+  return true;
+}
+
+static int interval_tree_static_entry_compare(const void *v1, const void *v2)
+{
+  const GtIntervalTreeStaticEntry *e1 = v1, *e2 = v2;
+  if (e1->low == e2->low)
+    return 0;
+  return e1->low < e2->low ? -1 : 1;
+}
+
+/* sets the <max> values of the implicit tree over the entries in [lo,hi) and
+   returns the maximum end position in this interval */
+static GtUword interval_tree_static_set_max(GtIntervalTreeStaticEntry *entries,
+                                            GtUword lo, GtUword hi)
+{
+  GtUword mid, max, leftmax, rightmax;
+  if (lo >= hi)
+    return 0;
+  mid = lo + (hi - lo) / 2;
+  leftmax = interval_tree_static_set_max(entries, lo, mid);
+  rightmax = interval_tree_static_set_max(entries, mid + 1, hi);
+  max = GT_MAX(entries[mid].high, leftmax);
+  max = GT_MAX(max, rightmax);
+  entries[mid].max = max;
+  return max;
+}
+
+void gt_interval_tree_static_build(GtIntervalTreeStatic *its)
+{
+  gt_assert(its);
+  if (its->built)
+    return;
+  if (its->nof_sorted < its->nof_entries) {
+    GtUword nof_added = its->nof_entries - its->nof_sorted;
+    gt_msort(its->entries + its->nof_sorted, nof_added,
+             sizeof (GtIntervalTreeStaticEntry),
+             interval_tree_static_entry_compare);
+    if (its->nof_sorted > 0 &&
+        its->entries[its->nof_sorted].low <
+        its->entries[its->nof_sorted - 1].low) {
+      /* merge the new entries into the sorted ones, from the back */
+      GtIntervalTreeStaticEntry *added;
+      GtUword i = its->nof_sorted, j = nof_added, k = its->nof_entries;
+      added = gt_malloc(sizeof (GtIntervalTreeStaticEntry) * nof_added);
+      memcpy(added, its->entries + its->nof_sorted,
+             sizeof (GtIntervalTreeStaticEntry) * nof_added);
+      while (j > 0) {
+        if (i > 0 && its->entries[i - 1].low > added[j - 1].low)
+          its->entries[--k] = its->entries[--i];
+        else
+          its->entries[--k] = added[--j];
+      }
+      gt_free(added);
+    }
+    its->nof_sorted = its->nof_entries;
+  }
+  (void) interval_tree_static_set_max(its->entries, 0, its->nof_entries);
+  its->built = true;
+}
+
+bool gt_interval_tree_static_is_built(const GtIntervalTreeStatic *its)
+{
+  gt_assert(its);
+  return its->built;
+}
+
+GtUword gt_interval_tree_static_size(const GtIntervalTreeStatic *its)
+{
+  gt_assert(its);
+  return its->nof_entries;
+}
+
+static int interval_tree_static_overlapping(const GtIntervalTreeStaticEntry
+                                            *entries,
+                                            GtUword lo, GtUword hi,
+                                            GtIntervalTreeStaticIteratorFunc
+                                            func,
+                                            GtUword start, GtUword end,
+                                            void *data)
+{
+  int rval = 0;
+  while (!rval && lo < hi) {
+    GtUword mid = lo + (hi - lo) / 2;
+    /* no interval in this subtree reaches the query */
+    if (entries[mid].max < start)
+      break;
+    rval = interval_tree_static_overlapping(entries, lo, mid, func, start, end,
+                                            data);
+    /* all intervals to the right start behind the query */
+    if (rval || entries[mid].low > end)
+      break;
+    if (entries[mid].high >= start)
+      rval = func(entries[mid].data, entries[mid].low, entries[mid].high,
+                  data);
+    lo = mid + 1;
+  }
+  return rval;
+}
+
+int gt_interval_tree_static_iterate_overlapping(GtIntervalTreeStatic *its,
+                                              GtIntervalTreeStaticIteratorFunc
+                                                func,
+                                                GtUword start, GtUword end,
+                                                void *data)
+{
+  gt_assert(its && func && start <= end);
+  gt_assert(its->built);
+  return interval_tree_static_overlapping(its->entries, 0, its->nof_entries,
+                                          func, start, end, data);
+}
+
+static int interval_tree_static_store_in_array(void *data,
+                                               GT_UNUSED GtUword low,
+                                               GT_UNUSED GtUword high,
+                                               void *results)
+{
+  gt_array_add((GtArray*) results, data);
+  return 0;
+}
+
+void gt_interval_tree_static_find_all_overlapping(GtIntervalTreeStatic *its,
+                                                  GtUword start, GtUword end,
+                                                  GtArray *results)
+{
+  gt_assert(its && results && start <= end);
+  gt_assert(its->built);
+  (void) interval_tree_static_overlapping(its->entries, 0, its->nof_entries,
+                                          interval_tree_static_store_in_array,
+                                          start, end, results);
+}
+
+int gt_interval_tree_static_iterate_overlapping_ranges(
+                                             GtIntervalTreeStatic *its,
+                                             const GtRange *ranges,
+                                             GtUword nof_ranges,
+                                             GtIntervalTreeStaticRangesFunc
+                                             func,
+                                             void *data)
+{
+  GtUword *active, nof_active = 0, next = 0, r, i, j;
+  int rval = 0;
+  gt_assert(its && (ranges || nof_ranges == 0) && func);
+  gt_assert(its->built);
+
+  /* <active> holds the numbers of the intervals starting before the end of a
+     range seen so far which may still overlap the following ranges, in the
+     order of their start positions */
+  active = gt_malloc(sizeof (GtUword) * (its->nof_entries + 1));
+  for (r = 0; !rval && r < nof_ranges; r++) {
+    gt_assert(r == 0 || ranges[r - 1].start <= ranges[r].start);
+    while (next < its->nof_entries && its->entries[next].low <= ranges[r].end)
+      active[nof_active++] = next++;
+    /* drop the intervals ending before this range, as all following ranges
+       start behind it as well */
+    for (i = j = 0; i < nof_active; i++) {
+      if (its->entries[active[i]].high >= ranges[r].start)
+        active[j++] = active[i];
+    }
+    nof_active = j;
+    for (i = 0; !rval && i < nof_active; i++) {
+      const GtIntervalTreeStaticEntry *entry = its->entries + active[i];
+      if (entry->low > ranges[r].end)
+        break;
+      rval = func(entry->data, r, data);
+    }
+  }
+  gt_free(active);
+  return rval;
+}
+
+int gt_interval_tree_static_traverse(GtIntervalTreeStatic *its,
+                                     GtIntervalTreeStaticIteratorFunc func,
+                                     void *data)
+{
+  GtUword idx;
+  int rval = 0;
+  gt_assert(its && func);
+  gt_assert(its->built);
+  for (idx = 0; !rval && idx < its->nof_entries; idx++) {
+    rval = func(its->entries[idx].data, its->entries[idx].low,
+                its->entries[idx].high, data);
+  }
+  return rval;
+}
+
+void gt_interval_tree_static_delete(GtIntervalTreeStatic *its)
+{
+  GtUword idx;
+  if (!its) return;
+  if (its->free_func) {
+    for (idx = 0; idx < its->nof_entries; idx++) {
+      if (its->entries[idx].data)
+        its->free_func(its->entries[idx].data);
+    }
+  }
+  gt_free(its->entries);
+  gt_free(its);
+}
+
 static void gt_interval_tree_print_rec(GtIntervalTree *it,
                                        GtIntervalTreeNode *n)
 {
@@ -695,3 +976,131 @@ int gt_interval_tree_unit_test(GT_UNUSED GtError *err)
   gt_interval_tree_delete(it);
   return had_err;
 }
+
+static int itree_static_test_check_order(void *data, GtUword low,
+                                         GT_UNUSED GtUword high,
+                                         void *lastlow)
+{
+  GtRange *rng = data;
+  if (rng->start != low || low < *(GtUword*) lastlow)
+    return -1;
+  *(GtUword*) lastlow = low;
+  return 0;
+}
+
+static int itree_static_test_collect_batch(void *data, GtUword range_index,
+                                           void *batch)
+{
+  gt_array_add(((GtArray**) batch)[range_index], data);
+  return 0;
+}
+
+int gt_interval_tree_static_unit_test(GT_UNUSED GtError *err)
+{
+  GtIntervalTreeStatic *its;
+  GtArray *arr, *res, *ref;
+  GtRange qrange;
+  GtUword i, j, lastlow;
+  int had_err = 0, num_testranges = 3000, num_find_all_samples = 3000,
+      gt_range_max_basepos = 90000, width = 700, query_width = 5000;
+
+  arr = gt_array_new(sizeof (GtRange*));
+  res = gt_array_new(sizeof (GtRange*));
+  ref = gt_array_new(sizeof (GtRange*));
+  its = gt_interval_tree_static_new(gt_free_func);
+  gt_ensure(gt_interval_tree_static_is_built(its));
+
+  /* add the ranges in two batches, so that the second build merges */
+  for (i = 0; i < num_testranges; i++) {
+    GtUword start;
+    GtRange *rng;
+    rng = gt_calloc(1, sizeof (GtRange));
+    start = gt_rand_max(gt_range_max_basepos);
+    rng->start = start;
+    rng->end = start + gt_rand_max(width);
+    gt_array_add(arr, rng);
+    gt_interval_tree_static_add(its, rng, rng->start, rng->end);
+    if (i == num_testranges / 2) {
+      gt_ensure(!gt_interval_tree_static_is_built(its));
+      gt_interval_tree_static_build(its);
+    }
+  }
+  gt_interval_tree_static_build(its);
+  gt_ensure(gt_interval_tree_static_is_built(its));
+  gt_ensure(gt_interval_tree_static_size(its) == num_testranges);
+  lastlow = 0;
+  gt_ensure(gt_interval_tree_static_traverse(its,
+                                             itree_static_test_check_order,
+                                             &lastlow) == 0);
+
+  /* remove a third of the ranges */
+  for (i = 0; !had_err && i < num_testranges / 3; i++) {
+    GtUword idx = gt_rand_max(gt_array_size(arr) - 1);
+    GtRange *rng = *(GtRange**) gt_array_get(arr, idx);
+    gt_array_rem(arr, idx);
+    gt_ensure(gt_interval_tree_static_remove(its, rng, rng->start,
+                                             rng->end));
+  }
+  qrange.start = qrange.end = 0;
+  gt_ensure(!gt_interval_tree_static_remove(its, &qrange, 0, 0));
+  gt_interval_tree_static_build(its);
+  gt_ensure(gt_interval_tree_static_size(its) == gt_array_size(arr));
+
+  /* compare overlap queries with a linear search */
+  for (i = 0; !had_err && i < num_find_all_samples; i++) {
+    qrange.start = gt_rand_max(gt_range_max_basepos);
+    qrange.end = qrange.start + gt_rand_max(query_width);
+    gt_array_reset(res);
+    gt_array_reset(ref);
+    gt_interval_tree_static_find_all_overlapping(its, qrange.start,
+                                                 qrange.end, res);
+    for (j = 0; j < gt_array_size(arr); j++) {
+      GtRange *this_rng = *(GtRange**) gt_array_get(arr, j);
+      if (gt_range_overlap(this_rng, &qrange))
+        gt_array_add(ref, this_rng);
+    }
+    lastlow = 0;
+    for (j = 0; !had_err && j < gt_array_size(res); j++) {
+      GtRange *this_rng = *(GtRange**) gt_array_get(res, j);
+      gt_ensure(this_rng->start >= lastlow);
+      lastlow = this_rng->start;
+    }
+    gt_array_sort_stable(ref, range_ptr_compare);
+    gt_array_sort_stable(res, range_ptr_compare);
+    gt_ensure(gt_array_size(ref) == gt_array_size(res));
+    if (!had_err)
+      gt_ensure(gt_array_cmp(ref, res) == 0);
+  }
+
+  /* compare batched queries with single queries */
+  if (!had_err) {
+    GtRange ranges[100];
+    GtArray *batch[100];
+    for (i = 0; i < 100; i++) {
+      ranges[i].start = gt_rand_max(gt_range_max_basepos);
+      ranges[i].end = ranges[i].start + gt_rand_max(query_width);
+      batch[i] = gt_array_new(sizeof (GtRange*));
+    }
+    qsort(ranges, 100, sizeof (GtRange), (GtCompare) gt_range_compare);
+    gt_ensure(gt_interval_tree_static_iterate_overlapping_ranges(its, ranges,
+                                               100,
+                                               itree_static_test_collect_batch,
+                                               batch) == 0);
+    for (i = 0; !had_err && i < 100; i++) {
+      gt_array_reset(res);
+      gt_interval_tree_static_find_all_overlapping(its, ranges[i].start,
+                                                   ranges[i].end, res);
+      gt_ensure(gt_array_size(res) == gt_array_size(batch[i]));
+      if (!had_err)
+        gt_ensure(gt_array_cmp(res, batch[i]) == 0);
+    }
+    for (i = 0; i < 100; i++)
+      gt_array_delete(batch[i]);
+  }
+
+  gt_interval_tree_static_delete(its);
+  gt_array_delete(ref);
+  gt_array_delete(res);
+  gt_array_delete(arr);
+  return had_err;
+}
@@ -18,8 +18,10 @@
 #ifndef INTERVAL_TREE_API_H
 #define INTERVAL_TREE_API_H
 
+#include <stdbool.h>
 #include "core/array_api.h"
 #include "core/fptr_api.h"
+#include "core/range_api.h"
 
 /* This is an interval tree data structure, implemented according to
    Cormen et al., Introduction to Algorithms, 2nd edition, MIT Press,
@@ -94,4 +96,104 @@ void                gt_interval_tree_remove(GtIntervalTree*,
    <GtFree> function. */
 void                gt_interval_tree_delete(GtIntervalTree*);
 
+/* A <GtIntervalTreeStatic> stores intervals in an array sorted by start
+   position, which is searched as an implicit binary tree whose nodes are
+   augmented with the maximum end position in their subtree. It is meant to be
+   bulk-loaded: intervals are added with <gt_interval_tree_static_add()>, then
+   <gt_interval_tree_static_build()> sorts them before the tree can be queried.
+   Compared to a <GtIntervalTree>, it needs no heap node per interval and a
+   query scans contiguous memory. */
+typedef struct GtIntervalTreeStatic GtIntervalTreeStatic;
+
+/* Callback for the intervals of a <GtIntervalTreeStatic>, <data> is the data
+   pointer of the interval from <low> to <high>. A non-zero return value stops
+   the iteration. */
+typedef int (*GtIntervalTreeStaticIteratorFunc)(void *data, GtUword low,
+                                                GtUword high, void *userdata);
+
+/* Creates a new, empty <GtIntervalTreeStatic>. If a <GtFree> function is
+   given, it is applied to the data pointers of the removed intervals and of
+   all intervals left when the tree is deleted. */
+GtIntervalTreeStatic* gt_interval_tree_static_new(GtFree);
+
+/* Adds the interval from <low> to <high> with <data> attached to <its>. The
+   tree has to be built again before it can be queried. */
+void                  gt_interval_tree_static_add(GtIntervalTreeStatic *its,
+                                                  void *data,
+                                                  GtUword low,
+                                                  GtUword high);
+
+/* Removes the interval from <low> to <high> with <data> attached from <its>,
+   freeing <data> if a <GtFree> function is set. Returns false if there is no
+   such interval. The tree has to be built again before it can be queried. */
+bool                  gt_interval_tree_static_remove(GtIntervalTreeStatic
+                                                     *its,
+                                                     void *data,
+                                                     GtUword low,
+                                                     GtUword high);
+
+/* Builds the search structure of <its> after intervals have been added or
+   removed. Intervals with the same start position keep the order they have
+   been added in. Does nothing if <its> is built already. */
+void                  gt_interval_tree_static_build(GtIntervalTreeStatic *its);
+
+/* Returns true if <its> has been built since the last change. */
+bool                  gt_interval_tree_static_is_built(const
+                                                       GtIntervalTreeStatic
+                                                       *its);
+
+/* Returns the number of intervals in <its>. */
+GtUword               gt_interval_tree_static_size(const GtIntervalTreeStatic
+                                                   *its);
+
+/* Appends the data pointers of all intervals in the built tree <its> which
+   overlap the range from <start> to <end> to <results>, ordered by the start
+   positions of the intervals. */
+void                  gt_interval_tree_static_find_all_overlapping(
+                                                     GtIntervalTreeStatic *its,
+                                                     GtUword start,
+                                                     GtUword end,
+                                                     GtArray *results);
+
+/* Calls <func> for all intervals in the built tree <its> which overlap the
+   range from <start> to <end>, ordered by their start positions. Returns the
+   first non-zero return value of <func>, or 0. */
+int                   gt_interval_tree_static_iterate_overlapping(
+                                           GtIntervalTreeStatic *its,
+                                           GtIntervalTreeStaticIteratorFunc
+                                           func,
+                                           GtUword start,
+                                           GtUword end,
+                                           void *data);
+
+/* Callback for the intervals overlapping the query range with number
+   <range_index>, <data> is the data pointer of the interval. A non-zero
+   return value stops the iteration. */
+typedef int (*GtIntervalTreeStaticRangesFunc)(void *data, GtUword range_index,
+                                              void *userdata);
+
+/* Answers the <nof_ranges> overlap queries <ranges>, which must be sorted by
+   start position, in one sweep over the built tree <its>. For each range in
+   turn, <func> is called for all intervals overlapping it, ordered by their
+   start positions. Returns the first non-zero return value of <func>, or 0. */
+int                   gt_interval_tree_static_iterate_overlapping_ranges(
+                                             GtIntervalTreeStatic *its,
+                                             const GtRange *ranges,
+                                             GtUword nof_ranges,
+                                             GtIntervalTreeStaticRangesFunc
+                                             func,
+                                             void *data);
+
+/* Calls <func> for all intervals in the built tree <its>, ordered by their
+   start positions. Returns the first non-zero return value of <func>, or 0. */
+int                   gt_interval_tree_static_traverse(
+                                           GtIntervalTreeStatic *its,
+                                           GtIntervalTreeStaticIteratorFunc
+                                           func,
+                                           void *data);
+
+/* Deletes <its>. */
+void                  gt_interval_tree_static_delete(GtIntervalTreeStatic
+                                                     *its);
+
 #endif
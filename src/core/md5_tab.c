@@ -15,18 +15,40 @@
   OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
 */
 
+#include <string.h>
+#include <sys/stat.h>
+#include "core/ensure_api.h"
 #include "core/fa_api.h"
 #include "core/fileutils_api.h"
 #include "core/hashmap_api.h"
 #include "core/ma_api.h"
 #include "core/md5_fingerprint_api.h"
 #include "core/md5_tab_api.h"
+#include "core/multithread_api.h"
+#include "core/thread_api.h"
 #include "core/undef_api.h"
 #include "core/xansi_api.h"
 
+#define MD5_TAB_MAGIC         "GTMD5TAB"
+#define MD5_TAB_VERSION       1
+#define MD5_TAB_ENTRY_SIZE    33
+/* number of sequences hashed by a thread before it fetches more work */
+#define MD5_TAB_CHUNK_SIZE    64
+
+/* Header of cache files written by <md5_tab_new()>. Cache files without it
+   (as written by the encoded sequence) consist of the fingerprints only. */
+typedef struct {
+  char     magic[8];
+  GtUint64 version,
+           num_of_seqs,
+           seqfile_size,
+           seqfile_mtime;
+} GtMD5TabHeader;
+
 struct GtMD5Tab{
   FILE *fingerprints_file; /* used to lock the memory mapped fingerprints */
-  char *fingerprints; /* holds memory mapped fingerprints */
+  char *mapped, /* memory mapped cache file */
+       *fingerprints; /* holds memory mapped fingerprints */
   char **md5_fingerprints;
   GtUword num_of_md5s,
                 reference_count;
@@ -34,8 +56,66 @@ struct GtMD5Tab{
   GtHashmap *md5map; /* maps md5 to index */
 };
 
+/* fills <header> for <num_of_seqs> sequences from <sequence_file>, returns
+   false if <sequence_file> cannot be accessed */
+static bool md5_tab_header_init(GtMD5TabHeader *header,
+                                const char *sequence_file,
+                                GtUword num_of_seqs)
+{
+  struct stat sb;
+  memset(header, 0, sizeof *header);
+  memcpy(header->magic, MD5_TAB_MAGIC, sizeof header->magic);
+  header->version = MD5_TAB_VERSION;
+  header->num_of_seqs = (GtUint64) num_of_seqs;
+  if (sequence_file != NULL) {
+    if (stat(sequence_file, &sb) != 0)
+      return false;
+    header->seqfile_size = (GtUint64) sb.st_size;
+    header->seqfile_mtime = (GtUint64) sb.st_mtime;
+  }
+  return true;
+}
+
+/* checks the contents of a mapped cache file of <len> bytes and sets the
+   fingerprints of <md5_tab> if they are valid. <sequence_file> can be NULL, in
+   which case the sequence file stored in the header is not checked. */
+static bool md5_tab_check_mapped(GtMD5Tab *md5_tab, size_t len,
+                                 const char *sequence_file)
+{
+  GtUword i;
+  size_t offset = 0;
+  if (len >= sizeof (GtMD5TabHeader) &&
+      memcmp(md5_tab->mapped, MD5_TAB_MAGIC, sizeof (MD5_TAB_MAGIC) - 1)
+        == 0) {
+    GtMD5TabHeader header, expected;
+    memcpy(&header, md5_tab->mapped, sizeof header);
+    if (!md5_tab_header_init(&expected, sequence_file, md5_tab->num_of_md5s) ||
+        header.version != expected.version ||
+        header.num_of_seqs != expected.num_of_seqs)
+      return false;
+    if (sequence_file != NULL &&
+        (header.seqfile_size != expected.seqfile_size ||
+         header.seqfile_mtime != expected.seqfile_mtime))
+      return false;
+    offset = sizeof header;
+  }
+  if (len - offset != md5_tab->num_of_md5s * MD5_TAB_ENTRY_SIZE)
+    return false;
+  md5_tab->fingerprints = md5_tab->mapped + offset;
+  /* every fingerprint has to be terminated */
+  for (i = 0; i < md5_tab->num_of_md5s; i++) {
+    if (md5_tab->fingerprints[i * MD5_TAB_ENTRY_SIZE + MD5_TAB_ENTRY_SIZE - 1]
+          != '\0') {
+      md5_tab->fingerprints = NULL;
+      return false;
+    }
+  }
+  return true;
+}
+
 static bool read_fingerprints(GtMD5Tab *md5_tab,
                               const char *fingerprints_filename,
+                              const char *sequence_file,
                               bool use_file_locking)
 {
   bool reading_succeeded = true;
@@ -47,10 +127,10 @@ static bool read_fingerprints(GtMD5Tab *md5_tab,
     md5_tab->fingerprints_file = gt_fa_xfopen(fingerprints_filename, "r");
     gt_fa_lock_shared(md5_tab->fingerprints_file);
   }
-  md5_tab->fingerprints = gt_fa_xmmap_read(fingerprints_filename, &len);
-  if (len != md5_tab->num_of_md5s * 33) {
-    gt_fa_xmunmap(md5_tab->fingerprints);
-    md5_tab->fingerprints = NULL;
+  md5_tab->mapped = gt_fa_xmmap_read(fingerprints_filename, &len);
+  if (!md5_tab_check_mapped(md5_tab, len, sequence_file)) {
+    gt_fa_xmunmap(md5_tab->mapped);
+    md5_tab->mapped = NULL;
     gt_fa_unlock(md5_tab->fingerprints_file);
     gt_fa_xfclose(md5_tab->fingerprints_file);
     md5_tab->fingerprints_file = NULL;
@@ -59,16 +139,63 @@ static bool read_fingerprints(GtMD5Tab *md5_tab,
   return reading_succeeded;
 }
 
+typedef struct {
+  char **md5_fingerprints;
+  void *seqs;
+  GtGetSeqFunc get_seq;
+  GtGetSeqLenFunc get_seq_len;
+  GtUword num_of_seqs,
+          next;
+  GtMutex *mutex;
+} GtMD5TabThreadInfo;
+
+static void* add_fingerprints_thread(void *data)
+{
+  GtMD5TabThreadInfo *info = data;
+  GtUword i, start, end;
+  gt_assert(info);
+  while (true) {
+    gt_mutex_lock(info->mutex);
+    start = info->next;
+    end = start + MD5_TAB_CHUNK_SIZE < info->num_of_seqs
+            ? start + MD5_TAB_CHUNK_SIZE
+            : info->num_of_seqs;
+    info->next = end;
+    gt_mutex_unlock(info->mutex);
+    if (start == end)
+      break;
+    for (i = start; i < end; i++) {
+      info->md5_fingerprints[i] =
+        gt_md5_fingerprint(info->get_seq(info->seqs, i),
+                           info->get_seq_len(info->seqs, i));
+    }
+  }
+  return NULL;
+}
+
+/* computes the fingerprints with <gt_jobs> threads, if <parallel> is true */
 static void add_fingerprints(char **md5_fingerprints, void *seqs,
                              GtGetSeqFunc get_seq, GtGetSeqLenFunc get_seq_len,
-                             GtUword num_of_seqs)
+                             GtUword num_of_seqs, bool parallel)
 {
-  GtUword i;
+  GtMD5TabThreadInfo info;
+  GtError *err;
   gt_assert(md5_fingerprints && seqs && get_seq && get_seq_len);
-  for (i = 0; i < num_of_seqs; i++) {
-    md5_fingerprints[i] = gt_md5_fingerprint(get_seq(seqs, i),
-                                             get_seq_len(seqs, i));
+  info.md5_fingerprints = md5_fingerprints;
+  info.seqs = seqs;
+  info.get_seq = get_seq;
+  info.get_seq_len = get_seq_len;
+  info.num_of_seqs = num_of_seqs;
+  info.next = 0;
+  info.mutex = gt_mutex_new();
+  err = gt_error_new();
+  if (!parallel || gt_jobs <= 1U || num_of_seqs <= MD5_TAB_CHUNK_SIZE ||
+      gt_multithread(add_fingerprints_thread, &info, err) != 0) {
+    /* hash the remaining sequences if no threads could be started */
+    (void) add_fingerprints_thread(&info);
   }
+  gt_error_delete(err);
+  gt_mutex_delete(info.mutex);
 }
 
 static void dump_md5_fingerprints(char **md5_fingerprints,
@@ -85,23 +212,28 @@ static void dump_md5_fingerprints(char **md5_fingerprints,
 static void write_fingerprints(char **md5_fingerprints,
                                GtUword num_of_md5s,
                                GtStr *fingerprints_filename,
+                               const char *sequence_file,
                                bool use_file_locking)
 {
   FILE *fingerprints_file;
+  GtMD5TabHeader header;
   gt_assert(md5_fingerprints && num_of_md5s && fingerprints_filename);
+  if (!md5_tab_header_init(&header, sequence_file, num_of_md5s))
+    return;
   fingerprints_file = gt_fa_xfopen(gt_str_get(fingerprints_filename), "w");
   if (use_file_locking)
     gt_fa_lock_exclusive(fingerprints_file);
+  gt_xfwrite(&header, sizeof header, 1, fingerprints_file);
   dump_md5_fingerprints(md5_fingerprints, num_of_md5s, fingerprints_file);
   if (use_file_locking)
     gt_fa_unlock(fingerprints_file);
   gt_fa_xfclose(fingerprints_file);
 }
 
-GtMD5Tab* gt_md5_tab_new(const char *sequence_file, void *seqs,
-                         GtGetSeqFunc get_seq, GtGetSeqLenFunc get_seq_len,
-                         GtUword num_of_seqs, bool use_cache_file,
-                         bool use_file_locking)
+static GtMD5Tab* md5_tab_new(const char *sequence_file, void *seqs,
+                             GtGetSeqFunc get_seq, GtGetSeqLenFunc get_seq_len,
+                             GtUword num_of_seqs, bool use_cache_file,
+                             bool use_file_locking, bool parallel)
 {
   GtMD5Tab *md5_tab;
   bool reading_succeeded = false;
@@ -117,22 +249,43 @@ GtMD5Tab* gt_md5_tab_new(const char *sequence_file, void *seqs,
        modified in the meantime */
     reading_succeeded = read_fingerprints(md5_tab,
                                           gt_str_get(fingerprints_filename),
+                                          sequence_file,
                                           use_file_locking);
   }
   if (!reading_succeeded) {
     md5_tab->md5_fingerprints = gt_calloc(num_of_seqs, sizeof (char*));
     add_fingerprints(md5_tab->md5_fingerprints, seqs, get_seq, get_seq_len,
-                     num_of_seqs);
+                     num_of_seqs, parallel);
     md5_tab->owns_md5s = true;
-    if (use_cache_file) {
+    if (use_cache_file && num_of_seqs > 0) {
       write_fingerprints(md5_tab->md5_fingerprints, md5_tab->num_of_md5s,
-                         fingerprints_filename, use_file_locking);
+                         fingerprints_filename, sequence_file,
+                         use_file_locking);
     }
   }
   gt_str_delete(fingerprints_filename);
   return md5_tab;
 }
 
+GtMD5Tab* gt_md5_tab_new(const char *sequence_file, void *seqs,
+                         GtGetSeqFunc get_seq, GtGetSeqLenFunc get_seq_len,
+                         GtUword num_of_seqs, bool use_cache_file,
+                         bool use_file_locking)
+{
+  return md5_tab_new(sequence_file, seqs, get_seq, get_seq_len, num_of_seqs,
+                     use_cache_file, use_file_locking, false);
+}
+
+GtMD5Tab* gt_md5_tab_new_parallel(const char *sequence_file, void *seqs,
+                                  GtGetSeqFunc get_seq,
+                                  GtGetSeqLenFunc get_seq_len,
+                                  GtUword num_of_seqs, bool use_cache_file,
+                                  bool use_file_locking)
+{
+  return md5_tab_new(sequence_file, seqs, get_seq, get_seq_len, num_of_seqs,
+                     use_cache_file, use_file_locking, true);
+}
+
 GtMD5Tab* gt_md5_tab_new_from_cache_file(const char *cache_file,
                                          GtUword num_of_seqs,
                                          bool use_file_locking,
@@ -148,6 +301,7 @@ GtMD5Tab* gt_md5_tab_new_from_cache_file(const char *cache_file,
   if (gt_file_exists(cache_file)) {
     reading_succeeded = read_fingerprints(md5_tab,
                                           cache_file,
+                                          NULL,
                                           use_file_locking);
   }
   if (!reading_succeeded) {
@@ -175,7 +329,7 @@ void gt_md5_tab_delete(GtMD5Tab *md5_tab)
     md5_tab->reference_count--;
     return;
   }
-  gt_fa_xmunmap(md5_tab->fingerprints);
+  gt_fa_xmunmap(md5_tab->mapped);
   gt_fa_unlock(md5_tab->fingerprints_file);
   gt_fa_xfclose(md5_tab->fingerprints_file);
   gt_hashmap_delete(md5_tab->md5map);
@@ -192,7 +346,7 @@ const char* gt_md5_tab_get(const GtMD5Tab *md5_tab, GtUword idx)
   gt_assert(md5_tab && idx < md5_tab->num_of_md5s);
   if (md5_tab->owns_md5s)
     return md5_tab->md5_fingerprints[idx];
- return md5_tab->fingerprints + idx * 33;
+ return md5_tab->fingerprints + idx * MD5_TAB_ENTRY_SIZE;
 }
 
 static void build_md5map(GtMD5Tab *md5_tab)
@@ -224,3 +378,134 @@ GtUword gt_md5_tab_size(const GtMD5Tab *md5_tab)
   gt_assert(md5_tab);
   return md5_tab->num_of_md5s;
 }
+
+static const char* md5_tab_unit_test_get_seq(void *seqs, GtUword idx)
+{
+  return ((char**) seqs)[idx];
+}
+
+static GtUword md5_tab_unit_test_get_seq_len(void *seqs, GtUword idx)
+{
+  return (GtUword) strlen(((char**) seqs)[idx]);
+}
+
+int gt_md5_tab_unit_test(GtError *err)
+{
+  int had_err = 0;
+  const GtUword num_of_seqs = 3 * MD5_TAB_CHUNK_SIZE + 1;
+  char **seqs, *md5;
+  GtStr *seqfile = gt_str_new(),
+        *cachefile;
+  GtMD5Tab *md5_tab;
+  FILE *fp;
+  GtUword i;
+  gt_error_check(err);
+
+  seqs = gt_malloc(sizeof (char*) * num_of_seqs);
+  fp = gt_xtmpfp(seqfile);
+  for (i = 0; i < num_of_seqs; i++) {
+    seqs[i] = gt_malloc(sizeof (char) * (i + 2));
+    memset(seqs[i], "acgt"[i % 4], (size_t) (i + 1));
+    seqs[i][i + 1] = '\0';
+    gt_xfputs(seqs[i], fp);
+  }
+  gt_fa_xfclose(fp);
+  cachefile = gt_str_clone(seqfile);
+  gt_str_append_cstr(cachefile, GT_MD5_TAB_FILE_SUFFIX);
+
+  /* computed and written to the cache file */
+  md5_tab = gt_md5_tab_new(gt_str_get(seqfile), seqs,
+                           md5_tab_unit_test_get_seq,
+                           md5_tab_unit_test_get_seq_len, num_of_seqs,
+                           true, false);
+  gt_ensure(md5_tab->owns_md5s);
+  for (i = 0; !had_err && i < num_of_seqs; i++) {
+    md5 = gt_md5_fingerprint(seqs[i], (GtUword) strlen(seqs[i]));
+    gt_ensure(strcmp(gt_md5_tab_get(md5_tab, i), md5) == 0);
+    gt_free(md5);
+  }
+  gt_ensure(gt_md5_tab_map(md5_tab, gt_md5_tab_get(md5_tab, 7)) == 7);
+  gt_md5_tab_delete(md5_tab);
+
+  /* read from the cache file */
+  if (!had_err) {
+    md5_tab = gt_md5_tab_new(gt_str_get(seqfile), seqs,
+                             md5_tab_unit_test_get_seq,
+                             md5_tab_unit_test_get_seq_len, num_of_seqs,
+                             true, false);
+    gt_ensure(!md5_tab->owns_md5s);
+    for (i = 0; !had_err && i < num_of_seqs; i++) {
+      md5 = gt_md5_fingerprint(seqs[i], (GtUword) strlen(seqs[i]));
+      gt_ensure(strcmp(gt_md5_tab_get(md5_tab, i), md5) == 0);
+      gt_free(md5);
+    }
+    gt_md5_tab_delete(md5_tab);
+  }
+
+  /* computed with gt_jobs threads, without cache file */
+  if (!had_err) {
+    md5_tab = gt_md5_tab_new_parallel(gt_str_get(seqfile), seqs,
+                                      md5_tab_unit_test_get_seq,
+                                      md5_tab_unit_test_get_seq_len,
+                                      num_of_seqs, false, false);
+    gt_ensure(md5_tab->owns_md5s);
+    for (i = 0; !had_err && i < num_of_seqs; i++) {
+      md5 = gt_md5_fingerprint(seqs[i], (GtUword) strlen(seqs[i]));
+      gt_ensure(strcmp(gt_md5_tab_get(md5_tab, i), md5) == 0);
+      gt_free(md5);
+    }
+    gt_md5_tab_delete(md5_tab);
+  }
+
+  /* a cache file for a different number of sequences is not used */
+  if (!had_err) {
+    md5_tab = gt_md5_tab_new(gt_str_get(seqfile), seqs,
+                             md5_tab_unit_test_get_seq,
+                             md5_tab_unit_test_get_seq_len, num_of_seqs - 1,
+                             true, false);
+    gt_ensure(md5_tab->owns_md5s);
+    gt_md5_tab_delete(md5_tab);
+  }
+  if (!had_err) {
+    md5_tab = gt_md5_tab_new_from_cache_file(gt_str_get(cachefile),
+                                             num_of_seqs, false, err);
+    gt_ensure(md5_tab == NULL && gt_error_is_set(err));
+    gt_error_unset(err);
+  }
+  if (!had_err) {
+    md5_tab = gt_md5_tab_new_from_cache_file(gt_str_get(cachefile),
+                                             num_of_seqs - 1, false, err);
+    gt_ensure(md5_tab != NULL);
+    gt_md5_tab_delete(md5_tab);
+  }
+
+  /* cache files without header, as written for encoded sequences */
+  if (!had_err) {
+    fp = gt_fa_xfopen(gt_str_get(cachefile), "w");
+    for (i = 0; i < num_of_seqs; i++) {
+      md5 = gt_md5_fingerprint(seqs[i], (GtUword) strlen(seqs[i]));
+      gt_xfwrite(md5, sizeof (char), MD5_TAB_ENTRY_SIZE, fp);
+      gt_free(md5);
+    }
+    gt_fa_xfclose(fp);
+    md5_tab = gt_md5_tab_new_from_cache_file(gt_str_get(cachefile),
+                                             num_of_seqs, false, err);
+    gt_ensure(md5_tab != NULL);
+    if (!had_err) {
+      md5 = gt_md5_fingerprint(seqs[3], (GtUword) strlen(seqs[3]));
+      gt_ensure(strcmp(gt_md5_tab_get(md5_tab, 3), md5) == 0);
+      gt_free(md5);
+    }
+    gt_md5_tab_delete(md5_tab);
+  }
+
+  if (gt_file_exists(gt_str_get(cachefile)))
+    gt_xremove(gt_str_get(cachefile));
+  gt_xremove(gt_str_get(seqfile));
+  for (i = 0; i < num_of_seqs; i++)
+    gt_free(seqs[i]);
+  gt_free(seqs);
+  gt_str_delete(cachefile);
+  gt_str_delete(seqfile);
+  return had_err;
+}
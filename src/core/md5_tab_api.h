@@ -34,16 +34,26 @@ typedef GtUword     (*GtGetSeqLenFunc)(void *seqs, GtUword index);
 
 /* Create a new MD5 table object for sequences contained in <sequence_file>.
    The sequences have to be stored in <seqs> (<num_of_seqs> many) and have to be
-   accessible via the functions <get_seq> and <get_seq_len>. If <use_cache_file>
-   is <true>, the MD5 sums are read from a cache file (named
-   "<sequence_file><GT_MD5TAB_FILE_SUFFIX>"), if it exists or written to it, if
-   it doesn't exist. If <use_cache_file> is <false>, no cache file is read or
-   written. If <use_file_locking> is <true>, file locking is used to access the
-   cache file (recommended). */
+   accessible via the functions <get_seq> and <get_seq_len>. If
+   <use_cache_file> is <true>, the MD5 sums are read
+   from a cache file (named "<sequence_file><GT_MD5TAB_FILE_SUFFIX>"), if it
+   exists and its header matches <num_of_seqs> and the size and modification
+   time of <sequence_file>. Otherwise they are computed and written to it. If
+   <use_cache_file> is <false>, no cache file is read or written. If
+   <use_file_locking> is <true>, file locking is used to access the cache file
+   (recommended). */
 GtMD5Tab*     gt_md5_tab_new(const char *sequence_file, void *seqs,
                              GtGetSeqFunc get_seq, GtGetSeqLenFunc get_seq_len,
                              GtUword num_of_seqs, bool use_cache_file,
                              bool use_file_locking);
+/* Like <gt_md5_tab_new()>, but the MD5 sums are computed by <gt_jobs>
+   threads. Hence <get_seq> and <get_seq_len> must be safe to call
+   concurrently. */
+GtMD5Tab*     gt_md5_tab_new_parallel(const char *sequence_file, void *seqs,
+                                      GtGetSeqFunc get_seq,
+                                      GtGetSeqLenFunc get_seq_len,
+                                      GtUword num_of_seqs, bool use_cache_file,
+                                      bool use_file_locking);
 /* Create a new MD5 table object for sequences directly from a <cache_file>,
    containing MD5 sums for <num_of_seqs> many sequences. If <use_file_locking>
    is <true>, file locking is used to access the cache file (recommended).
@@ -67,4 +77,6 @@ GtUword       gt_md5_tab_size(const GtMD5Tab *md5_tab);
 /* Decrement reference count for or delete <md5_tab>. */
 void          gt_md5_tab_delete(GtMD5Tab *md5_tab);
 
+int           gt_md5_tab_unit_test(GtError *err);
+
 #endif
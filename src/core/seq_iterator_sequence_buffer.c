@@ -16,6 +16,7 @@
   OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
 */
 
+#include <string.h>
 #include "core/arraydef_api.h"
 #include "core/chardef_api.h"
 #include "core/class_alloc_lock.h"
@@ -33,6 +34,9 @@ struct GtSeqIteratorSequenceBuffer
   const GtUchar *symbolmap;
   GtDescBuffer *descptr;
   GtArrayGtUchar sequencebuffer;
+  const GtUchar *block;
+  GtUword blocklength,
+          blockpos;
   GtUint64 unitnum;
   bool withsequence, exhausted;
   GtUint64 currentread,
@@ -68,6 +72,8 @@ GtSeqIterator* gt_seq_iterator_sequence_buffer_new_with_buffer(
   seqit->descptr = gt_desc_buffer_new();
   seqit->fb = gt_sequence_buffer_ref(buffer);
   gt_sequence_buffer_set_desc_buffer(seqit->fb, seqit->descptr);
+  seqit->block = NULL;
+  seqit->blocklength = seqit->blockpos = 0;
   seqit->exhausted = false;
   seqit->unitnum = 0;
   seqit->withsequence = true;
@@ -103,7 +109,6 @@ static int gt_seq_iterator_sequence_buffer_next(GtSeqIterator *si,
                                                GtError *err)
 {
   GtSeqIteratorSequenceBuffer *seqit;
-  GtUchar charcode;
   int retval;
   bool haserr = false, foundseq = false;
   gt_assert(si);
@@ -118,23 +123,54 @@ static int gt_seq_iterator_sequence_buffer_next(GtSeqIterator *si,
   }
   while (true)
   {
-    retval = gt_sequence_buffer_next(seqit->fb,&charcode,err);
-    if (retval < 0)
+    const GtUchar *run, *separator;
+    GtUword runlength;
+
+    if (seqit->blockpos == seqit->blocklength)
     {
-      haserr = true;
-      break;
+      retval = gt_sequence_buffer_next_block(seqit->fb, &seqit->block, NULL,
+                                             &seqit->blocklength, err);
+      if (retval < 0)
+      {
+        haserr = true;
+        break;
+      }
+      if (retval == 0)
+      {
+        seqit->exhausted = true;
+        break;
+      }
+      seqit->blockpos = 0;
     }
-    if (retval == 0)
+    /* process the characters up to the next separator in one go */
+    run = seqit->block + seqit->blockpos;
+    separator = memchr(run, GT_SEPARATOR, seqit->blocklength - seqit->blockpos);
+    runlength = separator == NULL ? seqit->blocklength - seqit->blockpos
+                                  : (GtUword) (separator - run);
+    seqit->blockpos += runlength;
+    if (seqit->currentread < seqit->maxread)
     {
-      seqit->exhausted = true;
-      break;
+      seqit->currentread = GT_MIN(seqit->maxread,
+                                  seqit->currentread + runlength
+                                    + (separator == NULL ? 0 : 1));
     }
-    if (seqit->currentread < seqit->maxread)
+    if (seqit->withsequence)
     {
-      seqit->currentread++;
+      /* reserve one more cell for the terminating '\0' */
+      GT_CHECKARRAYSPACE_GENERIC(&seqit->sequencebuffer, GtUchar,
+                                 runlength,
+                                 GT_MAX(runlength + 1,
+                                        GT_MAX(1024UL,
+                                               seqit->sequencebuffer.
+                                               nextfreeGtUchar * 0.5)));
+      memcpy(seqit->sequencebuffer.spaceGtUchar
+               + seqit->sequencebuffer.nextfreeGtUchar, run,
+             (size_t) runlength);
     }
-    if (charcode == (GtUchar) GT_SEPARATOR)
+    seqit->sequencebuffer.nextfreeGtUchar += runlength;
+    if (separator != NULL)
     {
+      seqit->blockpos++;
       if (seqit->sequencebuffer.nextfreeGtUchar == 0 && seqit->withsequence)
       {
         gt_error_set(err,"sequence "GT_LLU" is empty", seqit->unitnum);
@@ -155,15 +191,6 @@ static int gt_seq_iterator_sequence_buffer_next(GtSeqIterator *si,
       seqit->unitnum++;
       break;
     }
-    if (seqit->withsequence)
-    {
-      GT_STOREINARRAY(&seqit->sequencebuffer, GtUchar,
-                   GT_MAX(1024UL, seqit->sequencebuffer.nextfreeGtUchar * 0.5),
-                   charcode);
-    } else
-    {
-      seqit->sequencebuffer.nextfreeGtUchar++;
-    }
   }
   if (!haserr && seqit->sequencebuffer.nextfreeGtUchar > 0)
   {
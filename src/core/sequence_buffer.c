@@ -15,6 +15,7 @@
   OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
 */
 
+#include <ctype.h>
 #include <string.h>
 #include "core/ensure_api.h"
 #include "core/fa_api.h"
@@ -108,6 +109,13 @@ GtUword gt_sequence_buffer_get_file_index(GtSequenceBuffer *si)
   return si->c_class->get_file_index(si);
 }
 
+bool gt_sequence_buffer_has_class(const GtSequenceBuffer *sb,
+                                  const GtSequenceBufferClass *sbc)
+{
+  gt_assert(sb && sbc);
+  return sb->c_class == sbc;
+}
+
 void* gt_sequence_buffer_cast(GT_UNUSED const GtSequenceBufferClass *sic,
                               GtSequenceBuffer *si)
 {
@@ -117,8 +125,18 @@ void* gt_sequence_buffer_cast(GT_UNUSED const GtSequenceBufferClass *sic,
 
 void gt_sequence_buffer_set_symbolmap(GtSequenceBuffer *si, const GtUchar *m)
 {
+  unsigned int cc;
   gt_assert(si && si->pvt);
   si->pvt->symbolmap = m;
+  if (m != NULL) {
+    /* like <m>, but whitespace and FASTA separators end runs of sequence
+       characters processed by process_chars() */
+    for (cc = 0; cc <= UCHAR_MAX; cc++) {
+      si->pvt->runmap[cc] = (isspace((int) cc) || cc == (unsigned int) '>')
+                            ? (GtUchar) GT_UNDEFCHAR
+                            : m[cc];
+    }
+  }
 }
 
 void gt_sequence_buffer_set_desc_buffer(GtSequenceBuffer *si, GtDescBuffer *db)
@@ -154,8 +172,9 @@ int gt_sequence_buffer_advance(GtSequenceBuffer *sb, GtError *err)
   return sb->c_class->advance(sb, err);
 }
 
-int gt_sequence_buffer_next(GtSequenceBuffer *sb, GtUchar *val,
-                            GtError *err)
+/* Make sure that unread characters are buffered. Returns 1 if this is the
+   case, 0 if all files are exhausted, or -1 on error. */
+static int sequence_buffer_fill(GtSequenceBuffer *sb, GtError *err)
 {
   GtSequenceBufferMembers *pvt;
   pvt = sb->pvt;
@@ -177,38 +196,49 @@ int gt_sequence_buffer_next(GtSequenceBuffer *sb, GtUchar *val,
       return 0;
     }
   }
-  *val = pvt->outbuf[pvt->nextread++];
   return 1;
 }
 
+int gt_sequence_buffer_next(GtSequenceBuffer *sb, GtUchar *val,
+                            GtError *err)
+{
+  int retval;
+  if ((retval = sequence_buffer_fill(sb, err)) == 1)
+    *val = sb->pvt->outbuf[sb->pvt->nextread++];
+  return retval;
+}
+
 int gt_sequence_buffer_next_with_original(GtSequenceBuffer *sb,
                                           GtUchar *val, char *orig,
                                           GtError *err)
 {
   GtSequenceBufferMembers *pvt;
-  pvt = sb->pvt;
-  if (pvt->nextread >= pvt->nextfree)
-  {
-    if (pvt->complete)
-    {
-      return 0;
-    }
-    if (pvt->descptr && pvt->nextread > 0)
-      gt_desc_buffer_reset(pvt->descptr);
-    if (gt_sequence_buffer_advance(sb, err) != 0)
-    {
-      return -1;
-    }
-    pvt->nextread = 0;
-    if (pvt->nextfree == 0)
-    {
-      return 0;
-    }
+  int retval;
+  if ((retval = sequence_buffer_fill(sb, err)) == 1) {
+    pvt = sb->pvt;
+    *val = pvt->outbuf[pvt->nextread];
+    *orig = pvt->outbuforig[pvt->nextread];
+    pvt->nextread++;
   }
-  *val = pvt->outbuf[pvt->nextread];
-  *orig = pvt->outbuforig[pvt->nextread];
-  pvt->nextread++;
-  return 1;
+  return retval;
+}
+
+int gt_sequence_buffer_next_block(GtSequenceBuffer *sb, const GtUchar **block,
+                                  const char **orig, GtUword *length,
+                                  GtError *err)
+{
+  GtSequenceBufferMembers *pvt;
+  int retval;
+  gt_assert(block && length);
+  if ((retval = sequence_buffer_fill(sb, err)) == 1) {
+    pvt = sb->pvt;
+    *block = pvt->outbuf + pvt->nextread;
+    if (orig != NULL)
+      *orig = (const char*) pvt->outbuforig + pvt->nextread;
+    *length = pvt->nextfree - pvt->nextread;
+    pvt->nextread = pvt->nextfree;
+  }
+  return retval;
 }
 
 int gt_sequence_buffer_unit_test(GtError *err)
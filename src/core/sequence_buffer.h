@@ -44,6 +44,12 @@ GtSequenceBuffer*  gt_sequence_buffer_ref(GtSequenceBuffer*);
 GtSequenceBuffer*  gt_sequence_buffer_new_guess_type(const GtStrArray*,
                                                      GtError*);
 
+/* Returns true if <GtSequenceBuffer> is an instance of the class <sbc>, i.e.
+   reads the input format implemented by <sbc>. */
+bool               gt_sequence_buffer_has_class(const GtSequenceBuffer*,
+                                                const GtSequenceBufferClass
+                                                                         *sbc);
+
 /* Fetches next character from <GtSequenceBuffer>.
    Returns 1 if a new character could be read, 0 if all files are exhausted, or
    -1 on error (see the <GtError> object for details). */
@@ -58,6 +64,22 @@ int           gt_sequence_buffer_next_with_original(GtSequenceBuffer*,
                                                     GtUchar *val, char *orig,
                                                     GtError*);
 
+/* Fetches all characters buffered in <GtSequenceBuffer> which have not been
+   read yet, reading more input if necessary. <*block> is set to the first of
+   the <*length> characters (with GT_SEPARATOR symbols in between sequences)
+   and, if <orig> is not NULL, <*orig> to the corresponding original
+   characters, which are undefined at the positions of separators. The block
+   remains valid until the next call to one of the gt_sequence_buffer_next*()
+   functions. Reading blocks avoids the per-character overhead of
+   gt_sequence_buffer_next() and can be mixed with it.
+   Returns 1 if a nonempty block could be read, 0 if all files are exhausted,
+   or -1 on error (see the <GtError> object for details). */
+int           gt_sequence_buffer_next_block(GtSequenceBuffer*,
+                                            const GtUchar **block,
+                                            const char **orig,
+                                            GtUword *length,
+                                            GtError*);
+
 /* Returns the index of the currently read sequence file in the input file
    <GtStrArray>. */
 GtUword       gt_sequence_buffer_get_file_index(GtSequenceBuffer*);
@@ -18,6 +18,7 @@
 
 #include <ctype.h>
 #include "core/cstr_api.h"
+#include "core/minmax_api.h"
 #include "core/sequence_buffer_fasta.h"
 #include "core/sequence_buffer_rep.h"
 #include "core/sequence_buffer_inline.h"
@@ -82,6 +83,24 @@ static int gt_sequence_buffer_fasta_advance(GtSequenceBuffer *sb, GtError *err)
       pvt->currentfillpos = 0;
     } else
     {
+      if (!sbf->indesc && !pvt->use_ungetchar
+            && pvt->currentinpos < pvt->currentfillpos)
+      {
+        /* process the sequence characters up to the next line break (or
+           other special input character) in one go */
+        GtUword processed
+          = process_chars(sb, currentoutpos, pvt->inbuf + pvt->currentinpos,
+                          GT_MIN(pvt->currentfillpos - pvt->currentinpos,
+                                 (GtUword) OUTBUFSIZE - currentoutpos));
+        if (processed > 0)
+        {
+          pvt->currentinpos += processed;
+          currentoutpos += processed;
+          currentfileadd += processed;
+          currentfileread += processed;
+          continue;
+        }
+      }
       currentchar = inlinebuf_getchar(sb, pvt->inputstream);
       if (currentchar == EOF)
       {
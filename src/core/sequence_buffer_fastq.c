@@ -134,17 +134,26 @@ static int gt_sequence_buffer_fastq_advance(GtSequenceBuffer *sb, GtError *err)
       break;
     }
 
-    /* copy sequence */
-    for (cnt=0;cnt<seqlen;cnt++) {
-      if (currentoutpos >= (GtUword) OUTBUFSIZE) {
-        gt_str_append_char(sbfq->overflowbuffer, seq[cnt]);
-      } else {
+    /* copy sequence, in runs as long as possible */
+    cnt = 0;
+    while (cnt < seqlen && currentoutpos < (GtUword) OUTBUFSIZE) {
+      GtUword processed = process_chars(sb, currentoutpos, seq + cnt,
+                                        GT_MIN(seqlen - cnt,
+                                               (GtUword) OUTBUFSIZE
+                                                 - currentoutpos));
+      if (processed == 0) {
         if ((had_err = process_char(sb, currentoutpos, seq[cnt], err)))
           return had_err;
-        currentoutpos++;
-        currentfileadd++;
-        currentfileread++;
+        processed = 1UL;
       }
+      cnt += processed;
+      currentoutpos += processed;
+      currentfileadd += processed;
+      currentfileread += processed;
+    }
+    if (cnt < seqlen) {
+      gt_str_append_cstr_nt(sbfq->overflowbuffer, (const char*) seq + cnt,
+                            seqlen - cnt);
     }
 
     /* place separator after sequence (or defer) */
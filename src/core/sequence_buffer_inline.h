@@ -19,6 +19,7 @@
 #ifndef SEQUENCE_BUFFER_INLINE_H
 #define SEQUENCE_BUFFER_INLINE_H
 
+#include <string.h>
 #include "core/compat_api.h"
 #include "core/file_api.h"
 #include "core/sequence_buffer_rep.h"
@@ -57,6 +58,41 @@
   return 0;
 }
 
+/* Processes the characters <cc>[0..<len>-1] like process_char() does, but
+   stops at the first character which is whitespace, a FASTA separator or not
+   in the symbol map. These are left for process_char() and the caller. Returns
+   the number of processed characters, which is always 0 if no symbol map is
+   set. */
+/*@unused@*/ static inline GtUword process_chars(GtSequenceBuffer *sb,
+                                                GtUword currentoutpos,
+                                                const unsigned char *cc,
+                                                GtUword len)
+{
+  GtSequenceBufferMembers *pvt;
+  GtUchar *outptr;
+  GtUword idx;
+  pvt = sb->pvt;
+  if (pvt->symbolmap == NULL)
+    return 0;
+  outptr = pvt->outbuf + currentoutpos;
+  for (idx = 0; idx < len; idx++) {
+    unsigned char charcode = pvt->runmap[cc[idx]];
+    if (charcode == GT_UNDEFCHAR)
+      break;
+    if (GT_ISSPECIAL((GtUchar) charcode)) {
+      pvt->lastspeciallength++;
+    } else {
+      pvt->lastspeciallength = 0;
+      if (pvt->chardisttab != NULL)
+        pvt->chardisttab[(int) charcode]++;
+    }
+    outptr[idx] = charcode;
+  }
+  memcpy(pvt->outbuforig + currentoutpos, cc, (size_t) idx);
+  pvt->counter += idx;
+  return idx;
+}
+
 /*@unused@*/ static inline int inlinebuf_getchar(GtSequenceBuffer *sb,
                                                  GtFile *f)
 {
@@ -18,6 +18,7 @@
 #ifndef SEQUENCE_BUFFER_REP_H
 #define SEQUENCE_BUFFER_REP_H
 
+#include <limits.h>
 #include <stdio.h>
 #include "core/arraydef_api.h"
 #include "core/error_api.h"
@@ -63,7 +64,8 @@ struct GtSequenceBufferMembers {
   unsigned char ungetchar,
                 inbuf[INBUFSIZE],
                 outbuf[OUTBUFSIZE],
-                outbuforig[OUTBUFSIZE];
+                outbuforig[OUTBUFSIZE],
+                runmap[UCHAR_MAX+1];
   const unsigned char *symbolmap;
 };
 
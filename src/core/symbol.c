@@ -15,42 +15,162 @@
   OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
 */
 
+#include <limits.h>
 #include <string.h>
-#include "core/cstr_table.h"
+#include "core/cstr_api.h"
+#include "core/hashtable.h"
+#include "core/ma_api.h"
 #include "core/mathsupport_api.h"
 #include "core/multithread_api.h"
+#include "core/str_api.h"
 #include "core/symbol.h"
+#include "core/thread_api.h"
 #include "core/unused_api.h"
 
-static GtCstrTable *symbols = NULL;
-static GtMutex *symbol_mutex = NULL;
+/* The symbols are stored by number in chunks which are never moved: chunk <k>
+   holds SYMBOL_FIRST_CHUNK_SIZE * 2^k symbols. A symbol is stored before its
+   number is handed out, so <gt_symbol_get()> does not need to lock. The hash
+   table mapping symbols to their numbers is guarded by a read/write lock, such
+   that lookups of existing symbols do not block each other. */
+#define SYMBOL_FIRST_CHUNK_SIZE 64
+#define SYMBOL_MAX_CHUNKS       (sizeof (GtUword) * CHAR_BIT)
+
+static char **symbol_chunks[SYMBOL_MAX_CHUNKS];
+static GtUword num_of_symbols = 0,
+               *symbol_slots = NULL, /* symbol number plus one, 0 if empty */
+               symbol_slots_mask = 0;
+static GtRWLock *symbol_lock = NULL;
 
 void gt_symbol_init(void)
 {
-  if (!symbols)
-    symbols = gt_cstr_table_new();
-  if (!symbol_mutex)
-    symbol_mutex = gt_mutex_new();
+  if (!symbol_slots) {
+    symbol_slots_mask = 2 * SYMBOL_FIRST_CHUNK_SIZE - 1;
+    symbol_slots = gt_calloc(symbol_slots_mask + 1, sizeof *symbol_slots);
+  }
+  if (!symbol_lock)
+    symbol_lock = gt_rwlock_new();
+}
+
+static char** symbol_storage(GtUword number)
+{
+  unsigned int chunk = gt_determinebitspervalue(number /
+                                                SYMBOL_FIRST_CHUNK_SIZE + 1)
+                       - 1;
+  gt_assert(chunk < SYMBOL_MAX_CHUNKS && symbol_chunks[chunk]);
+  return symbol_chunks[chunk] +
+         (number - SYMBOL_FIRST_CHUNK_SIZE * (((GtUword) 1 << chunk) - 1));
+}
+
+static uint32_t symbol_hash(const char *cstr)
+{
+  return gt_ht_cstr_elem_hash(&cstr);
+}
+
+/* returns the slot of <cstr>, which is empty if there is no such symbol. Must
+   be called with <symbol_lock> held. */
+static GtUword symbol_slot(const char *cstr, uint32_t hash)
+{
+  GtUword slot = hash & symbol_slots_mask;
+  while (symbol_slots[slot] &&
+         strcmp(*symbol_storage(symbol_slots[slot] - 1), cstr)) {
+    slot = (slot + 1) & symbol_slots_mask;
+  }
+  return slot;
+}
+
+/* doubles the number of slots, must be called with the write lock held */
+static void symbol_slots_grow(void)
+{
+  GtUword number;
+  gt_free(symbol_slots);
+  symbol_slots_mask = 2 * symbol_slots_mask + 1;
+  symbol_slots = gt_calloc(symbol_slots_mask + 1, sizeof *symbol_slots);
+  for (number = 0; number < num_of_symbols; number++) {
+    const char *cstr = *symbol_storage(number);
+    symbol_slots[symbol_slot(cstr, symbol_hash(cstr))] = number + 1;
+  }
+}
+
+/* adds <cstr> to the empty <slot>, must be called with the write lock held */
+static GtUword symbol_add(const char *cstr, uint32_t hash, GtUword slot)
+{
+  unsigned int chunk = gt_determinebitspervalue(num_of_symbols /
+                                                SYMBOL_FIRST_CHUNK_SIZE + 1)
+                       - 1;
+  gt_assert(!symbol_slots[slot]);
+  if (2 * (num_of_symbols + 1) > symbol_slots_mask + 1) {
+    symbol_slots_grow();
+    slot = symbol_slot(cstr, hash);
+  }
+  if (!symbol_chunks[chunk]) {
+    symbol_chunks[chunk] = gt_malloc(sizeof (char*) * SYMBOL_FIRST_CHUNK_SIZE *
+                                     ((GtUword) 1 << chunk));
+  }
+  *symbol_storage(num_of_symbols) = gt_cstr_dup(cstr);
+  symbol_slots[slot] = ++num_of_symbols;
+  return num_of_symbols - 1;
 }
 
 const char* gt_symbol(const char *cstr)
 {
-  const char *symbol;
   if (!cstr)
     return NULL;
-  gt_mutex_lock(symbol_mutex);
-  if (!(symbol = gt_cstr_table_get(symbols, cstr))) {
-    gt_cstr_table_add(symbols, cstr);
-    symbol = gt_cstr_table_get(symbols, cstr);
-  }
-  gt_mutex_unlock(symbol_mutex);
-  return symbol;
+  return gt_symbol_get(gt_symbol_number(cstr));
+}
+
+GtUword gt_symbol_number(const char *cstr)
+{
+  GtUword number;
+  uint32_t hash;
+  gt_assert(cstr);
+  if (gt_symbol_find_number(cstr, &number))
+    return number;
+  hash = symbol_hash(cstr);
+  gt_rwlock_wrlock(symbol_lock);
+  /* the symbol might have been added in the meantime */
+  number = symbol_slot(cstr, hash);
+  if (symbol_slots[number])
+    number = symbol_slots[number] - 1;
+  else
+    number = symbol_add(cstr, hash, number);
+  gt_rwlock_unlock(symbol_lock);
+  return number;
+}
+
+bool gt_symbol_find_number(const char *cstr, GtUword *number)
+{
+  uint32_t hash;
+  GtUword slot;
+  gt_assert(cstr && number);
+  hash = symbol_hash(cstr);
+  gt_rwlock_rdlock(symbol_lock);
+  slot = symbol_slots[symbol_slot(cstr, hash)];
+  gt_rwlock_unlock(symbol_lock);
+  if (slot)
+    *number = slot - 1;
+  return slot != 0;
+}
+
+const char* gt_symbol_get(GtUword number)
+{
+  return *symbol_storage(number);
 }
 
 void gt_symbol_clean(void)
 {
-  gt_cstr_table_delete(symbols);
-  gt_mutex_delete(symbol_mutex);
+  GtUword number;
+  unsigned int chunk;
+  for (number = 0; number < num_of_symbols; number++)
+    gt_free(*symbol_storage(number));
+  for (chunk = 0; chunk < SYMBOL_MAX_CHUNKS; chunk++) {
+    gt_free(symbol_chunks[chunk]);
+    symbol_chunks[chunk] = NULL;
+  }
+  gt_free(symbol_slots);
+  symbol_slots = NULL;
+  num_of_symbols = 0;
+  gt_rwlock_delete(symbol_lock);
+  symbol_lock = NULL;
 }
 
 /* we use randomly generated numbers to test the symbol mechanism */
@@ -67,6 +187,8 @@ static void* test_symbol(GT_UNUSED void *data)
     gt_str_append_uword(symbol, gt_rand_max(MAX_SYMBOL));
     gt_symbol(gt_str_get(symbol));
     gt_assert(!strcmp(gt_symbol(gt_str_get(symbol)), gt_str_get(symbol)));
+    gt_assert(gt_symbol_get(gt_symbol_number(gt_str_get(symbol))) ==
+              gt_symbol(gt_str_get(symbol)));
   }
   gt_str_delete(symbol);
   return NULL;
@@ -18,11 +18,26 @@
 #ifndef SYMBOL_H
 #define SYMBOL_H
 
+#include <stdbool.h>
 #include "core/error_api.h"
 #include "core/symbol_api.h"
 
 void        gt_symbol_init(void);
 
+/* Return the number of the symbol for <cstr>, creating the symbol if
+   necessary. Symbols are numbered consecutively from 0 in the order of their
+   creation, so the number can be stored instead of the symbol where space
+   matters. */
+GtUword     gt_symbol_number(const char *cstr);
+
+/* If a symbol for <cstr> exists, store its number in <number> and return
+   <true>. Otherwise, <false> is returned and no symbol is created. */
+bool        gt_symbol_find_number(const char *cstr, GtUword *number);
+
+/* Return the symbol with the given <number>, which must have been returned by
+   <gt_symbol_number()> or <gt_symbol_find_number()>. Does not lock. */
+const char* gt_symbol_get(GtUword number);
+
 /* Free (and thereby invalidate) all created symbols! */
 void        gt_symbol_clean(void);
 
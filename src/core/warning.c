@@ -18,16 +18,67 @@
 #include <stdio.h>
 #include <stdarg.h>
 #include <stdlib.h>
+#include "core/ma_api.h"
 #include "core/unused_api.h"
 #include "core/warning_api.h"
 
 static GtWarningHandler warning_handler = gt_warning_default_handler;
 static void *warning_data = NULL;
 
+typedef struct {
+  GtWarningHandler handler;
+  void *data;
+} GtWarningThreadHandler;
+
+#ifdef GT_THREADS_ENABLED
+#include <pthread.h>
+
+static pthread_key_t thread_handler_key;
+static pthread_once_t thread_handler_key_once = PTHREAD_ONCE_INIT;
+
+static void warning_thread_handler_key_create(void)
+{
+  (void) pthread_key_create(&thread_handler_key, NULL);
+}
+
+static GtWarningThreadHandler* warning_thread_handler_get(void)
+{
+  (void) pthread_once(&thread_handler_key_once,
+                      warning_thread_handler_key_create);
+  return pthread_getspecific(thread_handler_key);
+}
+
+static void warning_thread_handler_set(GtWarningThreadHandler *th)
+{
+  (void) pthread_once(&thread_handler_key_once,
+                      warning_thread_handler_key_create);
+  (void) pthread_setspecific(thread_handler_key, th);
+}
+#else
+/* without threads, the calling thread is the only one */
+static GtWarningThreadHandler *thread_handler = NULL;
+
+static GtWarningThreadHandler* warning_thread_handler_get(void)
+{
+  return thread_handler;
+}
+
+static void warning_thread_handler_set(GtWarningThreadHandler *th)
+{
+  thread_handler = th;
+}
+#endif
+
 void gt_warning(const char *format, ...)
 {
+  GtWarningThreadHandler *th = warning_thread_handler_get();
   va_list ap;
-  if (warning_handler) {
+  if (th) {
+    va_start(ap, format);
+    th->handler(th->data, format, ap);
+    va_end(ap);
+  }
+  else if (warning_handler) {
     va_start(ap, format);
     warning_handler(warning_data, format, ap);
     va_end(ap);
@@ -46,12 +97,36 @@ void gt_warning_set_handler(GtWarningHandler warn_handler, void *data)
   warning_data = data;
 }
 
+void gt_warning_set_thread_handler(GtWarningHandler warn_handler, void *data)
+{
+  GtWarningThreadHandler *th = warning_thread_handler_get();
+  if (warn_handler) {
+    if (!th) {
+      th = gt_malloc(sizeof *th);
+      warning_thread_handler_set(th);
+    }
+    th->handler = warn_handler;
+    th->data = data;
+  }
+  else if (th) {
+    gt_free(th);
+    warning_thread_handler_set(NULL);
+  }
+}
+
 void gt_warning_default_handler(GT_UNUSED void *data, const char *format,
                                 va_list ap)
 {
+#if defined(GT_THREADS_ENABLED) && !defined(_WIN32)
+  /* keep warnings from different threads on separate lines */
+  flockfile(stderr);
+#endif
   (void) fputs("warning: ", stderr);
   (void) vfprintf(stderr, format, ap);
   (void) putc('\n', stderr);
+#if defined(GT_THREADS_ENABLED) && !defined(_WIN32)
+  funlockfile(stderr);
+#endif
 }
 
 GtWarningHandler gt_warning_get_handler(void)
@@ -37,6 +37,14 @@ void gt_warning_disable(void);
    The <data> is passed to <warning_handler> on each invocation. */
 void gt_warning_set_handler(GtWarningHandler warn_handler, void *data);
 
+/* Set <warn_handler> to handle the warnings issued with <gt_warning()> by the
+   calling thread, instead of the handler set with <gt_warning_set_handler()>.
+   The <data> is passed to <warn_handler> on each invocation. Setting
+   <warn_handler> to NULL restores the handler set with
+   <gt_warning_set_handler()> for the calling thread. This must be done before
+   the thread exits. */
+void gt_warning_set_thread_handler(GtWarningHandler warn_handler, void *data);
+
 /* The default warning handler which prints on <stderr>.
    "warning: " is prepended and a newline is appended to the message defined by
    <format> and <ap>. Does not use <data>. */
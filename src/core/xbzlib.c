@@ -36,7 +36,7 @@ BZFILE* gt_xbzopen(const char *path, const char *mode)
 int gt_xbzfgetc(BZFILE *bzfile)
 {
   char c;
-  return gt_xbzread(bzfile, &c, 1) ? c : EOF;
+  return gt_xbzread(bzfile, &c, 1) ? (int) (unsigned char) c : EOF;
 }
 
 static int bzputc(int c, BZFILE *bzfile)
@@ -36,7 +36,7 @@ gzFile gt_xgzopen(const char *path, const char *mode)
 int gt_xgzfgetc(gzFile file)
 {
   char c;
-  return gt_xgzread(file, &c, 1) ? c : EOF;
+  return gt_xgzread(file, &c, 1) ? (int) (unsigned char) c : EOF;
 }
 
 void gt_xgzfputc(int c, gzFile file)
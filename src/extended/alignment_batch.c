@@ -0,0 +1,254 @@
+/*
+  Copyright (c) 2026 agent <agent@local>
+
+  Permission to use, copy, modify, and distribute this software for any
+  purpose with or without fee is hereby granted, provided that the above
+  copyright notice and this permission notice appear in all copies.
+
+  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+
+#include "core/assert_api.h"
+#include "core/ma_api.h"
+#include "core/minmax_api.h"
+#include "core/multithread_api.h"
+#include "core/thread_api.h"
+#include "extended/linearalign.h"
+#include "extended/linearalign_affinegapcost.h"
+#include "extended/linspace_management.h"
+#include "extended/alignment_batch.h"
+
+typedef struct
+{
+  const GtUchar *useq,
+                *vseq;
+  GtUword ulen,
+          vlen;
+  GtWord value;
+} GtAlignmentBatchPair;
+
+struct GtAlignmentBatch
+{
+  const GtScoreHandler *scorehandler;
+  bool global,
+       affine;
+  GtUword timesquarefactor,
+          nextfreepair,
+          allocatedpairs,
+          numofalignments, /* number of allocated alignments */
+          numofworkers,
+          nextworker, /* the following two are only used in run */
+          nextpair;
+  GtAlignmentBatchPair *pairs;
+  GtAlignment **alignments;
+  GtLinspaceManagement **spacemanagers;
+  GtMutex *mutex;
+};
+
+GtAlignmentBatch *gt_alignment_batch_new(const GtScoreHandler *scorehandler,
+                                         bool global,
+                                         bool affine,
+                                         GtUword timesquarefactor)
+{
+  GtAlignmentBatch *batch = gt_malloc(sizeof *batch);
+
+  gt_assert(scorehandler != NULL);
+  batch->scorehandler = scorehandler;
+  batch->global = global;
+  batch->affine = affine;
+  batch->timesquarefactor = timesquarefactor;
+  batch->nextfreepair = 0;
+  batch->allocatedpairs = 0;
+  batch->numofalignments = 0;
+  batch->numofworkers = 0;
+  batch->nextworker = 0;
+  batch->nextpair = 0;
+  batch->pairs = NULL;
+  batch->alignments = NULL;
+  batch->spacemanagers = NULL;
+  batch->mutex = gt_mutex_new();
+  return batch;
+}
+
+void gt_alignment_batch_add(GtAlignmentBatch *batch,
+                            const GtUchar *useq,
+                            GtUword ulen,
+                            const GtUchar *vseq,
+                            GtUword vlen)
+{
+  GtAlignmentBatchPair *pair;
+
+  gt_assert(batch != NULL);
+  if (batch->nextfreepair == batch->allocatedpairs)
+  {
+    batch->allocatedpairs = batch->allocatedpairs * 1.2 + 32;
+    batch->pairs = gt_realloc(batch->pairs,
+                              sizeof *batch->pairs * batch->allocatedpairs);
+  }
+  pair = batch->pairs + batch->nextfreepair++;
+  pair->useq = useq;
+  pair->ulen = ulen;
+  pair->vseq = vseq;
+  pair->vlen = vlen;
+  pair->value = 0;
+}
+
+GtUword gt_alignment_batch_size(const GtAlignmentBatch *batch)
+{
+  gt_assert(batch != NULL);
+  return batch->nextfreepair;
+}
+
+static GtWord gt_alignment_batch_align(const GtAlignmentBatch *batch,
+                                       GtLinspaceManagement *spacemanager,
+                                       GtAlignment *align,
+                                       const GtAlignmentBatchPair *pair)
+{
+  if (batch->global)
+  {
+    return (GtWord) (batch->affine
+                     ? gt_linearalign_affinegapcost_compute_generic
+                     : gt_linearalign_compute_generic)
+                          (spacemanager, batch->scorehandler, align,
+                           pair->useq, 0, pair->ulen,
+                           pair->vseq, 0, pair->vlen);
+  }
+  return (batch->affine ? gt_linearalign_affinegapcost_compute_local_generic
+                        : gt_linearalign_compute_local_generic)
+                          (spacemanager, batch->scorehandler, align,
+                           pair->useq, 0, pair->ulen,
+                           pair->vseq, 0, pair->vlen);
+}
+
+/* Each thread takes the next free space manager and then the pairs one by
+   one until all pairs are aligned. */
+static void *gt_alignment_batch_thread_func(void *data)
+{
+  GtAlignmentBatch *batch = (GtAlignmentBatch *) data;
+  GtLinspaceManagement *spacemanager;
+
+  gt_mutex_lock(batch->mutex);
+  gt_assert(batch->nextworker < batch->numofworkers);
+  spacemanager = batch->spacemanagers[batch->nextworker++];
+  gt_mutex_unlock(batch->mutex);
+  while (true)
+  {
+    GtUword idx;
+
+    gt_mutex_lock(batch->mutex);
+    idx = batch->nextpair < batch->nextfreepair ? batch->nextpair++
+                                                : GT_UWORD_MAX;
+    gt_mutex_unlock(batch->mutex);
+    if (idx == GT_UWORD_MAX)
+    {
+      break;
+    }
+    gt_alignment_reset(batch->alignments[idx]);
+    batch->pairs[idx].value
+      = gt_alignment_batch_align(batch, spacemanager, batch->alignments[idx],
+                                 batch->pairs + idx);
+  }
+  return NULL;
+}
+
+int gt_alignment_batch_run(GtAlignmentBatch *batch, GtError *err)
+{
+  GtUword idx;
+
+  gt_error_check(err);
+  gt_assert(batch != NULL);
+  if (batch->numofalignments < batch->nextfreepair)
+  {
+    batch->alignments = gt_realloc(batch->alignments,
+                                   sizeof *batch->alignments *
+                                   batch->nextfreepair);
+    for (idx = batch->numofalignments; idx < batch->nextfreepair; idx++)
+    {
+      batch->alignments[idx] = gt_alignment_new();
+    }
+    batch->numofalignments = batch->nextfreepair;
+  }
+  if (batch->numofworkers < (GtUword) gt_jobs)
+  {
+    batch->spacemanagers = gt_realloc(batch->spacemanagers,
+                                      sizeof *batch->spacemanagers * gt_jobs);
+    for (idx = batch->numofworkers; idx < (GtUword) gt_jobs; idx++)
+    {
+      GtLinspaceManagement *spacemanager = gt_linspace_management_new();
+
+      gt_linspace_management_set_TSfactor(spacemanager,
+                                          batch->timesquarefactor);
+      /* the pairs are aligned in parallel, so that each single alignment is
+         computed by one thread */
+      gt_linspace_management_set_maxthreads(spacemanager, 1UL);
+      batch->spacemanagers[idx] = spacemanager;
+    }
+    batch->numofworkers = (GtUword) gt_jobs;
+  }
+  batch->nextworker = 0;
+  batch->nextpair = 0;
+  return gt_multithread(gt_alignment_batch_thread_func, batch, err);
+}
+
+const GtAlignment *gt_alignment_batch_get(const GtAlignmentBatch *batch,
+                                          GtUword idx)
+{
+  gt_assert(batch != NULL && idx < batch->nextfreepair &&
+            idx < batch->numofalignments);
+  return batch->alignments[idx];
+}
+
+GtWord gt_alignment_batch_get_value(const GtAlignmentBatch *batch,
+                                    GtUword idx)
+{
+  gt_assert(batch != NULL && idx < batch->nextfreepair);
+  return batch->pairs[idx].value;
+}
+
+size_t gt_alignment_batch_get_spacepeak(const GtAlignmentBatch *batch)
+{
+  GtUword idx;
+  size_t spacepeak = 0;
+
+  gt_assert(batch != NULL);
+  for (idx = 0; idx < batch->numofworkers; idx++)
+  {
+    spacepeak = GT_MAX(spacepeak, gt_linspace_management_get_spacepeak(
+                                                 batch->spacemanagers[idx]));
+  }
+  return spacepeak;
+}
+
+void gt_alignment_batch_reset(GtAlignmentBatch *batch)
+{
+  gt_assert(batch != NULL);
+  batch->nextfreepair = 0;
+}
+
+void gt_alignment_batch_delete(GtAlignmentBatch *batch)
+{
+  if (batch != NULL)
+  {
+    GtUword idx;
+
+    for (idx = 0; idx < batch->numofalignments; idx++)
+    {
+      gt_alignment_delete(batch->alignments[idx]);
+    }
+    for (idx = 0; idx < batch->numofworkers; idx++)
+    {
+      gt_linspace_management_delete(batch->spacemanagers[idx]);
+    }
+    gt_free(batch->alignments);
+    gt_free(batch->spacemanagers);
+    gt_free(batch->pairs);
+    gt_mutex_delete(batch->mutex);
+    gt_free(batch);
+  }
+}
@@ -0,0 +1,80 @@
+/*
+  Copyright (c) 2026 agent <agent@local>
+
+  Permission to use, copy, modify, and distribute this software for any
+  purpose with or without fee is hereby granted, provided that the above
+  copyright notice and this permission notice appear in all copies.
+
+  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+
+#ifndef ALIGNMENT_BATCH_H
+#define ALIGNMENT_BATCH_H
+
+#include "core/error_api.h"
+#include "core/types_api.h"
+#include "extended/alignment.h"
+#include "extended/scorehandler.h"
+
+/* The <GtAlignmentBatch> class collects many pairs of sequences and computes
+   an optimal alignment in linear space for each pair. The pairs are
+   distributed over <gt_jobs> threads. Each thread owns the space for the
+   dynamic programming tables and reuses it for all pairs it aligns, also
+   over several calls of <gt_alignment_batch_run>. */
+typedef struct GtAlignmentBatch GtAlignmentBatch;
+
+/* Return a new <GtAlignmentBatch> object computing global (if <global> is
+   true) or local alignments with affine (if <affine> is true) or linear gap
+   costs as specified by <scorehandler>. <timesquarefactor> is passed to the
+   space management of each thread, see
+   <gt_linspace_management_set_TSfactor>. */
+GtAlignmentBatch* gt_alignment_batch_new(const GtScoreHandler *scorehandler,
+                                         bool global,
+                                         bool affine,
+                                         GtUword timesquarefactor);
+
+/* Add the pair of sequences <useq> of length <ulen> and <vseq> of length
+   <vlen> to <batch>. The sequences are not copied and must be available
+   until the pair is removed by <gt_alignment_batch_reset>. */
+void              gt_alignment_batch_add(GtAlignmentBatch *batch,
+                                         const GtUchar *useq,
+                                         GtUword ulen,
+                                         const GtUchar *vseq,
+                                         GtUword vlen);
+
+/* Return the number of pairs added to <batch>. */
+GtUword           gt_alignment_batch_size(const GtAlignmentBatch *batch);
+
+/* Compute the alignments of all pairs of <batch>. Returns 0 on success and
+   -1 if the threads could not be started, in which case <err> is set. */
+int               gt_alignment_batch_run(GtAlignmentBatch *batch,
+                                         GtError *err);
+
+/* Return the alignment of pair <idx> (counting from 0 in the order the pairs
+   were added) computed by the last call of <gt_alignment_batch_run>. */
+const GtAlignment* gt_alignment_batch_get(const GtAlignmentBatch *batch,
+                                          GtUword idx);
+
+/* Return the value of the alignment of pair <idx>, i.e. the distance of a
+   global alignment or the score of a local alignment. */
+GtWord            gt_alignment_batch_get_value(const GtAlignmentBatch *batch,
+                                               GtUword idx);
+
+/* Return the maximal space in bytes used by one thread of <batch> for its
+   dynamic programming tables. */
+size_t            gt_alignment_batch_get_spacepeak(const GtAlignmentBatch
+                                                   *batch);
+
+/* Remove all pairs from <batch>, but keep the space of the threads. */
+void              gt_alignment_batch_reset(GtAlignmentBatch *batch);
+
+/* Delete <batch>. */
+void              gt_alignment_batch_delete(GtAlignmentBatch *batch);
+
+#endif
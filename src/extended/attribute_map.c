@@ -0,0 +1,482 @@
+/*
+  Copyright (c) 2026 agent <agent@local>
+
+  Permission to use, copy, modify, and distribute this software for any
+  purpose with or without fee is hereby granted, provided that the above
+  copyright notice and this permission notice appear in all copies.
+
+  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+
+
+#include <limits.h>
+#include <stddef.h>
+#include <string.h>
+#include "core/assert_api.h"
+#include "core/ensure_api.h"
+#include "core/ma_api.h"
+#include "core/multithread_api.h"
+#include "core/str_api.h"
+#include "core/symbol.h"
+#include "core/thread_api.h"
+#include "core/types_api.h"
+#include "core/unused_api.h"
+#include "extended/attribute_map.h"
+#include "extended/gff3_defines.h"
+
+/* The offsets of the values of the common tags (plus one) are stored in the
+   map header, an offset of 0 denotes a missing tag. Offsets which do not fit
+   into the header are marked by <GT_ATTRIBUTE_MAP_FAR>, such tags are looked
+   up like all other tags. */
+#define GT_ATTRIBUTE_MAP_NOF_COMMON  3
+#define GT_ATTRIBUTE_MAP_FAR         UCHAR_MAX
+
+/* The map is stored in a single memory region: the header, the tag numbers
+   (as variable length integers, 7 bits per byte, the highest bit of a byte is
+   set if another byte follows), and the \0-terminated values, both in the
+   order of addition. */
+struct GtAttributeMap {
+  unsigned short size,
+                 tags_length;
+  GtUchar common[GT_ATTRIBUTE_MAP_NOF_COMMON],
+          data[1];
+};
+
+#define attribute_map_values(MAP) \
+        ((char*) (MAP)->data + (MAP)->tags_length)
+
+static size_t attribute_map_bytes(GtUword tags_length, GtUword values_length)
+{
+  return offsetof(GtAttributeMap, data) + tags_length + values_length;
+}
+
+static GtUword attribute_map_encode(GtUchar *out, GtUword number)
+{
+  GtUword length = 0;
+  while (number >= 0x80) {
+    if (out)
+      out[length] = (GtUchar) ((number & 0x7f) | 0x80);
+    number >>= 7;
+    length++;
+  }
+  if (out)
+    out[length] = (GtUchar) number;
+  return length + 1;
+}
+
+static GtUword attribute_map_decode(const GtUchar *in, GtUword *number)
+{
+  GtUword length = 0, shift = 0;
+  *number = 0;
+  do {
+    *number |= (GtUword) (in[length] & 0x7f) << shift;
+    shift += 7;
+  } while (in[length++] & 0x80);
+  return length;
+}
+
+/* Return the total length of the values in <map>. */
+static GtUword attribute_map_values_length(const GtAttributeMap *map)
+{
+  const char *values, *value;
+  GtUword i;
+  values = value = attribute_map_values(map);
+  for (i = 0; i < map->size; i++)
+    value += strlen(value) + 1;
+  return value - values;
+}
+
+/* Return the index of <tag> in the common tags or -1 if it is not common. */
+static int attribute_map_common_index(const char *tag)
+{
+  switch (tag[0]) {
+    case 'I':
+      return strcmp(tag, GT_GFF_ID) ? -1 : 0;
+    case 'N':
+      return strcmp(tag, GT_GFF_NAME) ? -1 : 1;
+    case 'P':
+      return strcmp(tag, GT_GFF_PARENT) ? -1 : 2;
+  }
+  return -1;
+}
+
+static void attribute_map_set_common(GtAttributeMap *map, const char *tag,
+                                     GtUword value_offset)
+{
+  int common;
+  if ((common = attribute_map_common_index(tag)) >= 0) {
+    map->common[common] = value_offset + 1 < GT_ATTRIBUTE_MAP_FAR
+                          ? (GtUchar) (value_offset + 1)
+                          : GT_ATTRIBUTE_MAP_FAR;
+  }
+}
+
+/* Search <tag> in <map> by its symbol number. If <map> contains it, store
+   the offsets and length of its encoded number in <tag_offset> and <tag_len>
+   (if not NULL) and the offset of its value in <value_offset>, and return
+   <true>. */
+static bool attribute_map_find(const GtAttributeMap *map, const char *tag,
+                               GtUword *tag_offset, GtUword *tag_len,
+                               GtUword *value_offset)
+{
+  const char *values, *value;
+  GtUword i, number, tagnum, offset = 0, len;
+  if (!gt_symbol_find_number(tag, &number))
+    return false;
+  values = value = attribute_map_values(map);
+  for (i = 0; i < map->size; i++) {
+    len = attribute_map_decode(map->data + offset, &tagnum);
+    if (tagnum == number) {
+      if (tag_offset) {
+        *tag_offset = offset;
+        *tag_len = len;
+      }
+      *value_offset = value - values;
+      return true;
+    }
+    offset += len;
+    value += strlen(value) + 1;
+  }
+  return false;
+}
+
+/* Like <attribute_map_find()>, but look up common tags in constant time. */
+static bool attribute_map_find_value(const GtAttributeMap *map,
+                                     const char *tag, GtUword *value_offset)
+{
+  int common = attribute_map_common_index(tag);
+  if (common >= 0 && map->common[common] != GT_ATTRIBUTE_MAP_FAR) {
+    if (!map->common[common])
+      return false;
+    *value_offset = (GtUword) map->common[common] - 1;
+    return true;
+  }
+  return attribute_map_find(map, tag, NULL, NULL, value_offset);
+}
+
+/* Adjust the offsets of the common tags whose values follow <value_offset>
+   by <delta>, and forget the common tag at <value_offset> if <removed>. */
+static void attribute_map_shift_common(GtAttributeMap *map,
+                                       GtUword value_offset, GtWord delta,
+                                       bool removed)
+{
+  GtWord offset;
+  GtUword i;
+  for (i = 0; i < GT_ATTRIBUTE_MAP_NOF_COMMON; i++) {
+    if (!map->common[i] || map->common[i] == GT_ATTRIBUTE_MAP_FAR)
+      continue;
+    offset = (GtWord) map->common[i] - 1;
+    if (removed && offset == (GtWord) value_offset)
+      map->common[i] = 0;
+    else if (offset > (GtWord) value_offset) {
+      offset += delta;
+      map->common[i] = offset + 1 < GT_ATTRIBUTE_MAP_FAR
+                       ? (GtUchar) (offset + 1) : GT_ATTRIBUTE_MAP_FAR;
+    }
+  }
+}
+
+GtAttributeMap* gt_attribute_map_new(const char *tag, const char *value)
+{
+  GtAttributeMap *map;
+  gt_assert(tag && value);
+  map = gt_malloc(attribute_map_bytes(0, 0));
+  map->size = 0;
+  map->tags_length = 0;
+  memset(map->common, 0, sizeof map->common);
+  gt_attribute_map_add(&map, tag, value);
+  return map;
+}
+
+void gt_attribute_map_add(GtAttributeMap **mapp, const char *tag,
+                          const char *value)
+{
+  GtAttributeMap *map;
+  GtUword number, number_len, values_length;
+  GT_UNUSED GtUword offset;
+  size_t value_len;
+  char *values;
+  gt_assert(mapp && *mapp && tag && value);
+  gt_assert(strlen(tag));
+  value_len = strlen(value) + 1;
+  gt_assert(value_len > 1);
+  map = *mapp;
+  /* map does not contain given <tag> already */
+  gt_assert(!attribute_map_find(map, tag, NULL, NULL, &offset));
+  gt_assert(map->size < USHRT_MAX);
+  number = gt_symbol_number(tag);
+  number_len = attribute_map_encode(NULL, number);
+  gt_assert(map->tags_length + number_len <= USHRT_MAX);
+  values_length = attribute_map_values_length(map);
+  map = gt_realloc(map, attribute_map_bytes(map->tags_length + number_len,
+                                            values_length + value_len));
+  /* make room for the new tag number */
+  values = attribute_map_values(map);
+  memmove(values + number_len, values, values_length);
+  attribute_map_encode(map->data + map->tags_length, number);
+  map->tags_length += number_len;
+  map->size++;
+  memcpy(attribute_map_values(map) + values_length, value, value_len);
+  attribute_map_set_common(map, tag, values_length);
+  *mapp = map;
+}
+
+void gt_attribute_map_set(GtAttributeMap **mapp, const char *tag,
+                          const char *value)
+{
+  GtAttributeMap *map;
+  GtUword offset, tail, values_length = 0;
+  size_t old_len, new_len;
+  char *values;
+  gt_assert(mapp && *mapp && tag && value);
+  gt_assert(strlen(tag) && strlen(value));
+  map = *mapp;
+  if (!attribute_map_find_value(map, tag, &offset)) {
+    gt_attribute_map_add(mapp, tag, value);
+    return;
+  }
+  old_len = strlen(attribute_map_values(map) + offset) + 1;
+  new_len = strlen(value) + 1;
+  if (new_len != old_len) {
+    values_length = attribute_map_values_length(map);
+    if (new_len > old_len) {
+      map = gt_realloc(map, attribute_map_bytes(map->tags_length,
+                                                values_length - old_len
+                                                + new_len));
+    }
+    values = attribute_map_values(map);
+    tail = offset + old_len;
+    memmove(values + offset + new_len, values + tail, values_length - tail);
+    attribute_map_shift_common(map, offset, (GtWord) new_len - old_len,
+                               false);
+  }
+  memcpy(attribute_map_values(map) + offset, value, new_len);
+  if (new_len < old_len) {
+    map = gt_realloc(map, attribute_map_bytes(map->tags_length,
+                                              values_length - old_len
+                                              + new_len));
+  }
+  *mapp = map;
+}
+
+const char* gt_attribute_map_get(const GtAttributeMap *map, const char *tag)
+{
+  GtUword offset;
+  gt_assert(map && tag && strlen(tag));
+  if (!attribute_map_find_value(map, tag, &offset))
+    return NULL;
+  return attribute_map_values(map) + offset;
+}
+
+GtUword gt_attribute_map_size(const GtAttributeMap *map)
+{
+  gt_assert(map);
+  return map->size;
+}
+
+void gt_attribute_map_remove(GtAttributeMap **mapp, const char *tag)
+{
+  GtAttributeMap *map;
+  GtUword tag_offset, tag_len, value_offset, values_length;
+  GT_UNUSED bool found;
+  size_t value_len;
+  char *values;
+  gt_assert(mapp && *mapp && tag && (*mapp)->size > 1);
+  map = *mapp;
+  found = attribute_map_find(map, tag, &tag_offset, &tag_len, &value_offset);
+  gt_assert(found);
+  values_length = attribute_map_values_length(map);
+  values = attribute_map_values(map);
+  value_len = strlen(values + value_offset) + 1;
+  /* remove the value */
+  memmove(values + value_offset, values + value_offset + value_len,
+          values_length - value_offset - value_len);
+  values_length -= value_len;
+  /* remove the tag number, the values move along */
+  memmove(map->data + tag_offset, map->data + tag_offset + tag_len,
+          map->tags_length - tag_offset - tag_len + values_length);
+  map->tags_length -= tag_len;
+  map->size--;
+  attribute_map_shift_common(map, value_offset, -(GtWord) value_len, true);
+  *mapp = gt_realloc(map, attribute_map_bytes(map->tags_length,
+                                              values_length));
+}
+
+void gt_attribute_map_foreach(const GtAttributeMap *map,
+                              GtTagValueMapIteratorFunc func, void *data)
+{
+  const char *value;
+  GtUword i, number, offset = 0;
+  gt_assert(map && func);
+  value = attribute_map_values(map);
+  for (i = 0; i < map->size; i++) {
+    offset += attribute_map_decode(map->data + offset, &number);
+    func(gt_symbol_get(number), value, data);
+    value += strlen(value) + 1;
+  }
+}
+
+void gt_attribute_map_delete(GtAttributeMap *map)
+{
+  if (!map) return;
+  gt_free(map);
+}
+
+static void attribute_map_store_pair(const char *tag, const char *value,
+                                     void *data)
+{
+  GtStr *pairs = data;
+  gt_str_append_cstr(pairs, tag);
+  gt_str_append_char(pairs, '=');
+  gt_str_append_cstr(pairs, value);
+  gt_str_append_char(pairs, ';');
+}
+
+typedef struct {
+  const GtAttributeMap *map;
+  const char *pairs;
+  GtMutex *mutex;
+  bool failed;
+} GtAttributeMapTestInfo;
+
+/* reads the attributes of a shared map while new tags are interned */
+static void* attribute_map_test_read(void *data)
+{
+  GtAttributeMapTestInfo *info = data;
+  GtStr *pairs = gt_str_new(),
+        *tag = gt_str_new();
+  GtUword i, j;
+  bool failed = false;
+
+  for (i = 0; !failed && i < 100; i++) {
+    for (j = 0; !failed && j < gt_attribute_map_size(info->map); j++) {
+      const char *value;
+      gt_str_reset(tag);
+      gt_str_append_cstr(tag, "tag ");
+      gt_str_append_uword(tag, j);
+      value = gt_attribute_map_get(info->map, gt_str_get(tag));
+      failed = value == NULL || strcmp(value, gt_str_get(tag)) != 0;
+    }
+    gt_str_reset(pairs);
+    gt_attribute_map_foreach(info->map, attribute_map_store_pair, pairs);
+    if (strcmp(gt_str_get(pairs), info->pairs))
+      failed = true;
+    gt_str_reset(tag);
+    gt_str_append_cstr(tag, "new tag ");
+    gt_str_append_uword(tag, i);
+    (void) gt_symbol_number(gt_str_get(tag));
+  }
+  if (failed) {
+    gt_mutex_lock(info->mutex);
+    info->failed = true;
+    gt_mutex_unlock(info->mutex);
+  }
+  gt_str_delete(tag);
+  gt_str_delete(pairs);
+  return NULL;
+}
+
+int gt_attribute_map_unit_test(GtError *err)
+{
+  GtAttributeMap *map;
+  GtStr *pairs, *tag;
+  GtUword i;
+  int had_err = 0;
+  gt_error_check(err);
+
+  pairs = gt_str_new();
+  map = gt_attribute_map_new("tag 1", "value 1");
+  gt_attribute_map_add(&map, GT_GFF_ID, "gene1");
+  gt_attribute_map_add(&map, "tag 3", "value 3");
+  gt_attribute_map_add(&map, GT_GFF_PARENT, "region1");
+  gt_ensure(gt_attribute_map_size(map) == 4);
+  gt_ensure(!gt_attribute_map_get(map, "unused tag"));
+  gt_ensure(!gt_attribute_map_get(map, GT_GFF_NAME));
+  gt_ensure(!gt_attribute_map_get(map, "value 1"));
+  gt_ensure(!strcmp(gt_attribute_map_get(map, "tag 1"), "value 1"));
+  gt_ensure(!strcmp(gt_attribute_map_get(map, GT_GFF_ID), "gene1"));
+  gt_ensure(!strcmp(gt_attribute_map_get(map, GT_GFF_PARENT), "region1"));
+
+  /* shorter, equally long, and longer values */
+  if (!had_err) {
+    gt_attribute_map_set(&map, "tag 1", "v1");
+    gt_attribute_map_set(&map, GT_GFF_ID, "gene2");
+    gt_attribute_map_set(&map, "tag 3", "value 3 (longer)");
+    gt_attribute_map_set(&map, GT_GFF_NAME, "name");
+    gt_attribute_map_foreach(map, attribute_map_store_pair, pairs);
+    gt_ensure(!strcmp(gt_str_get(pairs), "tag 1=v1;ID=gene2;tag 3=value 3 "
+                      "(longer);Parent=region1;Name=name;"));
+  }
+
+  /* remove first, middle, and last tag */
+  if (!had_err) {
+    gt_attribute_map_remove(&map, "tag 1");
+    gt_attribute_map_remove(&map, "tag 3");
+    gt_attribute_map_remove(&map, GT_GFF_NAME);
+    gt_ensure(gt_attribute_map_size(map) == 2);
+    gt_ensure(!gt_attribute_map_get(map, "tag 1"));
+    gt_ensure(!gt_attribute_map_get(map, GT_GFF_NAME));
+    gt_str_reset(pairs);
+    gt_attribute_map_foreach(map, attribute_map_store_pair, pairs);
+    gt_ensure(!strcmp(gt_str_get(pairs), "ID=gene2;Parent=region1;"));
+  }
+  gt_attribute_map_delete(map);
+
+  /* common tags beyond the offsets stored in the header and tag numbers
+     which take more than one byte */
+  if (!had_err) {
+    tag = gt_str_new();
+    map = gt_attribute_map_new("tag 0", "value");
+    for (i = 1; i < 2 * GT_ATTRIBUTE_MAP_FAR; i++) {
+      gt_str_reset(tag);
+      gt_str_append_cstr(tag, "tag ");
+      gt_str_append_uword(tag, i);
+      gt_attribute_map_add(&map, gt_str_get(tag), gt_str_get(tag));
+    }
+    gt_ensure(gt_symbol_number(gt_str_get(tag)) >= 0x80);
+    gt_attribute_map_add(&map, GT_GFF_PARENT, "p");
+    gt_ensure(!strcmp(gt_attribute_map_get(map, GT_GFF_PARENT), "p"));
+    gt_ensure(!strcmp(gt_attribute_map_get(map, "tag 300"), "tag 300"));
+    gt_attribute_map_remove(&map, "tag 3");
+    gt_ensure(!gt_attribute_map_get(map, "tag 3"));
+    gt_ensure(!strcmp(gt_attribute_map_get(map, "tag 4"), "tag 4"));
+    gt_ensure(!strcmp(gt_attribute_map_get(map, GT_GFF_PARENT), "p"));
+    gt_ensure(gt_attribute_map_size(map) == 2 * GT_ATTRIBUTE_MAP_FAR);
+    gt_attribute_map_delete(map);
+    gt_str_delete(tag);
+  }
+
+  /* concurrent reads, with the number of jobs set by the -j option of
+     gt -test */
+  if (!had_err) {
+    GtAttributeMapTestInfo info;
+    tag = gt_str_new();
+    map = gt_attribute_map_new("tag 0", "tag 0");
+    for (i = 1; i < 2 * GT_ATTRIBUTE_MAP_FAR; i++) {
+      gt_str_reset(tag);
+      gt_str_append_cstr(tag, "tag ");
+      gt_str_append_uword(tag, i);
+      gt_attribute_map_add(&map, gt_str_get(tag), gt_str_get(tag));
+    }
+    gt_str_reset(pairs);
+    gt_attribute_map_foreach(map, attribute_map_store_pair, pairs);
+    info.map = map;
+    info.pairs = gt_str_get(pairs);
+    info.mutex = gt_mutex_new();
+    info.failed = false;
+    had_err = gt_multithread(attribute_map_test_read, &info, err);
+    gt_ensure(!info.failed);
+    gt_mutex_delete(info.mutex);
+    gt_attribute_map_delete(map);
+    gt_str_delete(tag);
+  }
+
+  gt_str_delete(pairs);
+  return had_err;
+}
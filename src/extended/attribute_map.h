@@ -0,0 +1,68 @@
+/*
+  Copyright (c) 2026 agent <agent@local>
+
+  Permission to use, copy, modify, and distribute this software for any
+  purpose with or without fee is hereby granted, provided that the above
+  copyright notice and this permission notice appear in all copies.
+
+  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+
+
+#ifndef ATTRIBUTE_MAP_H
+#define ATTRIBUTE_MAP_H
+
+#include "core/error_api.h"
+#include "extended/tag_value_map_api.h"
+
+/* A <GtAttributeMap> stores the attributes of a feature node. In contrast to
+   the <GtTagValueMap>, the tags are not stored in the map itself, but only the
+   numbers of the corresponding symbols (see core/symbol.h), which take one or
+   two bytes for typical tags. The map occupies a single memory region, and its
+   address can change whenever the map is modified (similar to the
+   <GtTagValueMap>).
+   The values of the tags <ID>, <Name>, and <Parent> are found in constant
+   time, looking up another tag costs one symbol lookup and a scan over the
+   tag numbers. The tag/value pairs are kept in the order of their addition.
+   Tags and values cannot have length 0. */
+typedef struct GtAttributeMap GtAttributeMap;
+
+/* Return a new <GtAttributeMap> object which stores the given <tag>/<value>
+   pair. */
+GtAttributeMap* gt_attribute_map_new(const char *tag, const char *value);
+/* Add <tag>/<value> pair to <attribute_map>. <attribute_map> must not contain
+   the given <tag> already! */
+void            gt_attribute_map_add(GtAttributeMap **attribute_map,
+                                     const char *tag, const char *value);
+/* Set the given <tag> in <attribute_map> to <value>. */
+void            gt_attribute_map_set(GtAttributeMap **attribute_map,
+                                     const char *tag, const char *value);
+/* Return value corresponding to <tag> from <attribute_map>. If
+   <attribute_map> does not contain such a value, <NULL> is returned. */
+const char*     gt_attribute_map_get(const GtAttributeMap *attribute_map,
+                                     const char *tag);
+/* Return the number of tag-value pairs in <attribute_map>. */
+GtUword         gt_attribute_map_size(const GtAttributeMap *attribute_map);
+/* Removes the given <tag> from <attribute_map>. <attribute_map> must contain
+   the given <tag> already! Also, at least one tag-value pair must remain in
+   the map. */
+void            gt_attribute_map_remove(GtAttributeMap **attribute_map,
+                                        const char *tag);
+/* Apply <iterator_func> to each tag/value pair contained in <attribute_map>
+   (in the order of their addition) and pass <data> along. */
+void            gt_attribute_map_foreach(const GtAttributeMap *attribute_map,
+                                         GtTagValueMapIteratorFunc
+                                         iterator_func,
+                                         void *data);
+/* Delete <attribute_map>. */
+void            gt_attribute_map_delete(GtAttributeMap *attribute_map);
+
+int             gt_attribute_map_unit_test(GtError *err);
+
+#endif
@@ -0,0 +1,58 @@
+/*
+  Copyright (c) 2026 agent <agent@local>
+
+  Permission to use, copy, modify, and distribute this software for any
+  purpose with or without fee is hereby granted, provided that the above
+  copyright notice and this permission notice appear in all copies.
+
+  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+
+#ifndef BINARY_DEFINES_H
+#define BINARY_DEFINES_H
+
+/* The binary format for streams of genome nodes consists of a header and a
+   sequence of records. The header is the magic string
+   <GT_BINARY_MAGIC> followed by one byte storing <GT_BINARY_VERSION>. Each
+   record starts with one of the tag bytes defined below. All integers are
+   stored as variable length unsigned integers (7 bits per byte, least
+   significant group first, the highest bit of a byte is set if another byte
+   follows). Strings are stored as their length followed by the characters.
+   Scores are stored as 4 byte floats in host byte order.
+
+   Sequence IDs, sources, types and attribute names are interned: each such
+   string is stored only once in a <GT_BINARY_TAG_STRING> record, which
+   precedes the first record referring to it. Later records refer to it by its
+   number, counting from 0 in the order of the string records.
+
+   A feature node tree is stored in one <GT_BINARY_TAG_FEATURE> record: the
+   number of nodes, the nodes (see <GT_BINARY_FEATURE_*> for the flags
+   stored for each node), the number of parent-child links and the links as
+   pairs of node numbers. This explicitly represents trees as well as
+   directed acyclic graphs. */
+
+#define GT_BINARY_MAGIC                   "\0GTB"
+#define GT_BINARY_MAGIC_LENGTH            4
+#define GT_BINARY_VERSION                 1
+
+#define GT_BINARY_TAG_STRING              'S'
+#define GT_BINARY_TAG_FEATURE             'F'
+#define GT_BINARY_TAG_REGION              'R'
+#define GT_BINARY_TAG_COMMENT             'C'
+#define GT_BINARY_TAG_META                'M'
+#define GT_BINARY_TAG_SEQUENCE            'Q'
+#define GT_BINARY_TAG_EOF                 'E'
+
+#define GT_BINARY_FEATURE_PSEUDO          1U
+#define GT_BINARY_FEATURE_SCORE           (1U << 1)
+#define GT_BINARY_FEATURE_SOURCE          (1U << 2)
+#define GT_BINARY_FEATURE_MULTI           (1U << 3)
+#define GT_BINARY_FEATURE_REPRESENTATIVE  (1U << 4)
+
+#endif
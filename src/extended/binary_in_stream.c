@@ -0,0 +1,120 @@
+/*
+  Copyright (c) 2026 agent <agent@local>
+
+  Permission to use, copy, modify, and distribute this software for any
+  purpose with or without fee is hereby granted, provided that the above
+  copyright notice and this permission notice appear in all copies.
+
+  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+
+#include "core/class_alloc_lock.h"
+#include "core/cstr_table.h"
+#include "core/queue.h"
+#include "extended/binary_in_stream.h"
+#include "extended/binary_parser.h"
+#include "extended/genome_node.h"
+#include "extended/node_stream_api.h"
+
+struct GtBinaryInStream {
+  const GtNodeStream parent_instance;
+  GtStr *filename;
+  GtFile *fpin;
+  bool is_stdin,
+       file_is_open,
+       eof;
+  GtUint64 record_number;
+  GtQueue *genome_node_buffer;
+  GtBinaryParser *binary_parser;
+  GtCstrTable *used_types;
+};
+
+#define binary_in_stream_cast(NS)\
+        gt_node_stream_cast(gt_binary_in_stream_class(), NS)
+
+static int binary_in_stream_next(GtNodeStream *ns, GtGenomeNode **gn,
+                                 GtError *err)
+{
+  GtBinaryInStream *is = binary_in_stream_cast(ns);
+  int had_err = 0, status_code = EOF;
+  gt_error_check(err);
+
+  if (!is->eof && !gt_queue_size(is->genome_node_buffer)) {
+    if (!is->file_is_open) {
+      is->fpin = gt_file_xopen(is->is_stdin ? NULL : gt_str_get(is->filename),
+                               "r");
+      is->file_is_open = true;
+    }
+    had_err = gt_binary_parser_parse_genome_nodes(is->binary_parser,
+                                                  &status_code,
+                                                  is->genome_node_buffer,
+                                                  is->used_types,
+                                                  is->filename,
+                                                  &is->record_number,
+                                                  is->fpin, err);
+    if (had_err || status_code == EOF)
+      is->eof = true;
+  }
+  *gn = !had_err && gt_queue_size(is->genome_node_buffer)
+        ? gt_queue_get(is->genome_node_buffer)
+        : NULL;
+  return had_err;
+}
+
+static void binary_in_stream_free(GtNodeStream *ns)
+{
+  GtBinaryInStream *is = binary_in_stream_cast(ns);
+  while (gt_queue_size(is->genome_node_buffer))
+    gt_genome_node_delete(gt_queue_get(is->genome_node_buffer));
+  gt_queue_delete(is->genome_node_buffer);
+  gt_binary_parser_delete(is->binary_parser);
+  gt_cstr_table_delete(is->used_types);
+  gt_file_delete(is->fpin);
+  gt_str_delete(is->filename);
+}
+
+const GtNodeStreamClass* gt_binary_in_stream_class(void)
+{
+  static const GtNodeStreamClass *nsc = NULL;
+  gt_class_alloc_lock_enter();
+  if (!nsc) {
+    nsc = gt_node_stream_class_new(sizeof (GtBinaryInStream),
+                                   binary_in_stream_free,
+                                   binary_in_stream_next);
+  }
+  gt_class_alloc_lock_leave();
+  return nsc;
+}
+
+static GtNodeStream* binary_in_stream_new(const char *filename, bool sorted)
+{
+  GtNodeStream *ns = gt_node_stream_create(gt_binary_in_stream_class(),
+                                           sorted);
+  GtBinaryInStream *is = binary_in_stream_cast(ns);
+  is->filename = gt_str_new_cstr(filename ? filename : "stdin");
+  is->fpin = NULL;
+  is->is_stdin = filename == NULL;
+  is->file_is_open = false;
+  is->eof = false;
+  is->record_number = 0;
+  is->genome_node_buffer = gt_queue_new();
+  is->binary_parser = gt_binary_parser_new();
+  is->used_types = gt_cstr_table_new();
+  return ns;
+}
+
+GtNodeStream* gt_binary_in_stream_new(const char *filename)
+{
+  return binary_in_stream_new(filename, false);
+}
+
+GtNodeStream* gt_binary_in_stream_new_sorted(const char *filename)
+{
+  return binary_in_stream_new(filename, true);
+}
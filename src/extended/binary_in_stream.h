@@ -0,0 +1,40 @@
+/*
+  Copyright (c) 2026 agent <agent@local>
+
+  Permission to use, copy, modify, and distribute this software for any
+  purpose with or without fee is hereby granted, provided that the above
+  copyright notice and this permission notice appear in all copies.
+
+  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+
+#ifndef BINARY_IN_STREAM_H
+#define BINARY_IN_STREAM_H
+
+#include "extended/node_stream_api.h"
+
+/* Implements the <GtNodeStream> interface. A <GtBinaryInStream> reads the
+   genome nodes written by a <GtBinaryOutStream>. In contrast to parsing
+   GFF3, no IDs have to be resolved, because the parent-child relationships
+   are stored explicitly. */
+typedef struct GtBinaryInStream GtBinaryInStream;
+
+const GtNodeStreamClass* gt_binary_in_stream_class(void);
+
+/* Create a <GtBinaryInStream> which reads the binary file <filename>
+   (stdin, if <filename> is <NULL>). The nodes are delivered in the order in
+   which they were written, use a <GtGFF3InStream> if the sorting of the input
+   has to be checked. */
+GtNodeStream*            gt_binary_in_stream_new(const char *filename);
+/* Like <gt_binary_in_stream_new()>, but the returned stream is sorted. The
+   sorting is not checked, the binary file <filename> must have been written
+   from a sorted stream. */
+GtNodeStream*            gt_binary_in_stream_new_sorted(const char *filename);
+
+#endif
@@ -0,0 +1,623 @@
+/*
+  Copyright (c) 2026 agent <agent@local>
+
+  Permission to use, copy, modify, and distribute this software for any
+  purpose with or without fee is hereby granted, provided that the above
+  copyright notice and this permission notice appear in all copies.
+
+  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+
+#include <limits.h>
+#include <string.h>
+#include "core/array_api.h"
+#include "core/assert_api.h"
+#include "core/ma_api.h"
+#include "core/phase_api.h"
+#include "core/strand_api.h"
+#include "core/undef_api.h"
+#include "extended/binary_defines.h"
+#include "extended/binary_parser.h"
+#include "extended/comment_node_api.h"
+#include "extended/eof_node_api.h"
+#include "extended/feature_node_api.h"
+#include "extended/genome_node.h"
+#include "extended/meta_node_api.h"
+#include "extended/region_node_api.h"
+#include "extended/sequence_node_api.h"
+
+struct GtBinaryParser {
+  GtArray *strings; /* the interned strings as <GtStr*> */
+  GtStr *buffer;
+  bool header_read,
+       eof_emitted;
+};
+
+/* the file and position currently parsed, used for error messages. If <mem>
+   is not <NULL>, the bytes are read from <mem> up to <memend> instead of
+   <fpin>. */
+typedef struct {
+  GtFile *fpin;
+  const unsigned char *mem,
+                      *memend;
+  GtStr *filenamestr;
+  const char *filename;
+  GtUint64 record_number;
+} GtBinaryParserInput;
+
+GtBinaryParser* gt_binary_parser_new(void)
+{
+  GtBinaryParser *parser = gt_malloc(sizeof *parser);
+  parser->strings = gt_array_new(sizeof (GtStr*));
+  parser->buffer = gt_str_new();
+  parser->header_read = false;
+  parser->eof_emitted = false;
+  return parser;
+}
+
+bool gt_binary_parser_file_is_binary(GtFile *fpin)
+{
+  int cc = gt_file_xfgetc(fpin);
+  if (cc == EOF)
+    return false;
+  gt_file_unget_char(fpin, (char) cc);
+  /* GFF3 and GTF files never start with the first character of the magic */
+  return cc == GT_BINARY_MAGIC[0];
+}
+
+static int binary_parser_corrupt(GtBinaryParserInput *input,
+                                 GtError *err)
+{
+  gt_error_set(err, "corrupt record " GT_LLU " in binary file \"%s\"",
+               input->record_number, input->filename);
+  return -1;
+}
+
+static int binary_parser_read_byte(GtBinaryParserInput *input,
+                                   unsigned int *value, GtError *err)
+{
+  int cc;
+  if (input->mem != NULL)
+    cc = input->mem < input->memend ? (int) *input->mem++ : EOF;
+  else
+    cc = gt_file_xfgetc(input->fpin);
+  if (cc == EOF) {
+    gt_error_set(err, "unexpected end of binary file \"%s\" in record "
+                 GT_LLU, input->filename, input->record_number);
+    return -1;
+  }
+  *value = (unsigned int) (unsigned char) cc;
+  return 0;
+}
+
+static int binary_parser_read_uword(GtBinaryParserInput *input,
+                                    GtUword *value, GtError *err)
+{
+  unsigned int byte, shift = 0;
+  int had_err = 0;
+
+  *value = 0;
+  do {
+    had_err = binary_parser_read_byte(input, &byte, err);
+    if (!had_err && shift >= sizeof (GtUword) * CHAR_BIT)
+      had_err = binary_parser_corrupt(input, err);
+    if (!had_err) {
+      *value |= ((GtUword) (byte & 127U)) << shift;
+      shift += 7;
+    }
+  } while (!had_err && (byte & 128U));
+  return had_err;
+}
+
+static int binary_parser_read_string(GtBinaryParserInput *input,
+                                     GtStr *str, GtError *err)
+{
+  GtUword length, idx;
+  unsigned int byte;
+  int had_err;
+
+  gt_str_reset(str);
+  had_err = binary_parser_read_uword(input, &length, err);
+  for (idx = 0; !had_err && idx < length; idx++) {
+    had_err = binary_parser_read_byte(input, &byte, err);
+    if (!had_err && byte == 0)
+      had_err = binary_parser_corrupt(input, err);
+    if (!had_err)
+      gt_str_append_char(str, (char) byte);
+  }
+  return had_err;
+}
+
+static int binary_parser_read_interned(GtBinaryParser *parser,
+                                       GtBinaryParserInput *input,
+                                       GtStr **str, GtError *err)
+{
+  GtUword string_id;
+  int had_err = binary_parser_read_uword(input, &string_id, err);
+  if (!had_err && string_id >= gt_array_size(parser->strings))
+    had_err = binary_parser_corrupt(input, err);
+  if (!had_err)
+    *str = *(GtStr**) gt_array_get(parser->strings, string_id);
+  return had_err;
+}
+
+static int binary_parser_read_range(GtBinaryParserInput *input,
+                                    GtRange *range, GtError *err)
+{
+  GtUword length;
+  int had_err = binary_parser_read_uword(input, &range->start, err);
+  if (!had_err)
+    had_err = binary_parser_read_uword(input, &length, err);
+  if (!had_err && range->start + length < range->start)
+    had_err = binary_parser_corrupt(input, err);
+  if (!had_err)
+    range->end = range->start + length;
+  return had_err;
+}
+
+static int binary_parser_read_feature(GtBinaryParser *parser,
+                                      GtBinaryParserInput *input,
+                                      GtArray *nodes, GtArray *seqids,
+                                      GtArray *representatives,
+                                      GtCstrTable *used_types, GtError *err)
+{
+  GtStr *seqid, *source = NULL, *type = NULL;
+  GtGenomeNode *gn = NULL;
+  GtFeatureNode *fn;
+  GtUword representative = GT_UNDEF_UWORD, numofattributes, idx;
+  unsigned int flags, strand, phase;
+  GtRange range;
+  float score = 0.0;
+  int had_err;
+
+  had_err = binary_parser_read_byte(input, &flags, err);
+  if (!had_err)
+    had_err = binary_parser_read_interned(parser, input, &seqid, err);
+  if (!had_err && (flags & GT_BINARY_FEATURE_SOURCE))
+    had_err = binary_parser_read_interned(parser, input, &source, err);
+  if (!had_err && !(flags & GT_BINARY_FEATURE_PSEUDO))
+    had_err = binary_parser_read_interned(parser, input, &type, err);
+  if (!had_err)
+    had_err = binary_parser_read_range(input, &range, err);
+  if (!had_err)
+    had_err = binary_parser_read_byte(input, &strand, err);
+  if (!had_err)
+    had_err = binary_parser_read_byte(input, &phase, err);
+  if (!had_err && (strand >= (unsigned int) GT_NUM_OF_STRAND_TYPES ||
+                   phase > (unsigned int) GT_PHASE_UNDEFINED)) {
+    had_err = binary_parser_corrupt(input, err);
+  }
+  if (!had_err && (flags & GT_BINARY_FEATURE_SCORE)) {
+    char scorebuf[sizeof score];
+    unsigned int byte;
+    for (idx = 0; !had_err && idx < (GtUword) sizeof score; idx++) {
+      had_err = binary_parser_read_byte(input, &byte, err);
+      scorebuf[idx] = (char) byte;
+    }
+    if (!had_err)
+      memcpy(&score, scorebuf, sizeof score);
+  }
+  if (!had_err && (flags & GT_BINARY_FEATURE_MULTI) &&
+      !(flags & GT_BINARY_FEATURE_REPRESENTATIVE)) {
+    had_err = binary_parser_read_uword(input, &representative, err);
+    if (!had_err && representative >= gt_array_size(nodes))
+      had_err = binary_parser_corrupt(input, err);
+  }
+  if (!had_err)
+    had_err = binary_parser_read_uword(input, &numofattributes, err);
+
+  if (!had_err) {
+    if (flags & GT_BINARY_FEATURE_PSEUDO) {
+      gn = gt_feature_node_new_pseudo(seqid, range.start, range.end,
+                                      (GtStrand) strand);
+    }
+    else {
+      gn = gt_feature_node_new(seqid, gt_str_get(type), range.start,
+                               range.end, (GtStrand) strand);
+      if (!gt_cstr_table_get(used_types, gt_str_get(type)))
+        gt_cstr_table_add(used_types, gt_str_get(type));
+    }
+    gt_genome_node_set_origin(gn, input->filenamestr,
+                              (unsigned int) input->record_number);
+    fn = (GtFeatureNode*) gn;
+    if (source)
+      gt_feature_node_set_source(fn, source);
+    if (flags & GT_BINARY_FEATURE_SCORE)
+      gt_feature_node_set_score(fn, score);
+    gt_feature_node_set_phase(fn, (GtPhase) phase);
+    gt_array_add(nodes, gn);
+    gt_array_add(seqids, seqid);
+    if ((flags & GT_BINARY_FEATURE_MULTI) &&
+        (flags & GT_BINARY_FEATURE_REPRESENTATIVE)) {
+      representative = gt_array_size(nodes) - 1;
+    }
+    gt_array_add(representatives, representative);
+  }
+
+  for (idx = 0; !had_err && idx < numofattributes; idx++) {
+    GtStr *key;
+    had_err = binary_parser_read_interned(parser, input, &key, err);
+    if (!had_err)
+      had_err = binary_parser_read_string(input, parser->buffer, err);
+    if (!had_err && (!gt_str_length(key) || !gt_str_length(parser->buffer) ||
+                     gt_feature_node_get_attribute((GtFeatureNode*) gn,
+                                                   gt_str_get(key)))) {
+      had_err = binary_parser_corrupt(input, err);
+    }
+    if (!had_err) {
+      gt_feature_node_add_attribute((GtFeatureNode*) gn, gt_str_get(key),
+                                    gt_str_get(parser->buffer));
+    }
+  }
+  return had_err;
+}
+
+/* returns true if the parent-child <links> between <numofnodes> nodes contain
+   a cycle (including a link from a node to itself), which would make later
+   traversals of the feature graph loop forever */
+static bool binary_parser_links_have_cycle(const GtArray *links,
+                                           GtUword numofnodes)
+{
+  GtUword *indegree, *firstlink, *children, *stack, idx, numoflinks,
+          stacksize = 0, numofsorted = 0;
+
+  /* topological sort, the links are sorted by parent into <children> */
+  numoflinks = gt_array_size(links) / 2;
+  indegree = gt_calloc((size_t) numofnodes, sizeof (GtUword));
+  firstlink = gt_calloc((size_t) numofnodes + 1, sizeof (GtUword));
+  children = gt_malloc(sizeof (GtUword) * (numoflinks + 1));
+  stack = gt_malloc(sizeof (GtUword) * numofnodes);
+  for (idx = 0; idx < numoflinks; idx++) {
+    firstlink[*(GtUword*) gt_array_get(links, 2 * idx) + 1]++;
+    indegree[*(GtUword*) gt_array_get(links, 2 * idx + 1)]++;
+  }
+  for (idx = 0; idx < numofnodes; idx++)
+    firstlink[idx + 1] += firstlink[idx];
+  for (idx = 0; idx < numoflinks; idx++) {
+    GtUword parent = *(GtUword*) gt_array_get(links, 2 * idx);
+    children[firstlink[parent]++] = *(GtUword*) gt_array_get(links,
+                                                            2 * idx + 1);
+  }
+  /* <firstlink[parent]> now points behind the children of <parent> */
+  for (idx = numofnodes; idx > 0; idx--)
+    firstlink[idx] = firstlink[idx - 1];
+  firstlink[0] = 0;
+  for (idx = 0; idx < numofnodes; idx++) {
+    if (indegree[idx] == 0)
+      stack[stacksize++] = idx;
+  }
+  while (stacksize > 0) {
+    GtUword node = stack[--stacksize], link;
+    numofsorted++;
+    for (link = firstlink[node]; link < firstlink[node + 1]; link++) {
+      if (--indegree[children[link]] == 0)
+        stack[stacksize++] = children[link];
+    }
+  }
+  gt_free(indegree);
+  gt_free(firstlink);
+  gt_free(children);
+  gt_free(stack);
+  return numofsorted < numofnodes;
+}
+
+static int binary_parser_read_feature_tree(GtBinaryParser *parser,
+                                           GtBinaryParserInput *input,
+                                           GtGenomeNode **root,
+                                           GtCstrTable *used_types,
+                                           GtError *err)
+{
+  GtArray *nodes, *seqids, *representatives, *links;
+  GtUword numofnodes, numoflinks, idx;
+  bool *has_parent = NULL;
+  int had_err;
+
+  nodes = gt_array_new(sizeof (GtGenomeNode*));
+  seqids = gt_array_new(sizeof (GtStr*));
+  representatives = gt_array_new(sizeof (GtUword));
+  links = gt_array_new(sizeof (GtUword));
+
+  had_err = binary_parser_read_uword(input, &numofnodes, err);
+  if (!had_err && numofnodes == 0)
+    had_err = binary_parser_corrupt(input, err);
+  for (idx = 0; !had_err && idx < numofnodes; idx++) {
+    had_err = binary_parser_read_feature(parser, input, nodes, seqids,
+                                         representatives, used_types, err);
+  }
+  if (!had_err)
+    had_err = binary_parser_read_uword(input, &numoflinks, err);
+  if (!had_err)
+    has_parent = gt_calloc((size_t) numofnodes, sizeof (bool));
+
+  /* check the links before the first one is added, because afterwards the
+     nodes cannot be deleted separately anymore */
+  for (idx = 0; !had_err && idx < numoflinks; idx++) {
+    GtUword parent, child;
+    had_err = binary_parser_read_uword(input, &parent, err);
+    if (!had_err)
+      had_err = binary_parser_read_uword(input, &child, err);
+    if (!had_err &&
+        (parent >= numofnodes || child == 0 || child >= numofnodes ||
+         gt_feature_node_is_pseudo(*(GtFeatureNode**)
+                                   gt_array_get(nodes, child)) ||
+         *(GtStr**) gt_array_get(seqids, parent) !=
+         *(GtStr**) gt_array_get(seqids, child))) {
+      had_err = binary_parser_corrupt(input, err);
+    }
+    if (!had_err) {
+      /* in breadth first order, each node is first reached from a parent
+         with a smaller number */
+      if (parent < child)
+        has_parent[child] = true;
+      gt_array_add(links, parent);
+      gt_array_add(links, child);
+    }
+  }
+  for (idx = 1; !had_err && idx < numofnodes; idx++) {
+    if (!has_parent[idx])
+      had_err = binary_parser_corrupt(input, err);
+  }
+  if (!had_err && binary_parser_links_have_cycle(links, numofnodes))
+    had_err = binary_parser_corrupt(input, err);
+
+  if (!had_err) {
+    for (idx = 0; idx < numofnodes; idx++) {
+      GtUword representative = *(GtUword*) gt_array_get(representatives, idx);
+      if (representative == idx) {
+        gt_feature_node_make_multi_representative(*(GtFeatureNode**)
+                                                  gt_array_get(nodes, idx));
+      }
+    }
+    for (idx = 0; idx < numofnodes; idx++) {
+      GtUword representative = *(GtUword*) gt_array_get(representatives, idx);
+      if (representative != GT_UNDEF_UWORD && representative != idx) {
+        gt_feature_node_set_multi_representative(*(GtFeatureNode**)
+                                                 gt_array_get(nodes, idx),
+                                                 *(GtFeatureNode**)
+                                                 gt_array_get(nodes,
+                                                              representative));
+      }
+    }
+    /* reuse <has_parent> to mark the nodes already added as a child, each
+       further parent of a node needs its own reference (as in the GFF3
+       parser) */
+    memset(has_parent, 0, (size_t) numofnodes * sizeof (bool));
+    for (idx = 0; idx < gt_array_size(links); idx += 2) {
+      GtUword parent = *(GtUword*) gt_array_get(links, idx),
+              child = *(GtUword*) gt_array_get(links, idx + 1);
+      GtGenomeNode *child_node = *(GtGenomeNode**) gt_array_get(nodes, child);
+      if (has_parent[child])
+        child_node = gt_genome_node_ref(child_node);
+      has_parent[child] = true;
+      gt_feature_node_add_child(*(GtFeatureNode**) gt_array_get(nodes, parent),
+                                (GtFeatureNode*) child_node);
+    }
+    *root = *(GtGenomeNode**) gt_array_get_first(nodes);
+  }
+  else {
+    for (idx = 0; idx < gt_array_size(nodes); idx++)
+      gt_genome_node_delete(*(GtGenomeNode**) gt_array_get(nodes, idx));
+  }
+
+  gt_free(has_parent);
+  gt_array_delete(links);
+  gt_array_delete(representatives);
+  gt_array_delete(seqids);
+  gt_array_delete(nodes);
+  return had_err;
+}
+
+static int binary_parser_read_header(GtBinaryParserInput *input,
+                                     GtError *err)
+{
+  unsigned int byte;
+  int idx, had_err = 0;
+
+  for (idx = 0; !had_err && idx < GT_BINARY_MAGIC_LENGTH; idx++) {
+    had_err = binary_parser_read_byte(input, &byte, err);
+    if (!had_err && byte != (unsigned int) GT_BINARY_MAGIC[idx]) {
+      gt_error_set(err, "file \"%s\" is not in binary format",
+                   input->filename);
+      had_err = -1;
+    }
+  }
+  if (!had_err)
+    had_err = binary_parser_read_byte(input, &byte, err);
+  if (!had_err && byte != GT_BINARY_VERSION) {
+    gt_error_set(err, "binary file \"%s\" has unsupported format version %u "
+                 "(expected %u)", input->filename, byte, GT_BINARY_VERSION);
+    had_err = -1;
+  }
+  return had_err;
+}
+
+/* reads the next record which is not a string record, <gn> is set to NULL at
+   the end of the file */
+static int binary_parser_read_record(GtBinaryParser *parser,
+                                     GtBinaryParserInput *input,
+                                     GtGenomeNode **gn,
+                                     GtCstrTable *used_types, GtError *err)
+{
+  int cc, had_err = 0;
+  GtStr *seqid, *data;
+  GtRange range;
+  unsigned int has_data;
+
+  *gn = NULL;
+  while (!had_err && (cc = gt_file_xfgetc(input->fpin)) == GT_BINARY_TAG_STRING)
+  {
+    had_err = binary_parser_read_string(input, parser->buffer, err);
+    if (!had_err) {
+      GtStr *str = gt_str_clone(parser->buffer);
+      gt_array_add(parser->strings, str);
+    }
+  }
+  if (had_err || cc == EOF)
+    return had_err;
+
+  switch (cc) {
+    case GT_BINARY_TAG_FEATURE:
+      had_err = binary_parser_read_feature_tree(parser, input, gn, used_types,
+                                                err);
+      break;
+    case GT_BINARY_TAG_REGION:
+      had_err = binary_parser_read_interned(parser, input, &seqid, err);
+      if (!had_err)
+        had_err = binary_parser_read_range(input, &range, err);
+      if (!had_err)
+        *gn = gt_region_node_new(seqid, range.start, range.end);
+      break;
+    case GT_BINARY_TAG_COMMENT:
+      had_err = binary_parser_read_string(input, parser->buffer, err);
+      if (!had_err)
+        *gn = gt_comment_node_new(gt_str_get(parser->buffer));
+      break;
+    case GT_BINARY_TAG_META:
+      had_err = binary_parser_read_string(input, parser->buffer, err);
+      if (!had_err)
+        had_err = binary_parser_read_byte(input, &has_data, err);
+      if (!had_err) {
+        data = gt_str_new();
+        if (has_data)
+          had_err = binary_parser_read_string(input, data, err);
+        if (!had_err) {
+          *gn = gt_meta_node_new(gt_str_get(parser->buffer),
+                                 has_data ? gt_str_get(data) : NULL);
+        }
+        gt_str_delete(data);
+      }
+      break;
+    case GT_BINARY_TAG_SEQUENCE:
+      had_err = binary_parser_read_string(input, parser->buffer, err);
+      if (!had_err) {
+        data = gt_str_new();
+        had_err = binary_parser_read_string(input, data, err);
+        if (!had_err)
+          *gn = gt_sequence_node_new(gt_str_get(parser->buffer), data);
+        gt_str_delete(data);
+      }
+      break;
+    case GT_BINARY_TAG_EOF:
+      *gn = gt_eof_node_new();
+      parser->eof_emitted = true;
+      break;
+    default:
+      had_err = binary_parser_corrupt(input, err);
+  }
+  return had_err;
+}
+
+int gt_binary_parser_parse_genome_nodes(GtBinaryParser *parser,
+                                        int *status_code,
+                                        GtQueue *genome_nodes,
+                                        GtCstrTable *used_types,
+                                        GtStr *filenamestr,
+                                        GtUint64 *record_number,
+                                        GtFile *fpin, GtError *err)
+{
+  GtBinaryParserInput input;
+  GtGenomeNode *gn = NULL;
+  int had_err = 0;
+  gt_error_check(err);
+  gt_assert(parser && status_code && genome_nodes && used_types);
+
+  input.fpin = fpin;
+  input.mem = input.memend = NULL;
+  input.filenamestr = filenamestr;
+  input.filename = gt_str_get(filenamestr);
+  input.record_number = *record_number;
+
+  if (!parser->header_read) {
+    had_err = binary_parser_read_header(&input, err);
+    parser->header_read = true;
+  }
+  if (!had_err) {
+    input.record_number = ++(*record_number);
+    had_err = binary_parser_read_record(parser, &input, &gn, used_types, err);
+  }
+  if (!had_err) {
+    if (gn != NULL) {
+      gt_genome_node_set_origin(gn, filenamestr,
+                                (unsigned int) input.record_number);
+      gt_queue_add(genome_nodes, gn);
+    }
+    else if (!parser->eof_emitted) {
+      gn = gt_eof_node_new();
+      gt_genome_node_set_origin(gn, filenamestr,
+                                (unsigned int) input.record_number);
+      gt_queue_add(genome_nodes, gn);
+      parser->eof_emitted = true;
+    }
+  }
+  if (had_err) {
+    while (gt_queue_size(genome_nodes))
+      gt_genome_node_delete(gt_queue_get(genome_nodes));
+  }
+  *status_code = gt_queue_size(genome_nodes) ? 0 : EOF;
+  return had_err;
+}
+
+void gt_binary_parser_add_string(GtBinaryParser *parser, const char *cstr)
+{
+  GtStr *str;
+  gt_assert(parser && cstr);
+  str = gt_str_new_cstr(cstr);
+  gt_array_add(parser->strings, str);
+}
+
+int gt_binary_parser_decode_feature_tree(GtBinaryParser *parser,
+                                         GtGenomeNode **root,
+                                         const void *data, GtUword length,
+                                         GtStr *filenamestr,
+                                         GtUword record_number, GtError *err)
+{
+  GtBinaryParserInput input;
+  GtCstrTable *used_types;
+  int had_err;
+  gt_error_check(err);
+  gt_assert(parser && root && data && filenamestr);
+
+  input.fpin = NULL;
+  input.mem = data;
+  input.memend = input.mem + length;
+  input.filenamestr = filenamestr;
+  input.filename = gt_str_get(filenamestr);
+  input.record_number = (GtUint64) record_number;
+  used_types = gt_cstr_table_new();
+  *root = NULL;
+  had_err = binary_parser_read_feature_tree(parser, &input, root, used_types,
+                                            err);
+  if (!had_err && input.mem != input.memend) {
+    gt_genome_node_delete(*root);
+    *root = NULL;
+    had_err = binary_parser_corrupt(&input, err);
+  }
+  gt_cstr_table_delete(used_types);
+  return had_err;
+}
+
+void gt_binary_parser_reset(GtBinaryParser *parser)
+{
+  GtUword idx;
+  gt_assert(parser);
+  for (idx = 0; idx < gt_array_size(parser->strings); idx++)
+    gt_str_delete(*(GtStr**) gt_array_get(parser->strings, idx));
+  gt_array_reset(parser->strings);
+  parser->header_read = false;
+  parser->eof_emitted = false;
+}
+
+void gt_binary_parser_delete(GtBinaryParser *parser)
+{
+  if (!parser) return;
+  gt_binary_parser_reset(parser);
+  gt_array_delete(parser->strings);
+  gt_str_delete(parser->buffer);
+  gt_free(parser);
+}
@@ -0,0 +1,71 @@
+/*
+  Copyright (c) 2026 agent <agent@local>
+
+  Permission to use, copy, modify, and distribute this software for any
+  purpose with or without fee is hereby granted, provided that the above
+  copyright notice and this permission notice appear in all copies.
+
+  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+
+#ifndef BINARY_PARSER_H
+#define BINARY_PARSER_H
+
+#include "core/cstr_table_api.h"
+#include "core/file_api.h"
+#include "core/queue_api.h"
+#include "core/str_api.h"
+#include "extended/genome_node_api.h"
+
+/* A <GtBinaryParser> converts files in the binary format described in
+   extended/binary_defines.h back into <GtGenomeNode> objects. It is the
+   counterpart of the <GtBinaryVisitor>. */
+typedef struct GtBinaryParser GtBinaryParser;
+
+GtBinaryParser* gt_binary_parser_new(void);
+/* Return <true> if <fpin> (stdin, if <fpin> is <NULL>) starts with the magic
+   string of the binary format. Only the first character is consumed, it is
+   pushed back afterwards. */
+bool            gt_binary_parser_file_is_binary(GtFile *fpin);
+/* Parse the next genome node from <fpin> and add it to <genome_nodes>.
+   Like for the <GtGFF3Parser>, <status_code> is set to <EOF> if
+   <genome_nodes> is empty afterwards, to 0 otherwise. The types of the parsed
+   feature nodes are added to <used_types> and the record number is stored as
+   line number of the nodes in <record_number>. Returns 0 on success, -1 on
+   error (<err> is set). */
+int             gt_binary_parser_parse_genome_nodes(GtBinaryParser *parser,
+                                                    int *status_code,
+                                                    GtQueue *genome_nodes,
+                                                    GtCstrTable *used_types,
+                                                    GtStr *filenamestr,
+                                                    GtUint64 *record_number,
+                                                    GtFile *fpin,
+                                                    GtError *err);
+/* Intern <cstr> in <parser> as if a string record containing <cstr> had
+   been parsed. */
+void            gt_binary_parser_add_string(GtBinaryParser *parser,
+                                            const char *cstr);
+/* Decode the feature node tree stored in the <length> bytes at <data> (the
+   contents of a feature record without the tag byte, see
+   <gt_binary_visitor_encode_feature_tree()>) and store its root in <root>.
+   The strings referred to must have been added to <parser> before.
+   <filenamestr> and <record_number> are used as the origin of the nodes.
+   Returns 0 on success, -1 on error (<err> is set). */
+int             gt_binary_parser_decode_feature_tree(GtBinaryParser *parser,
+                                                     GtGenomeNode **root,
+                                                     const void *data,
+                                                     GtUword length,
+                                                     GtStr *filenamestr,
+                                                     GtUword record_number,
+                                                     GtError *err);
+/* Reset <parser> before the next file is parsed. */
+void            gt_binary_parser_reset(GtBinaryParser *parser);
+void            gt_binary_parser_delete(GtBinaryParser *parser);
+
+#endif
@@ -0,0 +1,377 @@
+/*
+  Copyright (c) 2026 agent <agent@local>
+
+  Permission to use, copy, modify, and distribute this software for any
+  purpose with or without fee is hereby granted, provided that the above
+  copyright notice and this permission notice appear in all copies.
+
+  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+
+#include <string.h>
+#include "core/array_api.h"
+#include "core/assert_api.h"
+#include "core/class_alloc_lock.h"
+#include "core/cstr_api.h"
+#include "core/hashmap_api.h"
+#include "core/ma_api.h"
+#include "core/str_api.h"
+#include "core/unused_api.h"
+#include "extended/binary_defines.h"
+#include "extended/binary_visitor.h"
+#include "extended/comment_node_api.h"
+#include "extended/feature_node.h"
+#include "extended/feature_node_iterator_api.h"
+#include "extended/meta_node_api.h"
+#include "extended/node_visitor_api.h"
+#include "extended/region_node_api.h"
+#include "extended/sequence_node_api.h"
+
+struct GtBinaryVisitor {
+  const GtNodeVisitor parent_instance;
+  bool header_written;
+  GtFile *outfp;
+  GtStr *recordbuf, /* the current record */
+        *stringbuf; /* the string records preceding the current record */
+  GtHashmap *string_ids;
+  GtArray *strings; /* the interned strings in the order of their numbers */
+};
+
+#define binary_visitor_cast(NV)\
+        gt_node_visitor_cast(gt_binary_visitor_class(), NV)
+
+static void binary_visitor_append_uword(GtStr *buf, GtUword value)
+{
+  while (value >= 128UL) {
+    gt_str_append_char(buf, (char) ((value & 127UL) | 128UL));
+    value >>= 7;
+  }
+  gt_str_append_char(buf, (char) value);
+}
+
+static void binary_visitor_append_string(GtStr *buf, const char *cstr,
+                                         GtUword length)
+{
+  binary_visitor_append_uword(buf, length);
+  gt_str_append_cstr_nt(buf, cstr, length);
+}
+
+GtUword gt_binary_visitor_intern_string(GtBinaryVisitor *bv, const char *cstr)
+{
+  GtUword *string_id;
+  gt_assert(bv && cstr);
+
+  if ((string_id = gt_hashmap_get(bv->string_ids, cstr)) == NULL) {
+    char *dup = gt_cstr_dup(cstr);
+    string_id = gt_malloc(sizeof *string_id);
+    *string_id = gt_array_size(bv->strings);
+    gt_hashmap_add(bv->string_ids, dup, string_id);
+    gt_array_add(bv->strings, dup);
+    gt_str_append_char(bv->stringbuf, GT_BINARY_TAG_STRING);
+    binary_visitor_append_string(bv->stringbuf, cstr, strlen(cstr));
+  }
+  return *string_id;
+}
+
+/* appends the number of the interned string <cstr> to the current record,
+   a string record is added if <cstr> has not been interned before */
+static void binary_visitor_append_interned(GtBinaryVisitor *bv,
+                                           const char *cstr)
+{
+  binary_visitor_append_uword(bv->recordbuf,
+                              gt_binary_visitor_intern_string(bv, cstr));
+}
+
+static void binary_visitor_write_record(GtBinaryVisitor *bv)
+{
+  if (!bv->header_written) {
+    char magic[] = GT_BINARY_MAGIC;
+    gt_file_xwrite(bv->outfp, magic, GT_BINARY_MAGIC_LENGTH);
+    gt_file_xfputc(GT_BINARY_VERSION, bv->outfp);
+    bv->header_written = true;
+  }
+  if (gt_str_length(bv->stringbuf) > 0) {
+    gt_file_xwrite(bv->outfp, gt_str_get_mem(bv->stringbuf),
+                   gt_str_length(bv->stringbuf));
+    gt_str_reset(bv->stringbuf);
+  }
+  gt_file_xwrite(bv->outfp, gt_str_get_mem(bv->recordbuf),
+                 gt_str_length(bv->recordbuf));
+  gt_str_reset(bv->recordbuf);
+}
+
+static void binary_visitor_append_attribute(const char *attr_name,
+                                            const char *attr_value, void *data)
+{
+  GtBinaryVisitor *bv = data;
+
+  binary_visitor_append_interned(bv, attr_name);
+  binary_visitor_append_string(bv->recordbuf, attr_value, strlen(attr_value));
+}
+
+static void binary_visitor_append_feature(GtBinaryVisitor *bv,
+                                          GtFeatureNode *fn,
+                                          GtHashmap *node_numbers)
+{
+  GtGenomeNode *gn = (GtGenomeNode*) fn;
+  GtRange range = gt_genome_node_get_range(gn);
+  GtFeatureNode *representative = NULL;
+  unsigned int flags = 0;
+  GtStrArray *attributes;
+
+  if (gt_feature_node_is_pseudo(fn))
+    flags |= GT_BINARY_FEATURE_PSEUDO;
+  if (gt_feature_node_score_is_defined(fn))
+    flags |= GT_BINARY_FEATURE_SCORE;
+  if (gt_feature_node_has_source(fn))
+    flags |= GT_BINARY_FEATURE_SOURCE;
+  if (gt_feature_node_is_multi(fn)) {
+    flags |= GT_BINARY_FEATURE_MULTI;
+    representative = gt_feature_node_get_multi_representative(fn);
+    /* a representative outside of the tree cannot be referred to */
+    if (representative == fn ||
+        !gt_hashmap_get(node_numbers, representative)) {
+      flags |= GT_BINARY_FEATURE_REPRESENTATIVE;
+    }
+  }
+  gt_str_append_char(bv->recordbuf, (char) flags);
+  binary_visitor_append_interned(bv,
+                                 gt_str_get(gt_genome_node_get_seqid(gn)));
+  if (flags & GT_BINARY_FEATURE_SOURCE)
+    binary_visitor_append_interned(bv, gt_feature_node_get_source(fn));
+  if (!(flags & GT_BINARY_FEATURE_PSEUDO))
+    binary_visitor_append_interned(bv, gt_feature_node_get_type(fn));
+  binary_visitor_append_uword(bv->recordbuf, range.start);
+  binary_visitor_append_uword(bv->recordbuf, range.end - range.start);
+  gt_str_append_char(bv->recordbuf, (char) gt_feature_node_get_strand(fn));
+  gt_str_append_char(bv->recordbuf, (char) gt_feature_node_get_phase(fn));
+  if (flags & GT_BINARY_FEATURE_SCORE) {
+    float score = gt_feature_node_get_score(fn);
+    gt_str_append_cstr_nt(bv->recordbuf, (const char*) &score,
+                          (GtUword) sizeof score);
+  }
+  if ((flags & GT_BINARY_FEATURE_MULTI) &&
+      !(flags & GT_BINARY_FEATURE_REPRESENTATIVE)) {
+    binary_visitor_append_uword(bv->recordbuf,
+                                *(GtUword*) gt_hashmap_get(node_numbers,
+                                                           representative));
+  }
+  attributes = gt_feature_node_get_attribute_list(fn);
+  binary_visitor_append_uword(bv->recordbuf, gt_str_array_size(attributes));
+  gt_str_array_delete(attributes);
+  gt_feature_node_foreach_attribute(fn, binary_visitor_append_attribute, bv);
+}
+
+/* appends the contents of a feature record for the tree rooted at <fn> to the
+   current record */
+static void binary_visitor_append_feature_tree(GtBinaryVisitor *bv,
+                                               GtFeatureNode *fn)
+{
+  GtHashmap *node_numbers;
+  GtArray *nodes, *links;
+  GtUword idx, *number;
+
+  /* number the nodes in breadth first order and collect the links */
+  node_numbers = gt_hashmap_new(GT_HASH_DIRECT, NULL, gt_free_func);
+  nodes = gt_array_new(sizeof (GtFeatureNode*));
+  links = gt_array_new(sizeof (GtUword));
+  number = gt_malloc(sizeof *number);
+  *number = 0;
+  gt_hashmap_add(node_numbers, fn, number);
+  gt_array_add(nodes, fn);
+  for (idx = 0; idx < gt_array_size(nodes); idx++) {
+    GtFeatureNode *parent = *(GtFeatureNode**) gt_array_get(nodes, idx),
+                  *child;
+    GtFeatureNodeIterator *fni = gt_feature_node_iterator_new_direct(parent);
+
+    while ((child = gt_feature_node_iterator_next(fni))) {
+      if (!(number = gt_hashmap_get(node_numbers, child))) {
+        number = gt_malloc(sizeof *number);
+        *number = gt_array_size(nodes);
+        gt_hashmap_add(node_numbers, child, number);
+        gt_array_add(nodes, child);
+      }
+      gt_array_add(links, idx);
+      gt_array_add(links, *number);
+    }
+    gt_feature_node_iterator_delete(fni);
+  }
+
+  binary_visitor_append_uword(bv->recordbuf, gt_array_size(nodes));
+  for (idx = 0; idx < gt_array_size(nodes); idx++) {
+    binary_visitor_append_feature(bv, *(GtFeatureNode**)
+                                      gt_array_get(nodes, idx), node_numbers);
+  }
+  binary_visitor_append_uword(bv->recordbuf, gt_array_size(links) / 2);
+  for (idx = 0; idx < gt_array_size(links); idx++) {
+    binary_visitor_append_uword(bv->recordbuf,
+                                *(GtUword*) gt_array_get(links, idx));
+  }
+
+  gt_array_delete(links);
+  gt_array_delete(nodes);
+  gt_hashmap_delete(node_numbers);
+}
+
+static int binary_visitor_feature_node(GtNodeVisitor *nv, GtFeatureNode *fn,
+                                       GT_UNUSED GtError *err)
+{
+  GtBinaryVisitor *bv;
+  gt_error_check(err);
+  bv = binary_visitor_cast(nv);
+  gt_str_append_char(bv->recordbuf, GT_BINARY_TAG_FEATURE);
+  binary_visitor_append_feature_tree(bv, fn);
+  binary_visitor_write_record(bv);
+  return 0;
+}
+
+const char* gt_binary_visitor_encode_feature_tree(GtBinaryVisitor *bv,
+                                                  GtFeatureNode *fn,
+                                                  GtUword *length)
+{
+  gt_assert(bv && fn && length);
+  gt_str_reset(bv->recordbuf);
+  binary_visitor_append_feature_tree(bv, fn);
+  /* the caller takes care of the strings */
+  gt_str_reset(bv->stringbuf);
+  *length = gt_str_length(bv->recordbuf);
+  return gt_str_get_mem(bv->recordbuf);
+}
+
+GtUword gt_binary_visitor_num_of_strings(const GtBinaryVisitor *bv)
+{
+  gt_assert(bv);
+  return gt_array_size(bv->strings);
+}
+
+const char* gt_binary_visitor_get_string(const GtBinaryVisitor *bv,
+                                         GtUword string_id)
+{
+  gt_assert(bv && string_id < gt_array_size(bv->strings));
+  return *(const char**) gt_array_get(bv->strings, string_id);
+}
+
+static int binary_visitor_region_node(GtNodeVisitor *nv, GtRegionNode *rn,
+                                      GT_UNUSED GtError *err)
+{
+  GtBinaryVisitor *bv;
+  GtRange range;
+  gt_error_check(err);
+  bv = binary_visitor_cast(nv);
+  range = gt_genome_node_get_range((GtGenomeNode*) rn);
+  gt_str_append_char(bv->recordbuf, GT_BINARY_TAG_REGION);
+  binary_visitor_append_interned(bv, gt_str_get(gt_genome_node_get_seqid(
+                                                       (GtGenomeNode*) rn)));
+  binary_visitor_append_uword(bv->recordbuf, range.start);
+  binary_visitor_append_uword(bv->recordbuf, range.end - range.start);
+  binary_visitor_write_record(bv);
+  return 0;
+}
+
+static int binary_visitor_comment_node(GtNodeVisitor *nv, GtCommentNode *cn,
+                                       GT_UNUSED GtError *err)
+{
+  GtBinaryVisitor *bv;
+  const char *comment;
+  gt_error_check(err);
+  bv = binary_visitor_cast(nv);
+  comment = gt_comment_node_get_comment(cn);
+  gt_str_append_char(bv->recordbuf, GT_BINARY_TAG_COMMENT);
+  binary_visitor_append_string(bv->recordbuf, comment, strlen(comment));
+  binary_visitor_write_record(bv);
+  return 0;
+}
+
+static int binary_visitor_meta_node(GtNodeVisitor *nv, GtMetaNode *mn,
+                                    GT_UNUSED GtError *err)
+{
+  GtBinaryVisitor *bv;
+  const char *directive, *data;
+  gt_error_check(err);
+  bv = binary_visitor_cast(nv);
+  directive = gt_meta_node_get_directive(mn);
+  data = gt_meta_node_get_data(mn);
+  gt_str_append_char(bv->recordbuf, GT_BINARY_TAG_META);
+  binary_visitor_append_string(bv->recordbuf, directive, strlen(directive));
+  gt_str_append_char(bv->recordbuf, data != NULL ? 1 : 0);
+  if (data != NULL)
+    binary_visitor_append_string(bv->recordbuf, data, strlen(data));
+  binary_visitor_write_record(bv);
+  return 0;
+}
+
+static int binary_visitor_sequence_node(GtNodeVisitor *nv, GtSequenceNode *sn,
+                                        GT_UNUSED GtError *err)
+{
+  GtBinaryVisitor *bv;
+  const char *description;
+  gt_error_check(err);
+  bv = binary_visitor_cast(nv);
+  description = gt_sequence_node_get_description(sn);
+  gt_str_append_char(bv->recordbuf, GT_BINARY_TAG_SEQUENCE);
+  binary_visitor_append_string(bv->recordbuf, description,
+                               strlen(description));
+  binary_visitor_append_string(bv->recordbuf,
+                               gt_sequence_node_get_sequence(sn),
+                               gt_sequence_node_get_sequence_length(sn));
+  binary_visitor_write_record(bv);
+  return 0;
+}
+
+static int binary_visitor_eof_node(GtNodeVisitor *nv, GT_UNUSED GtEOFNode *en,
+                                   GT_UNUSED GtError *err)
+{
+  GtBinaryVisitor *bv;
+  gt_error_check(err);
+  bv = binary_visitor_cast(nv);
+  gt_str_append_char(bv->recordbuf, GT_BINARY_TAG_EOF);
+  binary_visitor_write_record(bv);
+  return 0;
+}
+
+static void binary_visitor_free(GtNodeVisitor *nv)
+{
+  GtBinaryVisitor *bv = binary_visitor_cast(nv);
+  gt_str_delete(bv->recordbuf);
+  gt_str_delete(bv->stringbuf);
+  gt_hashmap_delete(bv->string_ids);
+  gt_array_delete(bv->strings);
+  gt_file_delete(bv->outfp);
+}
+
+const GtNodeVisitorClass* gt_binary_visitor_class(void)
+{
+  static GtNodeVisitorClass *nvc = NULL;
+  gt_class_alloc_lock_enter();
+  if (!nvc) {
+    nvc = gt_node_visitor_class_new(sizeof (GtBinaryVisitor),
+                                    binary_visitor_free,
+                                    binary_visitor_comment_node,
+                                    binary_visitor_feature_node,
+                                    binary_visitor_region_node,
+                                    binary_visitor_sequence_node,
+                                    binary_visitor_eof_node);
+    gt_node_visitor_class_set_meta_node_func(nvc, binary_visitor_meta_node);
+  }
+  gt_class_alloc_lock_leave();
+  return nvc;
+}
+
+GtNodeVisitor* gt_binary_visitor_new(GtFile *outfp)
+{
+  GtNodeVisitor *nv = gt_node_visitor_create(gt_binary_visitor_class());
+  GtBinaryVisitor *bv = binary_visitor_cast(nv);
+  bv->header_written = false;
+  bv->outfp = gt_file_ref(outfp);
+  bv->recordbuf = gt_str_new();
+  bv->stringbuf = gt_str_new();
+  bv->string_ids = gt_hashmap_new(GT_HASH_STRING, gt_free_func, gt_free_func);
+  bv->strings = gt_array_new(sizeof (char*));
+  return nv;
+}
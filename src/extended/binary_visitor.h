@@ -0,0 +1,58 @@
+/*
+  Copyright (c) 2026 agent <agent@local>
+
+  Permission to use, copy, modify, and distribute this software for any
+  purpose with or without fee is hereby granted, provided that the above
+  copyright notice and this permission notice appear in all copies.
+
+  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+
+#ifndef BINARY_VISITOR_H
+#define BINARY_VISITOR_H
+
+#include "core/file_api.h"
+#include "extended/feature_node_api.h"
+#include "extended/node_visitor.h"
+
+/* Implements the <GtNodeVisitor> interface. A <GtBinaryVisitor> writes the
+   nodes it visits in the binary format described in
+   extended/binary_defines.h. */
+typedef struct GtBinaryVisitor GtBinaryVisitor;
+
+const GtNodeVisitorClass* gt_binary_visitor_class(void);
+
+/* Create a <GtBinaryVisitor> writing to <outfp> (stdout, if <outfp> is
+   NULL). */
+GtNodeVisitor*            gt_binary_visitor_new(GtFile *outfp);
+
+/* Return the number of the interned string <cstr>, <cstr> is interned if
+   necessary. */
+GtUword                   gt_binary_visitor_intern_string(GtBinaryVisitor
+                                                          *binary_visitor,
+                                                          const char *cstr);
+/* Encode the feature node tree rooted at <feature_node> like the contents of
+   a feature record (without the tag byte) and return it, its length is stored
+   in <length>. Nothing is written, the strings interned on the way have to be
+   stored by the caller (see <gt_binary_visitor_get_string()>). The returned
+   memory is valid until the next call. */
+const char*               gt_binary_visitor_encode_feature_tree(
+                                                GtBinaryVisitor *binary_visitor,
+                                                GtFeatureNode *feature_node,
+                                                GtUword *length);
+/* Return the number of strings interned by <binary_visitor>. */
+GtUword                   gt_binary_visitor_num_of_strings(const
+                                                           GtBinaryVisitor
+                                                           *binary_visitor);
+/* Return the interned string with number <string_id>. */
+const char*               gt_binary_visitor_get_string(const GtBinaryVisitor
+                                                       *binary_visitor,
+                                                       GtUword string_id);
+
+#endif
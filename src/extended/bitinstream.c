@@ -63,9 +63,6 @@ GtBitInStream *gt_bitinstream_new(const char* path,
   bitstream->read_bits = 0;
   gt_bitinstream_reinit(bitstream,
                         offset);
-
-  bitstream->bufferlength = (bitstream->pages_to_map * bitstream->pagesize) /
-                            sizeof (*bitstream->bitseqbuffer);
   return bitstream;
 }
 
@@ -81,12 +78,16 @@ void gt_bitinstream_reinit(GtBitInStream *bitstream,
 
   gt_fa_xmunmap(bitstream->bitseqbuffer);
 
-  if (bitstream->cur_filepos + mapsize > bitstream->filesize) {
+  /* a previous mapping might have been the last one, so this has to be
+     recomputed for every new offset */
+  if (bitstream->cur_filepos + mapsize >= bitstream->filesize) {
     mapsize = bitstream->filesize - bitstream->cur_filepos;
-    bitstream->bufferlength = (GtUword)  mapsize /
-                                sizeof (*bitstream->bitseqbuffer);
     bitstream->last_chunk = true;
   }
+  else
+    bitstream->last_chunk = false;
+  bitstream->bufferlength = (GtUword) mapsize /
+                            sizeof (*bitstream->bitseqbuffer);
   bitstream->bitseqbuffer =
     gt_fa_xmmap_read_range(bitstream->path,
                            mapsize,
@@ -98,6 +99,22 @@ void gt_bitinstream_reinit(GtBitInStream *bitstream,
   bitstream->cur_bitseq = 0;
 }
 
+void gt_bitinstream_reinit_at_bit(GtBitInStream *bitstream,
+                                  GtUint64 bitpos)
+{
+  size_t byteoffset, pageoffset;
+
+  gt_assert(bitstream != NULL);
+  byteoffset = (size_t) (bitpos / GT_INTWORDSIZE) *
+               sizeof (*bitstream->bitseqbuffer);
+  pageoffset = byteoffset - byteoffset % bitstream->pagesize;
+  gt_bitinstream_reinit(bitstream, pageoffset);
+  bitstream->cur_bitseq = (GtUword) (byteoffset - pageoffset) /
+                          sizeof (*bitstream->bitseqbuffer);
+  gt_assert(bitstream->cur_bitseq < bitstream->bufferlength);
+  bitstream->cur_bit = (int) (bitpos % GT_INTWORDSIZE);
+}
+
 int gt_bitinstream_get_next_bit(GtBitInStream *bitstream,
                                 bool * bit)
 {
@@ -39,6 +39,12 @@ GtBitInStream* gt_bitinstream_new(const char *path,
 void           gt_bitinstream_reinit(GtBitInStream *bitstream,
                                      size_t offset);
 
+/* Tells <bitstream> to remap the file such that the next bit read is the bit
+   at absolute position <bitpos> in the file, counted in bits from the start of
+   the file. The file is expected to consist of <GtBitsequence> words. */
+void           gt_bitinstream_reinit_at_bit(GtBitInStream *bitstream,
+                                            GtUint64 bitpos);
+
 /* Reads one more bit and sets <bit> to the read value. Returns 0 if there are
    no more bits to read and 1 if successfully read one bit. */
 int            gt_bitinstream_get_next_bit(GtBitInStream *bitstream,
@@ -15,6 +15,7 @@
   OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
 */
 
+#include <limits.h>
 #include <sys/stat.h>
 #include <unistd.h>
 
@@ -84,6 +85,37 @@ void gt_bitoutstream_append_bittab(GtBitOutStream *bitstream,
   }
 }
 
+void gt_bitoutstream_append_bitsequences(GtBitOutStream *bitstream,
+                                         const GtBitsequence *bitsequences,
+                                         GtUword numofbits)
+{
+  gt_assert(bitstream != NULL);
+  for (/* Nothing */; numofbits >= (GtUword) GT_INTWORDSIZE;
+       numofbits -= GT_INTWORDSIZE) {
+    if (bitstream->bits_left == GT_INTWORDSIZE) {
+      gt_xfwrite(bitsequences, sizeof (GtBitsequence), (size_t) 1,
+                 bitstream->fp);
+    }
+    else {
+      if (bitstream->bits_left > 0)
+        bitstream->bitseqbuffer |= *bitsequences >>
+                                   (GT_INTWORDSIZE - bitstream->bits_left);
+      gt_xfwrite(&bitstream->bitseqbuffer,
+                 sizeof (GtBitsequence),
+                 (size_t) 1, bitstream->fp);
+      bitstream->bitseqbuffer = bitstream->bits_left > 0
+                                  ? *bitsequences << bitstream->bits_left
+                                  : *bitsequences;
+    }
+    bitstream->written_bits += GT_INTWORDSIZE;
+    bitsequences++;
+  }
+  if (numofbits > 0)
+    gt_bitoutstream_append(bitstream,
+                           *bitsequences >> (GT_INTWORDSIZE - numofbits),
+                           (unsigned) numofbits);
+}
+
 void gt_bitoutstream_flush(GtBitOutStream *bitstream)
 {
   gt_assert(bitstream);
@@ -98,13 +130,14 @@ void gt_bitoutstream_flush(GtBitOutStream *bitstream)
 void gt_bitoutstream_flush_advance(GtBitOutStream *bitstream)
 {
   GtWord fpos;
-  bool is_not_at_pageborder = (ftell(bitstream->fp) % bitstream->pagesize) != 0;
 
   gt_assert(bitstream);
 
+  /* the flush itself writes a word, so the page border has to be checked
+     afterwards */
   gt_bitoutstream_flush(bitstream);
 
-  if (is_not_at_pageborder) {
+  if ((ftell(bitstream->fp) % bitstream->pagesize) != 0) {
     fpos = (ftell(bitstream->fp) / bitstream->pagesize + 1) *
            bitstream->pagesize;
     gt_xfseek(bitstream->fp, fpos, SEEK_SET);
@@ -116,6 +149,13 @@ GtWord gt_bitoutstream_pos(const GtBitOutStream *bitstream)
   return ftell(bitstream->fp);
 }
 
+GtUint64 gt_bitoutstream_bitpos(const GtBitOutStream *bitstream)
+{
+  gt_assert(bitstream);
+  return (GtUint64) ftell(bitstream->fp) * CHAR_BIT +
+         (GtUint64) (GT_INTWORDSIZE - bitstream->bits_left);
+}
+
 void gt_bitoutstream_delete(GtBitOutStream *bitstream)
 {
   if (bitstream != NULL)
@@ -43,6 +43,14 @@ void            gt_bitoutstream_append(GtBitOutStream *bitstream,
 void            gt_bitoutstream_append_bittab(GtBitOutStream *bitstream,
                                               GtBittab *tab);
 
+/* Append the first <numofbits> bits of <bitsequences> to the file associated
+   with <bitstream>. The bits are expected to be stored beginning with the most
+   significant bit of the first element, as written by this class. */
+void            gt_bitoutstream_append_bitsequences(
+                                          GtBitOutStream *bitstream,
+                                          const GtBitsequence *bitsequences,
+                                          GtUword numofbits);
+
 /* Write all currently appended bitcodes to the file associated with
    <bitstream>. Possibly 'empty' bits in the current word will be set to zero
    and all non empty bits will be shifted to the most significant bits. */
@@ -57,6 +65,11 @@ void            gt_bitoutstream_flush_advance(GtBitOutStream *bitstream);
    error. */
 GtWord          gt_bitoutstream_pos(const GtBitOutStream *bitstream);
 
+/* Returns the position in bits of the next bit to be appended, counted from
+   the start of the file associated with <bitstream>. Unlike
+   <gt_bitoutstream_pos()> this does not require a flush. */
+GtUint64        gt_bitoutstream_bitpos(const GtBitOutStream *bitstream);
+
 void            gt_bitoutstream_delete(GtBitOutStream *bitstream);
 
 #endif
@@ -98,6 +98,8 @@ const GtNodeVisitorClass* gt_check_boundaries_visitor_class()
                                     NULL,
                                     NULL,
                                     NULL);
+    /* the trees are checked independently */
+    gt_node_visitor_class_set_thread_safe(nvc, true);
   }
   gt_class_alloc_lock_leave();
   return nvc;
@@ -1226,6 +1226,12 @@ GtAlphabet *gt_condenseq_alphabet(const GtCondenseq *condenseq)
   return gt_alphabet_ref(condenseq->alphabet);
 }
 
+const GtEncseq *gt_condenseq_unique_encseq(const GtCondenseq *condenseq)
+{
+  gt_assert(condenseq != NULL);
+  return condenseq->unique_es;
+}
+
 GtUword gt_condenseq_count_relevant_uniques(const GtCondenseq *condenseq,
                                             unsigned int min_align_len)
 {
@@ -195,6 +195,11 @@ const GtEditscript* gt_condenseq_link_editscript(const GtCondenseq *condenseq,
    <condenseq> are based. */
 GtAlphabet*         gt_condenseq_alphabet(const GtCondenseq *condenseq);
 
+/* Returns the <GtEncseq> containing the unique elements of <condenseq>, the
+   unique with id <uid> is the sequence with number <uid>. <condenseq> retains
+   ownership of the encseq. */
+const GtEncseq*     gt_condenseq_unique_encseq(const GtCondenseq *condenseq);
+
 /* Free space for <condenseq> */
 void                gt_condenseq_delete(GtCondenseq *condenseq);
 #endif
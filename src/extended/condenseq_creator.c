@@ -25,10 +25,13 @@
 #include "core/log_api.h"
 #include "core/logger.h"
 #include "core/ma_api.h"
+#include "core/minmax_api.h"
+#include "core/multithread_api.h"
 #include "core/range_api.h"
 #include "core/safearith_api.h"
 #include "core/showtime.h"
 #include "core/str_array.h"
+#include "core/thread_api.h"
 #include "core/undef_api.h"
 #include "core/unused_api.h"
 #include "extended/kmer_database.h"
@@ -43,6 +46,11 @@
 /* factor of deletable diagonals before they should be deleted */
 #define GT_DIAGS_CLEAN_LIMIT 20U
 
+/* minimal number of xdrop extensions for one seed to compute them in parallel,
+   and the number of extensions a thread takes at once */
+#define GT_CES_C_MIN_PARALLEL_XDROPS (GtUword) 16
+#define GT_CES_C_XDROPS_PER_TASK (GtUword) 4
+
 /* outputs distriputions of how many deletes and inserts and replacements happen
    */
 /* #define GT_CONDENSEQ_CREATOR_DIST_DEBUG */
@@ -281,6 +289,42 @@ typedef struct {
   GtWord            xdropscore;
 } GtCondenseqCreatorXdrop;
 
+/* extension of one candidate hit of the current seed, <xdrops> counts the
+   calls of the xdrop algorithm */
+typedef struct {
+  GtRange      subject_bounds;
+  GtXdropbest  left,
+               right;
+  GtUword      querypos,
+               subjectpos,
+               unique_id;
+  unsigned int xdrops;
+} CesCXdropJob;
+
+/* The candidate hits of the current seed. Their extensions are independent of
+   each other and are computed by <numofworkers> threads, each with its own
+   xdrop resources. The best link is then chosen in the order of the hits, so
+   the result does not depend on the number of threads. */
+typedef struct {
+  CesCXdropJob            *space;
+  GtCondenseqCreatorXdrop *workers;
+  GtMutex                 *mutex;
+  GtRange                  query_bounds;
+  GtUword                  allocated,
+                           nextfree,
+                           nextjob;
+  unsigned int             nextworker,
+                           numofworkers;
+} CesCXdropJobs;
+
+/* which candidates are skipped because an earlier better alignment already
+   covers them */
+typedef enum {
+  GT_CES_C_SKIP_NONE,
+  GT_CES_C_SKIP_COVERED,
+  GT_CES_C_SKIP_NOT_BEHIND
+} CesCSkip;
+
 /* circular storage for hits */
 typedef struct {
   GtKmerStartpos *pos_arrs;
@@ -306,6 +350,7 @@ struct GtCondenseqCreator {
                      *delete;
   gt_condenseq_creator_extend_fkt extend;
   GtCondenseqCreatorXdrop         xdrop;
+  CesCXdropJobs                   xdrop_jobs;
   GtCondenseqCreatorWindow        window;
   GtUword                         current_orig_start,
                                   current_seq_len,
@@ -440,6 +485,95 @@ static void ces_c_xdrop_init(GtXdropArbitraryscores *scores,
   xdrop->xdropscore = xdropscore;
 }
 
+static void ces_c_xdrop_delete(GtCondenseqCreatorXdrop *xdrop)
+{
+  gt_seqabstract_delete(xdrop->current_seq_bwd);
+  gt_seqabstract_delete(xdrop->current_seq_fwd);
+  gt_seqabstract_delete(xdrop->unique_seq_bwd);
+  gt_seqabstract_delete(xdrop->unique_seq_fwd);
+  gt_xdrop_resources_delete(xdrop->best_left_res);
+  gt_xdrop_resources_delete(xdrop->best_right_res);
+  gt_xdrop_resources_delete(xdrop->left_xdrop_res);
+  gt_xdrop_resources_delete(xdrop->right_xdrop_res);
+  gt_free(xdrop->left);
+  gt_free(xdrop->right);
+}
+
+/* sets the parts of the current sequence left and right of <querypos> */
+static void ces_c_xdrop_set_query(GtCondenseqCreatorXdrop *xdrop,
+                                  const GtEncseq *input_es,
+                                  GtUword querypos,
+                                  GtRange query_bounds)
+{
+  const bool forward = true;
+  if (query_bounds.start < querypos) {
+    gt_seqabstract_reinit_encseq(!forward,
+                                 GT_READMODE_FORWARD,
+                                 xdrop->current_seq_bwd,
+                                 input_es,
+                                 querypos - query_bounds.start,
+                                 query_bounds.start);
+  }
+  if (querypos < query_bounds.end) {
+    gt_seqabstract_reinit_encseq(forward,
+                                 GT_READMODE_FORWARD,
+                                 xdrop->current_seq_fwd,
+                                 input_es,
+                                 query_bounds.end - querypos,
+                                 querypos);
+  }
+}
+
+/* extends the hit at <i> (subject) and <j> (query) to both sides, the
+   current sequence has to be set for <j>. Returns the number of xdrop
+   calls. */
+static unsigned int ces_c_xdrop_extend(GtCondenseqCreatorXdrop *xdrop,
+                                       const GtEncseq *input_es,
+                                       GtUword i,
+                                       GtUword j,
+                                       GtRange query_bounds,
+                                       GtRange subject_bounds,
+                                       GtXdropbest *left_xdrop,
+                                       GtXdropbest *right_xdrop)
+{
+  unsigned int xdrops = 0;
+  const bool forward = true;
+
+  /* left xdrop */
+  if (query_bounds.start < j && subject_bounds.start < i) {
+    gt_seqabstract_reinit_encseq(!forward,
+                                 GT_READMODE_FORWARD,
+                                 xdrop->unique_seq_bwd,
+                                 input_es,
+                                 i - subject_bounds.start,
+                                 subject_bounds.start);
+    xdrops++;
+    gt_evalxdroparbitscoresextend(!forward,
+                                  left_xdrop,
+                                  xdrop->left_xdrop_res,
+                                  xdrop->unique_seq_bwd,
+                                  xdrop->current_seq_bwd,
+                                  xdrop->xdropscore);
+  }
+  /* right xdrop (i < subject_bounds.end by assertion) */
+  if (j < query_bounds.end) {
+    gt_seqabstract_reinit_encseq(forward,
+                                 GT_READMODE_FORWARD,
+                                 xdrop->unique_seq_fwd,
+                                 input_es,
+                                 subject_bounds.end - i,
+                                 i);
+    xdrops++;
+    gt_evalxdroparbitscoresextend(forward,
+                                  right_xdrop,
+                                  xdrop->right_xdrop_res,
+                                  xdrop->unique_seq_fwd,
+                                  xdrop->current_seq_fwd,
+                                  xdrop->xdropscore);
+  }
+  return xdrops;
+}
+
 #define GT_CES_LENCHECK(TO_STORE)                                           \
   do {                                                                      \
     if ((TO_STORE) > CES_UNSIGNED_MAX) {                                    \
@@ -468,43 +602,13 @@ static int ces_c_xdrop(GtCondenseqCreator *ces_c,
   int had_err = 0;
   GtXdropbest left_xdrop = {0,0,0,0,0}, right_xdrop = {0,0,0,0,0};
   GtCondenseqCreatorXdrop *xdrop = &ces_c->xdrop;
-  const bool forward = true;
 
   gt_assert(subject_bounds.start <= i);
   gt_assert(i + ces_c->kmersize - 1 < subject_bounds.end);
 
-  /* left xdrop */
-  if (query_bounds.start < j && subject_bounds.start < i) {
-    gt_seqabstract_reinit_encseq(!forward,
-                                 GT_READMODE_FORWARD,
-                                 xdrop->unique_seq_bwd,
-                                 ces_c->input_es,
-                                 i - subject_bounds.start,
-                                 subject_bounds.start);
-    ces_c_xdrops++;
-    gt_evalxdroparbitscoresextend(!forward,
-                                  &left_xdrop,
-                                  xdrop->left_xdrop_res,
-                                  xdrop->unique_seq_bwd,
-                                  xdrop->current_seq_bwd,
-                                  xdrop->xdropscore);
-  }
-  /* right xdrop (i < subject_bounds.end by assertion) */
-  if (j < query_bounds.end) {
-    gt_seqabstract_reinit_encseq(forward,
-                                 GT_READMODE_FORWARD,
-                                 xdrop->unique_seq_fwd,
-                                 ces_c->input_es,
-                                 subject_bounds.end - i,
-                                 i);
-    ces_c_xdrops++;
-    gt_evalxdroparbitscoresextend(forward,
-                                  &right_xdrop,
-                                  xdrop->right_xdrop_res,
-                                  xdrop->unique_seq_fwd,
-                                  xdrop->current_seq_fwd,
-                                  xdrop->xdropscore);
-  }
+  ces_c_xdrops += ces_c_xdrop_extend(xdrop, ces_c->input_es, i, j,
+                                     query_bounds, subject_bounds,
+                                     &left_xdrop, &right_xdrop);
 
   /* ivalue corresponds to length of alignment in unique_seq (match) and jvalue
      to length of alignment in current_seq (seed) */
@@ -547,6 +651,157 @@ static int ces_c_xdrop(GtCondenseqCreator *ces_c,
   return had_err;
 }
 
+static void ces_c_xdrop_jobs_add(GtCondenseqCreator *ces_c,
+                                 GtUword subjectpos,
+                                 GtUword querypos,
+                                 GtRange subject_bounds,
+                                 GtUword unique_id)
+{
+  CesCXdropJobs *jobs = &ces_c->xdrop_jobs;
+  CesCXdropJob *job;
+  if (jobs->nextfree == jobs->allocated) {
+    jobs->allocated += jobs->allocated / 2 + 16;
+    jobs->space = gt_realloc(jobs->space,
+                             (size_t) jobs->allocated * sizeof (*jobs->space));
+  }
+  job = jobs->space + jobs->nextfree++;
+  job->subjectpos = subjectpos;
+  job->querypos = querypos;
+  job->subject_bounds = subject_bounds;
+  job->unique_id = unique_id;
+}
+
+static void *ces_c_xdrop_jobs_thread(void *data)
+{
+  GtCondenseqCreator *ces_c = (GtCondenseqCreator*) data;
+  CesCXdropJobs *jobs = &ces_c->xdrop_jobs;
+  GtCondenseqCreatorXdrop *xdrop;
+  GtUword idx, end;
+
+  gt_mutex_lock(jobs->mutex);
+  gt_assert(jobs->nextworker < jobs->numofworkers);
+  xdrop = jobs->workers + jobs->nextworker++;
+  gt_mutex_unlock(jobs->mutex);
+  while (true) {
+    gt_mutex_lock(jobs->mutex);
+    idx = jobs->nextjob;
+    end = GT_MIN(idx + GT_CES_C_XDROPS_PER_TASK, jobs->nextfree);
+    jobs->nextjob = end;
+    gt_mutex_unlock(jobs->mutex);
+    if (idx == end)
+      break;
+    for (/* nothing */; idx < end; idx++) {
+      CesCXdropJob *job = jobs->space + idx;
+      GtXdropbest empty = {0,0,0,0,0};
+      job->left = job->right = empty;
+      ces_c_xdrop_set_query(xdrop, ces_c->input_es, job->querypos,
+                            jobs->query_bounds);
+      job->xdrops = ces_c_xdrop_extend(xdrop, ces_c->input_es,
+                                       job->subjectpos, job->querypos,
+                                       jobs->query_bounds,
+                                       job->subject_bounds,
+                                       &job->left, &job->right);
+      gt_xdrop_resources_reset(xdrop->left_xdrop_res);
+      gt_xdrop_resources_reset(xdrop->right_xdrop_res);
+    }
+  }
+  return NULL;
+}
+
+static inline bool ces_c_xdrop_job_skip(const CesCXdropJob *job,
+                                        CesCSkip skip,
+                                        GtUword best_match,
+                                        GtUword best_ivalue)
+{
+  if (best_match == GT_UNDEF_UWORD)
+    return false;
+  switch (skip) {
+    case GT_CES_C_SKIP_COVERED:
+      return job->subjectpos < best_match + best_ivalue;
+    case GT_CES_C_SKIP_NOT_BEHIND:
+      return job->subjectpos <= best_match + best_ivalue;
+    default:
+      return false;
+  }
+}
+
+/* Extends the collected candidate hits in their order and stores the best
+   alignment in <best_link>. Candidates <skip>ped by the best alignment found
+   before them are ignored. With more than one thread all extensions are
+   computed in parallel first, then the best one is selected in the same
+   order and extended again to keep its backtracking information. */
+static int ces_c_xdrop_jobs_run(GtCondenseqCreator *ces_c,
+                                GtRange query_bounds,
+                                CesCSkip skip,
+                                GtCondenseqLink *best_link,
+                                GtError *err)
+{
+  int had_err = 0;
+  CesCXdropJobs *jobs = &ces_c->xdrop_jobs;
+  GtCondenseqCreatorXdrop *xdrop = &ces_c->xdrop;
+  CesCXdropJob *best = NULL;
+  GtUword idx,
+          best_match = GT_UNDEF_UWORD;
+  GtXdropbest empty = {0,0,0,0,0};
+
+  *xdrop->left = empty;
+  *xdrop->right = empty;
+
+  if (jobs->numofworkers > 1U &&
+      jobs->nextfree >= GT_CES_C_MIN_PARALLEL_XDROPS) {
+    GtUword best_ivalue = 0;
+    GtXdropscore best_score = 0;
+    jobs->query_bounds = query_bounds;
+    jobs->nextjob = 0;
+    jobs->nextworker = 0;
+    had_err = gt_multithread(ces_c_xdrop_jobs_thread, ces_c, err);
+    for (idx = 0; !had_err && idx < jobs->nextfree; idx++) {
+      CesCXdropJob *job = jobs->space + idx;
+      ces_c_xdrops += job->xdrops;
+      if (!ces_c_xdrop_job_skip(job, skip, best_match, best_ivalue) &&
+          job->left.jvalue + job->right.jvalue >= ces_c->min_align_len &&
+          job->left.score + job->right.score > best_score) {
+        best = job;
+        best_match = job->subjectpos;
+        best_ivalue = job->right.ivalue;
+        best_score = job->left.score + job->right.score;
+      }
+    }
+    if (!had_err && best != NULL) {
+      best_match = GT_UNDEF_UWORD;
+      ces_c_xdrop_set_query(xdrop, ces_c->input_es, best->querypos,
+                            query_bounds);
+      had_err = ces_c_xdrop(ces_c,
+                            best->subjectpos, best->querypos,
+                            query_bounds,
+                            best->subject_bounds,
+                            best->unique_id,
+                            best_link,
+                            &best_match,
+                            err);
+    }
+  }
+  else {
+    for (idx = 0; !had_err && idx < jobs->nextfree; idx++) {
+      CesCXdropJob *job = jobs->space + idx;
+      if (!ces_c_xdrop_job_skip(job, skip, best_match, xdrop->right->ivalue)) {
+        ces_c_xdrop_set_query(xdrop, ces_c->input_es, job->querypos,
+                              query_bounds);
+        had_err = ces_c_xdrop(ces_c,
+                              job->subjectpos, job->querypos,
+                              query_bounds,
+                              job->subject_bounds,
+                              job->unique_id,
+                              best_link,
+                              &best_match,
+                              err);
+      }
+    }
+  }
+  jobs->nextfree = 0;
+  return had_err;
+}
+
 #define GT_CONDENSEQ_CREATOR_WINDOWIDX(WIN,N) (WIN->next + N < WIN->count ? \
                                               WIN->next + N :              \
                                               WIN->next + N - WIN->count)
@@ -579,20 +834,13 @@ static int ces_c_extend_seeds_window(GtCondenseqCreator *ces_c,
           subject_bounds;
   GtKmerStartpos match_positions;
   GtCondenseqCreatorWindow *win = &ces_c->window;
-  GtCondenseqCreatorXdrop *xdrop = &ces_c->xdrop;
-  GtUword best_match = GT_UNDEF_UWORD,
-          idx_cur,
+  GtUword idx_cur,
           querypos = ces_c->main_pos - ces_c->windowsize + 1;
   const unsigned int max_win_idx = ces_c->windowsize - 1;
   unsigned int idx_win;
-  GtXdropbest empty = {0,0,0,0,0};
-  const bool forward = true;
   subject_bounds.end =
     subject_bounds.start = 0;
 
-  *xdrop->left = empty;
-  *xdrop->right = empty;
-
   match_positions = win->pos_arrs[GT_CONDENSEQ_CREATOR_WINDOWIDX(win, 0)];
 
   /* nothing there or window not full */
@@ -618,23 +866,6 @@ static int ces_c_extend_seeds_window(GtCondenseqCreator *ces_c,
     for (idx_win = 0; idx_win <= max_win_idx; idx_win++) {
       win->idxs[idx_win] = 0;
     }
-
-    if (query_bounds.start < querypos) {
-      gt_seqabstract_reinit_encseq(!forward,
-                                   GT_READMODE_FORWARD,
-                                   xdrop->current_seq_bwd,
-                                   ces_c->input_es,
-                                   querypos - query_bounds.start,
-                                   query_bounds.start);
-    }
-    if (querypos < query_bounds.end) {
-      gt_seqabstract_reinit_encseq(forward,
-                                   GT_READMODE_FORWARD,
-                                   xdrop->current_seq_fwd,
-                                   ces_c->input_es,
-                                   query_bounds.end - querypos,
-                                   querypos);
-    }
   }
 
   /* iterate over all known match_positions of left kmer */
@@ -654,53 +885,45 @@ static int ces_c_extend_seeds_window(GtCondenseqCreator *ces_c,
       gt_assert(subject_bounds.start <= subjectpos &&
                 subjectpos + ces_c->kmersize <= subject_bounds.end);
     }
-    /* check if new position is already covered by current best alignment */
-    if (best_match == GT_UNDEF_UWORD ||
-        /* ivalue is a length (within unique) -> best + ivalue is outside of
-           best alignment */
-        subjectpos >= best_match + xdrop->right->ivalue) {
-      /* start with search for right hit at end of window */
-      for (idx_win = ces_c->windowsize - 1;
-           !had_err && !found && idx_win >= ces_c->kmersize;
-           idx_win--) {
-        GtKmerStartpos j_primes;
-        j_primes.startpos =
-          win->pos_arrs[GT_CONDENSEQ_CREATOR_WINDOWIDX(win, idx_win)].startpos;
-        j_primes.no_positions =
-          win->pos_arrs[GT_CONDENSEQ_CREATOR_WINDOWIDX(win,
-                                                       idx_win)].no_positions;
-        /* If 0, there are no known match_positions for kmer at this window
-           position. */
-        if (j_primes.no_positions != 0) {
-          GtUword j_prime_idx = win->idxs[idx_win],
-                  j_prime = j_primes.startpos[j_prime_idx];
-          /* advance to at least the window */
-          while (j_prime_idx < j_primes.no_positions &&
-                 subjectpos + ces_c->kmersize - 1 > j_prime) {
-            j_prime_idx++;
-            j_prime = j_primes.startpos[j_prime_idx];
-          }
-          /* hit within window? */
-          if (j_prime_idx < j_primes.no_positions &&
-              subjectpos + ces_c->windowsize > j_prime) {
-            found = true;
-            had_err = ces_c_xdrop(ces_c,
-                                  subjectpos, querypos,
-                                  query_bounds,
-                                  subject_bounds,
-                                  new_uid,
-                                  best_link,
-                                  &best_match,
-                                  err);
-          }
-          /* within each position array, remember last highest position, start
-             there, because subjectpos increases each iteration */
-          win->idxs[idx_win] = j_prime_idx;
+    /* start with search for right hit at end of window, positions covered by
+       a better alignment are skipped when the candidates are extended */
+    for (idx_win = ces_c->windowsize - 1;
+         !found && idx_win >= ces_c->kmersize;
+         idx_win--) {
+      GtKmerStartpos j_primes;
+      j_primes.startpos =
+        win->pos_arrs[GT_CONDENSEQ_CREATOR_WINDOWIDX(win, idx_win)].startpos;
+      j_primes.no_positions =
+        win->pos_arrs[GT_CONDENSEQ_CREATOR_WINDOWIDX(win,
+                                                     idx_win)].no_positions;
+      /* If 0, there are no known match_positions for kmer at this window
+         position. */
+      if (j_primes.no_positions != 0) {
+        GtUword j_prime_idx = win->idxs[idx_win],
+                j_prime = j_primes.startpos[j_prime_idx];
+        /* advance to at least the window */
+        while (j_prime_idx < j_primes.no_positions &&
+               subjectpos + ces_c->kmersize - 1 > j_prime) {
+          j_prime_idx++;
+          j_prime = j_primes.startpos[j_prime_idx];
+        }
+        /* hit within window? */
+        if (j_prime_idx < j_primes.no_positions &&
+            subjectpos + ces_c->windowsize > j_prime) {
+          found = true;
+          ces_c_xdrop_jobs_add(ces_c, subjectpos, querypos, subject_bounds,
+                               new_uid);
         }
+        /* within each position array, remember last highest position, start
+           there, because subjectpos increases each iteration */
+        win->idxs[idx_win] = j_prime_idx;
       }
     }
   }
 
+  if (!had_err)
+    had_err = ces_c_xdrop_jobs_run(ces_c, query_bounds, GT_CES_C_SKIP_COVERED,
+                                   best_link, err);
   if (!had_err) {
     if (best_link->len < ces_c->min_align_len)
       best_link->len = 0;
@@ -721,15 +944,8 @@ static int ces_c_extend_seeds_brute_force(GtCondenseqCreator *ces_c,
           subject_bounds;
   GtKmerStartpos match_positions;
   GtCondenseqCreatorWindow *win = &ces_c->window;
-  GtCondenseqCreatorXdrop *xdrop = &ces_c->xdrop;
-  GtUword best_match = GT_UNDEF_UWORD,
-          idx_cur,
+  GtUword idx_cur,
           querypos = ces_c->main_pos;
-  const bool forward = true;
-  GtXdropbest empty = {0,0,0,0,0};
-
-  *xdrop->left = empty;
-  *xdrop->right = empty;
 
   subject_bounds.end =
     subject_bounds.start = 0;
@@ -743,26 +959,7 @@ static int ces_c_extend_seeds_brute_force(GtCondenseqCreator *ces_c,
   query_bounds.start = ces_c->current_orig_start;
   query_bounds.end = ces_c->current_seq_start + ces_c->current_seq_len;
 
-  if (query_bounds.start < querypos) {
-    gt_seqabstract_reinit_encseq(!forward,
-                                 GT_READMODE_FORWARD,
-                                 xdrop->current_seq_bwd,
-                                 ces_c->input_es,
-                                 querypos - query_bounds.start,
-                                 query_bounds.start);
-  }
-  if (querypos < query_bounds.end) {
-    gt_seqabstract_reinit_encseq(forward,
-                                 GT_READMODE_FORWARD,
-                                 xdrop->current_seq_fwd,
-                                 ces_c->input_es,
-                                 query_bounds.end - querypos,
-                                 querypos);
-  }
-
-  for (idx_cur = 0;
-       !had_err && idx_cur < match_positions.no_positions;
-       ++idx_cur) {
+  for (idx_cur = 0; idx_cur < match_positions.no_positions; ++idx_cur) {
     GtUword subjectpos = match_positions.startpos[idx_cur],
             new_id = match_positions.unique_ids[idx_cur];
     if (subject_bounds.end < subjectpos || subject_bounds.end == 0) {
@@ -773,16 +970,11 @@ static int ces_c_extend_seeds_brute_force(GtCondenseqCreator *ces_c,
       gt_assert(subject_bounds.start <= subjectpos &&
                 subjectpos + ces_c->kmersize <= subject_bounds.end);
     }
-    had_err = ces_c_xdrop(ces_c,
-                          subjectpos, querypos,
-                          query_bounds,
-                          subject_bounds,
-                          new_id,
-                          best_link,
-                          &best_match,
-                          err);
+    ces_c_xdrop_jobs_add(ces_c, subjectpos, querypos, subject_bounds, new_id);
   }
 
+  had_err = ces_c_xdrop_jobs_run(ces_c, query_bounds, GT_CES_C_SKIP_NONE,
+                                 best_link, err);
   if (!had_err) {
     if (best_link->len < ces_c->min_align_len)
       best_link->len = 0;
@@ -803,15 +995,8 @@ static int ces_c_extend_seeds_diags(GtCondenseqCreator *ces_c,
           subject_bounds = {0,0};
   GtKmerStartpos subject_positions;
   GtCondenseqCreatorWindow *win = &ces_c->window;
-  GtCondenseqCreatorXdrop *xdrop = &ces_c->xdrop;
   CesCDiags *diags = ces_c->diagonals;
-  GtUword best_match = GT_UNDEF_UWORD,
-          subject_idx, querypos;
-  GtXdropbest empty = {0,0,0,0,0};
-  const bool forward = true;
-
-  *xdrop->left = empty;
-  *xdrop->right = empty;
+  GtUword subject_idx, querypos;
 
   subject_bounds.end = 0;
 
@@ -836,7 +1021,7 @@ static int ces_c_extend_seeds_diags(GtCondenseqCreator *ces_c,
 #endif
 
   for (subject_idx = 0;
-       !had_err && subject_idx < subject_positions.no_positions;
+       subject_idx < subject_positions.no_positions;
        ++subject_idx) {
     GtUword d,
             subjectpos = subject_positions.startpos[subject_idx],
@@ -880,39 +1065,16 @@ static int ces_c_extend_seeds_diags(GtCondenseqCreator *ces_c,
         gt_assert(i_prime <= query_bounds.end);
 
         /* subjectpos and j_prime are from the same unique sequences.
-           j' position has to be outside of the current best alignment. (only
-           checks for '>' because the previous querypos was smaller) */
-        if (best_match == GT_UNDEF_UWORD ||
-            j_prime > best_match + xdrop->right->ivalue) {
-          if (query_bounds.start < i_prime) {
-            gt_seqabstract_reinit_encseq(!forward,
-                                         GT_READMODE_FORWARD,
-                                         xdrop->current_seq_bwd,
-                                         ces_c->input_es,
-                                         i_prime - query_bounds.start,
-                                         query_bounds.start);
-          }
-          if (i_prime < query_bounds.end) {
-            gt_seqabstract_reinit_encseq(forward,
-                                         GT_READMODE_FORWARD,
-                                         xdrop->current_seq_fwd,
-                                         ces_c->input_es,
-                                         query_bounds.end - i_prime,
-                                         i_prime);
-          }
-          had_err = ces_c_xdrop(ces_c,
-                                j_prime, i_prime,
-                                query_bounds,
-                                subject_bounds,
-                                new_id,
-                                best_link,
-                                &best_match,
-                                err);
-        }
+           j' position has to be outside of the current best alignment, this
+           is checked when the candidates are extended. (only checks for '>'
+           because the previous querypos was smaller) */
+        ces_c_xdrop_jobs_add(ces_c, j_prime, i_prime, subject_bounds, new_id);
       }
     }
     ces_c_diags_set(ces_c, d, subjectpos, subject_bounds.start, overwrite_diag);
   }
+  had_err = ces_c_xdrop_jobs_run(ces_c, query_bounds, GT_CES_C_SKIP_NOT_BEHIND,
+                                 best_link, err);
 
 #ifdef GT_CONDENSEQ_CREATOR_DIAGS_DEBUG
   if (diags->full != NULL) {
@@ -1013,6 +1175,20 @@ GtCondenseqCreator *gt_condenseq_creator_new(GtUword initsize,
   ces_c->extend = ces_c_extend_seeds_diags;
 
   ces_c_xdrop_init(scores, xdropscore, &ces_c->xdrop);
+  ces_c->xdrop_jobs.space = NULL;
+  ces_c->xdrop_jobs.allocated = 0;
+  ces_c->xdrop_jobs.nextfree = 0;
+  ces_c->xdrop_jobs.numofworkers = gt_jobs;
+  ces_c->xdrop_jobs.workers = NULL;
+  ces_c->xdrop_jobs.mutex = NULL;
+  if (gt_jobs > 1U) {
+    unsigned int idx;
+    ces_c->xdrop_jobs.workers =
+      gt_malloc(sizeof (*ces_c->xdrop_jobs.workers) * gt_jobs);
+    for (idx = 0; idx < gt_jobs; idx++)
+      ces_c_xdrop_init(scores, xdropscore, ces_c->xdrop_jobs.workers + idx);
+    ces_c->xdrop_jobs.mutex = gt_mutex_new();
+  }
   ces_c->window.idxs = gt_calloc((size_t) windowsize,
                                  sizeof (*ces_c->window.idxs));
   ces_c->window.pos_arrs = gt_calloc((size_t) windowsize,
@@ -1147,16 +1323,15 @@ void gt_condenseq_creator_delete(GtCondenseqCreator *condenseq_creator)
     gt_free(condenseq_creator->window.idxs);
     gt_free(condenseq_creator->window.pos_arrs);
     gt_kmer_database_delete(condenseq_creator->kmer_db);
-    gt_seqabstract_delete(condenseq_creator->xdrop.current_seq_bwd);
-    gt_seqabstract_delete(condenseq_creator->xdrop.current_seq_fwd);
-    gt_seqabstract_delete(condenseq_creator->xdrop.unique_seq_bwd);
-    gt_seqabstract_delete(condenseq_creator->xdrop.unique_seq_fwd);
-    gt_xdrop_resources_delete(condenseq_creator->xdrop.best_left_res);
-    gt_xdrop_resources_delete(condenseq_creator->xdrop.best_right_res);
-    gt_xdrop_resources_delete(condenseq_creator->xdrop.left_xdrop_res);
-    gt_xdrop_resources_delete(condenseq_creator->xdrop.right_xdrop_res);
-    gt_free(condenseq_creator->xdrop.left);
-    gt_free(condenseq_creator->xdrop.right);
+    ces_c_xdrop_delete(&condenseq_creator->xdrop);
+    if (condenseq_creator->xdrop_jobs.workers != NULL) {
+      unsigned int idx;
+      for (idx = 0; idx < condenseq_creator->xdrop_jobs.numofworkers; idx++)
+        ces_c_xdrop_delete(condenseq_creator->xdrop_jobs.workers + idx);
+      gt_free(condenseq_creator->xdrop_jobs.workers);
+      gt_mutex_delete(condenseq_creator->xdrop_jobs.mutex);
+    }
+    gt_free(condenseq_creator->xdrop_jobs.space);
 
     gt_free(condenseq_creator);
   }
@@ -17,7 +17,9 @@
 
 #include <errno.h>
 #include <fcntl.h>
+#include <limits.h>
 #include <math.h>
+#include <string.h>
 #include <sys/stat.h>
 #include <unistd.h>
 
@@ -34,6 +36,7 @@
 #include "core/log_api.h"
 #include "core/ma_api.h"
 #include "core/parseutils.h"
+#include "core/qsort_r_api.h"
 #include "core/undef_api.h"
 #include "core/warning_api.h"
 #include "core/xansi_api.h"
@@ -43,6 +46,7 @@
 #include "extended/encdesc.h"
 #include "extended/encdesc_header_io.h"
 #include "extended/encdesc_rep.h"
+#include "extended/fasta_header_iterator.h"
 #include "extended/huffcode.h"
 #include "extended/sampling.h"
 
@@ -753,11 +757,17 @@ static int encdesc_write_encoding(GtEncdesc *encdesc,
           info->codes->nextfreeEncdescCode = 0;
           prepare_write_data_and_count_bits(encdesc,
                                             info);
-          gt_bitoutstream_flush_advance(bitstream);
-
-          gt_sampling_add_sample(encdesc->sampling,
-                                 (size_t) gt_bitoutstream_pos(bitstream),
-                                 info->cur_desc);
+          /* blocks start at any bit, pages at the next page border */
+          if (gt_sampling_is_block(encdesc->sampling))
+            gt_sampling_add_sample(encdesc->sampling,
+                                   (size_t) gt_bitoutstream_bitpos(bitstream),
+                                   info->cur_desc);
+          else {
+            gt_bitoutstream_flush_advance(bitstream);
+            gt_sampling_add_sample(encdesc->sampling,
+                                   (size_t) gt_bitoutstream_pos(bitstream),
+                                   info->cur_desc);
+          }
 
           desc_counter = 0;
           page_counter = 0;
@@ -1051,8 +1061,9 @@ int gt_encdesc_encoder_encode(GtEncdescEncoder *ee,
                              (off_t) ee->encdesc->start_of_encoding);
     else if (ee->regular_sampling)
       ee->encdesc->sampling =
-        gt_sampling_new_regular(ee->sampling_rate,
-                                (off_t) ee->encdesc->start_of_encoding);
+        gt_sampling_new_block(ee->sampling_rate,
+                              (GtUint64) ee->encdesc->start_of_encoding *
+                              CHAR_BIT);
     had_err = encdesc_write_encoding(ee->encdesc, cstr_iterator, fp, err);
   }
   if (!had_err) {
@@ -1076,7 +1087,7 @@ int gt_encdesc_encoder_encode(GtEncdescEncoder *ee,
       gt_log_log("==>");
       if (ee->encdesc->sampling != NULL) {
         rate = gt_sampling_get_rate(ee->encdesc->sampling);
-        if (gt_sampling_is_regular(ee->encdesc->sampling)) {
+        if (gt_sampling_is_block(ee->encdesc->sampling)) {
           gt_log_log("applied sampling technique:"
                      " sampling every "GT_WU"th description",
                      rate);
@@ -1165,6 +1176,15 @@ GtEncdesc* gt_encdesc_load(const char *name,
   return encdesc;
 }
 
+/* moves the bitinstream of <encdesc> to the sample at <position> */
+static void encdesc_seek_sample(GtEncdesc *encdesc, size_t position)
+{
+  if (gt_sampling_is_block(encdesc->sampling))
+    gt_bitinstream_reinit_at_bit(encdesc->bitinstream, (GtUint64) position);
+  else
+    gt_bitinstream_reinit(encdesc->bitinstream, position);
+}
+
 static inline int encdesc_read_bits(GtBitInStream *instream,
                                     unsigned bits_to_read,
                                     GtBitsequence *bitseq,
@@ -1192,7 +1212,7 @@ static int encdesc_next_desc(GtEncdesc *encdesc, GtStr *desc, GtError *err)
 {
   int stat, had_err = 0;
   bool bit,
-       sampled = false;
+       sampled = encdesc->at_sample;
   GtWord tmp = 0;
   GtUword cur_field_num,
           fieldlen = 0,
@@ -1209,7 +1229,8 @@ static int encdesc_next_desc(GtEncdesc *encdesc, GtStr *desc, GtError *err)
     return -1;
   }
 
-  if (encdesc->sampling != NULL &&
+  encdesc->at_sample = false;
+  if (encdesc->sampling != NULL && !sampled &&
       encdesc->cur_desc == gt_sampling_get_next_elementnum(encdesc->sampling)) {
     int sample_status;
     size_t startofnearestsample;
@@ -1218,7 +1239,7 @@ static int encdesc_next_desc(GtEncdesc *encdesc, GtStr *desc, GtError *err)
                                                 &nearestsample,
                                                 &startofnearestsample);
     if (sample_status == 1) {
-      gt_bitinstream_reinit(encdesc->bitinstream, startofnearestsample);
+      encdesc_seek_sample(encdesc, startofnearestsample);
       sampled = true;
     }
     else
@@ -1443,13 +1464,14 @@ int gt_encdesc_decode(GtEncdesc *encdesc,
                                 num,
                                 &nearestsample,
                                 &startofnearestsample);
-    /* nearestsample <= cur_read < readnum: current sample is the right one */
-    if (nearestsample <= encdesc->cur_desc && encdesc->cur_desc <= num)
+    /* nearestsample < cur_desc <= num: current sample is the right one. If
+       cur_desc is the sample itself, it was not yet read from its start. */
+    if (nearestsample < encdesc->cur_desc && encdesc->cur_desc <= num)
       descs2read = num - encdesc->cur_desc;
     else { /* reset decoder to new sample */
-      gt_bitinstream_reinit(encdesc->bitinstream,
-                            startofnearestsample);
+      encdesc_seek_sample(encdesc, startofnearestsample);
       encdesc->cur_desc = nearestsample;
+      encdesc->at_sample = true;
       descs2read = num - nearestsample;
     }
   }
@@ -1476,6 +1498,61 @@ int gt_encdesc_decode(GtEncdesc *encdesc,
   return had_err;
 }
 
+static int encdesc_compare_nums(const void *a, const void *b, void *data)
+{
+  const GtUword *nums = data,
+                idx_a = *(const GtUword*) a,
+                idx_b = *(const GtUword*) b;
+  if (nums[idx_a] != nums[idx_b])
+    return nums[idx_a] < nums[idx_b] ? -1 : 1;
+  if (idx_a != idx_b)
+    return idx_a < idx_b ? -1 : 1;
+  return 0;
+}
+
+int gt_encdesc_decode_batch(GtEncdesc *encdesc,
+                            const GtUword *nums,
+                            GtUword numofnums,
+                            GtStrArray *descs,
+                            GtError *err)
+{
+  int had_err = 0;
+  GtUword idx,
+          first = gt_str_array_size(descs),
+          *order;
+  GtStr *desc;
+
+  gt_assert(encdesc);
+  gt_assert(descs);
+  gt_assert(numofnums == 0 || nums != NULL);
+  gt_error_check(err);
+
+  if (numofnums == 0)
+    return 0;
+  order = gt_malloc(sizeof (*order) * numofnums);
+  for (idx = 0; idx < numofnums; idx++) {
+    gt_assert(nums[idx] < encdesc->num_of_descs);
+    order[idx] = idx;
+    gt_str_array_add_cstr(descs, "");
+  }
+  /* decoding in ascending order only moves forward within a block and jumps
+     to the sample of the next requested block at most once */
+  gt_qsort_r(order, (size_t) numofnums, sizeof (*order), (void *) nums,
+             encdesc_compare_nums);
+  desc = gt_str_new();
+  for (idx = 0; !had_err && idx < numofnums; idx++) {
+    if (idx == 0 || nums[order[idx]] != nums[order[idx - 1]])
+      had_err = gt_encdesc_decode(encdesc, nums[order[idx]], desc, err);
+    if (!had_err)
+      gt_str_array_set(descs, first + order[idx], desc);
+  }
+  gt_str_delete(desc);
+  gt_free(order);
+  if (had_err)
+    gt_str_array_set_size(descs, first);
+  return had_err;
+}
+
 static void encdesc_delete_desc_fields(DescField *fields,
                                       GtUword numoffields)
 {
@@ -1573,5 +1650,78 @@ int gt_encdesc_unit_test(GtError *err)
   GT_FREEARRAY(info->codes, EncdescCode);
   gt_free(info->codes);
   gt_free(info);
+
+  /* test random access and batch decoding with block sampling */
+  if (!had_err) {
+    const GtUword numofdescs = 100UL,
+                  nums[] = {57UL, 3UL, 99UL, 3UL, 0, 12UL, 13UL, 98UL, 11UL};
+    GtStr *tmpfilename = gt_str_new(),
+          *desc = gt_str_new();
+    GtStrArray *files = gt_str_array_new(),
+               *descs = gt_str_array_new();
+    GtCstrIterator *cstr_iterator = NULL;
+    GtEncdescEncoder *ee = gt_encdesc_encoder_new();
+    GtEncdesc *encdesc = NULL;
+    FILE *fp = gt_xtmpfp(tmpfilename);
+    GtUword idx;
+
+    for (idx = 0; idx < numofdescs; idx++)
+      fprintf(fp, ">read_" GT_WU ".%d len=" GT_WU "\nacgt\n",
+              idx * 3UL, (int) (idx % 7), 100UL + idx % 13);
+    gt_fa_xfclose(fp);
+    gt_str_array_add(files, tmpfilename);
+    cstr_iterator = gt_fasta_header_iterator_new(files, err);
+    if (cstr_iterator == NULL)
+      had_err = -1;
+    if (!had_err) {
+      gt_encdesc_encoder_set_sampling_regular(ee);
+      gt_encdesc_encoder_set_sampling_rate(ee, 3UL);
+      had_err = gt_encdesc_encoder_encode(ee, cstr_iterator,
+                                          gt_str_get(tmpfilename), err);
+    }
+    if (!had_err) {
+      encdesc = gt_encdesc_load(gt_str_get(tmpfilename), err);
+      if (encdesc == NULL)
+        had_err = -1;
+    }
+    if (!had_err)
+      gt_ensure(gt_encdesc_num_of_descriptions(encdesc) == numofdescs);
+    /* single descriptions backwards, each one needs a jump */
+    for (idx = numofdescs; !had_err && idx > 0; idx--) {
+      char expected[BUFSIZ];
+      (void) snprintf(expected, sizeof (expected),
+                      "read_" GT_WU ".%d len=" GT_WU, (idx - 1) * 3UL,
+                      (int) ((idx - 1) % 7), 100UL + (idx - 1) % 13);
+      had_err = gt_encdesc_decode(encdesc, idx - 1, desc, err);
+      if (!had_err)
+        gt_ensure(strcmp(gt_str_get(desc), expected) == 0);
+    }
+    if (!had_err) {
+      gt_str_array_add_cstr(descs, "first");
+      had_err = gt_encdesc_decode_batch(encdesc, nums,
+                                        (GtUword) (sizeof (nums) /
+                                                   sizeof (nums[0])),
+                                        descs, err);
+    }
+    if (!had_err)
+      gt_ensure(gt_str_array_size(descs) ==
+                1UL + sizeof (nums) / sizeof (nums[0]));
+    for (idx = 0; !had_err && idx < sizeof (nums) / sizeof (nums[0]); idx++) {
+      gt_ensure(gt_encdesc_decode(encdesc, nums[idx], desc, err) == 0);
+      gt_ensure(strcmp(gt_str_get(desc),
+                       gt_str_array_get(descs, idx + 1)) == 0);
+    }
+    gt_encdesc_delete(encdesc);
+    gt_encdesc_encoder_delete(ee);
+    gt_cstr_iterator_delete(cstr_iterator);
+    gt_str_append_cstr(tmpfilename, GT_ENCDESC_FILESUFFIX);
+    if (gt_file_exists(gt_str_get(tmpfilename)))
+      gt_xremove(gt_str_get(tmpfilename));
+    gt_xremove(gt_str_array_get(files, 0));
+    gt_str_array_delete(descs);
+    gt_str_array_delete(files);
+    gt_str_delete(desc);
+    gt_str_delete(tmpfilename);
+  }
   return had_err;
 }
@@ -46,8 +46,11 @@ void              gt_encdesc_encoder_set_sampling_none(GtEncdescEncoder *ee);
 /* Set the sampling method of <ee> to either __page__wise sampling. Sampling
    increases encoded size and decreases time for random access. */
 void              gt_encdesc_encoder_set_sampling_page(GtEncdescEncoder *ee);
-/* Set the sampling method of <ee> to either __regular__ sampling. Sampling
-   increases encoded size and decreases time for random access. */
+/* Set the sampling method of <ee> to either __regular__ sampling. Every
+   <sampling_rate>th description starts a new block, which can be decoded
+   without its predecessors. Blocks are not aligned to pages, so even small
+   rates only cost the absolute coding of the first description of each block
+   and one offset. */
 void              gt_encdesc_encoder_set_sampling_regular(GtEncdescEncoder *ee);
 
 /* Sets the sampling rate */
@@ -74,13 +77,26 @@ GtEncdesc*        gt_encdesc_load(const char *name, GtError *err);
 GtUword           gt_encdesc_num_of_descriptions(const GtEncdesc *encdesc);
 
 /* Decodes description with number <num> and writes it to <desc>, which will be
-   reset before writing to it. Returns 1 on success, 0 on EOF and -1 on
-   error. <err> is set accordingly. */
+   reset before writing to it. Decoding starts at the sample preceding <num>,
+   or continues from the last decoded description if that is closer. Returns 0
+   on success and -1 on error. <err> is set accordingly. */
 int               gt_encdesc_decode(GtEncdesc *encdesc,
                                     GtUword num,
                                     GtStr *desc,
                                     GtError *err);
 
+/* Decodes the <numofnums> descriptions with the numbers in <nums> and appends
+   them to <descs> in the order given by <nums>. <nums> does not need to be
+   sorted and may contain duplicates; the descriptions are decoded in ascending
+   order in one pass, so each block is decoded at most once. Returns 0 on
+   success and -1 on error, in which case <descs> is left unchanged and <err>
+   is set accordingly. */
+int               gt_encdesc_decode_batch(GtEncdesc *encdesc,
+                                          const GtUword *nums,
+                                          GtUword numofnums,
+                                          GtStrArray *descs,
+                                          GtError *err);
+
 void              gt_encdesc_delete(GtEncdesc *encdesc);
 
 void              gt_encdesc_encoder_delete(GtEncdescEncoder *ee);
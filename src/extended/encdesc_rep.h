@@ -95,7 +95,8 @@ struct GtEncdesc {
   GtWord          start_of_samplingtab,
                   start_of_encoding;
   unsigned int    bits_per_field;
-  bool            num_of_fields_is_const;
+  bool            at_sample,
+                  num_of_fields_is_const;
 };
 
 struct GtEncdescEncoder {
@@ -40,6 +40,7 @@ struct GtFeatureIndexClass {
   GtFeatureIndexRemoveNodeFunc remove_node;
   GtFeatureIndexGetFeatsForSeqidFunc get_features_for_seqid;
   GtFeatureIndexGetFeatsForRangeFunc get_features_for_range;
+  GtFeatureIndexGetFeatsForRangesFunc get_features_for_ranges;
   GtFeatureIndexGetFirstSeqidFunc get_first_seqid;
   GtFeatureIndexSaveFunc save_func;
   GtFeatureIndexGetSeqidsFunc get_seqids;
@@ -54,7 +55,7 @@ struct GtFeatureIndexMembers {
   GtRWLock *lock;
 };
 
-const GtFeatureIndexClass* gt_feature_index_class_new(size_t size,
+GtFeatureIndexClass* gt_feature_index_class_new(size_t size,
                                          GtFeatureIndexAddRegionNodeFunc
                                                  add_region_node,
                                          GtFeatureIndexAddFeatureNodeFunc
@@ -97,6 +98,15 @@ const GtFeatureIndexClass* gt_feature_index_class_new(size_t size,
   return c_class;
 }
 
+void gt_feature_index_class_set_get_features_for_ranges_func(
+                                            GtFeatureIndexClass *fic,
+                                            GtFeatureIndexGetFeatsForRangesFunc
+                                            get_features_for_ranges)
+{
+  gt_assert(fic);
+  fic->get_features_for_ranges = get_features_for_ranges;
+}
+
 GtFeatureIndex* gt_feature_index_create(const GtFeatureIndexClass *fic)
 {
   GtFeatureIndex *fi;
@@ -231,6 +241,66 @@ int gt_feature_index_get_features_for_range(GtFeatureIndex *feature_index,
   return ret;
 }
 
+static int feature_index_get_features_for_ranges_generic(GtFeatureIndex
+                                                        *feature_index,
+                                                        const char *seqid,
+                                                        const GtRange *ranges,
+                                                        GtUword nof_ranges,
+                                                       GtFeatureIndexRangesFunc
+                                                        func,
+                                                        void *data,
+                                                        GtError *err)
+{
+  GtArray *results;
+  GtUword r, i;
+  int had_err = 0;
+  results = gt_array_new(sizeof (GtFeatureNode*));
+  for (r = 0; !had_err && r < nof_ranges; r++) {
+    gt_array_reset(results);
+    had_err = feature_index->c_class->get_features_for_range(feature_index,
+                                                             results, seqid,
+                                                             ranges + r, err);
+    for (i = 0; !had_err && i < gt_array_size(results); i++) {
+      had_err = func(*(GtFeatureNode**) gt_array_get(results, i), r, data,
+                     err);
+    }
+  }
+  gt_array_delete(results);
+  return had_err;
+}
+
+int gt_feature_index_get_features_for_ranges(GtFeatureIndex *feature_index,
+                                             const char *seqid,
+                                             const GtRange *ranges,
+                                             GtUword nof_ranges,
+                                             GtFeatureIndexRangesFunc func,
+                                             void *data, GtError *err)
+{
+  GT_UNUSED GtUword r;
+  int ret;
+  gt_error_check(err);
+  gt_assert(feature_index && feature_index->c_class && seqid && func);
+  gt_assert(ranges || nof_ranges == 0);
+#ifndef NDEBUG
+  for (r = 1; r < nof_ranges; r++)
+    gt_assert(ranges[r - 1].start <= ranges[r].start);
+#endif
+  gt_rwlock_rdlock(feature_index->pvt->lock);
+  if (feature_index->c_class->get_features_for_ranges) {
+    ret = feature_index->c_class->get_features_for_ranges(feature_index,
+                                                          seqid, ranges,
+                                                          nof_ranges, func,
+                                                          data, err);
+  }
+  else {
+    ret = feature_index_get_features_for_ranges_generic(feature_index, seqid,
+                                                        ranges, nof_ranges,
+                                                        func, data, err);
+  }
+  gt_rwlock_unlock(feature_index->pvt->lock);
+  return ret;
+}
+
 char* gt_feature_index_get_first_seqid(const GtFeatureIndex
                                              *feature_index,
                                               GtError *err)
@@ -424,6 +494,68 @@ static void* gt_feature_index_unit_test_query(void *data)
   return NULL;
 }
 
+#define GT_FI_TEST_NOF_RANGES 100
+
+static int gt_feature_index_unit_test_collect(GtFeatureNode *fn,
+                                              GtUword range_index, void *data,
+                                              GT_UNUSED GtError *err)
+{
+  GtArray **results = data;
+  gt_array_add(results[range_index], fn);
+  return 0;
+}
+
+static int gt_feature_index_unit_test_ranges(GtFeatureIndex *fi, GtError *err)
+{
+  GtRange ranges[GT_FI_TEST_NOF_RANGES];
+  GtArray *results[GT_FI_TEST_NOF_RANGES], *arr_ref;
+  GtUword i, j;
+  int had_err = 0;
+
+  for (i = 0; i < GT_FI_TEST_NOF_RANGES; i++) {
+    ranges[i].start = random() % (GT_FI_TEST_END - GT_FI_TEST_QUERY_WIDTH);
+    ranges[i].end = ranges[i].start + random() % (GT_FI_TEST_QUERY_WIDTH);
+    results[i] = gt_array_new(sizeof (GtFeatureNode*));
+  }
+  qsort(ranges, GT_FI_TEST_NOF_RANGES, sizeof (GtRange),
+        (GtCompare) gt_range_compare);
+  arr_ref = gt_array_new(sizeof (GtFeatureNode*));
+
+  /* a batched query must return the same nodes as the single queries */
+  gt_ensure(gt_feature_index_get_features_for_ranges(fi, GT_FI_TEST_SEQID,
+                                            ranges, GT_FI_TEST_NOF_RANGES,
+                                            gt_feature_index_unit_test_collect,
+                                            results, err) == 0);
+  for (i = 0; !had_err && i < GT_FI_TEST_NOF_RANGES; i++) {
+    gt_array_reset(arr_ref);
+    gt_ensure(gt_feature_index_get_features_for_range(fi, arr_ref,
+                                                      GT_FI_TEST_SEQID,
+                                                      ranges + i, err) == 0);
+    gt_ensure(gt_array_size(arr_ref) == gt_array_size(results[i]));
+    for (j = 1; !had_err && j < gt_array_size(results[i]); j++) {
+      GtRange prev, cur;
+      prev = gt_genome_node_get_range(*(GtGenomeNode**)
+                                      gt_array_get(results[i], j - 1));
+      cur = gt_genome_node_get_range(*(GtGenomeNode**)
+                                     gt_array_get(results[i], j));
+      gt_ensure(prev.start <= cur.start);
+    }
+    gt_array_sort(results[i], cmp_range_start);
+    gt_array_sort(arr_ref, cmp_range_start);
+    for (j = 0; !had_err && j < gt_array_size(arr_ref); j++) {
+      gt_ensure(gt_feature_node_is_similar(*(GtFeatureNode**)
+                                           gt_array_get(results[i], j),
+                                           *(GtFeatureNode**)
+                                           gt_array_get(arr_ref, j)));
+    }
+  }
+
+  for (i = 0; i < GT_FI_TEST_NOF_RANGES; i++)
+    gt_array_delete(results[i]);
+  gt_array_delete(arr_ref);
+  return had_err;
+}
+
 /* to be called from implementing class! */
 int gt_feature_index_unit_test(GtFeatureIndex *fi, GtError *err)
 {
@@ -490,6 +622,10 @@ int gt_feature_index_unit_test(GtFeatureIndex *fi, GtError *err)
     gt_multithread(gt_feature_index_unit_test_query, &sh, err);
   gt_ensure(sh.error_count == 0);
 
+  /* test batched queries */
+  if (!had_err)
+    had_err = gt_feature_index_unit_test_ranges(fi, err);
+
   gt_mutex_delete(sh.mutex);
   gt_error_delete(sh.err);
   gt_str_array_delete(seqids);
@@ -64,6 +64,30 @@ int         gt_feature_index_get_features_for_range(GtFeatureIndex
                                                     const char *seqid,
                                                     const GtRange *range,
                                                     GtError*);
+/* Callback function for <gt_feature_index_get_features_for_ranges()>, called
+   with a <feature_node> overlapping the query range with number
+   <range_index>. */
+typedef int (*GtFeatureIndexRangesFunc)(GtFeatureNode *feature_node,
+                                        GtUword range_index, void *data,
+                                        GtError *err);
+/* Look up genome features in <feature_index> for sequence region <seqid>
+   overlapping each of the <nof_ranges> <ranges>, which must be sorted by start
+   position. For each range in turn, <func> is called with <data> for the
+   overlapping features, sorted by feature start position. A feature
+   overlapping several ranges is passed once for each of them, in the same way
+   as <gt_feature_index_get_features_for_range()> would return it. The queries
+   are answered together, without allocating memory for each query. <func>
+   must not modify <feature_index>. If <func> returns an error, the lookup is
+   stopped and the error is returned. */
+int         gt_feature_index_get_features_for_ranges(GtFeatureIndex
+                                                     *feature_index,
+                                                     const char *seqid,
+                                                     const GtRange *ranges,
+                                                     GtUword nof_ranges,
+                                                     GtFeatureIndexRangesFunc
+                                                     func,
+                                                     void *data,
+                                                     GtError *err);
 /* Returns the first sequence region identifier added to <feature_index>. */
 char*       gt_feature_index_get_first_seqid(const GtFeatureIndex
                                              *feature_index,
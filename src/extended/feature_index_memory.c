@@ -28,6 +28,7 @@
 #include "core/ma_api.h"
 #include "core/minmax_api.h"
 #include "core/range_api.h"
+#include "core/thread_api.h"
 #include "core/undef_api.h"
 #include "core/unused_api.h"
 #include "extended/feature_index_memory.h"
@@ -40,6 +41,8 @@ struct GtFeatureIndexMemory {
   const GtFeatureIndex parent_instance;
   GtHashmap *regions;
   GtHashmap *nodes_in_index;
+  /* serializes building the interval trees on first query */
+  GtMutex *build_lock;
   GtArray *ids;
   char *firstseqid;
   GtUword nof_region_nodes,
@@ -51,14 +54,14 @@ struct GtFeatureIndexMemory {
         gt_feature_index_cast(gt_feature_index_memory_class(), FI)
 
 typedef struct {
-  GtIntervalTree *features;
+  GtIntervalTreeStatic *features;
   GtRegionNode *region;
   GtRange dyn_range;
 } RegionInfo;
 
 static void region_info_delete(RegionInfo *info)
 {
-  gt_interval_tree_delete(info->features);
+  gt_interval_tree_static_delete(info->features);
   if (info->region)
     gt_genome_node_delete((GtGenomeNode*)info->region);
   gt_free(info);
@@ -77,8 +80,8 @@ int gt_feature_index_memory_add_region_node(GtFeatureIndex *gfi,
   if (!gt_hashmap_get(fi->regions, seqid)) {
     info = gt_calloc(1, sizeof (RegionInfo));
     info->region = (GtRegionNode*) gt_genome_node_ref((GtGenomeNode*) rn);
-    info->features = gt_interval_tree_new((GtFree)
-                                          gt_genome_node_delete);
+    info->features = gt_interval_tree_static_new((GtFree)
+                                                 gt_genome_node_delete);
     info->dyn_range.start = ~0UL;
     info->dyn_range.end   = 0;
     gt_hashmap_add(fi->regions, seqid, info);
@@ -97,7 +100,6 @@ int gt_feature_index_memory_add_feature_node(GtFeatureIndex *gfi,
   GtFeatureIndexMemory *fi;
   GtRange node_range;
   RegionInfo *info;
-  GtIntervalTreeNode *new_node;
   gt_assert(gfi && fn);
 
   fi = gt_feature_index_memory_cast(gfi);
@@ -116,8 +118,8 @@ int gt_feature_index_memory_add_feature_node(GtFeatureIndex *gfi,
   {
     info = gt_calloc(1, sizeof (RegionInfo));
     info->region = NULL;
-    info->features = gt_interval_tree_new((GtFree)
-                                          gt_genome_node_delete);
+    info->features = gt_interval_tree_static_new((GtFree)
+                                                 gt_genome_node_delete);
     info->dyn_range.start = ~0UL;
     info->dyn_range.end   = 0;
     gt_hashmap_add(fi->regions, seqid, info);
@@ -125,31 +127,16 @@ int gt_feature_index_memory_add_feature_node(GtFeatureIndex *gfi,
       fi->firstseqid = seqid;
   }
 
-  /* add node to the appropriate array in the hashtable */
-  new_node = gt_interval_tree_node_new(gn, node_range.start, node_range.end);
-  gt_interval_tree_insert(info->features, new_node);
+  /* add node to the appropriate array in the hashtable, the interval tree is
+     built on the next query */
+  gt_interval_tree_static_add(info->features, gn, node_range.start,
+                              node_range.end);
   /* update dynamic range */
   info->dyn_range.start = GT_MIN(info->dyn_range.start, node_range.start);
   info->dyn_range.end = GT_MAX(info->dyn_range.end, node_range.end);
   return 0;
 }
 
-typedef struct {
-  GtIntervalTreeNode *node;
-  GtGenomeNode *genome_node;
-} GtFeatureIndexMemoryByPtrExtractInfo;
-
-static int gt_feature_index_memory_get_itreenode_by_ptr(GtIntervalTreeNode *n,
-                                                        void *data)
-{
-  GtFeatureIndexMemoryByPtrExtractInfo *i =
-                                   (GtFeatureIndexMemoryByPtrExtractInfo*) data;
-  if (i->genome_node == gt_interval_tree_node_get_data(n)) {
-    i->node = n;
-  }
-  return 0;
-}
-
 int gt_feature_index_memory_remove_node(GtFeatureIndex *gfi,
                                         GtFeatureNode *gn,
                                         GT_UNUSED GtError *err)
@@ -157,7 +144,6 @@ int gt_feature_index_memory_remove_node(GtFeatureIndex *gfi,
   char* seqid;
   GtFeatureIndexMemory *fi;
   GtRange node_range;
-  GtFeatureIndexMemoryByPtrExtractInfo info;
   RegionInfo *rinfo;
   gt_assert(gfi && gn);
 
@@ -169,28 +155,37 @@ int gt_feature_index_memory_remove_node(GtFeatureIndex *gfi,
   rinfo = (RegionInfo*) gt_hashmap_get(fi->regions, seqid);
   if (!rinfo)
     return 0;
-  info.genome_node = (GtGenomeNode*) gn;
-  info.node = NULL;
-
-  gt_interval_tree_iterate_overlapping(rinfo->features,
-                                   gt_feature_index_memory_get_itreenode_by_ptr,
-                                   node_range.start,
-                                   node_range.end,
-                                   &info);
-
-  if (info.node)
-    gt_interval_tree_remove(rinfo->features, info.node);
+  (void) gt_interval_tree_static_remove(rinfo->features, gn, node_range.start,
+                                        node_range.end);
   return 0;
 }
 
-static int collect_features_from_itree(GtIntervalTreeNode *node, void *data)
+static int collect_features_from_itree(void *node, GT_UNUSED GtUword low,
+                                       GT_UNUSED GtUword high, void *data)
 {
   GtArray *a = (GtArray*) data;
-  GtGenomeNode *gn = (GtGenomeNode*) gt_interval_tree_node_get_data(node);
-  gt_array_add(a, gn);
+  gt_array_add(a, node);
   return 0;
 }
 
+/* Returns the region of <seqid> with its interval tree built, or NULL if the
+   index does not contain <seqid>. Queries only hold the read lock of the
+   feature index, so the interval tree of a region is built under <build_lock>
+   by the first of them. Once it is built, queries do not take the lock. */
+static RegionInfo* feature_index_memory_get_region(GtFeatureIndexMemory *fi,
+                                                   const char *seqid)
+{
+  RegionInfo *ri = (RegionInfo*) gt_hashmap_get(fi->regions, seqid);
+  if (!ri || gt_interval_tree_static_is_built(ri->features))
+    return ri;
+  gt_mutex_lock(fi->build_lock);
+  /* another query may have built it in the meantime */
+  if (!gt_interval_tree_static_is_built(ri->features))
+    gt_interval_tree_static_build(ri->features);
+  gt_mutex_unlock(fi->build_lock);
+  return ri;
+}
+
 GtArray* gt_feature_index_memory_get_features_for_seqid(GtFeatureIndex *gfi,
                                                         const char *seqid,
                                                         GT_UNUSED GtError *err)
@@ -202,11 +197,11 @@ GtArray* gt_feature_index_memory_get_features_for_seqid(GtFeatureIndex *gfi,
   gt_assert(gfi && seqid);
   fi = gt_feature_index_memory_cast(gfi);
   a = gt_array_new(sizeof (GtFeatureNode*));
-  ri = (RegionInfo*) gt_hashmap_get(fi->regions, seqid);
+  ri = feature_index_memory_get_region(fi, seqid);
   if (ri) {
-    had_err = gt_interval_tree_traverse(ri->features,
-                                        collect_features_from_itree,
-                                        a);
+    had_err = gt_interval_tree_static_traverse(ri->features,
+                                               collect_features_from_itree,
+                                               a);
   }
   gt_assert(!had_err);   /* collect_features_from_itree() is sane */
   return a;
@@ -232,17 +227,60 @@ int gt_feature_index_memory_get_features_for_range(GtFeatureIndex *gfi,
   gt_assert(gfi && results);
 
   fi = gt_feature_index_memory_cast(gfi);
-  ri = (RegionInfo*) gt_hashmap_get(fi->regions, seqid);
+  ri = feature_index_memory_get_region(fi, seqid);
   if (!ri) {
     gt_error_set(err, "feature index does not contain the given sequence id");
     return -1;
   }
-  gt_interval_tree_find_all_overlapping(ri->features, qry_range->start,
-                                        qry_range->end, results);
+  gt_interval_tree_static_find_all_overlapping(ri->features, qry_range->start,
+                                               qry_range->end, results);
   gt_array_sort(results, gt_genome_node_cmp_range_start);
   return 0;
 }
 
+typedef struct {
+  GtFeatureIndexRangesFunc func;
+  void *data;
+  GtError *err;
+} GtFeatureIndexMemoryRangesInfo;
+
+static int feature_index_memory_pass_feature(void *node, GtUword range_index,
+                                             void *data)
+{
+  GtFeatureIndexMemoryRangesInfo *info = data;
+  return info->func((GtFeatureNode*) node, range_index, info->data, info->err);
+}
+
+static int feature_index_memory_get_features_for_ranges(GtFeatureIndex *gfi,
+                                                        const char *seqid,
+                                                        const GtRange *ranges,
+                                                        GtUword nof_ranges,
+                                                       GtFeatureIndexRangesFunc
+                                                        func,
+                                                        void *data,
+                                                        GtError *err)
+{
+  GtFeatureIndexMemoryRangesInfo info;
+  GtFeatureIndexMemory *fi;
+  RegionInfo *ri;
+  gt_error_check(err);
+  gt_assert(gfi && func);
+
+  fi = gt_feature_index_memory_cast(gfi);
+  ri = feature_index_memory_get_region(fi, seqid);
+  if (!ri) {
+    gt_error_set(err, "feature index does not contain the given sequence id");
+    return -1;
+  }
+  info.func = func;
+  info.data = data;
+  info.err = err;
+  return gt_interval_tree_static_iterate_overlapping_ranges(ri->features,
+                                             ranges, nof_ranges,
+                                             feature_index_memory_pass_feature,
+                                             &info);
+}
+
 GtFeatureNode*  gt_feature_index_memory_get_node_by_ptr(GtFeatureIndexMemory
                                                                           *fim,
                                                         GtFeatureNode *ptr,
@@ -358,11 +396,12 @@ void gt_feature_index_memory_delete(GtFeatureIndex *gfi)
   fi = gt_feature_index_memory_cast(gfi);
   gt_hashmap_delete(fi->regions);
   gt_hashmap_delete(fi->nodes_in_index);
+  gt_mutex_delete(fi->build_lock);
 }
 
 const GtFeatureIndexClass* gt_feature_index_memory_class(void)
 {
-  static const GtFeatureIndexClass *fic = NULL;
+  static GtFeatureIndexClass *fic = NULL;
   gt_class_alloc_lock_enter();
   if (!fic) {
     fic = gt_feature_index_class_new(sizeof (GtFeatureIndexMemory),
@@ -378,6 +417,8 @@ const GtFeatureIndexClass* gt_feature_index_memory_class(void)
                      gt_feature_index_memory_get_orig_range_for_seqid,
                      gt_feature_index_memory_has_seqid,
                      gt_feature_index_memory_delete);
+    gt_feature_index_class_set_get_features_for_ranges_func(fic,
+                                  feature_index_memory_get_features_for_ranges);
   }
   gt_class_alloc_lock_leave();
   return fic;
@@ -393,6 +434,7 @@ GtFeatureIndex* gt_feature_index_memory_new(void)
   fim->regions = gt_hashmap_new(GT_HASH_STRING, NULL,
                                 (GtFree) region_info_delete);
   fim->nodes_in_index = gt_hashmap_new(GT_HASH_DIRECT, NULL, NULL);
+  fim->build_lock = gt_mutex_new();
   return fi;
 }
 
@@ -0,0 +1,918 @@
+/*
+  Copyright (c) 2026 agent <agent@local>
+
+  Permission to use, copy, modify, and distribute this software for any
+  purpose with or without fee is hereby granted, provided that the above
+  copyright notice and this permission notice appear in all copies.
+
+  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+
+#include <string.h>
+#include "core/array_api.h"
+#include "core/class_alloc_lock.h"
+#include "core/cstr_api.h"
+#include "core/ensure_api.h"
+#include "core/fa_api.h"
+#include "core/hashmap_api.h"
+#include "core/ma_api.h"
+#include "core/minmax_api.h"
+#include "core/thread_api.h"
+#include "core/undef_api.h"
+#include "core/unused_api.h"
+#include "core/xansi_api.h"
+#include "extended/binary_parser.h"
+#include "extended/binary_visitor.h"
+#include "extended/feature_index_memory_api.h"
+#include "extended/feature_index_mmap.h"
+#include "extended/feature_index_rep.h"
+#include "extended/feature_node.h"
+#include "extended/genome_node.h"
+
+/* An index file consists of the header, the table of sequence regions (sorted
+   by sequence ID), the table of top-level features (for each sequence region
+   sorted by position), the interned strings (each terminated by '\0', padded
+   to a multiple of the word size) and the encoded feature node trees. All
+   numbers are stored as words in host byte order. */
+#define GT_FEATURE_INDEX_MMAP_MAGIC         "GTFIMMAP"
+#define GT_FEATURE_INDEX_MMAP_MAGIC_LENGTH  8
+#define GT_FEATURE_INDEX_MMAP_VERSION       1UL
+
+typedef struct {
+  char magic[GT_FEATURE_INDEX_MMAP_MAGIC_LENGTH];
+  GtUword version,
+          wordsize,
+          firstseqid, /* string number or <GT_UNDEF_UWORD> */
+          numofseqids,
+          numoftrees,
+          numofstrings,
+          stringslength, /* including padding */
+          blobslength;
+} GtFeatureIndexMmapHeader;
+
+typedef struct {
+  GtUword seqid, /* string number */
+          has_region,
+          region_start,
+          region_end,
+          firsttree,
+          numoftrees;
+} GtFeatureIndexMmapRegion;
+
+/* The features of a region form an implicit binary search tree: the root of
+   the features in the interval [lo,hi) is the one in the middle, its
+   <maxend> is the maximum end position in this interval. */
+typedef struct {
+  GtUword start,
+          end,
+          maxend,
+          bloboffset,
+          bloblength;
+} GtFeatureIndexMmapTree;
+
+struct GtFeatureIndexMmap {
+  const GtFeatureIndex parent_instance;
+  GtStr *filename;
+  /* collects the features until the index is saved (<NULL> if opened) */
+  GtFeatureIndex *memory_index;
+  /* maps the collected features to the order they have been added in, which
+     is kept for features at the same position */
+  GtHashmap *addition_rank;
+  GtUword nof_added;
+  /* the mapped index file */
+  void *map;
+  const GtFeatureIndexMmapHeader *header;
+  const GtFeatureIndexMmapRegion *regions;
+  const GtFeatureIndexMmapTree *trees;
+  const char **strings;
+  const char *blobs;
+  GtHashmap *region_of_seqid;
+  /* the feature node trees decoded so far */
+  GtGenomeNode **decoded;
+  GtBinaryParser *parser;
+  GtMutex *decode_lock;
+};
+
+#define gt_feature_index_mmap_cast(FI)\
+        gt_feature_index_cast(gt_feature_index_mmap_class(), FI)
+
+static int feature_index_mmap_read_only(GtFeatureIndexMmap *fim,
+                                        GtError *err)
+{
+  gt_error_set(err, "feature index \"%s\" has been opened for reading only",
+               gt_str_get(fim->filename));
+  return -1;
+}
+
+static int feature_index_mmap_add_region_node(GtFeatureIndex *gfi,
+                                              GtRegionNode *rn,
+                                              GtError *err)
+{
+  GtFeatureIndexMmap *fim = gt_feature_index_mmap_cast(gfi);
+  if (!fim->memory_index)
+    return feature_index_mmap_read_only(fim, err);
+  return gt_feature_index_add_region_node(fim->memory_index, rn, err);
+}
+
+static int feature_index_mmap_add_feature_node(GtFeatureIndex *gfi,
+                                               GtFeatureNode *fn,
+                                               GtError *err)
+{
+  GtFeatureIndexMmap *fim = gt_feature_index_mmap_cast(gfi);
+  GtUword *rank;
+  if (!fim->memory_index)
+    return feature_index_mmap_read_only(fim, err);
+  rank = gt_malloc(sizeof *rank);
+  *rank = fim->nof_added++;
+  gt_hashmap_add(fim->addition_rank, fn, rank);
+  return gt_feature_index_add_feature_node(fim->memory_index, fn, err);
+}
+
+static int feature_index_mmap_remove_node(GtFeatureIndex *gfi,
+                                          GtFeatureNode *fn, GtError *err)
+{
+  GtFeatureIndexMmap *fim = gt_feature_index_mmap_cast(gfi);
+  if (!fim->memory_index)
+    return feature_index_mmap_read_only(fim, err);
+  gt_hashmap_remove(fim->addition_rank, fn);
+  return gt_feature_index_remove_node(fim->memory_index, fn, err);
+}
+
+static const GtFeatureIndexMmapRegion*
+feature_index_mmap_get_region(const GtFeatureIndexMmap *fim,
+                              const char *seqid)
+{
+  GtUword *region = gt_hashmap_get(fim->region_of_seqid, seqid);
+  return region != NULL ? fim->regions + *region : NULL;
+}
+
+/* returns the feature node tree with number <treenum>, decoding it on the
+   first access */
+static GtGenomeNode* feature_index_mmap_get_tree(GtFeatureIndexMmap *fim,
+                                                 GtUword treenum,
+                                                 GtError *err)
+{
+  const GtFeatureIndexMmapTree *tree = fim->trees + treenum;
+  GtGenomeNode *gn;
+  int had_err = 0;
+
+  gt_mutex_lock(fim->decode_lock);
+  if ((gn = fim->decoded[treenum]) == NULL) {
+    if (tree->bloboffset > fim->header->blobslength ||
+        tree->bloblength > fim->header->blobslength - tree->bloboffset) {
+      gt_error_set(err, "feature index \"%s\" is corrupt",
+                   gt_str_get(fim->filename));
+      had_err = -1;
+    }
+    if (!had_err) {
+      had_err = gt_binary_parser_decode_feature_tree(fim->parser, &gn,
+                                                     fim->blobs
+                                                     + tree->bloboffset,
+                                                     tree->bloblength,
+                                                     fim->filename,
+                                                     treenum + 1, err);
+    }
+    if (!had_err)
+      fim->decoded[treenum] = gn;
+  }
+  gt_mutex_unlock(fim->decode_lock);
+  return had_err ? NULL : gn;
+}
+
+static GtArray* feature_index_mmap_get_features_for_seqid(GtFeatureIndex *gfi,
+                                                          const char *seqid,
+                                                          GtError *err)
+{
+  GtFeatureIndexMmap *fim = gt_feature_index_mmap_cast(gfi);
+  const GtFeatureIndexMmapRegion *region;
+  GtArray *features;
+  GtUword idx;
+
+  if (fim->memory_index)
+    return gt_feature_index_get_features_for_seqid(fim->memory_index, seqid,
+                                                   err);
+  features = gt_array_new(sizeof (GtFeatureNode*));
+  if ((region = feature_index_mmap_get_region(fim, seqid)) != NULL) {
+    for (idx = 0; idx < region->numoftrees; idx++) {
+      GtGenomeNode *gn = feature_index_mmap_get_tree(fim,
+                                                     region->firsttree + idx,
+                                                     err);
+      if (gn == NULL) {
+        gt_array_delete(features);
+        return NULL;
+      }
+      gt_array_add(features, gn);
+    }
+  }
+  return features;
+}
+
+/* appends the numbers of the trees in [lo,hi) overlapping <range> to
+   <treenums> in the order of their positions */
+static void feature_index_mmap_find_overlapping(const GtFeatureIndexMmapTree
+                                                *trees, GtUword lo,
+                                                GtUword hi,
+                                                const GtRange *range,
+                                                GtArray *treenums)
+{
+  while (lo < hi) {
+    GtUword mid = lo + (hi - lo) / 2;
+    if (trees[mid].maxend < range->start)
+      return;
+    feature_index_mmap_find_overlapping(trees, lo, mid, range, treenums);
+    if (trees[mid].start > range->end)
+      return;
+    if (trees[mid].end >= range->start)
+      gt_array_add(treenums, mid);
+    lo = mid + 1;
+  }
+}
+
+static int feature_index_mmap_get_features_for_range(GtFeatureIndex *gfi,
+                                                     GtArray *results,
+                                                     const char *seqid,
+                                                     const GtRange *range,
+                                                     GtError *err)
+{
+  GtFeatureIndexMmap *fim = gt_feature_index_mmap_cast(gfi);
+  const GtFeatureIndexMmapRegion *region;
+  GtArray *treenums;
+  GtUword idx;
+  int had_err = 0;
+  gt_error_check(err);
+
+  if (fim->memory_index)
+    return gt_feature_index_get_features_for_range(fim->memory_index, results,
+                                                   seqid, range, err);
+  if ((region = feature_index_mmap_get_region(fim, seqid)) == NULL) {
+    gt_error_set(err, "feature index does not contain the given sequence id");
+    return -1;
+  }
+  treenums = gt_array_new(sizeof (GtUword));
+  feature_index_mmap_find_overlapping(fim->trees + region->firsttree, 0,
+                                      region->numoftrees, range, treenums);
+  for (idx = 0; !had_err && idx < gt_array_size(treenums); idx++) {
+    GtGenomeNode *gn = feature_index_mmap_get_tree(fim, region->firsttree
+                                                   + *(GtUword*)
+                                                   gt_array_get(treenums, idx),
+                                                   err);
+    if (gn == NULL)
+      had_err = -1;
+    else
+      gt_array_add(results, gn);
+  }
+  gt_array_delete(treenums);
+  return had_err;
+}
+
+static int feature_index_mmap_get_features_for_ranges(GtFeatureIndex *gfi,
+                                                      const char *seqid,
+                                                      const GtRange *ranges,
+                                                      GtUword nof_ranges,
+                                                      GtFeatureIndexRangesFunc
+                                                      func,
+                                                      void *data,
+                                                      GtError *err)
+{
+  GtFeatureIndexMmap *fim = gt_feature_index_mmap_cast(gfi);
+  const GtFeatureIndexMmapRegion *region;
+  const GtFeatureIndexMmapTree *trees;
+  GtUword *active, nof_active = 0, next = 0, r, i, j;
+  int had_err = 0;
+  gt_error_check(err);
+
+  if (fim->memory_index)
+    return gt_feature_index_get_features_for_ranges(fim->memory_index, seqid,
+                                                    ranges, nof_ranges, func,
+                                                    data, err);
+  if ((region = feature_index_mmap_get_region(fim, seqid)) == NULL) {
+    gt_error_set(err, "feature index does not contain the given sequence id");
+    return -1;
+  }
+  /* sweep over the features of the region, keeping those which may overlap
+     the following ranges in <active> */
+  trees = fim->trees + region->firsttree;
+  active = gt_malloc(sizeof (GtUword) * (region->numoftrees + 1));
+  for (r = 0; !had_err && r < nof_ranges; r++) {
+    while (next < region->numoftrees && trees[next].start <= ranges[r].end)
+      active[nof_active++] = next++;
+    for (i = j = 0; i < nof_active; i++) {
+      if (trees[active[i]].end >= ranges[r].start)
+        active[j++] = active[i];
+    }
+    nof_active = j;
+    for (i = 0; !had_err && i < nof_active; i++) {
+      GtGenomeNode *gn;
+      if (trees[active[i]].start > ranges[r].end)
+        break;
+      if (!(gn = feature_index_mmap_get_tree(fim, region->firsttree
+                                                  + active[i], err))) {
+        had_err = -1;
+      }
+      else
+        had_err = func((GtFeatureNode*) gn, r, data, err);
+    }
+  }
+  gt_free(active);
+  return had_err;
+}
+
+static char* feature_index_mmap_get_first_seqid(const GtFeatureIndex *gfi,
+                                                GtError *err)
+{
+  GtFeatureIndexMmap *fim = gt_feature_index_mmap_cast((GtFeatureIndex*) gfi);
+  if (fim->memory_index)
+    return gt_feature_index_get_first_seqid(fim->memory_index, err);
+  if (fim->header->firstseqid == GT_UNDEF_UWORD)
+    return NULL;
+  return gt_cstr_dup(fim->strings[fim->header->firstseqid]);
+}
+
+static GtStrArray* feature_index_mmap_get_seqids(const GtFeatureIndex *gfi,
+                                                 GtError *err)
+{
+  GtFeatureIndexMmap *fim = gt_feature_index_mmap_cast((GtFeatureIndex*) gfi);
+  GtStrArray *seqids;
+  GtUword idx;
+
+  if (fim->memory_index)
+    return gt_feature_index_get_seqids(fim->memory_index, err);
+  seqids = gt_str_array_new();
+  for (idx = 0; idx < fim->header->numofseqids; idx++)
+    gt_str_array_add_cstr(seqids, fim->strings[fim->regions[idx].seqid]);
+  return seqids;
+}
+
+static int feature_index_mmap_get_range_for_seqid(GtFeatureIndex *gfi,
+                                                  GtRange *range,
+                                                  const char *seqid,
+                                                  GtError *err)
+{
+  GtFeatureIndexMmap *fim = gt_feature_index_mmap_cast(gfi);
+  const GtFeatureIndexMmapRegion *region;
+  const GtFeatureIndexMmapTree *trees;
+
+  if (fim->memory_index)
+    return gt_feature_index_get_range_for_seqid(fim->memory_index, range,
+                                                seqid, err);
+  if ((region = feature_index_mmap_get_region(fim, seqid)) == NULL) {
+    gt_error_set(err, "feature index does not contain the given sequence id");
+    return -1;
+  }
+  /* like the database backends, prefer the range of the sequence region */
+  if (region->has_region) {
+    range->start = region->region_start;
+    range->end = region->region_end;
+  }
+  else if (region->numoftrees > 0) {
+    trees = fim->trees + region->firsttree;
+    range->start = trees[0].start;
+    range->end = trees[region->numoftrees / 2].maxend;
+  }
+  return 0;
+}
+
+static int feature_index_mmap_get_orig_range_for_seqid(GtFeatureIndex *gfi,
+                                                       GtRange *range,
+                                                       const char *seqid,
+                                                       GtError *err)
+{
+  GtFeatureIndexMmap *fim = gt_feature_index_mmap_cast(gfi);
+  const GtFeatureIndexMmapRegion *region;
+
+  if (fim->memory_index)
+    return gt_feature_index_get_orig_range_for_seqid(fim->memory_index, range,
+                                                     seqid, err);
+  if ((region = feature_index_mmap_get_region(fim, seqid)) == NULL) {
+    gt_error_set(err, "feature index does not contain the given sequence id");
+    return -1;
+  }
+  if (region->has_region) {
+    range->start = region->region_start;
+    range->end = region->region_end;
+  }
+  return 0;
+}
+
+static int feature_index_mmap_has_seqid(const GtFeatureIndex *gfi,
+                                        bool *has_seqid, const char *seqid,
+                                        GtError *err)
+{
+  GtFeatureIndexMmap *fim = gt_feature_index_mmap_cast((GtFeatureIndex*) gfi);
+  if (fim->memory_index)
+    return gt_feature_index_has_seqid(fim->memory_index, has_seqid, seqid,
+                                      err);
+  *has_seqid = feature_index_mmap_get_region(fim, seqid) != NULL;
+  return 0;
+}
+
+static int feature_index_mmap_cmp_trees(const void *v1, const void *v2,
+                                        void *data)
+{
+  GtHashmap *addition_rank = data;
+  GtUword *rank1, *rank2;
+  int rval;
+  if ((rval = gt_genome_node_compare((GtGenomeNode**) v1,
+                                     (GtGenomeNode**) v2))) {
+    return rval;
+  }
+  rank1 = gt_hashmap_get(addition_rank, *(GtGenomeNode**) v1);
+  rank2 = gt_hashmap_get(addition_rank, *(GtGenomeNode**) v2);
+  gt_assert(rank1 && rank2);
+  if (*rank1 == *rank2)
+    return 0;
+  return *rank1 < *rank2 ? -1 : 1;
+}
+
+static GtUword feature_index_mmap_set_maxend(GtFeatureIndexMmapTree *trees,
+                                             GtUword lo, GtUword hi)
+{
+  GtUword mid, maxend, leftmaxend, rightmaxend;
+  if (lo >= hi)
+    return 0;
+  mid = lo + (hi - lo) / 2;
+  leftmaxend = feature_index_mmap_set_maxend(trees, lo, mid);
+  rightmaxend = feature_index_mmap_set_maxend(trees, mid + 1, hi);
+  maxend = GT_MAX(trees[mid].end, leftmaxend);
+  maxend = GT_MAX(maxend, rightmaxend);
+  trees[mid].maxend = maxend;
+  return maxend;
+}
+
+static int feature_index_mmap_save(GtFeatureIndex *gfi, GtError *err)
+{
+  GtFeatureIndexMmap *fim = gt_feature_index_mmap_cast(gfi);
+  GtFeatureIndexMmapHeader header;
+  GtArray *regions, *trees;
+  GtStr *strings, *blobs;
+  GtStrArray *seqids;
+  GtNodeVisitor *nv;
+  GtBinaryVisitor *bv;
+  FILE *fp;
+  char *firstseqid;
+  GtUword idx, j;
+  int had_err = 0;
+  gt_error_check(err);
+
+  if (!fim->memory_index)
+    return feature_index_mmap_read_only(fim, err);
+  if (!(seqids = gt_feature_index_get_seqids(fim->memory_index, err)))
+    return -1;
+  nv = gt_binary_visitor_new(NULL);
+  bv = (GtBinaryVisitor*) nv;
+  regions = gt_array_new(sizeof (GtFeatureIndexMmapRegion));
+  trees = gt_array_new(sizeof (GtFeatureIndexMmapTree));
+  blobs = gt_str_new();
+
+  for (idx = 0; !had_err && idx < gt_str_array_size(seqids); idx++) {
+    const char *seqid = gt_str_array_get(seqids, idx);
+    GtFeatureIndexMmapRegion region;
+    GtArray *features;
+    GtRange range;
+
+    region.seqid = gt_binary_visitor_intern_string(bv, seqid);
+    range.start = range.end = GT_UNDEF_UWORD;
+    had_err = gt_feature_index_get_orig_range_for_seqid(fim->memory_index,
+                                                        &range, seqid, err);
+    if (!had_err) {
+      region.has_region = range.start != GT_UNDEF_UWORD ? 1UL : 0;
+      region.region_start = range.start;
+      region.region_end = range.end;
+      features = gt_feature_index_get_features_for_seqid(fim->memory_index,
+                                                         seqid, err);
+      if (!features)
+        had_err = -1;
+    }
+    if (!had_err) {
+      gt_array_sort_with_data(features, feature_index_mmap_cmp_trees,
+                              fim->addition_rank);
+      region.firsttree = gt_array_size(trees);
+      region.numoftrees = gt_array_size(features);
+      for (j = 0; j < gt_array_size(features); j++) {
+        GtFeatureNode *fn = *(GtFeatureNode**) gt_array_get(features, j);
+        GtFeatureIndexMmapTree tree;
+        const char *blob;
+
+        range = gt_genome_node_get_range((GtGenomeNode*) fn);
+        tree.start = range.start;
+        tree.end = range.end;
+        tree.bloboffset = gt_str_length(blobs);
+        blob = gt_binary_visitor_encode_feature_tree(bv, fn, &tree.bloblength);
+        gt_str_append_cstr_nt(blobs, blob, tree.bloblength);
+        gt_array_add(trees, tree);
+      }
+      feature_index_mmap_set_maxend(gt_array_get_space(trees),
+                                    region.firsttree,
+                                    gt_array_size(trees));
+      gt_array_add(regions, region);
+      gt_array_delete(features);
+    }
+  }
+
+  if (!had_err) {
+    memcpy(header.magic, GT_FEATURE_INDEX_MMAP_MAGIC,
+           GT_FEATURE_INDEX_MMAP_MAGIC_LENGTH);
+    header.version = GT_FEATURE_INDEX_MMAP_VERSION;
+    header.wordsize = (GtUword) sizeof (GtUword);
+    firstseqid = gt_feature_index_get_first_seqid(fim->memory_index, err);
+    header.firstseqid = firstseqid != NULL
+                        ? gt_binary_visitor_intern_string(bv, firstseqid)
+                        : GT_UNDEF_UWORD;
+    gt_free(firstseqid);
+    header.numofseqids = gt_array_size(regions);
+    header.numoftrees = gt_array_size(trees);
+    header.numofstrings = gt_binary_visitor_num_of_strings(bv);
+    strings = gt_str_new();
+    for (idx = 0; idx < header.numofstrings; idx++) {
+      const char *cstr = gt_binary_visitor_get_string(bv, idx);
+      gt_str_append_cstr_nt(strings, cstr, (GtUword) strlen(cstr) + 1);
+    }
+    while (gt_str_length(strings) % sizeof (GtUword))
+      gt_str_append_char(strings, '\0');
+    header.stringslength = gt_str_length(strings);
+    header.blobslength = gt_str_length(blobs);
+
+    if (!(fp = gt_fa_fopen(gt_str_get(fim->filename), "wb", err)))
+      had_err = -1;
+    else {
+      gt_xfwrite_one(&header, fp);
+      gt_xfwrite(gt_array_get_space(regions), sizeof (GtFeatureIndexMmapRegion),
+                 (size_t) gt_array_size(regions), fp);
+      gt_xfwrite(gt_array_get_space(trees), sizeof (GtFeatureIndexMmapTree),
+                 (size_t) gt_array_size(trees), fp);
+      gt_xfwrite(gt_str_get_mem(strings), 1, (size_t) gt_str_length(strings),
+                 fp);
+      gt_xfwrite(gt_str_get_mem(blobs), 1, (size_t) gt_str_length(blobs), fp);
+      gt_fa_xfclose(fp);
+    }
+    gt_str_delete(strings);
+  }
+
+  gt_str_delete(blobs);
+  gt_array_delete(trees);
+  gt_array_delete(regions);
+  gt_node_visitor_delete(nv);
+  gt_str_array_delete(seqids);
+  return had_err;
+}
+
+static void feature_index_mmap_free(GtFeatureIndex *gfi)
+{
+  GtFeatureIndexMmap *fim = gt_feature_index_mmap_cast(gfi);
+  GtUword idx;
+  if (fim->decoded) {
+    for (idx = 0; idx < fim->header->numoftrees; idx++)
+      gt_genome_node_delete(fim->decoded[idx]);
+    gt_free(fim->decoded);
+  }
+  gt_feature_index_delete(fim->memory_index);
+  gt_hashmap_delete(fim->addition_rank);
+  gt_hashmap_delete(fim->region_of_seqid);
+  gt_binary_parser_delete(fim->parser);
+  gt_mutex_delete(fim->decode_lock);
+  gt_free(fim->strings);
+  gt_fa_xmunmap(fim->map);
+  gt_str_delete(fim->filename);
+}
+
+const GtFeatureIndexClass* gt_feature_index_mmap_class(void)
+{
+  static GtFeatureIndexClass *fic = NULL;
+  gt_class_alloc_lock_enter();
+  if (!fic) {
+    fic = gt_feature_index_class_new(sizeof (GtFeatureIndexMmap),
+                                    feature_index_mmap_add_region_node,
+                                    feature_index_mmap_add_feature_node,
+                                    feature_index_mmap_remove_node,
+                                    feature_index_mmap_get_features_for_seqid,
+                                    feature_index_mmap_get_features_for_range,
+                                    feature_index_mmap_get_first_seqid,
+                                    feature_index_mmap_save,
+                                    feature_index_mmap_get_seqids,
+                                    feature_index_mmap_get_range_for_seqid,
+                                    feature_index_mmap_get_orig_range_for_seqid,
+                                    feature_index_mmap_has_seqid,
+                                    feature_index_mmap_free);
+    gt_feature_index_class_set_get_features_for_ranges_func(fic,
+                                  feature_index_mmap_get_features_for_ranges);
+  }
+  gt_class_alloc_lock_leave();
+  return fic;
+}
+
+GtFeatureIndex* gt_feature_index_mmap_new(const char *filename)
+{
+  GtFeatureIndex *fi;
+  GtFeatureIndexMmap *fim;
+  gt_assert(filename);
+  fi = gt_feature_index_create(gt_feature_index_mmap_class());
+  fim = gt_feature_index_mmap_cast(fi);
+  fim->filename = gt_str_new_cstr(filename);
+  fim->memory_index = gt_feature_index_memory_new();
+  fim->addition_rank = gt_hashmap_new(GT_HASH_DIRECT, NULL, gt_free_func);
+  return fi;
+}
+
+/* checks the tables of the mapped index of size <maplen> and sets up the
+   pointers to them */
+static int feature_index_mmap_setup(GtFeatureIndexMmap *fim, size_t maplen,
+                                    GtError *err)
+{
+  const GtFeatureIndexMmapHeader *header = fim->map;
+  const char *ptr;
+  GtUword idx, remaining = (GtUword) maplen;
+  int had_err = 0;
+
+  if (remaining < (GtUword) sizeof *header ||
+      memcmp(header->magic, GT_FEATURE_INDEX_MMAP_MAGIC,
+             GT_FEATURE_INDEX_MMAP_MAGIC_LENGTH) != 0) {
+    gt_error_set(err, "file \"%s\" is not a feature index",
+                 gt_str_get(fim->filename));
+    return -1;
+  }
+  if (header->version != GT_FEATURE_INDEX_MMAP_VERSION ||
+      header->wordsize != (GtUword) sizeof (GtUword)) {
+    gt_error_set(err, "feature index \"%s\" has an unsupported version or "
+                 "word size", gt_str_get(fim->filename));
+    return -1;
+  }
+  fim->header = header;
+  remaining -= sizeof *header;
+  ptr = (const char*) fim->map + sizeof *header;
+  if (header->numofseqids > remaining / sizeof (GtFeatureIndexMmapRegion))
+    had_err = -1;
+  if (!had_err) {
+    fim->regions = (const GtFeatureIndexMmapRegion*) ptr;
+    ptr += header->numofseqids * sizeof (GtFeatureIndexMmapRegion);
+    remaining -= header->numofseqids * sizeof (GtFeatureIndexMmapRegion);
+    if (header->numoftrees > remaining / sizeof (GtFeatureIndexMmapTree))
+      had_err = -1;
+  }
+  if (!had_err) {
+    fim->trees = (const GtFeatureIndexMmapTree*) ptr;
+    ptr += header->numoftrees * sizeof (GtFeatureIndexMmapTree);
+    remaining -= header->numoftrees * sizeof (GtFeatureIndexMmapTree);
+    if (header->stringslength > remaining ||
+        header->blobslength != remaining - header->stringslength) {
+      had_err = -1;
+    }
+  }
+  if (!had_err) {
+    /* every string must be terminated inside the string table */
+    const char *string = ptr, *stringsend = ptr + header->stringslength;
+    fim->strings = gt_malloc(sizeof (char*) * (header->numofstrings + 1));
+    for (idx = 0; !had_err && idx < header->numofstrings; idx++) {
+      const char *end = string < stringsend
+                        ? memchr(string, '\0', (size_t) (stringsend - string))
+                        : NULL;
+      if (end == NULL)
+        had_err = -1;
+      else {
+        fim->strings[idx] = string;
+        gt_binary_parser_add_string(fim->parser, string);
+        string = end + 1;
+      }
+    }
+    fim->blobs = stringsend;
+  }
+  if (!had_err && header->firstseqid != GT_UNDEF_UWORD &&
+      header->firstseqid >= header->numofstrings) {
+    had_err = -1;
+  }
+  for (idx = 0; !had_err && idx < header->numofseqids; idx++) {
+    const GtFeatureIndexMmapRegion *region = fim->regions + idx;
+    if (region->seqid >= header->numofstrings ||
+        region->firsttree > header->numoftrees ||
+        region->numoftrees > header->numoftrees - region->firsttree) {
+      had_err = -1;
+    }
+    else {
+      GtUword *regionnum = gt_malloc(sizeof *regionnum);
+      *regionnum = idx;
+      gt_hashmap_add(fim->region_of_seqid,
+                     (void*) fim->strings[region->seqid], regionnum);
+    }
+  }
+  if (had_err) {
+    gt_error_set(err, "feature index \"%s\" is corrupt",
+                 gt_str_get(fim->filename));
+  }
+  return had_err;
+}
+
+GtFeatureIndex* gt_feature_index_mmap_open(const char *filename, GtError *err)
+{
+  GtFeatureIndex *fi;
+  GtFeatureIndexMmap *fim;
+  size_t maplen;
+  gt_error_check(err);
+  gt_assert(filename);
+
+  fi = gt_feature_index_create(gt_feature_index_mmap_class());
+  fim = gt_feature_index_mmap_cast(fi);
+  fim->filename = gt_str_new_cstr(filename);
+  fim->region_of_seqid = gt_hashmap_new(GT_HASH_STRING, NULL, gt_free_func);
+  fim->parser = gt_binary_parser_new();
+  fim->decode_lock = gt_mutex_new();
+  if (!(fim->map = gt_fa_mmap_read(filename, &maplen, err)) ||
+      feature_index_mmap_setup(fim, maplen, err) != 0) {
+    gt_feature_index_delete(fi);
+    return NULL;
+  }
+  fim->decoded = gt_calloc((size_t) fim->header->numoftrees,
+                           sizeof (GtGenomeNode*));
+  return fi;
+}
+
+#define GT_FIM_TEST_START        1
+#define GT_FIM_TEST_END          10000000
+#define GT_FIM_TEST_QUERY_WIDTH  50000
+#define GT_FIM_TEST_SEQID        "testseqid"
+
+static int feature_index_mmap_compare_results(GtArray *a, GtArray *b)
+{
+  GtUword idx;
+  if (gt_array_size(a) != gt_array_size(b))
+    return -1;
+  gt_genome_nodes_sort_stable(a);
+  gt_genome_nodes_sort_stable(b);
+  for (idx = 0; idx < gt_array_size(a); idx++) {
+    if (!gt_feature_node_is_similar(*(GtFeatureNode**) gt_array_get(a, idx),
+                                    *(GtFeatureNode**) gt_array_get(b, idx)))
+      return -1;
+  }
+  return 0;
+}
+
+#define GT_FIM_TEST_NOF_RANGES   100
+
+static int feature_index_mmap_test_collect(GtFeatureNode *fn,
+                                           GtUword range_index, void *data,
+                                           GT_UNUSED GtError *err)
+{
+  gt_array_add(((GtArray**) data)[range_index], fn);
+  return 0;
+}
+
+/* compares a batched query of the opened index <fi_opened> with the index
+   <fi> it has been built from */
+static int feature_index_mmap_test_ranges(GtFeatureIndex *fi,
+                                          GtFeatureIndex *fi_opened,
+                                          GtError *err)
+{
+  GtRange ranges[GT_FIM_TEST_NOF_RANGES];
+  GtArray *expected[GT_FIM_TEST_NOF_RANGES],
+          *results[GT_FIM_TEST_NOF_RANGES];
+  GtUword i;
+  int had_err = 0;
+
+  for (i = 0; i < GT_FIM_TEST_NOF_RANGES; i++) {
+    ranges[i].start = random() % (GT_FIM_TEST_END - GT_FIM_TEST_QUERY_WIDTH);
+    ranges[i].end = ranges[i].start + random() % GT_FIM_TEST_QUERY_WIDTH;
+    expected[i] = gt_array_new(sizeof (GtFeatureNode*));
+    results[i] = gt_array_new(sizeof (GtFeatureNode*));
+  }
+  qsort(ranges, GT_FIM_TEST_NOF_RANGES, sizeof (GtRange),
+        (GtCompare) gt_range_compare);
+  gt_ensure(!gt_feature_index_get_features_for_ranges(fi, GT_FIM_TEST_SEQID,
+                                               ranges, GT_FIM_TEST_NOF_RANGES,
+                                               feature_index_mmap_test_collect,
+                                               expected, err));
+  gt_ensure(!gt_feature_index_get_features_for_ranges(fi_opened,
+                                               GT_FIM_TEST_SEQID,
+                                               ranges, GT_FIM_TEST_NOF_RANGES,
+                                               feature_index_mmap_test_collect,
+                                               results, err));
+  for (i = 0; !had_err && i < GT_FIM_TEST_NOF_RANGES; i++)
+    gt_ensure(!feature_index_mmap_compare_results(expected[i], results[i]));
+  for (i = 0; i < GT_FIM_TEST_NOF_RANGES; i++) {
+    gt_array_delete(expected[i]);
+    gt_array_delete(results[i]);
+  }
+  return had_err;
+}
+
+int gt_feature_index_mmap_unit_test(GtError *err)
+{
+  GtFeatureIndex *fi, *fi_opened = NULL;
+  GtArray *expected, *results;
+  GtStrArray *seqids = NULL;
+  GtStr *filename, *seqid;
+  GtGenomeNode *gn;
+  GtRange range, orig_range;
+  GtError *testerr;
+  bool has_seqid;
+  char *firstseqid;
+  FILE *fp;
+  int had_err = 0, i;
+  gt_error_check(err);
+
+  filename = gt_str_new();
+  fp = gt_xtmpfp(filename);
+  gt_fa_xfclose(fp);
+
+  /* run generic feature index tests on an index being built */
+  fi = gt_feature_index_mmap_new(gt_str_get(filename));
+  gt_ensure(fi);
+  had_err = gt_feature_index_unit_test(fi, err);
+
+  /* add a second sequence region without features */
+  seqid = gt_str_new_cstr("another seqid");
+  gn = gt_region_node_new(seqid, 100, 200);
+  gt_ensure(!gt_feature_index_add_region_node(fi, (GtRegionNode*) gn, err));
+  gt_genome_node_delete(gn);
+
+  /* save the index and map it */
+  if (!had_err)
+    had_err = gt_feature_index_save(fi, err);
+  gt_ensure(had_err == 0);
+  if (!had_err) {
+    fi_opened = gt_feature_index_mmap_open(gt_str_get(filename), err);
+    gt_ensure(fi_opened);
+  }
+
+  if (!had_err) {
+    seqids = gt_feature_index_get_seqids(fi_opened, err);
+    gt_ensure(seqids && gt_str_array_size(seqids) == 2);
+  }
+  if (!had_err) {
+    gt_ensure(strcmp(gt_str_array_get(seqids, 0), "another seqid") == 0);
+    firstseqid = gt_feature_index_get_first_seqid(fi_opened, err);
+    gt_ensure(firstseqid && strcmp(firstseqid, GT_FIM_TEST_SEQID) == 0);
+    gt_free(firstseqid);
+    gt_ensure(!gt_feature_index_has_seqid(fi_opened, &has_seqid,
+                                          "another seqid", err));
+    gt_ensure(has_seqid);
+    gt_ensure(!gt_feature_index_has_seqid(fi_opened, &has_seqid,
+                                          "no such seqid", err));
+    gt_ensure(!has_seqid);
+    gt_ensure(!gt_feature_index_get_range_for_seqid(fi_opened, &range,
+                                                    "another seqid", err));
+    gt_ensure(range.start == 100 && range.end == 200);
+    gt_ensure(!gt_feature_index_get_range_for_seqid(fi_opened, &range,
+                                                    GT_FIM_TEST_SEQID, err));
+    gt_ensure(range.start == GT_FIM_TEST_START && range.end == GT_FIM_TEST_END);
+    gt_ensure(!gt_feature_index_get_orig_range_for_seqid(fi, &orig_range,
+                                                         GT_FIM_TEST_SEQID,
+                                                         err));
+    gt_ensure(gt_range_compare(&range, &orig_range) == 0);
+  }
+
+  /* compare random queries against the index the file was built from */
+  expected = gt_array_new(sizeof (GtFeatureNode*));
+  results = gt_array_new(sizeof (GtFeatureNode*));
+  for (i = 0; !had_err && i < 100; i++) {
+    range.start = random() % (GT_FIM_TEST_END - GT_FIM_TEST_QUERY_WIDTH);
+    range.end = range.start + random() % GT_FIM_TEST_QUERY_WIDTH;
+    gt_array_reset(expected);
+    gt_array_reset(results);
+    gt_ensure(!gt_feature_index_get_features_for_range(fi, expected,
+                                                       GT_FIM_TEST_SEQID,
+                                                       &range, err));
+    gt_ensure(!gt_feature_index_get_features_for_range(fi_opened, results,
+                                                       GT_FIM_TEST_SEQID,
+                                                       &range, err));
+    gt_ensure(!feature_index_mmap_compare_results(expected, results));
+  }
+  gt_array_delete(results);
+  gt_array_delete(expected);
+  if (!had_err)
+    had_err = feature_index_mmap_test_ranges(fi, fi_opened, err);
+  if (!had_err) {
+    expected = gt_feature_index_get_features_for_seqid(fi, GT_FIM_TEST_SEQID,
+                                                       err);
+    results = gt_feature_index_get_features_for_seqid(fi_opened,
+                                                      GT_FIM_TEST_SEQID, err);
+    gt_ensure(expected && results);
+    if (!had_err)
+      gt_ensure(!feature_index_mmap_compare_results(expected, results));
+    gt_array_delete(results);
+    gt_array_delete(expected);
+  }
+
+  /* an opened index is read-only */
+  if (!had_err) {
+    testerr = gt_error_new();
+    gn = gt_feature_node_new_standard_gene();
+    gt_ensure(gt_feature_index_add_feature_node(fi_opened,
+                                                gt_feature_node_cast(gn),
+                                                testerr) != 0);
+    gt_ensure(gt_error_is_set(testerr));
+    gt_genome_node_delete(gn);
+    gt_error_delete(testerr);
+  }
+
+  gt_xremove(gt_str_get(filename));
+  gt_str_array_delete(seqids);
+  gt_feature_index_delete(fi_opened);
+  gt_feature_index_delete(fi);
+  gt_str_delete(filename);
+  gt_str_delete(seqid);
+  return had_err;
+}
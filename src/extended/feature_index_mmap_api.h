@@ -0,0 +1,43 @@
+/*
+  Copyright (c) 2026 agent <agent@local>
+
+  Permission to use, copy, modify, and distribute this software for any
+  purpose with or without fee is hereby granted, provided that the above
+  copyright notice and this permission notice appear in all copies.
+
+  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+
+#ifndef FEATURE_INDEX_MMAP_API_H
+#define FEATURE_INDEX_MMAP_API_H
+
+#include "extended/feature_index_api.h"
+
+/* The <GtFeatureIndexMmap> class implements a <GtFeatureIndex> stored in a
+   file which is mapped into memory for querying. For each sequence region,
+   the top-level features are stored in an array sorted by position which is
+   augmented with the maximum end position of an implicit binary search tree,
+   so that range queries only touch the part of the file they need. The
+   feature node trees are stored in the binary format of the
+   <GtBinaryOutStream> and are only decoded when a query returns them. The
+   decoded nodes belong to the index. */
+typedef struct GtFeatureIndexMmap GtFeatureIndexMmap;
+
+/* Creates a new <GtFeatureIndexMmap> object which collects features in
+   memory until they are written to the file <filename> with
+   <gt_feature_index_save()>. */
+GtFeatureIndex* gt_feature_index_mmap_new(const char *filename);
+
+/* Opens the feature index stored in file <filename> for querying. Returns
+   <NULL> and sets <err> if <filename> is not a valid index. Features cannot
+   be added to or removed from an opened index. */
+GtFeatureIndex* gt_feature_index_mmap_open(const char *filename,
+                                           GtError *err);
+
+#endif
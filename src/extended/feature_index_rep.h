@@ -38,6 +38,13 @@ typedef int         (*GtFeatureIndexGetFeatsForRangeFunc)(GtFeatureIndex*,
                                                           const char*,
                                                           const GtRange*,
                                                           GtError*);
+typedef int         (*GtFeatureIndexGetFeatsForRangesFunc)(GtFeatureIndex*,
+                                                           const char*,
+                                                           const GtRange*,
+                                                           GtUword,
+                                                       GtFeatureIndexRangesFunc,
+                                                           void*,
+                                                           GtError*);
 typedef char*       (*GtFeatureIndexGetFirstSeqidFunc)(const GtFeatureIndex*,
                                                        GtError*);
 typedef int         (*GtFeatureIndexSaveFunc)(GtFeatureIndex*, GtError*);
@@ -64,7 +71,7 @@ struct GtFeatureIndex {
   GtFeatureIndexMembers *pvt;
 };
 
-const GtFeatureIndexClass* gt_feature_index_class_new(size_t size,
+GtFeatureIndexClass* gt_feature_index_class_new(size_t size,
                                          GtFeatureIndexAddRegionNodeFunc
                                                  add_region_node,
                                          GtFeatureIndexAddFeatureNodeFunc
@@ -89,6 +96,12 @@ const GtFeatureIndexClass* gt_feature_index_class_new(size_t size,
                                                  has_seqid,
                                          GtFeatureIndexFreeFunc
                                                  free);
+/* Sets the function answering batched range queries. Classes without it
+   answer them with one <get_features_for_range> call per range. */
+void            gt_feature_index_class_set_get_features_for_ranges_func(
+                                            GtFeatureIndexClass*,
+                                            GtFeatureIndexGetFeatsForRangesFunc
+                                            get_features_for_ranges);
 GtFeatureIndex* gt_feature_index_create(const GtFeatureIndexClass*);
 void*           gt_feature_index_cast(const GtFeatureIndexClass*,
                                       GtFeatureIndex*);
@@ -28,11 +28,11 @@
 #include "core/symbol_api.h"
 #include "core/undef_api.h"
 #include "core/unused_api.h"
+#include "extended/attribute_map.h"
 #include "extended/feature_node.h"
 #include "extended/feature_node_rep.h"
 #include "extended/feature_node_iterator_api.h"
 #include "extended/genome_node_rep.h"
-#include "extended/tag_value_map.h"
 
 #define PARENT_STATUS_OFFSET            1
 #define PARENT_STATUS_MASK              0x3
@@ -86,7 +86,7 @@ static void feature_node_free(GtGenomeNode *gn)
   GtFeatureNode *fn = gt_feature_node_cast(gn);
   gt_str_delete(fn->seqid);
   gt_str_delete(fn->source);
-  gt_tag_value_map_delete(fn->attributes);
+  gt_attribute_map_delete(fn->attributes);
   if (fn->children) {
     GtDlistelem *dlistelem;
     for (dlistelem = gt_dlist_first(fn->children);
@@ -107,7 +107,7 @@ const char* gt_feature_node_get_attribute(const GtFeatureNode *fn,
 {
   if (!fn->attributes)
     return NULL;
-  return gt_tag_value_map_get(fn->attributes, attr_name);
+  return gt_attribute_map_get(fn->attributes, attr_name);
 }
 
 static void store_attribute(const char *attr_name,
@@ -122,7 +122,7 @@ GtStrArray* gt_feature_node_get_attribute_list(const GtFeatureNode *fn)
 {
   GtStrArray *list = gt_str_array_new();
   if (fn->attributes)
-    gt_tag_value_map_foreach(fn->attributes, store_attribute, list);
+    gt_attribute_map_foreach(fn->attributes, store_attribute, list);
   return list;
 }
 
@@ -671,9 +671,9 @@ void gt_feature_node_add_attribute(GtFeatureNode *fn,
   gt_assert(strlen(attr_name)); /* attribute name cannot be empty */
   gt_assert(strlen(attr_value)); /* attribute value cannot be empty */
   if (!fn->attributes)
-    fn->attributes = gt_tag_value_map_new(attr_name, attr_value);
+    fn->attributes = gt_attribute_map_new(attr_name, attr_value);
   else
-    gt_tag_value_map_add(&fn->attributes, attr_name, attr_value);
+    gt_attribute_map_add(&fn->attributes, attr_name, attr_value);
   if (fn->observer && fn->observer->attribute_changed) {
     fn->observer->attribute_changed(fn, true, attr_name, attr_value,
                                     fn->observer->data);
@@ -688,9 +688,9 @@ void gt_feature_node_set_attribute(GtFeatureNode *fn,
   gt_assert(strlen(attr_name)); /* attribute name cannot be empty */
   gt_assert(strlen(attr_value)); /* attribute value cannot be empty */
   if (!fn->attributes)
-    fn->attributes = gt_tag_value_map_new(attr_name, attr_value);
+    fn->attributes = gt_attribute_map_new(attr_name, attr_value);
   else
-    gt_tag_value_map_set(&fn->attributes, attr_name, attr_value);
+    gt_attribute_map_set(&fn->attributes, attr_name, attr_value);
   if (fn->observer && fn->observer->attribute_changed) {
     fn->observer->attribute_changed(fn, false, attr_name, attr_value,
                                     fn->observer->data);
@@ -703,11 +703,11 @@ void gt_feature_node_remove_attribute(GtFeatureNode *fn,
   gt_assert(fn && attr_name);
   gt_assert(strlen(attr_name)); /* attribute name cannot be empty */
   gt_assert(fn->attributes); /* attribute list must exist already */
-  if (gt_tag_value_map_size(fn->attributes) == 1) {
-    gt_tag_value_map_delete(fn->attributes);
+  if (gt_attribute_map_size(fn->attributes) == 1) {
+    gt_attribute_map_delete(fn->attributes);
     fn->attributes = NULL;
   } else
-    gt_tag_value_map_remove(&fn->attributes, attr_name);
+    gt_attribute_map_remove(&fn->attributes, attr_name);
   if (fn->observer && fn->observer->attribute_deleted) {
     fn->observer->attribute_deleted(fn, attr_name, fn->observer->data);
   }
@@ -719,7 +719,7 @@ void gt_feature_node_foreach_attribute(GtFeatureNode *fn,
 {
   gt_assert(fn && iterfunc);
   if (fn->attributes) {
-    gt_tag_value_map_foreach(fn->attributes,
+    gt_attribute_map_foreach(fn->attributes,
                              (GtTagValueMapIteratorFunc) iterfunc,
                              data);
   }
@@ -0,0 +1,299 @@
+/*
+  Copyright (c) 2026 agent <agent@local>
+
+  Permission to use, copy, modify, and distribute this software for any
+  purpose with or without fee is hereby granted, provided that the above
+  copyright notice and this permission notice appear in all copies.
+
+  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+
+#include <string.h>
+#include "core/assert_api.h"
+#include "core/ensure_api.h"
+#include "core/hashmap_api.h"
+#include "core/ma_api.h"
+#include "core/mathsupport_api.h"
+#include "core/md5_seqid_api.h"
+#include "core/minmax_api.h"
+#include "core/msort.h"
+#include "core/multithread_api.h"
+#include "core/thread_api.h"
+#include "extended/eof_node_api.h"
+#include "extended/feature_node_api.h"
+#include "extended/genome_node.h"
+#include "extended/gff3_defines.h"
+#include "extended/meta_node_api.h"
+#include "extended/region_node_api.h"
+#include "extended/sequence_node_api.h"
+#include "extended/genome_node_sort.h"
+
+/* minimal number of nodes sorted by one thread */
+#define GT_GENOME_NODES_SORT_MINCHUNK 1024UL
+
+typedef struct
+{
+  unsigned int typerank;
+  GtUword seqidrank,
+          start,
+          end;
+  GtGenomeNode *gn;
+} GtGenomeNodeSortKey;
+
+typedef struct
+{
+  GtGenomeNodeSortKey *src,
+                      *dest;
+  GtUword numofkeys,
+          width, /* length of the sorted parts of <src> */
+          nexttask,
+          numoftasks;
+  GtMutex *mutex;
+} GtGenomeNodesSortInfo;
+
+/* the order of the node types as defined by compare_genome_node_type() in
+   genome_node.c: meta nodes first, then region nodes, all other nodes,
+   sequence nodes and finally EOF nodes */
+static unsigned int gt_genome_node_sort_typerank(GtGenomeNode *gn)
+{
+  GtMetaNode *mn;
+
+  if ((mn = gt_meta_node_try_cast(gn))) {
+    if (strcmp(gt_meta_node_get_directive(mn), GT_GFF_VERSION_DIRECTIVE) == 0)
+      return 0;
+    if (strcmp(gt_meta_node_get_directive(mn), GT_GVF_VERSION_DIRECTIVE) == 0)
+      return 1;
+    return 2;
+  }
+  if (gt_region_node_try_cast(gn))
+    return 3;
+  if (gt_sequence_node_try_cast(gn))
+    return 5;
+  if (gt_eof_node_try_cast(gn))
+    return 6;
+  return 4;
+}
+
+static int gt_genome_node_sort_key_compare(const void *a, const void *b)
+{
+  const GtGenomeNodeSortKey *key_a = (const GtGenomeNodeSortKey *) a,
+                            *key_b = (const GtGenomeNodeSortKey *) b;
+
+  if (key_a->typerank != key_b->typerank)
+    return key_a->typerank < key_b->typerank ? -1 : 1;
+  if (key_a->seqidrank != key_b->seqidrank)
+    return key_a->seqidrank < key_b->seqidrank ? -1 : 1;
+  if (key_a->start != key_b->start)
+    return key_a->start < key_b->start ? -1 : 1;
+  if (key_a->end != key_b->end)
+    return key_a->end < key_b->end ? -1 : 1;
+  return 0;
+}
+
+static int gt_genome_node_sort_seqid_compare(const void *a, const void *b)
+{
+  return gt_md5_seqid_cmp_seqids(*(const char **) a, *(const char **) b);
+}
+
+/* Sequence IDs which are equal with respect to gt_md5_seqid_cmp_seqids() get
+   the same rank. */
+static void gt_genome_nodes_sort_keys_fill(GtGenomeNodeSortKey *keys,
+                                           const GtArray *nodes)
+{
+  GtHashmap *seqid2rank = gt_hashmap_new(GT_HASH_STRING, NULL, gt_free_func);
+  GtArray *seqids = gt_array_new(sizeof (const char *));
+  GtUword idx, rank = 0, **rankptrs = gt_malloc(sizeof *rankptrs *
+                                                gt_array_size(nodes));
+
+  for (idx = 0; idx < gt_array_size(nodes); idx++) {
+    GtGenomeNode *gn = *(GtGenomeNode**) gt_array_get(nodes, idx);
+    const char *seqid = gt_str_get(gt_genome_node_get_idstr(gn));
+    GtRange range = gt_genome_node_get_range(gn);
+
+    keys[idx].gn = gn;
+    keys[idx].typerank = gt_genome_node_sort_typerank(gn);
+    keys[idx].start = range.start;
+    keys[idx].end = range.end;
+    if (!(rankptrs[idx] = gt_hashmap_get(seqid2rank, seqid))) {
+      rankptrs[idx] = gt_malloc(sizeof *rankptrs[idx]);
+      gt_hashmap_add(seqid2rank, (void *) seqid, rankptrs[idx]);
+      gt_array_add(seqids, seqid);
+    }
+  }
+  qsort(gt_array_get_space(seqids), gt_array_size(seqids),
+        sizeof (const char *), gt_genome_node_sort_seqid_compare);
+  for (idx = 0; idx < gt_array_size(seqids); idx++) {
+    const char *seqid = *(const char **) gt_array_get(seqids, idx);
+
+    if (idx > 0 && gt_md5_seqid_cmp_seqids(*(const char **)
+                                           gt_array_get(seqids, idx - 1),
+                                           seqid) != 0) {
+      rank++;
+    }
+    *(GtUword *) gt_hashmap_get(seqid2rank, seqid) = rank;
+  }
+  for (idx = 0; idx < gt_array_size(nodes); idx++)
+    keys[idx].seqidrank = *rankptrs[idx];
+  gt_free(rankptrs);
+  gt_array_delete(seqids);
+  gt_hashmap_delete(seqid2rank);
+}
+
+static GtUword gt_genome_nodes_sort_next_task(GtGenomeNodesSortInfo *info)
+{
+  GtUword task;
+
+  gt_mutex_lock(info->mutex);
+  task = info->nexttask < info->numoftasks ? info->nexttask++ : GT_UWORD_MAX;
+  gt_mutex_unlock(info->mutex);
+  return task;
+}
+
+/* sorts the parts of length <width> of <src> */
+static void *gt_genome_nodes_sort_thread_func(void *data)
+{
+  GtGenomeNodesSortInfo *info = (GtGenomeNodesSortInfo *) data;
+  GtUword task;
+
+  while ((task = gt_genome_nodes_sort_next_task(info)) != GT_UWORD_MAX) {
+    const GtUword start = task * info->width,
+                  end = GT_MIN(start + info->width, info->numofkeys);
+
+    gt_msort(info->src + start, end - start, sizeof *info->src,
+             gt_genome_node_sort_key_compare);
+  }
+  return NULL;
+}
+
+/* merges pairs of consecutive sorted parts of length <width> of <src> into
+   <dest>. If both parts contain equal keys, the key of the left part is taken
+   first, so that the order is stable. */
+static void *gt_genome_nodes_merge_thread_func(void *data)
+{
+  GtGenomeNodesSortInfo *info = (GtGenomeNodesSortInfo *) data;
+  GtUword task;
+
+  while ((task = gt_genome_nodes_sort_next_task(info)) != GT_UWORD_MAX) {
+    const GtUword start = task * 2 * info->width,
+                  mid = GT_MIN(start + info->width, info->numofkeys),
+                  end = GT_MIN(mid + info->width, info->numofkeys);
+    GtUword left = start, right = mid, idx = start;
+
+    while (left < mid && right < end) {
+      if (gt_genome_node_sort_key_compare(info->src + right,
+                                          info->src + left) < 0)
+        info->dest[idx++] = info->src[right++];
+      else
+        info->dest[idx++] = info->src[left++];
+    }
+    if (left < mid) {
+      memcpy(info->dest + idx, info->src + left,
+             sizeof *info->src * (mid - left));
+    }
+    if (right < end) {
+      memcpy(info->dest + idx, info->src + right,
+             sizeof *info->src * (end - right));
+    }
+  }
+  return NULL;
+}
+
+int gt_genome_nodes_sort_stable_parallel(GtArray *nodes, GtError *err)
+{
+  GtGenomeNodesSortInfo info;
+  GtGenomeNodeSortKey *keys, *buffer;
+  GtUword idx, numofparts;
+  int had_err = 0;
+  gt_error_check(err);
+  gt_assert(nodes);
+
+  info.numofkeys = gt_array_size(nodes);
+  if (info.numofkeys < 2)
+    return 0;
+  keys = gt_malloc(sizeof *keys * info.numofkeys);
+  gt_genome_nodes_sort_keys_fill(keys, nodes);
+  numofparts = GT_MIN((GtUword) gt_jobs,
+                      1 + (info.numofkeys - 1) / GT_GENOME_NODES_SORT_MINCHUNK);
+  if (numofparts <= 1) {
+    gt_msort(keys, info.numofkeys, sizeof *keys,
+             gt_genome_node_sort_key_compare);
+  }
+  else {
+    buffer = gt_malloc(sizeof *buffer * info.numofkeys);
+    info.mutex = gt_mutex_new();
+    info.src = keys;
+    info.dest = buffer;
+    info.width = 1 + (info.numofkeys - 1) / numofparts;
+    info.nexttask = 0;
+    info.numoftasks = numofparts;
+    had_err = gt_multithread(gt_genome_nodes_sort_thread_func, &info, err);
+    while (!had_err && info.width < info.numofkeys) {
+      GtGenomeNodeSortKey *tmp;
+
+      info.nexttask = 0;
+      info.numoftasks = 1 + (info.numofkeys - 1) / (2 * info.width);
+      had_err = gt_multithread(gt_genome_nodes_merge_thread_func, &info, err);
+      tmp = info.src;
+      info.src = info.dest;
+      info.dest = tmp;
+      info.width *= 2;
+    }
+    if (!had_err && info.src != keys)
+      memcpy(keys, info.src, sizeof *keys * info.numofkeys);
+    gt_mutex_delete(info.mutex);
+    gt_free(buffer);
+  }
+  if (!had_err) {
+    for (idx = 0; idx < info.numofkeys; idx++)
+      *(GtGenomeNode**) gt_array_get(nodes, idx) = keys[idx].gn;
+  }
+  gt_free(keys);
+  return had_err;
+}
+
+int gt_genome_nodes_sort_unit_test(GtError *err)
+{
+  const char *seqids[] = {"chr10", "chr2", "ctg123", "chr2"};
+  GtArray *nodes, *expected, *sorted;
+  GtUword idx, numofnodes = 5000, numofseqids = sizeof seqids/sizeof *seqids;
+  int had_err = 0;
+  gt_error_check(err);
+
+  nodes = gt_array_new(sizeof (GtGenomeNode*));
+  for (idx = 0; idx < numofseqids; idx++) {
+    GtStr *seqid = gt_str_new_cstr(seqids[idx]);
+    GtGenomeNode *gn = gt_region_node_new(seqid, 1, 100000);
+    gt_array_add(nodes, gn);
+    gt_str_delete(seqid);
+  }
+  for (idx = 0; idx < numofnodes; idx++) {
+    GtStr *seqid = gt_str_new_cstr(seqids[gt_rand_max(numofseqids - 1)]);
+    GtUword start = 1 + gt_rand_max(1000);
+    GtGenomeNode *gn = gt_feature_node_new(seqid, "gene", start,
+                                           start + gt_rand_max(10),
+                                           GT_STRAND_FORWARD);
+    gt_array_add(nodes, gn);
+    gt_str_delete(seqid);
+  }
+  expected = gt_array_clone(nodes);
+  gt_genome_nodes_sort_stable(expected);
+  /* the number of jobs is set with the -j option of gt -test */
+  sorted = gt_array_clone(nodes);
+  had_err = gt_genome_nodes_sort_stable_parallel(sorted, err);
+  for (idx = 0; !had_err && idx < gt_array_size(sorted); idx++) {
+    gt_ensure(*(GtGenomeNode**) gt_array_get(sorted, idx) ==
+              *(GtGenomeNode**) gt_array_get(expected, idx));
+  }
+  gt_array_delete(sorted);
+  for (idx = 0; idx < gt_array_size(nodes); idx++)
+    gt_genome_node_delete(*(GtGenomeNode**) gt_array_get(nodes, idx));
+  gt_array_delete(nodes);
+  gt_array_delete(expected);
+  return had_err;
+}
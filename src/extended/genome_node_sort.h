@@ -0,0 +1,34 @@
+/*
+  Copyright (c) 2026 agent <agent@local>
+
+  Permission to use, copy, modify, and distribute this software for any
+  purpose with or without fee is hereby granted, provided that the above
+  copyright notice and this permission notice appear in all copies.
+
+  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+
+#ifndef GENOME_NODE_SORT_H
+#define GENOME_NODE_SORT_H
+
+#include "core/array_api.h"
+#include "core/error_api.h"
+
+/* Sort the <GtGenomeNode*> objects stored in <nodes> in the same order as
+   <gt_genome_nodes_sort_stable()>. Before sorting, a key consisting of the
+   rank of the node type, the rank of the sequence ID and the range is
+   computed for each node, so that the nodes are compared without looking at
+   the sequence ID strings. The keys are sorted by a merge sort using
+   <gt_jobs> threads. Returns 0 on success and -1 if the threads could not be
+   started, in which case <err> is set. */
+int gt_genome_nodes_sort_stable_parallel(GtArray *nodes, GtError *err);
+
+int gt_genome_nodes_sort_unit_test(GtError *err);
+
+#endif
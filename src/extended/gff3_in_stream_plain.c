@@ -23,6 +23,7 @@
 #include "core/queue.h"
 #include "core/progressbar.h"
 #include "core/str_array.h"
+#include "extended/binary_parser.h"
 #include "extended/genome_node.h"
 #include "extended/gff3_in_stream_plain.h"
 #include "extended/gff3_parser.h"
@@ -37,11 +38,13 @@ struct GtGFF3InStreamPlain {
        stdin_argument,
        stdin_processed,
        file_is_open,
+       file_is_binary,
        progress_bar;
   GtFile *fpin;
   GtUint64 line_number;
   GtQueue *genome_node_buffer;
   GtGFF3Parser *gff3_parser;
+  GtBinaryParser *binary_parser;
   GtCstrTable *used_types;
 };
 
@@ -71,6 +74,25 @@ static int buffer_is_sorted(void **elem, void *info, GtError *err)
   return 0;
 }
 
+/* files written by a <GtBinaryOutStream> are recognized automatically, the
+   settings of the GFF3 parser do not apply to them */
+static int gff3_in_stream_plain_parse(GtGFF3InStreamPlain *is,
+                                      int *status_code, GtStr *filenamestr,
+                                      GtError *err)
+{
+  if (is->file_is_binary) {
+    return gt_binary_parser_parse_genome_nodes(is->binary_parser, status_code,
+                                               is->genome_node_buffer,
+                                               is->used_types, filenamestr,
+                                               &is->line_number, is->fpin,
+                                               err);
+  }
+  return gt_gff3_parser_parse_genome_nodes(is->gff3_parser, status_code,
+                                           is->genome_node_buffer,
+                                           is->used_types, filenamestr,
+                                           &is->line_number, is->fpin, err);
+}
+
 static int gff3_in_stream_plain_next(GtNodeStream *ns, GtGenomeNode **gn,
                                      GtError *err)
 {
@@ -121,6 +143,7 @@ static int gff3_in_stream_plain_next(GtNodeStream *ns, GtGenomeNode **gn,
         is->file_is_open = true;
       }
       is->line_number = 0;
+      is->file_is_binary = gt_binary_parser_file_is_binary(is->fpin);
 
       if (!had_err && is->progress_bar) {
         printf("processing file \"%s\"\n", gt_str_array_size(is->files)
@@ -139,19 +162,12 @@ static int gff3_in_stream_plain_next(GtNodeStream *ns, GtGenomeNode **gn,
                   ? gt_str_array_get_str(is->files, is->next_file-1)
                   : is->stdinstr;
     /* read two nodes */
-    had_err = gt_gff3_parser_parse_genome_nodes(is->gff3_parser, &status_code,
-                                                is->genome_node_buffer,
-                                                is->used_types, filenamestr,
-                                                &is->line_number, is->fpin,
-                                                err);
+    had_err = gff3_in_stream_plain_parse(is, &status_code, filenamestr, err);
     if (had_err)
       break;
     if (status_code != EOF) {
-      had_err = gt_gff3_parser_parse_genome_nodes(is->gff3_parser, &status_code,
-                                                  is->genome_node_buffer,
-                                                  is->used_types, filenamestr,
-                                                  &is->line_number, is->fpin,
-                                                  err);
+      had_err = gff3_in_stream_plain_parse(is, &status_code, filenamestr,
+                                           err);
       if (had_err)
         break;
     }
@@ -163,6 +179,7 @@ static int gff3_in_stream_plain_next(GtNodeStream *ns, GtGenomeNode **gn,
       is->fpin = NULL;
       is->file_is_open = false;
       gt_gff3_parser_reset(is->gff3_parser);
+      gt_binary_parser_reset(is->binary_parser);
       if (!gt_str_array_size(is->files)) {
         is->stdin_processed = true;
         break;
@@ -202,6 +219,7 @@ static void gff3_in_stream_plain_free(GtNodeStream *ns)
   }
   gt_queue_delete(gff3_in_stream_plain->genome_node_buffer);
   gt_gff3_parser_delete(gff3_in_stream_plain->gff3_parser);
+  gt_binary_parser_delete(gff3_in_stream_plain->binary_parser);
   gt_cstr_table_delete(gff3_in_stream_plain->used_types);
   gt_file_delete(gff3_in_stream_plain->fpin);
 }
@@ -231,6 +249,7 @@ static GtNodeStream* gff3_in_stream_plain_new(GtStrArray *files,
   gff3_in_stream_plain->ensure_sorting      = ensure_sorting;
   gff3_in_stream_plain->genome_node_buffer  = gt_queue_new();
   gff3_in_stream_plain->gff3_parser         = gt_gff3_parser_new(NULL);
+  gff3_in_stream_plain->binary_parser       = gt_binary_parser_new();
   gff3_in_stream_plain->used_types          = gt_cstr_table_new();
   return ns;
 }
@@ -21,6 +21,7 @@
 #include <fcntl.h>
 #include <math.h>
 #include <stdio.h>
+#include <string.h>
 #include <sys/stat.h>
 #include <unistd.h>
 
@@ -35,9 +36,12 @@
 #include "core/intbits.h"
 #include "core/log_api.h"
 #include "core/ma_api.h"
+#include "core/minmax_api.h"
+#include "core/multithread_api.h"
 #include "core/safearith_api.h"
 #include "core/seq_iterator_fastq_api.h"
 #include "core/str_array.h"
+#include "core/thread_api.h"
 #include "core/undef_api.h"
 #include "core/unused_api.h"
 #include "core/xansi_api.h"
@@ -55,6 +59,10 @@
 #define HCR_DESCSEPSEQ '@'
 #define HCR_DESCSEPQUAL '+'
 #define HCR_PAGES_PER_CHUNK 10UL
+#define HCR_BLOCKS_PER_JOB 4UL
+#define HCR_POSBUCKETS 4UL
+#define HCR_NUMOFCONTEXTS ((HCR_HIGHESTQUALVALUE + 2UL) * HCR_POSBUCKETS)
+#define HCR_CONTEXTMARKER GT_UWORD_MAX
 
 typedef struct GtBaseQualDistr {
   GtUint64 **distr;
@@ -78,7 +86,8 @@ typedef struct GtHcrSeqEncoder {
   GtQualRange    qrange;
   FastqFileInfo *fileinfos;
   GtAlphabet    *alpha;
-  GtHuffman     *huffman;
+  GtHuffman     *huffman,
+               **ctx_huffman;
   GtSampling    *sampling;
   GtUint64       total_num_of_symbols;
   GtUword        num_of_files;
@@ -99,6 +108,48 @@ struct GtHcrEncoder {
                     regular_sampling;
 };
 
+/* A range of consecutive reads of a <HcrEncodeBatch>, encoded by one thread
+   into <bits>. */
+typedef struct {
+  GtBitsequence *bits;
+  GtUword        firstread,
+                 endread,
+                 allocatedwords;
+} HcrEncodeBlock;
+
+/* The reads collected from the input files, waiting to be encoded in
+   parallel. The symbols of read <i> are stored at
+   <seqs>[<symbolstart>[i]..<symbolstart>[i+1]-1], the same holds for
+   <quals>. */
+typedef struct {
+  GtHcrSeqEncoder *seq_encoder;
+  HcrEncodeBlock  *blocks;
+  GtMutex         *mutex;
+  GtUchar         *seqs,
+                  *quals;
+  GtUword         *symbolstart,
+                  *wordstart,
+                  *numofbits,
+                   numofreads,
+                   allocatedreads,
+                   numofsymbols,
+                   allocatedsymbols,
+                   maxnumofsymbols,
+                   blocksymbols,
+                   numofblocks,
+                   allocatedblocks,
+                   nextblock;
+} HcrEncodeBatch;
+
+/* The state of the writer, needed to place the samples. */
+typedef struct {
+  GtUword read_counter,
+          page_counter,
+          bits_left_in_page,
+          cur_read,
+          pagesize;
+} HcrWriteState;
+
 typedef struct hcr_huff_mem_info {
   char         *path;
   void         *data;
@@ -117,7 +168,8 @@ typedef struct GtHcrSeqDecoder {
   GtAlphabet          *alpha;
   GtArray             *symbols;
   GtBitsequence       *bitseq_buffer;
-  GtHuffman           *huffman;
+  GtHuffman           *huffman,
+                     **ctx_huffman;
   GtHuffmanDecoder    *huff_dec;
   GtRBTree            *file_info_rbt;
   GtSampling          *sampling;
@@ -132,6 +184,30 @@ typedef struct GtHcrSeqDecoder {
                        qual_offset;
 } GtHcrSeqDecoder;
 
+/* The reads <firstread>..<endread>-1, decoded by one thread starting at the
+   sample of read <sampledread>, found at <startpos>. The formatted lines of
+   read <firstread>+i start at <textstart>[i] in <text>. */
+typedef struct {
+  GtStr   *text;
+  GtUword *textstart,
+           sampledread,
+           firstread,
+           endread;
+  size_t   startpos;
+} HcrDecodeBlock;
+
+typedef struct {
+  GtHcrSeqDecoder *seq_dec;
+  HcrDecodeBlock  *blocks;
+  GtMutex         *mutex;
+  GtError         *err;
+  GtUword          numofblocks,
+                   nextblock,
+                   maxreadlength,
+                   width;
+  bool             had_err;
+} HcrDecodeInfo;
+
 struct GtHcrDecoder {
   GtEncdesc       *encdesc;
   GtHcrSeqDecoder *seq_dec;
@@ -143,6 +219,15 @@ typedef struct WriteNodeInfo {
   unsigned    qual_offset;
 } WriteNodeInfo;
 
+/* Returns the context of the symbol at position <pos> of a read of length
+   <len>, following a symbol with quality value <prev_qual>. The first symbol
+   of a read has no previous quality value. */
+static inline GtUword hcr_context(GtUword pos, GtUword len, unsigned prev_qual)
+{
+  return (pos == 0 ? 0 : (GtUword) prev_qual + 1) * HCR_POSBUCKETS +
+         pos * HCR_POSBUCKETS / len;
+}
+
 static GtUint64 hcr_base_qual_distr_func(const void *distr,
                                                    GtUword symbol)
 {
@@ -173,55 +258,6 @@ static void hcr_base_qual_distr_trim(GtBaseQualDistr *bqd)
   }
 }
 
-static GtBaseQualDistr* hcr_base_qual_distr_new_from_file(FILE *fp,
-                                                          GtAlphabet *alpha)
-{
-  GtBaseQualDistr *bqd;
-  char read_char_code;
-  GtUchar cur_char_code;
-  unsigned char cur_qual;
-  unsigned alpha_size,
-           min_qual = HCR_HIGHESTQUALVALUE,
-           max_qual = HCR_LOWESTQUALVALUE;
-  GtUword numofleaves,
-                i;
-  GtUint64 cur_freq;
-  GT_UNUSED size_t read,
-            one = (size_t) 1;
-
-  alpha_size = gt_alphabet_size(alpha);
-  bqd = gt_malloc(sizeof (GtBaseQualDistr));
-  gt_array2dim_calloc(bqd->distr, HCR_HIGHESTQUALVALUE + 1UL, alpha_size)
-  bqd->ncols = alpha_size;
-  bqd->nrows = HCR_HIGHESTQUALVALUE + 1U;
-  bqd->qual_offset = HCR_LOWESTQUALVALUE;
-  bqd->wildcard_indx = alpha_size - 1;
-
-  read = gt_xfread_one(&numofleaves, fp);
-  gt_assert(read == one);
-  for (i = 0; i < numofleaves; i++) {
-    read = gt_xfread_one(&read_char_code, fp);
-    gt_assert(read == one);
-    read = gt_xfread_one(&cur_qual, fp);
-    gt_assert(read == one);
-    read = gt_xfread_one(&cur_freq, fp);
-    gt_assert(read == one);
-    cur_char_code = gt_alphabet_encode(alpha, read_char_code);
-    if (cur_char_code == (GtUchar) GT_WILDCARD)
-      gt_safe_assign(cur_char_code, bqd->wildcard_indx);
-    bqd->distr[cur_qual][cur_char_code] = cur_freq;
-    if ((unsigned) cur_qual > max_qual)
-      max_qual = cur_qual;
-    if ((unsigned) cur_qual < min_qual)
-      min_qual = cur_qual;
-  }
-
-  bqd->min_qual = min_qual;
-  bqd->max_qual = max_qual;
-  hcr_base_qual_distr_trim(bqd);
-  return bqd;
-}
-
 static GtBaseQualDistr* hcr_base_qual_distr_new(GtAlphabet *alpha,
                                                 GtQualRange qrange)
 {
@@ -242,12 +278,17 @@ static GtBaseQualDistr* hcr_base_qual_distr_new(GtAlphabet *alpha,
   return bqd;
 }
 
-static int hcr_base_qual_distr_add(GtBaseQualDistr *bqd, const GtUchar *qual,
+/* Adds the <base, quality> pairs of a read to <bqd>. If <ctx_bqd> is not NULL,
+   they are also added to the distribution of their context. */
+static int hcr_base_qual_distr_add(GtBaseQualDistr *bqd,
+                                   GtBaseQualDistr **ctx_bqd,
+                                   const GtUchar *qual,
                                    const GtUchar *seq, GtUword len)
 {
   GtUword i;
   unsigned cur_char_code,
-           cur_qual;
+           cur_qual,
+           prev_qual = 0;
 
   for (i = 0; i < len; i++) {
     cur_char_code = (unsigned) gt_alphabet_encode(bqd->alpha,
@@ -265,13 +306,21 @@ static int hcr_base_qual_distr_add(GtBaseQualDistr *bqd, const GtUchar *qual,
         cur_qual = bqd->qrange_end;
     }
     if (cur_char_code == GT_WILDCARD)
-      bqd->distr[cur_qual][bqd->wildcard_indx]++;
-    else
-      bqd->distr[cur_qual][cur_char_code]++;
+      cur_char_code = bqd->wildcard_indx;
+    bqd->distr[cur_qual][cur_char_code]++;
     if (cur_qual > bqd->max_qual)
       bqd->max_qual = cur_qual;
     if (cur_qual < bqd->min_qual)
       bqd->min_qual = cur_qual;
+    if (ctx_bqd != NULL) {
+      GtUword ctxnum = hcr_context(i, len, prev_qual);
+      if (ctx_bqd[ctxnum] == NULL) {
+        GtQualRange qrange = {bqd->qrange_start, bqd->qrange_end};
+        ctx_bqd[ctxnum] = hcr_base_qual_distr_new(bqd->alpha, qrange);
+      }
+      ctx_bqd[ctxnum]->distr[cur_qual][cur_char_code]++;
+      prev_qual = cur_qual;
+    }
   }
   return 0;
 }
@@ -284,6 +333,140 @@ static void hcr_base_qual_distr_delete(GtBaseQualDistr *bqd)
   gt_free(bqd);
 }
 
+/* Reads <numofleaves> <base, quality> pairs with their frequencies from <fp>
+   into <bqd>. The frequencies are also added to <total>, which keeps track of
+   the smallest and largest quality value. */
+static void hcr_base_qual_distr_read_leaves(GtBaseQualDistr *bqd,
+                                            GtBaseQualDistr *total,
+                                            GtUword numofleaves, FILE *fp)
+{
+  char read_char_code;
+  GtUchar cur_char_code;
+  unsigned char cur_qual;
+  GtUword i;
+  GtUint64 cur_freq;
+  GT_UNUSED size_t read,
+            one = (size_t) 1;
+
+  for (i = 0; i < numofleaves; i++) {
+    read = gt_xfread_one(&read_char_code, fp);
+    gt_assert(read == one);
+    read = gt_xfread_one(&cur_qual, fp);
+    gt_assert(read == one);
+    read = gt_xfread_one(&cur_freq, fp);
+    gt_assert(read == one);
+    cur_char_code = gt_alphabet_encode(bqd->alpha, read_char_code);
+    if (cur_char_code == (GtUchar) GT_WILDCARD)
+      gt_safe_assign(cur_char_code, bqd->wildcard_indx);
+    bqd->distr[cur_qual][cur_char_code] = cur_freq;
+    if (total != bqd)
+      total->distr[cur_qual][cur_char_code] += cur_freq;
+    if ((unsigned) cur_qual > total->max_qual)
+      total->max_qual = cur_qual;
+    if ((unsigned) cur_qual < total->min_qual)
+      total->min_qual = cur_qual;
+  }
+}
+
+/* Trims the distributions of all contexts to the quality values occurring in
+   <bqd>, so all of them share the same quality offset. */
+static void hcr_base_qual_distr_trim_contexts(GtBaseQualDistr **ctx_bqd,
+                                              const GtBaseQualDistr *bqd)
+{
+  GtUword i;
+
+  for (i = 0; i < HCR_NUMOFCONTEXTS; i++) {
+    if (ctx_bqd[i] != NULL) {
+      ctx_bqd[i]->min_qual = bqd->min_qual;
+      ctx_bqd[i]->max_qual = bqd->max_qual;
+      hcr_base_qual_distr_trim(ctx_bqd[i]);
+    }
+  }
+}
+
+/* Reads the <base, quality> distribution from <fp>. If the file contains one
+   distribution for every context, these are stored in the new array
+   <*ctx_bqd> and the returned distribution is their sum, otherwise <*ctx_bqd>
+   is set to NULL. */
+static GtBaseQualDistr* hcr_base_qual_distr_new_from_file(FILE *fp,
+                                                    GtAlphabet *alpha,
+                                                    GtBaseQualDistr ***ctx_bqd)
+{
+  GtBaseQualDistr *bqd;
+  GtQualRange qrange = {GT_UNDEF_UINT, GT_UNDEF_UINT};
+  GtUword numofleaves,
+          numofcontexts,
+          ctxnum,
+          i;
+  GT_UNUSED size_t read,
+            one = (size_t) 1;
+
+  bqd = hcr_base_qual_distr_new(alpha, qrange);
+  *ctx_bqd = NULL;
+
+  read = gt_xfread_one(&numofleaves, fp);
+  gt_assert(read == one);
+  if (numofleaves == HCR_CONTEXTMARKER) {
+    *ctx_bqd = gt_calloc((size_t) HCR_NUMOFCONTEXTS, sizeof (**ctx_bqd));
+    read = gt_xfread_one(&numofcontexts, fp);
+    gt_assert(read == one);
+    for (i = 0; i < numofcontexts; i++) {
+      read = gt_xfread_one(&ctxnum, fp);
+      gt_assert(read == one && ctxnum < HCR_NUMOFCONTEXTS);
+      read = gt_xfread_one(&numofleaves, fp);
+      gt_assert(read == one);
+      (*ctx_bqd)[ctxnum] = hcr_base_qual_distr_new(alpha, qrange);
+      hcr_base_qual_distr_read_leaves((*ctx_bqd)[ctxnum], bqd, numofleaves,
+                                      fp);
+    }
+    hcr_base_qual_distr_trim_contexts(*ctx_bqd, bqd);
+  }
+  else
+    hcr_base_qual_distr_read_leaves(bqd, bqd, numofleaves, fp);
+
+  hcr_base_qual_distr_trim(bqd);
+  return bqd;
+}
+
+static void hcr_base_qual_distr_delete_contexts(GtBaseQualDistr **ctx_bqd)
+{
+  GtUword i;
+
+  if (ctx_bqd == NULL)
+    return;
+  for (i = 0; i < HCR_NUMOFCONTEXTS; i++)
+    hcr_base_qual_distr_delete(ctx_bqd[i]);
+  gt_free(ctx_bqd);
+}
+
+/* Returns an array of <HCR_NUMOFCONTEXTS> Huffman codes, one for every context
+   with a distribution in <ctx_bqd>, the others are NULL. */
+static GtHuffman **hcr_context_huffmans_new(GtBaseQualDistr **ctx_bqd)
+{
+  GtHuffman **ctx_huffman = gt_calloc((size_t) HCR_NUMOFCONTEXTS,
+                                      sizeof (*ctx_huffman));
+  GtUword i;
+
+  for (i = 0; i < HCR_NUMOFCONTEXTS; i++) {
+    if (ctx_bqd[i] != NULL)
+      ctx_huffman[i] = gt_huffman_new(ctx_bqd[i], hcr_base_qual_distr_func,
+                                      (GtUword) ctx_bqd[i]->ncols *
+                                        ctx_bqd[i]->nrows);
+  }
+  return ctx_huffman;
+}
+
+static void hcr_context_huffmans_delete(GtHuffman **ctx_huffman)
+{
+  GtUword i;
+
+  if (ctx_huffman == NULL)
+    return;
+  for (i = 0; i < HCR_NUMOFCONTEXTS; i++)
+    gt_huffman_delete(ctx_huffman[i]);
+  gt_free(ctx_huffman);
+}
+
 static int hcr_cmp_FastqFileInfo(const void *node1, const void *node2,
                                  GT_UNUSED void *unused)
 {
@@ -299,74 +482,301 @@ static int hcr_cmp_FastqFileInfo(const void *node1, const void *node2,
   return 0;
 }
 
-static GtUword hcr_write_seq(GtHcrSeqEncoder *seq_encoder,
-                                   const GtUchar *seq,
-                                   const GtUchar *qual,
-                                   GtUword len,
-                                   GtBitOutStream *bitstream,
-                                   bool dry)
+static inline GtUword hcr_encode_symbol(const GtHcrSeqEncoder *seq_encoder,
+                                        GtUchar base, GtUchar qual)
 {
-  unsigned bits_to_write,
-           cur_char_code,
-           cur_qual,
-           symbol;
-  GtUword i,
-                written_bits = 0;
-  GtBitsequence code;
+  unsigned cur_char_code = (unsigned) base,
+           cur_qual = (unsigned) qual;
 
-  for (i = 0; i < len; i++) {
-    cur_char_code = (unsigned) seq[i];
+  if (cur_char_code == GT_WILDCARD)
+    cur_char_code = gt_alphabet_size(seq_encoder->alpha) - 1;
 
-    if (cur_char_code == GT_WILDCARD)
-      cur_char_code = gt_alphabet_size(seq_encoder->alpha) - 1;
+  if (seq_encoder->qrange.start != GT_UNDEF_UINT) {
+    if (cur_qual <= seq_encoder->qrange.start)
+      cur_qual = seq_encoder->qrange.start;
+  }
 
-    cur_qual = (unsigned) qual[i];
+  if (seq_encoder->qrange.end != GT_UNDEF_UINT) {
+    if (cur_qual >= seq_encoder->qrange.end)
+      cur_qual = seq_encoder->qrange.end;
+  }
 
-    if (seq_encoder->qrange.start != GT_UNDEF_UINT) {
-      if (cur_qual <= seq_encoder->qrange.start)
-        cur_qual = seq_encoder->qrange.start;
+  cur_qual = cur_qual - seq_encoder->qual_offset;
+
+  return (GtUword) (gt_alphabet_size(seq_encoder->alpha) * cur_qual +
+                    cur_char_code);
+}
+
+/* Encodes the reads of <block> into <block->bits>. The encoding of every read
+   starts at a new <GtBitsequence>, so the writer can append them one by one
+   and still decide about the sampling between reads. */
+static void hcr_encode_block(HcrEncodeBatch *batch, HcrEncodeBlock *block)
+{
+  const GtHcrSeqEncoder *seq_encoder = batch->seq_encoder;
+  const GtHuffman *huffman = seq_encoder->huffman;
+  GtUword readnum,
+          i,
+          symbol,
+          bitpos = 0;
+  unsigned alphasize = gt_alphabet_size(seq_encoder->alpha),
+           prev_qual = 0;
+
+  if (block->allocatedwords > 0)
+    memset(block->bits, 0, block->allocatedwords * sizeof (*block->bits));
+  for (readnum = block->firstread; readnum < block->endread; readnum++) {
+    const GtUchar *seq = batch->seqs + batch->symbolstart[readnum],
+                  *qual = batch->quals + batch->symbolstart[readnum];
+    GtUword len = batch->symbolstart[readnum + 1] -
+                  batch->symbolstart[readnum],
+            startpos;
+
+    bitpos = GT_DIVWORDSIZE(bitpos + GT_INTWORDSIZE - 1) * GT_INTWORDSIZE;
+    startpos = bitpos;
+    batch->wordstart[readnum] = GT_DIVWORDSIZE(bitpos);
+    for (i = 0; i < len; i++) {
+      GtBitsequence code;
+      GtUword word;
+      unsigned bits_to_write,
+               bits_free;
+
+      symbol = hcr_encode_symbol(seq_encoder, seq[i], qual[i]);
+      if (seq_encoder->ctx_huffman != NULL) {
+        huffman = seq_encoder->ctx_huffman[hcr_context(i, len, prev_qual)];
+        gt_safe_assign(prev_qual,
+                       (symbol / alphasize + seq_encoder->qual_offset));
+      }
+      gt_huffman_encode(huffman, symbol, &code, &bits_to_write);
+      word = GT_DIVWORDSIZE(bitpos);
+      if (word + 1 >= block->allocatedwords) {
+        GtUword oldsize = block->allocatedwords;
+        block->allocatedwords += block->allocatedwords / 2 + 2;
+        block->bits = gt_realloc(block->bits, block->allocatedwords *
+                                                sizeof (*block->bits));
+        memset(block->bits + oldsize, 0,
+               (block->allocatedwords - oldsize) * sizeof (*block->bits));
+      }
+      bits_free = (unsigned) (GT_INTWORDSIZE - GT_MODWORDSIZE(bitpos));
+      if (bits_to_write <= bits_free)
+        block->bits[word] |= code << (bits_free - bits_to_write);
+      else {
+        block->bits[word] |= code >> (bits_to_write - bits_free);
+        block->bits[word + 1] |=
+          code << (GT_INTWORDSIZE - (bits_to_write - bits_free));
+      }
+      bitpos += bits_to_write;
     }
+    batch->numofbits[readnum] = bitpos - startpos;
+  }
+}
 
-    if (seq_encoder->qrange.end != GT_UNDEF_UINT) {
-      if (cur_qual >= seq_encoder->qrange.end)
-        cur_qual = seq_encoder->qrange.end;
+static void *hcr_encode_thread_func(void *data)
+{
+  HcrEncodeBatch *batch = (HcrEncodeBatch*) data;
+
+  while (true) {
+    GtUword blocknum;
+
+    gt_mutex_lock(batch->mutex);
+    blocknum = batch->nextblock < batch->numofblocks ? batch->nextblock++
+                                                     : GT_UWORD_MAX;
+    gt_mutex_unlock(batch->mutex);
+    if (blocknum == GT_UWORD_MAX)
+      break;
+    hcr_encode_block(batch, batch->blocks + blocknum);
+  }
+  return NULL;
+}
+
+static HcrEncodeBatch *hcr_encode_batch_new(GtHcrSeqEncoder *seq_encoder,
+                                            GtUword blocksymbols)
+{
+  HcrEncodeBatch *batch = gt_calloc((size_t) 1, sizeof (*batch));
+  batch->seq_encoder = seq_encoder;
+  batch->blocksymbols = blocksymbols;
+  batch->maxnumofsymbols = blocksymbols * HCR_BLOCKS_PER_JOB * gt_jobs;
+  batch->mutex = gt_mutex_new();
+  return batch;
+}
+
+static void hcr_encode_batch_add(HcrEncodeBatch *batch, const GtUchar *seq,
+                                 const GtUchar *qual, GtUword len)
+{
+  if (batch->numofreads + 1 >= batch->allocatedreads) {
+    batch->allocatedreads += batch->allocatedreads / 2 + 16;
+    batch->symbolstart = gt_realloc(batch->symbolstart,
+                                    batch->allocatedreads *
+                                      sizeof (*batch->symbolstart));
+    batch->wordstart = gt_realloc(batch->wordstart, batch->allocatedreads *
+                                                sizeof (*batch->wordstart));
+    batch->numofbits = gt_realloc(batch->numofbits, batch->allocatedreads *
+                                                sizeof (*batch->numofbits));
+  }
+  if (batch->numofsymbols + len > batch->allocatedsymbols) {
+    batch->allocatedsymbols = GT_MAX(batch->numofsymbols + len,
+                                     batch->maxnumofsymbols);
+    batch->seqs = gt_realloc(batch->seqs, batch->allocatedsymbols *
+                                            sizeof (*batch->seqs));
+    batch->quals = gt_realloc(batch->quals, batch->allocatedsymbols *
+                                              sizeof (*batch->quals));
+  }
+  memcpy(batch->seqs + batch->numofsymbols, seq, len * sizeof (*seq));
+  memcpy(batch->quals + batch->numofsymbols, qual, len * sizeof (*qual));
+  batch->symbolstart[batch->numofreads++] = batch->numofsymbols;
+  batch->numofsymbols += len;
+  batch->symbolstart[batch->numofreads] = batch->numofsymbols;
+}
+
+static bool hcr_encode_batch_is_full(const HcrEncodeBatch *batch)
+{
+  return batch->numofsymbols >= batch->maxnumofsymbols;
+}
+
+/* Splits the reads of <batch> into blocks of about <blocksymbols> symbols and
+   encodes these on <gt_jobs> threads. */
+static int hcr_encode_batch_encode(HcrEncodeBatch *batch, GtError *err)
+{
+  GtUword readnum,
+          blockstart = 0;
+
+  batch->numofblocks = 0;
+  for (readnum = 0; readnum < batch->numofreads; readnum++) {
+    if (readnum + 1 == batch->numofreads ||
+        batch->symbolstart[readnum + 1] - batch->symbolstart[blockstart] >=
+          batch->blocksymbols) {
+      HcrEncodeBlock *block;
+      if (batch->numofblocks == batch->allocatedblocks) {
+        batch->allocatedblocks += batch->allocatedblocks / 2 + 4;
+        batch->blocks = gt_realloc(batch->blocks, batch->allocatedblocks *
+                                                    sizeof (*batch->blocks));
+        memset(batch->blocks + batch->numofblocks, 0,
+               (batch->allocatedblocks - batch->numofblocks) *
+                 sizeof (*batch->blocks));
+      }
+      block = batch->blocks + batch->numofblocks++;
+      block->firstread = blockstart;
+      block->endread = readnum + 1;
+      blockstart = readnum + 1;
     }
+  }
+  batch->nextblock = 0;
+  return gt_multithread(hcr_encode_thread_func, batch, err);
+}
 
-    cur_qual = cur_qual - seq_encoder->qual_offset;
+static void hcr_encode_batch_reset(HcrEncodeBatch *batch)
+{
+  batch->numofreads = batch->numofsymbols = batch->numofblocks = 0;
+}
 
-    symbol = gt_alphabet_size(seq_encoder->alpha) * cur_qual + cur_char_code;
-    gt_huffman_encode(seq_encoder->huffman, (GtUword) symbol,
-                      &code, &bits_to_write);
-    written_bits += bits_to_write;
-    if (!dry) {
-      gt_bitoutstream_append(bitstream, code, bits_to_write);
+static void hcr_encode_batch_delete(HcrEncodeBatch *batch)
+{
+  GtUword i;
+  if (batch == NULL)
+    return;
+  for (i = 0; i < batch->allocatedblocks; i++)
+    gt_free(batch->blocks[i].bits);
+  gt_free(batch->blocks);
+  gt_free(batch->seqs);
+  gt_free(batch->quals);
+  gt_free(batch->symbolstart);
+  gt_free(batch->wordstart);
+  gt_free(batch->numofbits);
+  gt_mutex_delete(batch->mutex);
+  gt_free(batch);
+}
+
+/* Appends the encoded reads of <batch> to <bitstream> in their original
+   order, adding samples where needed. */
+static int hcr_write_batch(HcrWriteState *state, HcrEncodeBatch *batch,
+                           GtBitOutStream *bitstream, GtError *err)
+{
+  int had_err = 0;
+  GtUword blocknum,
+          readnum,
+          bits_to_write;
+  GtWord filepos;
+  GtSampling *sampling = batch->seq_encoder->sampling;
+
+  for (blocknum = 0; !had_err && blocknum < batch->numofblocks; blocknum++) {
+    HcrEncodeBlock *block = batch->blocks + blocknum;
+    for (readnum = block->firstread; !had_err && readnum < block->endread;
+         readnum++) {
+      bits_to_write = batch->numofbits[readnum];
+
+      /* check if a new sample has to be added */
+      if (sampling != NULL &&
+          gt_sampling_is_next_element_sample(sampling,
+                                             state->page_counter,
+                                             state->read_counter,
+                                             bits_to_write,
+                                             state->bits_left_in_page)) {
+        gt_log_log("sampling read " GT_WU, state->cur_read);
+        gt_bitoutstream_flush_advance(bitstream);
+
+        filepos = gt_bitoutstream_pos(bitstream);
+        if (filepos < 0) {
+          had_err = -1;
+          gt_error_set(err, "error by ftell: %s", strerror(errno));
+        }
+        else {
+          gt_sampling_add_sample(sampling,
+                                 (size_t) filepos,
+                                 state->cur_read);
+
+          state->read_counter = 0;
+          state->page_counter = 0;
+          gt_safe_assign(state->bits_left_in_page, (state->pagesize * 8));
+        }
+      }
+
+      if (!had_err) {
+        /* do the writing */
+        gt_bitoutstream_append_bitsequences(bitstream,
+                                            block->bits +
+                                              batch->wordstart[readnum],
+                                            bits_to_write);
+
+        /* update counter for sampling */
+        while (state->bits_left_in_page < bits_to_write) {
+          state->page_counter++;
+          bits_to_write -= state->bits_left_in_page;
+          gt_safe_assign(state->bits_left_in_page, (state->pagesize * 8));
+        }
+        state->bits_left_in_page -= bits_to_write;
+        /* always set first page as written */
+        if (state->page_counter == 0)
+          state->page_counter++;
+        state->read_counter++;
+        state->cur_read++;
+      }
     }
   }
-  return written_bits;
+  batch->seq_encoder->total_num_of_symbols += batch->numofsymbols;
+  return had_err;
 }
 
 static int hcr_write_seqs(FILE *fp, GtHcrEncoder *hcr_enc, GtError *err)
 {
   int had_err = 0, seqit_err;
-  GtUword bits_to_write = 0,
-                len,
-                read_counter = 0,
-                page_counter = 0,
-                bits_left_in_page,
-                cur_read = 0;
+  GtUword len;
   GtWord filepos;
   GtSeqIterator *seqit;
   const GtUchar *seq,
                 *qual;
   char *desc;
   GtBitOutStream *bitstream;
+  HcrEncodeBatch *batch;
+  HcrWriteState state;
 
   gt_error_check(err);
 
-  gt_safe_assign(bits_left_in_page, (hcr_enc->pagesize * 8));
+  state.read_counter = state.page_counter = state.cur_read = 0;
+  state.pagesize = hcr_enc->pagesize;
+  gt_safe_assign(state.bits_left_in_page, (hcr_enc->pagesize * 8));
 
   gt_xfseek(fp, hcr_enc->seq_encoder->start_of_encoding, SEEK_SET);
   bitstream = gt_bitoutstream_new(fp);
+  batch = hcr_encode_batch_new(hcr_enc->seq_encoder,
+                               hcr_enc->pagesize * HCR_PAGES_PER_CHUNK);
 
   seqit = gt_seq_iterator_fastq_new(hcr_enc->files, err);
   if (!seqit) {
@@ -384,59 +794,20 @@ static int hcr_write_seqs(FILE *fp, GtHcrEncoder *hcr_enc, GtError *err)
                                             &seq,
                                             &len,
                                             &desc, err)) == 1) {
-      GtSampling *sampling = hcr_enc->seq_encoder->sampling;
-
-      /* count the bits */
-      bits_to_write = hcr_write_seq(hcr_enc->seq_encoder, seq, qual, len,
-                                    bitstream, true);
-
-      /* check if a new sample has to be added */
-      if (sampling != NULL &&
-          gt_sampling_is_next_element_sample(sampling,
-                                             page_counter,
-                                             read_counter,
-                                             bits_to_write,
-                                             bits_left_in_page)) {
-        gt_log_log("sampling read " GT_WU, cur_read);
-        gt_bitoutstream_flush_advance(bitstream);
-
-        filepos = gt_bitoutstream_pos(bitstream);
-        if (filepos < 0) {
-          had_err = -1;
-          gt_error_set(err, "error by ftell: %s", strerror(errno));
-        }
-        else {
-        gt_sampling_add_sample(sampling,
-                               (size_t) filepos,
-                               cur_read);
-
-        read_counter = 0;
-        page_counter = 0;
-        gt_safe_assign(bits_left_in_page, (hcr_enc->pagesize * 8));
-        }
-      }
-
-      if (!had_err) {
-      /* do the writing */
-      bits_to_write = hcr_write_seq(hcr_enc->seq_encoder,
-                                    seq, qual, len, bitstream, false);
-
-      /* update counter for sampling */
-      while (bits_left_in_page < bits_to_write) {
-        page_counter++;
-        bits_to_write -= bits_left_in_page;
-        gt_safe_assign(bits_left_in_page, (hcr_enc->pagesize * 8));
-      }
-      bits_left_in_page -= bits_to_write;
-      /* always set first page as written */
-      if (page_counter == 0)
-        page_counter++;
-      read_counter++;
-      hcr_enc->seq_encoder->total_num_of_symbols += len;
-      cur_read++;
+      hcr_encode_batch_add(batch, seq, qual, len);
+      if (hcr_encode_batch_is_full(batch)) {
+        had_err = hcr_encode_batch_encode(batch, err);
+        if (!had_err)
+          had_err = hcr_write_batch(&state, batch, bitstream, err);
+        hcr_encode_batch_reset(batch);
       }
     }
-    gt_assert(hcr_enc->num_of_reads == cur_read);
+    if (!had_err && batch->numofreads > 0) {
+      had_err = hcr_encode_batch_encode(batch, err);
+      if (!had_err)
+        had_err = hcr_write_batch(&state, batch, bitstream, err);
+    }
+    gt_assert(had_err || hcr_enc->num_of_reads == state.cur_read);
     if (!had_err && seqit_err) {
       had_err = seqit_err;
       gt_assert(gt_error_is_set(err));
@@ -460,6 +831,7 @@ static int hcr_write_seqs(FILE *fp, GtHcrEncoder *hcr_enc, GtError *err)
     }
   }
   gt_bitoutstream_delete(bitstream);
+  hcr_encode_batch_delete(batch);
   gt_seq_iterator_delete(seqit);
   return had_err;
 }
@@ -500,12 +872,38 @@ static int hcr_write_seqdistrtab(FILE *fp, GtHcrEncoder *hcr_enc)
   info->qual_offset = hcr_enc->seq_encoder->qual_offset;
   info->output = fp;
 
-  numofleaves = gt_huffman_numofsymbols(hcr_enc->seq_encoder->huffman);
-  gt_xfwrite_one(&numofleaves, fp);
+  if (hcr_enc->seq_encoder->ctx_huffman == NULL) {
+    numofleaves = gt_huffman_numofsymbols(hcr_enc->seq_encoder->huffman);
+    gt_xfwrite_one(&numofleaves, fp);
 
-  had_err = gt_huffman_iterate(hcr_enc->seq_encoder->huffman,
-                               hcr_huffman_write_base_qual_freq,
-                               info);
+    had_err = gt_huffman_iterate(hcr_enc->seq_encoder->huffman,
+                                 hcr_huffman_write_base_qual_freq,
+                                 info);
+  }
+  else {
+    /* marker followed by the distributions of all used contexts */
+    GtHuffman **ctx_huffman = hcr_enc->seq_encoder->ctx_huffman;
+    GtUword ctxnum,
+            numofcontexts = 0;
+
+    numofleaves = HCR_CONTEXTMARKER;
+    gt_xfwrite_one(&numofleaves, fp);
+    for (ctxnum = 0; ctxnum < HCR_NUMOFCONTEXTS; ctxnum++) {
+      if (ctx_huffman[ctxnum] != NULL)
+        numofcontexts++;
+    }
+    gt_xfwrite_one(&numofcontexts, fp);
+    for (ctxnum = 0; !had_err && ctxnum < HCR_NUMOFCONTEXTS; ctxnum++) {
+      if (ctx_huffman[ctxnum] != NULL) {
+        gt_xfwrite_one(&ctxnum, fp);
+        numofleaves = gt_huffman_numofsymbols(ctx_huffman[ctxnum]);
+        gt_xfwrite_one(&numofleaves, fp);
+        had_err = gt_huffman_iterate(ctx_huffman[ctxnum],
+                                     hcr_huffman_write_base_qual_freq,
+                                     info);
+      }
+    }
+  }
   gt_free(info);
   return had_err;
 }
@@ -742,6 +1140,7 @@ static void hcr_seq_decoder_delete(GtHcrSeqDecoder *seq_dec)
     gt_free(seq_dec->fileinfos);
     gt_huffman_decoder_delete(seq_dec->huff_dec);
     gt_huffman_delete(seq_dec->huffman);
+    hcr_context_huffmans_delete(seq_dec->ctx_huffman);
     gt_sampling_delete(seq_dec->sampling);
     gt_rbtree_delete(seq_dec->file_info_rbt);
     gt_str_delete(seq_dec->filename);
@@ -756,7 +1155,8 @@ static GtHcrSeqDecoder *hcr_seq_decoder_new(GtAlphabet *alpha, const char *name,
 {
   int had_err = 0;
   GtHcrSeqDecoder *seq_dec = gt_malloc(sizeof (GtHcrSeqDecoder));
-  GtBaseQualDistr *bqd = NULL;
+  GtBaseQualDistr *bqd = NULL,
+                 **ctx_bqd = NULL;
   GtWord end_enc_start_sampling = 0;
   FILE *fp = NULL;
   GT_UNUSED size_t read;
@@ -771,6 +1171,7 @@ static GtHcrSeqDecoder *hcr_seq_decoder_new(GtAlphabet *alpha, const char *name,
   seq_dec->filename = gt_str_new_cstr(name);
   seq_dec->huff_dec = NULL;
   seq_dec->huffman = NULL;
+  seq_dec->ctx_huffman = NULL;
   seq_dec->sampling = NULL;
   seq_dec->symbols = NULL;
   gt_str_append_cstr(seq_dec->filename, HCRFILESUFFIX);
@@ -785,8 +1186,10 @@ static GtHcrSeqDecoder *hcr_seq_decoder_new(GtAlphabet *alpha, const char *name,
   if (!had_err) {
     hcr_read_file_info(seq_dec, fp);
 
-    bqd = hcr_base_qual_distr_new_from_file(fp, seq_dec->alpha);
+    bqd = hcr_base_qual_distr_new_from_file(fp, seq_dec->alpha, &ctx_bqd);
     seq_dec->qual_offset = bqd->qual_offset;
+    if (ctx_bqd != NULL)
+      seq_dec->ctx_huffman = hcr_context_huffmans_new(ctx_bqd);
 
     read = gt_xfread_one(&end_enc_start_sampling, fp);
     gt_assert(read == one);
@@ -817,6 +1220,7 @@ static GtHcrSeqDecoder *hcr_seq_decoder_new(GtAlphabet *alpha, const char *name,
   }
 
   hcr_base_qual_distr_delete(bqd);
+  hcr_base_qual_distr_delete_contexts(ctx_bqd);
   gt_fa_fclose(fp);
   return seq_dec;
 }
@@ -876,6 +1280,29 @@ static unsigned char get_base_from_symbol(GtHcrSeqDecoder *seq_dec,
   return base;
 }
 
+/* Decodes the <len> symbols of the next read symbol by symbol, switching to
+   the code of the context of each symbol. */
+static int hcr_decode_symbols_context(GtHcrSeqDecoder *seq_dec, GtUword len,
+                                      GtError *err)
+{
+  GtUword i;
+  unsigned prev_qual = 0;
+  int ret = 1;
+
+  for (i = 0; ret == 1 && i < len; i++) {
+    gt_huffman_decoder_set_huffman(seq_dec->huff_dec,
+                                   seq_dec->ctx_huffman[hcr_context(i, len,
+                                                                  prev_qual)]);
+    ret = gt_huffman_decoder_next(seq_dec->huff_dec, seq_dec->symbols, 1UL,
+                                  err);
+    if (ret == 1)
+      prev_qual = (unsigned char)
+        get_qual_from_symbol(seq_dec,
+                             *(GtUword*) gt_array_get_last(seq_dec->symbols));
+  }
+  return ret;
+}
+
 static int hcr_next_seq_qual(GtHcrSeqDecoder *seq_dec, char *seq, char *qual,
                              GtError *err)
 {
@@ -922,8 +1349,11 @@ static int hcr_next_seq_qual(GtHcrSeqDecoder *seq_dec, char *seq, char *qual,
     }
     if (status != HCR_ERROR) {
       int ret;
-      ret =  gt_huffman_decoder_next(seq_dec->huff_dec, seq_dec->symbols,
-                                     fileinfo->readlength, err);
+      if (seq_dec->ctx_huffman == NULL)
+        ret = gt_huffman_decoder_next(seq_dec->huff_dec, seq_dec->symbols,
+                                      fileinfo->readlength, err);
+      else
+        ret = hcr_decode_symbols_context(seq_dec, fileinfo->readlength, err);
       if (ret != 1)
         status = HCR_ERROR;
       if (ret == 0)
@@ -1024,19 +1454,227 @@ int gt_hcr_decoder_decode(GtHcrDecoder *hcr_dec, GtUword readnum,
   return had_err;
 }
 
+static void hcr_append_wrapped(GtStr *text, const char *line, GtUword width)
+{
+  GtUword len = (GtUword) strlen(line),
+          i;
+
+  if (width == 0)
+    gt_str_append_cstr_nt(text, line, len);
+  else {
+    for (i = 0; i < len; i += width) {
+      if (i > 0)
+        gt_str_append_char(text, '\n');
+      gt_str_append_cstr_nt(text, line + i, GT_MIN(width, len - i));
+    }
+  }
+  gt_str_append_char(text, '\n');
+}
+
+/* Appends the sequence and quality lines of a read to <text>, wrapped after
+   <width> characters if <width> is not 0. */
+static void hcr_format_seq_qual(GtStr *text, const char *seq, const char *qual,
+                                GtUword width)
+{
+  hcr_append_wrapped(text, seq, width);
+  gt_str_append_char(text, HCR_DESCSEPQUAL);
+  gt_str_append_char(text, '\n');
+  hcr_append_wrapped(text, qual, width);
+}
+
+static void hcr_write_header(FILE *output, const GtHcrDecoder *hcr_dec,
+                             const GtStr *desc, GtUword readnum)
+{
+  gt_xfputc(HCR_DESCSEPSEQ, output);
+  if (hcr_dec->encdesc != NULL)
+    gt_xfputs(gt_str_get(desc), output);
+  else
+    fprintf(output, ""GT_WU"", readnum);
+  gt_xfputc('\n', output);
+}
+
+static GtUword hcr_seq_decoder_max_readlength(const GtHcrSeqDecoder *seq_dec)
+{
+  GtUword i,
+          maxreadlength = 0;
+  for (i = 0; i < seq_dec->num_of_files; i++)
+    maxreadlength = GT_MAX(maxreadlength, seq_dec->fileinfos[i].readlength);
+  return maxreadlength;
+}
+
+/* Decodes the reads of <block> with a private copy of the state of the shared
+   decoder, which is only read. Each thread has its own data iterator and
+   Huffman decoder and restarts them at the sample the block begins with. */
+static void *hcr_decode_thread_func(void *data)
+{
+  HcrDecodeInfo *info = (HcrDecodeInfo*) data;
+  GtHcrSeqDecoder seq_dec = *info->seq_dec;
+  GtError *err = gt_error_new();
+  char *seq = gt_malloc((size_t) info->maxreadlength + 1),
+       *qual = gt_malloc((size_t) info->maxreadlength + 1);
+  int had_err = 0;
+
+  seq_dec.sampling = NULL;
+  seq_dec.symbols = NULL;
+  seq_dec.data_iter =
+    decoder_init_data_iterator(seq_dec.start_of_encoding,
+                               (GtWord) info->seq_dec->data_iter->end,
+                               seq_dec.filename);
+  seq_dec.huff_dec =
+    gt_huffman_decoder_new_from_memory(seq_dec.huffman,
+                                       get_next_file_chunk_for_huffman,
+                                       seq_dec.data_iter, err);
+  if (seq_dec.huff_dec == NULL)
+    had_err = -1;
+
+  while (!had_err) {
+    HcrDecodeBlock *block;
+    GtUword blocknum,
+            readnum;
+
+    gt_mutex_lock(info->mutex);
+    blocknum = info->nextblock < info->numofblocks && !info->had_err
+                 ? info->nextblock++
+                 : GT_UWORD_MAX;
+    gt_mutex_unlock(info->mutex);
+    if (blocknum == GT_UWORD_MAX)
+      break;
+    block = info->blocks + blocknum;
+    gt_str_reset(block->text);
+    reset_data_iterator_to_pos(seq_dec.data_iter, block->startpos);
+    had_err = gt_huffman_decoder_get_new_mem_chunk(seq_dec.huff_dec, err);
+    seq_dec.cur_read = block->sampledread;
+    /* skip the reads between the sample and the start of the range */
+    while (!had_err && seq_dec.cur_read < block->firstread)
+      had_err = hcr_next_seq_qual(&seq_dec, NULL, NULL, err) == -1 ? -1 : 0;
+    for (readnum = block->firstread; !had_err && readnum < block->endread;
+         readnum++) {
+      had_err = hcr_next_seq_qual(&seq_dec, seq, qual, err) == -1 ? -1 : 0;
+      if (!had_err) {
+        block->textstart[readnum - block->firstread] =
+          gt_str_length(block->text);
+        hcr_format_seq_qual(block->text, seq, qual, info->width);
+      }
+    }
+    block->textstart[block->endread - block->firstread] =
+      gt_str_length(block->text);
+  }
+
+  if (had_err) {
+    gt_mutex_lock(info->mutex);
+    if (!info->had_err) {
+      info->had_err = true;
+      gt_error_set(info->err, "%s", gt_error_get(err));
+    }
+    gt_mutex_unlock(info->mutex);
+  }
+  gt_huffman_decoder_delete(seq_dec.huff_dec);
+  data_iterator_delete(seq_dec.data_iter);
+  gt_array_delete(seq_dec.symbols);
+  gt_free(seq);
+  gt_free(qual);
+  gt_error_delete(err);
+  return NULL;
+}
+
+/* Decodes the reads <start>..<end> on <gt_jobs> threads. The range is split at
+   the samples, each part is decoded independently and the results are written
+   to <output> in their original order. */
+static int hcr_decode_range_parallel(GtHcrDecoder *hcr_dec, FILE *output,
+                                     GtUword start, GtUword end, GtUword width,
+                                     GtError *err)
+{
+  GtHcrSeqDecoder *seq_dec = hcr_dec->seq_dec;
+  GtSampling *sampling = seq_dec->sampling;
+  GtStr *desc = gt_str_new();
+  HcrDecodeInfo info;
+  GtUword i,
+          nextread = start,
+          sampledread,
+          maxnumofblocks = gt_jobs * HCR_BLOCKS_PER_JOB,
+          current_sample = gt_sampling_get_current_elementnum(sampling);
+  size_t startpos;
+  int had_err = 0;
+
+  info.seq_dec = seq_dec;
+  info.maxreadlength = hcr_seq_decoder_max_readlength(seq_dec);
+  info.width = width;
+  info.err = err;
+  info.had_err = false;
+  info.mutex = gt_mutex_new();
+  info.blocks = gt_calloc((size_t) maxnumofblocks, sizeof (*info.blocks));
+  for (i = 0; i < maxnumofblocks; i++)
+    info.blocks[i].text = gt_str_new();
+
+  gt_sampling_get_page(sampling, start, &sampledread, &startpos);
+  while (!had_err && nextread <= end) {
+    /* collect the next blocks, each ranging up to the next sample */
+    for (info.numofblocks = 0;
+         info.numofblocks < maxnumofblocks && nextread <= end;
+         info.numofblocks++) {
+      HcrDecodeBlock *block = info.blocks + info.numofblocks;
+      GtUword nextsample = gt_sampling_get_next_elementnum(sampling);
+
+      block->sampledread = sampledread;
+      block->startpos = startpos;
+      block->firstread = nextread;
+      block->endread = nextsample == 0 || nextsample > end
+                         ? end + 1
+                         : nextsample;
+      block->textstart = gt_realloc(block->textstart,
+                                    (size_t) (block->endread - nextread + 1) *
+                                      sizeof (*block->textstart));
+      nextread = block->endread;
+      if (nextread <= end)
+        (void) gt_sampling_get_next_sample(sampling, &sampledread, &startpos);
+    }
+    info.nextblock = 0;
+    had_err = gt_multithread(hcr_decode_thread_func, &info, err);
+    if (!had_err && info.had_err)
+      had_err = -1;
+    for (i = 0; !had_err && i < info.numofblocks; i++) {
+      HcrDecodeBlock *block = info.blocks + i;
+      GtUword readnum;
+      for (readnum = block->firstread; !had_err && readnum < block->endread;
+           readnum++) {
+        GtUword offset = block->textstart[readnum - block->firstread];
+        if (hcr_dec->encdesc != NULL)
+          had_err = gt_encdesc_decode(hcr_dec->encdesc, readnum, desc, err);
+        if (!had_err) {
+          hcr_write_header(output, hcr_dec, desc, readnum);
+          gt_xfwrite(gt_str_get(block->text) + offset, sizeof (char),
+                     (size_t) (block->textstart[readnum - block->firstread + 1]
+                               - offset),
+                     output);
+        }
+      }
+    }
+  }
+  /* restore the sample the shared decoder is positioned in */
+  gt_sampling_get_page(sampling, current_sample, &sampledread, &startpos);
+
+  for (i = 0; i < maxnumofblocks; i++) {
+    gt_str_delete(info.blocks[i].text);
+    gt_free(info.blocks[i].textstart);
+  }
+  gt_free(info.blocks);
+  gt_mutex_delete(info.mutex);
+  gt_str_delete(desc);
+  return had_err;
+}
+
 int gt_hcr_decoder_decode_range(GtHcrDecoder *hcr_dec, const char *name,
                                 GtUword start, GtUword end, GtUword width,
                                 GtTimer *timer, GtError *err)
 {
-  char qual[BUFSIZ] = {0},
-       seq[BUFSIZ] = {0};
-  GtStr *desc = gt_str_new();
+  char *qual = NULL,
+       *seq = NULL;
+  GtStr *desc = gt_str_new(),
+        *text = gt_str_new();
   int had_err = 0;
-  GtUword cur_width,
-                cur_read;
-  size_t i;
+  GtUword cur_read;
   FILE *output;
-  GT_UNUSED GtHcrSeqDecoder *seq_dec;
+  GtHcrSeqDecoder *seq_dec;
 
   gt_error_check(err);
   gt_assert(hcr_dec && name);
@@ -1049,37 +1687,29 @@ int gt_hcr_decoder_decode_range(GtHcrDecoder *hcr_dec, const char *name,
   if (output == NULL)
     had_err = -1;
 
-  for (cur_read = start; had_err == 0 && cur_read <= end; cur_read++) {
+  if (!had_err && gt_jobs > 1U && seq_dec->sampling != NULL)
+    had_err = hcr_decode_range_parallel(hcr_dec, output, start, end, width,
+                                        err);
+  else if (!had_err) {
+    seq = gt_malloc((size_t) hcr_seq_decoder_max_readlength(seq_dec) + 1);
+    qual = gt_malloc((size_t) hcr_seq_decoder_max_readlength(seq_dec) + 1);
+  }
+  for (cur_read = start; seq != NULL && had_err == 0 && cur_read <= end;
+       cur_read++) {
     if (gt_hcr_decoder_decode(hcr_dec, cur_read, seq, qual, desc, err) != 0)
       had_err = -1;
     else {
-      gt_xfputc(HCR_DESCSEPSEQ, output);
-      if (hcr_dec->encdesc != NULL)
-        gt_xfputs(gt_str_get(desc), output);
-      else
-        fprintf(output, ""GT_WU"", cur_read);
-      gt_xfputc('\n', output);
-      for (i = 0, cur_width = 0; i < strlen(seq); i++, cur_width++) {
-        if (width != 0 && cur_width == width) {
-          cur_width = 0;
-          gt_xfputc('\n', output);
-        }
-        gt_xfputc(seq[i], output);
-      }
-      gt_xfputc('\n', output);
-      gt_xfputc(HCR_DESCSEPQUAL, output);
-      gt_xfputc('\n', output);
-      for (i = 0, cur_width = 0; i < strlen(qual); i++, cur_width++) {
-        if (width != 0 && cur_width == width) {
-          cur_width = 0;
-          gt_xfputc('\n', output);
-        }
-        gt_xfputc(qual[i], output);
-      }
-      gt_xfputc('\n', output);
+      hcr_write_header(output, hcr_dec, desc, cur_read);
+      gt_str_reset(text);
+      hcr_format_seq_qual(text, seq, qual, width);
+      gt_xfwrite(gt_str_get(text), sizeof (char), (size_t) gt_str_length(text),
+                 output);
     }
   }
   gt_fa_xfclose(output);
+  gt_free(seq);
+  gt_free(qual);
+  gt_str_delete(text);
   gt_str_delete(desc);
   return had_err;
 }
@@ -1099,10 +1729,11 @@ GtUword gt_hcr_decoder_readlength(const GtHcrDecoder *hcr_dec,
 }
 
 GtHcrEncoder *gt_hcr_encoder_new(GtStrArray *files, GtAlphabet *alpha,
-                                 bool descs, GtQualRange qrange, GtTimer *timer,
-                                 GtError *err)
+                                 bool descs, bool qcontext, GtQualRange qrange,
+                                 GtTimer *timer, GtError *err)
 {
-  GtBaseQualDistr *bqd;
+  GtBaseQualDistr *bqd,
+                 **ctx_bqd = NULL;
   GtHcrEncoder *hcr_enc;
   GtSeqIterator *seqit;
   GtStrArray *file;
@@ -1146,11 +1777,15 @@ GtHcrEncoder *gt_hcr_encoder_new(GtStrArray *files, GtAlphabet *alpha,
 
   hcr_enc->seq_encoder = gt_malloc(sizeof (GtHcrSeqEncoder));
   hcr_enc->seq_encoder->alpha = alpha;
+  hcr_enc->seq_encoder->huffman = NULL;
+  hcr_enc->seq_encoder->ctx_huffman = NULL;
   hcr_enc->seq_encoder->sampling = NULL;
   hcr_enc->seq_encoder->fileinfos = gt_calloc((size_t) hcr_enc->num_of_files,
                                    sizeof (*(hcr_enc->seq_encoder->fileinfos)));
   hcr_enc->seq_encoder->qrange = qrange;
   bqd = hcr_base_qual_distr_new(alpha, qrange);
+  if (qcontext)
+    ctx_bqd = gt_calloc((size_t) HCR_NUMOFCONTEXTS, sizeof (*ctx_bqd));
 
   /* check if reads in the same file are of same length and get
      <base, quality> pair distribution */
@@ -1169,6 +1804,7 @@ GtHcrEncoder *gt_hcr_encoder_new(GtStrArray *files, GtAlphabet *alpha,
 
       if (status == 1) {
         num_of_reads = 1UL;
+        had_err = hcr_base_qual_distr_add(bqd, ctx_bqd, qual, seq, len1);
         while (!had_err) {
           status = gt_seq_iterator_next(seqit, &seq, &len2, &desc, err);
           if (status == -1)
@@ -1180,7 +1816,7 @@ GtHcrEncoder *gt_hcr_encoder_new(GtStrArray *files, GtAlphabet *alpha,
             had_err = -1;
             break;
           }
-          if (hcr_base_qual_distr_add(bqd, qual, seq, len1) != 0)
+          if (hcr_base_qual_distr_add(bqd, ctx_bqd, qual, seq, len2) != 0)
             had_err = -1;
           len1 = len2;
           num_of_reads++;
@@ -1202,18 +1838,25 @@ GtHcrEncoder *gt_hcr_encoder_new(GtStrArray *files, GtAlphabet *alpha,
     gt_str_array_delete(file);
     gt_seq_iterator_delete(seqit);
   }
-  if (!had_err)
+  if (!had_err) {
     hcr_base_qual_distr_trim(bqd);
+    if (ctx_bqd != NULL)
+      hcr_base_qual_distr_trim_contexts(ctx_bqd, bqd);
+  }
 
   if (!had_err) {
     if (timer != NULL)
       gt_timer_show_progress(timer, "build huffman tree for sequences and"
                              " qualities", stdout);
-    hcr_enc->seq_encoder->huffman =
-      gt_huffman_new(bqd,
-                     hcr_base_qual_distr_func,
-                     (GtUword) bqd->ncols * bqd->nrows);
+    if (ctx_bqd != NULL)
+      hcr_enc->seq_encoder->ctx_huffman = hcr_context_huffmans_new(ctx_bqd);
+    else
+      hcr_enc->seq_encoder->huffman =
+        gt_huffman_new(bqd,
+                       hcr_base_qual_distr_func,
+                       (GtUword) bqd->ncols * bqd->nrows);
   }
+  hcr_base_qual_distr_delete_contexts(ctx_bqd);
   if (!had_err) {
     hcr_enc->seq_encoder->qual_offset = bqd->qual_offset;
     hcr_base_qual_distr_delete(bqd);
@@ -1326,6 +1969,7 @@ void gt_hcr_encoder_delete(GtHcrEncoder *hcr_enc)
   if (!hcr_enc)
     return;
   gt_huffman_delete(hcr_enc->seq_encoder->huffman);
+  hcr_context_huffmans_delete(hcr_enc->seq_encoder->ctx_huffman);
   gt_sampling_delete(hcr_enc->seq_encoder->sampling);
   gt_free(hcr_enc->seq_encoder->fileinfos);
   gt_free(hcr_enc->seq_encoder);
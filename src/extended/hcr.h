@@ -44,14 +44,17 @@ struct GtQualRange {
 };
 
 /* Returns a new GtHcrEncoder object. If <descs> is true, description lines
-   will be encoded. <qrange> denotes the range of quality values. All quality
+   will be encoded. If <qcontext> is true, every base and quality value is
+   encoded with a Huffman code chosen by the previous quality value of the read
+   and the position in the read instead of a single code for all of them.
+   <qrange> denotes the range of quality values. All quality
    values smaller or equal to the lower bound will be converted to the lower
    bound. All quality values equal or larger than the upper bound will be
    converted to the upper bound.
    Reads have to be of constant length, this might be changed in future updates
 */
 GtHcrEncoder* gt_hcr_encoder_new(GtStrArray *files, GtAlphabet *alpha,
-                                 bool descs, GtQualRange qrange,
+                                 bool descs, bool qcontext, GtQualRange qrange,
                                  GtTimer *timer, GtError *err);
 
 /* Returns true if <hcr_enc> was initialized with <descs> = true. */
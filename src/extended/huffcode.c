@@ -577,13 +577,14 @@ int gt_huffman_decoder_next(GtHuffmanDecoder *huff_decoder,
         else
           huff_decoder->cur_node = huff_decoder->cur_node->leftchild;
       }
-    }
 
-    /* symbol found, reset huffman */
-    if (!had_err && huff_decoder->cur_node->leftchild == NULL) {
-      gt_array_add(symbols, huff_decoder->cur_node->symbol.symbol);
-      read_symbols++;
-      huff_decoder->cur_node = huff_decoder->huffman->root_huffman_tree;
+      /* symbol found, reset huffman. Only checked after a bit was read, as the
+         code of a tree with only one node is one bit long. */
+      if (huff_decoder->cur_node->leftchild == NULL) {
+        gt_array_add(symbols, huff_decoder->cur_node->symbol.symbol);
+        read_symbols++;
+        huff_decoder->cur_node = huff_decoder->huffman->root_huffman_tree;
+      }
     }
   }
   if (!had_err) {
@@ -593,6 +594,16 @@ int gt_huffman_decoder_next(GtHuffmanDecoder *huff_decoder,
   return had_err;
 }
 
+void gt_huffman_decoder_set_huffman(GtHuffmanDecoder *huff_decoder,
+                                    GtHuffman *huffman)
+{
+  gt_assert(huff_decoder != NULL && huffman != NULL);
+  gt_assert(huff_decoder->cur_node ==
+            huff_decoder->huffman->root_huffman_tree);
+  huff_decoder->huffman = huffman;
+  huff_decoder->cur_node = huffman->root_huffman_tree;
+}
+
 void gt_huffman_decoder_delete(GtHuffmanDecoder *huff_decoder)
 {
   gt_free(huff_decoder);
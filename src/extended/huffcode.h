@@ -146,6 +146,12 @@ int               gt_huffman_decoder_next(GtHuffmanDecoder *huff_decoder,
                                           GtUword symbols_to_read,
                                           GtError *err);
 
+/* Makes <huff_decoder> decode the following symbols with the code of
+   <huffman>. Must only be called between two symbols, this can be used to
+   switch between codes for different contexts. */
+void              gt_huffman_decoder_set_huffman(GtHuffmanDecoder *huff_decoder,
+                                                 GtHuffman *huffman);
+
 /* Deletes <huff_decoder>. */
 void              gt_huffman_decoder_delete(GtHuffmanDecoder *huff_decoder);
 
@@ -57,60 +57,69 @@ static void firstEDtabRtabcolumn(GtUword *EDtabcolumn,
   }
 }
 
+/* The following function computes the next column in two passes. On entry
+   <bestdiagwest>[i] holds the replacement cost of row i+1. The first pass
+   overwrites it with the minimum of the replacement and the deletion
+   recurrence, and <bestdiagwestR> with the corresponding entry of the
+   Rtab. This pass only reads the previous column and has no loop carried
+   dependency, so that the compiler can vectorize it. The second pass
+   evaluates the insertion recurrence, which depends on the entry of the
+   previous row, and stores the new column. */
 static void nextEDtabRtabcolumn(GtUword *EDtabcolumn,
                                 GtUword *Rtabcolumn,
                                 GtUword colindex,
                                 GtUword midcolumn,
-                                GtUchar b,
-                                const GtUchar *useq,
-                                GtUword ustart,
+                                GtWord *bestdiagwest,
+                                GtUword *bestdiagwestR,
                                 GtUword ulen,
-                                const GtScoreHandler *scorehandler)
+                                GtUword gapcost)
 {
-  GtUword rowindex, val, gapcost,
-          northwestEDtabentry,
-          westEDtabentry,
-          northwestRtabentry,
-          westRtabentry = 0;
-
-  gt_assert(scorehandler);
-  gapcost = gt_scorehandler_get_gapscore(scorehandler);
-
-  westEDtabentry = EDtabcolumn[0];
-  EDtabcolumn[0] += gapcost;
+  GtUword rowindex;
 
   if (colindex > midcolumn)
   {
-    Rtabcolumn[0] = 0;
-  }
-
-  for (rowindex = 1UL; rowindex <= ulen; rowindex++) {
-    northwestEDtabentry = westEDtabentry;
-    northwestRtabentry  = westRtabentry;
-    westEDtabentry = EDtabcolumn[rowindex];
-    westRtabentry  = Rtabcolumn[rowindex];
-    EDtabcolumn[rowindex] += gapcost; /* 1. recurrence */
-
-    /* 2. recurrence: */
-    val = northwestEDtabentry + gt_scorehandler_get_replacement(scorehandler,
-                                                    useq[ustart+rowindex-1], b);
-    if (val <= EDtabcolumn[rowindex])
+    for (rowindex = 0; rowindex < ulen; rowindex++)
     {
-      EDtabcolumn[rowindex] = val;
-      if (colindex > midcolumn)
-      {
-        Rtabcolumn[rowindex] = northwestRtabentry;
-      }
+      const GtUword westEDtabentry = EDtabcolumn[rowindex+1] + gapcost,
+                    val = EDtabcolumn[rowindex] + bestdiagwest[rowindex];
+      const bool diagonal = val <= westEDtabentry ? true : false;
+
+      bestdiagwest[rowindex] = (GtWord) (diagonal ? val : westEDtabentry);
+      bestdiagwestR[rowindex] = diagonal ? Rtabcolumn[rowindex]
+                                         : Rtabcolumn[rowindex+1];
     }
-    /* 3. recurrence: */
-    if ((val = EDtabcolumn[rowindex-1]+gapcost) < EDtabcolumn[rowindex])
+    EDtabcolumn[0] += gapcost;
+    Rtabcolumn[0] = 0;
+    for (rowindex = 1UL; rowindex <= ulen; rowindex++)
     {
-      EDtabcolumn[rowindex] = val;
-      if (colindex > midcolumn)
+      const GtUword val = EDtabcolumn[rowindex-1] + gapcost;
+
+      if (val < (GtUword) bestdiagwest[rowindex-1])
       {
+        EDtabcolumn[rowindex] = val;
         Rtabcolumn[rowindex] = Rtabcolumn[rowindex-1];
+      } else
+      {
+        EDtabcolumn[rowindex] = (GtUword) bestdiagwest[rowindex-1];
+        Rtabcolumn[rowindex] = bestdiagwestR[rowindex-1];
       }
     }
+  } else
+  {
+    for (rowindex = 0; rowindex < ulen; rowindex++)
+    {
+      const GtUword westEDtabentry = EDtabcolumn[rowindex+1] + gapcost,
+                    val = EDtabcolumn[rowindex] + bestdiagwest[rowindex];
+
+      bestdiagwest[rowindex] = (GtWord) GT_MIN(val, westEDtabentry);
+    }
+    EDtabcolumn[0] += gapcost;
+    for (rowindex = 1UL; rowindex <= ulen; rowindex++)
+    {
+      const GtUword val = EDtabcolumn[rowindex-1] + gapcost;
+
+      EDtabcolumn[rowindex] = GT_MIN(val, (GtUword) bestdiagwest[rowindex-1]);
+    }
   }
 }
 
@@ -125,18 +134,25 @@ static GtUword evaluateallEDtabRtabcolumns(GtUword *EDtabcolumn,
                                            GtUword vstart,
                                            GtUword vlen)
 {
-  GtUword gapcost, colindex;
+  GtUword gapcost, colindex, *bestdiagwestR;
+  GtWord *bestdiagwest;
   gt_assert(scorehandler && EDtabcolumn && Rtabcolumn);
 
   gapcost = gt_scorehandler_get_gapscore(scorehandler);
   firstEDtabRtabcolumn(EDtabcolumn, Rtabcolumn, ulen, gapcost);
 
+  bestdiagwest = gt_malloc(sizeof (*bestdiagwest) * (ulen + 1));
+  bestdiagwestR = gt_malloc(sizeof (*bestdiagwestR) * (ulen + 1));
   for (colindex = 1UL; colindex <= vlen; colindex++)
   {
+    gt_scorehandler_get_replacement_profile(scorehandler, bestdiagwest,
+                                            useq + ustart, ulen,
+                                            vseq[vstart+colindex-1]);
     nextEDtabRtabcolumn(EDtabcolumn, Rtabcolumn, colindex, midcol,
-                        vseq[vstart+colindex-1], useq, ustart,
-                        ulen, scorehandler);
+                        bestdiagwest, bestdiagwestR, ulen, gapcost);
   }
+  gt_free(bestdiagwest);
+  gt_free(bestdiagwestR);
   return EDtabcolumn[ulen];
 }
 
@@ -276,7 +292,7 @@ static GtUword evaluatelinearcrosspoints(GtLinspaceManagement *spacemanager,
     }
 
 #ifdef GT_THREADS_ENABLED
-    if (gt_jobs == 1)
+    if (gt_linspace_management_get_maxthreads(spacemanager) == 1)
     {
 #endif
       if (gt_linspace_management_checksquare(spacemanager, ulen,vlen,
@@ -305,7 +321,8 @@ static GtUword evaluatelinearcrosspoints(GtLinspaceManagement *spacemanager,
     Ctab[midcol] = rowoffset + midrow;
 
 #ifdef GT_THREADS_ENABLED
-    if (*threadcount + 2 > gt_jobs)
+    if (!gt_linspace_management_reserve_threads(spacemanager, threadcount,
+                                                2UL))
     {
 #endif
       /* upper left corner */
@@ -333,7 +350,6 @@ static GtUword evaluatelinearcrosspoints(GtLinspaceManagement *spacemanager,
                                                    vseq, vstart, midcol,
                                                    Ctab, rowoffset,
                                                    threadidx, threadcount);
-      (*threadcount)++;
       t1 = gt_thread_new(evaluatelinearcrosspoints_thread_caller,
                          &threadinfo1, NULL);
 
@@ -346,14 +362,13 @@ static GtUword evaluatelinearcrosspoints(GtLinspaceManagement *spacemanager,
                                                    rowoffset + midrow,
                                                    threadidx + GT_DIV2(midcol),
                                                    threadcount);
-      (*threadcount)++;
       t2 = gt_thread_new(evaluatelinearcrosspoints_thread_caller,
                          &threadinfo2, NULL);
 
       gt_thread_join(t1);
-      (*threadcount)--;
+      gt_linspace_management_release_thread(spacemanager, threadcount);
       gt_thread_join(t2);
-      (*threadcount)--;
+      gt_linspace_management_release_thread(spacemanager, threadcount);
       gt_thread_delete(t1);
       gt_thread_delete(t2);
     }
@@ -546,18 +561,17 @@ static void firstLStabcolumn(GtWord *Ltabcolumn,
 
 static void nextLStabcolumn(GtWord *Ltabcolumn,
                             GtUwordPair *Starttabcolumn,
-                            const GtScoreHandler *scorehandler,
-                            const GtUchar *useq,
-                            GtUword ustart, GtUword ulen,
-                            const GtUchar b, GtUword colindex,
+                            GtWord gapscore,
+                            const GtWord *replacement,
+                            GtUword ulen,
+                            GtUword colindex,
                             GtMaxcoordvalue *max)
 {
   GtUword rowindex;
   GtUwordPair northwestStarttabentry, westStarttabentry;
-  GtWord northwestLtabentry, westLtabentry, gapscore;
+  GtWord northwestLtabentry, westLtabentry;
 
   gt_assert(max != NULL);
-  gapscore = gt_scorehandler_get_gapscore(scorehandler);
 
   westLtabentry = Ltabcolumn[0];
   westStarttabentry = Starttabcolumn[0];
@@ -575,8 +589,7 @@ static void nextLStabcolumn(GtWord *Ltabcolumn,
     westStarttabentry = Starttabcolumn[rowindex];
     Ltabcolumn[rowindex] += gapscore;
 
-    val = northwestLtabentry + gt_scorehandler_get_replacement(scorehandler,
-                                                  useq[ustart + rowindex-1], b);
+    val = northwestLtabentry + replacement[rowindex-1];
 
     if (val >= Ltabcolumn[rowindex])
     {
@@ -613,7 +626,7 @@ static GtMaxcoordvalue *evaluateallLScolumns(GtLinspaceManagement *spacemanager,
                                              GtUword vlen)
 {
   GtUword colindex;
-  GtWord *Ltabcolumn;
+  GtWord *Ltabcolumn, *replacement, gapscore;
   GtUwordPair *Starttabcolumn;
   GtMaxcoordvalue *max;
 
@@ -623,11 +636,17 @@ static GtMaxcoordvalue *evaluateallLScolumns(GtLinspaceManagement *spacemanager,
   firstLStabcolumn(Ltabcolumn, Starttabcolumn, ulen);
 
   max = gt_linspace_management_get_maxspace(spacemanager);
+  gapscore = gt_scorehandler_get_gapscore(scorehandler);
+  replacement = gt_malloc(sizeof (*replacement) * (ulen + 1));
   for (colindex = 1UL; colindex <= vlen; colindex++)
   {
-    nextLStabcolumn(Ltabcolumn, Starttabcolumn, scorehandler,
-                    useq, ustart, ulen, vseq[vstart+colindex-1], colindex, max);
+    gt_scorehandler_get_replacement_profile(scorehandler, replacement,
+                                            useq + ustart, ulen,
+                                            vseq[vstart+colindex-1]);
+    nextLStabcolumn(Ltabcolumn, Starttabcolumn, gapscore, replacement,
+                    ulen, colindex, max);
   }
+  gt_free(replacement);
   return max;
 }
 
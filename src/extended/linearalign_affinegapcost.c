@@ -148,21 +148,16 @@ static void firstAtabRtabcolumn(GtAffinealignDPentry *Atabcolumn,
 
 static void nextAtabRtabcolumn(GtAffinealignDPentry *Atabcolumn,
                                GtAffineAlignRtabentry *Rtabcolumn,
-                               const GtScoreHandler *scorehandler,
-                               const GtUchar *useq,
-                               GtUword ustart,
+                               GtUword gap_opening,
+                               GtUword gap_extension,
+                               const GtWord *replacement,
                                GtUword ulen,
-                               GtUchar b,
                                GtUword midcolumn,
                                GtUword colindex)
 {
   GtAffinealignDPentry northwestAffinealignDPentry, westAffinealignDPentry;
   GtAffineAlignRtabentry northwestRtabentry, westRtabentry;
   GtWord rowindex, rcost, rdist, ddist, idist, minvalue;
-  GtUword gap_opening, gap_extension;
-
-  gap_opening = gt_scorehandler_get_gap_opening(scorehandler);
-  gap_extension = gt_scorehandler_get_gapscore(scorehandler);
 
   northwestAffinealignDPentry = Atabcolumn[0];
   northwestRtabentry = Rtabcolumn[0];
@@ -198,8 +193,7 @@ static void nextAtabRtabcolumn(GtAffinealignDPentry *Atabcolumn,
     westAffinealignDPentry = Atabcolumn[rowindex];
     westRtabentry = Rtabcolumn[rowindex];
 
-    rcost = gt_scorehandler_get_replacement(scorehandler,
-                                            useq[ustart+rowindex-1], b);
+    rcost = replacement[rowindex-1];
     rdist = add_safe_max(northwestAffinealignDPentry.Rvalue, rcost);
     ddist = add_safe_max(northwestAffinealignDPentry.Dvalue, rcost);
     idist = add_safe_max(northwestAffinealignDPentry.Ivalue, rcost);
@@ -261,6 +255,7 @@ static GtUword evaluateallAtabRtabcolumns(GtAffinealignDPentry *Atabcolumn,
                                           GtAffineAlignEdge edge)
 {
   GtUword colindex, gap_opening, gap_extension;
+  GtWord *replacement;
 
   gap_opening = gt_scorehandler_get_gap_opening(scorehandler);
   gap_extension = gt_scorehandler_get_gapscore(scorehandler);
@@ -268,16 +263,22 @@ static GtUword evaluateallAtabRtabcolumns(GtAffinealignDPentry *Atabcolumn,
   firstAtabRtabcolumn(Atabcolumn, Rtabcolumn, ulen,
                       gap_opening, gap_extension, edge);
 
+  replacement = gt_malloc(sizeof (*replacement) * (ulen + 1));
   for (colindex = 1UL; colindex <= vlen; colindex++)
   {
+    gt_scorehandler_get_replacement_profile(scorehandler, replacement,
+                                            useq + ustart, ulen,
+                                            vseq[vstart+colindex-1]);
     nextAtabRtabcolumn(Atabcolumn,
                        Rtabcolumn,
-                       scorehandler,
-                       useq, ustart,ulen,
-                       vseq[vstart+colindex-1],
+                       gap_opening,
+                       gap_extension,
+                       replacement,
+                       ulen,
                        midcolumn,
                        colindex);
   }
+  gt_free(replacement);
 
   return GT_MIN3(Atabcolumn[ulen].Rvalue,
               Atabcolumn[ulen].Dvalue,
@@ -416,7 +417,7 @@ static GtUword evaluateaffinecrosspoints(GtLinspaceManagement *spacemanager,
   if (vlen >= 2UL)
   {
 #ifdef GT_THREADS_ENABLED
-    if (gt_jobs == 1)
+    if (gt_linspace_management_get_maxthreads(spacemanager) == 1)
     {
 #endif
       if (gt_linspace_management_checksquare(spacemanager, ulen, vlen,
@@ -474,7 +475,8 @@ static GtUword evaluateaffinecrosspoints(GtLinspaceManagement *spacemanager,
             Ctab[midcol-1] = Ctab[midcol] == 0 ? 0: Ctab[midcol] - 1;
 
 #ifdef GT_THREADS_ENABLED
-          if (*threadcount + 1 > gt_jobs)
+          if (!gt_linspace_management_reserve_threads(spacemanager,
+                                                      threadcount, 1UL))
           {
 #endif
             (void) evaluateaffinecrosspoints(spacemanager, scorehandler,
@@ -494,7 +496,6 @@ static GtUword evaluateaffinecrosspoints(GtLinspaceManagement *spacemanager,
                                                        Ctab, rowoffset,
                                                        from_edge, midtype,
                                                        threadcount);
-            (*threadcount)++;
             t1 = gt_thread_new(evaluateaffinecrosspoints_thread_caller,
                                &threadinfo1, NULL);
           }
@@ -502,7 +503,8 @@ static GtUword evaluateaffinecrosspoints(GtLinspaceManagement *spacemanager,
           break;
         case Affine_D:
 #ifdef GT_THREADS_ENABLED
-          if (*threadcount + 1 > gt_jobs)
+          if (!gt_linspace_management_reserve_threads(spacemanager,
+                                                      threadcount, 1UL))
           {
 #endif
           (void) evaluateaffinecrosspoints(spacemanager, scorehandler,
@@ -523,7 +525,6 @@ static GtUword evaluateaffinecrosspoints(GtLinspaceManagement *spacemanager,
                                                       from_edge, midtype,
                                                       threadcount);
 
-           (*threadcount)++;
            t1 = gt_thread_new(evaluateaffinecrosspoints_thread_caller,
                                &threadinfo1, NULL);
           }
@@ -545,7 +546,8 @@ static GtUword evaluateaffinecrosspoints(GtLinspaceManagement *spacemanager,
     }
    /*bottom right corner */
 #ifdef GT_THREADS_ENABLED
-    if (*threadcount + 1 > gt_jobs)
+    if (!gt_linspace_management_reserve_threads(spacemanager,
+                                                threadcount, 1UL))
     {
 #endif
       (void) evaluateaffinecrosspoints(spacemanager, scorehandler,
@@ -566,7 +568,6 @@ static GtUword evaluateaffinecrosspoints(GtLinspaceManagement *spacemanager,
                                                    rowoffset + midrow,
                                                    midtype, to_edge,
                                                    threadcount);
-      (*threadcount)++;
       t2 = gt_thread_new(evaluateaffinecrosspoints_thread_caller,
                          &threadinfo2, NULL);
     }
@@ -574,13 +575,13 @@ static GtUword evaluateaffinecrosspoints(GtLinspaceManagement *spacemanager,
     if (t1 != NULL)
     {
       gt_thread_join(t1);
-      (*threadcount)--;
+      gt_linspace_management_release_thread(spacemanager, threadcount);
       gt_thread_delete(t1);
     }
     if (t2 != NULL)
     {
       gt_thread_join(t2);
-      (*threadcount)--;
+      gt_linspace_management_release_thread(spacemanager, threadcount);
       gt_thread_delete(t2);
     }
 
@@ -827,22 +828,19 @@ static GtUwordPair setStarttabentry(GtWord entry, GtAffinealignDPentry *Atab,
 
 static void nextAStabcolumn(GtAffinealignDPentry *Atabcolumn,
                             Starttabentry *Starttabcolumn,
-                            const GtScoreHandler *scorehandler,
-                            const GtUchar *useq, GtUword ustart,
+                            GtWord gap_opening,
+                            GtWord gap_extension,
+                            const GtWord *replacementcolumn,
                             GtUword ulen,
-                            GtUchar b,
                             GtUword colindex,
                             GtMaxcoordvalue *max)
 {
   GtAffinealignDPentry northwestAffinealignDPentry, westAffinealignDPentry;
   Starttabentry Snw, Swe;
   GtUword rowindex;
-  GtWord gap_extension, gap_opening, replacement, temp, val1, val2;
+  GtWord replacement, temp, val1, val2;
   GtUwordPair start = {0};
 
-  gap_opening = gt_scorehandler_get_gap_opening(scorehandler);
-  gap_extension = gt_scorehandler_get_gapscore(scorehandler);
-
   northwestAffinealignDPentry = Atabcolumn[0];
   Snw = Starttabcolumn[0];
   Atabcolumn[0].Rvalue = GT_WORD_MIN;
@@ -880,8 +878,7 @@ static void nextAStabcolumn(GtAffinealignDPentry *Atabcolumn,
     Swe = Starttabcolumn[rowindex];
 
     /*calculate Rvalue*/
-    replacement = gt_scorehandler_get_replacement(scorehandler,
-                                                  useq[ustart+rowindex-1], b);
+    replacement = replacementcolumn[rowindex-1];
 
     Atabcolumn[rowindex].Rvalue =
               add_safe_min(northwestAffinealignDPentry.totalvalue, replacement);
@@ -953,6 +950,7 @@ static GtMaxcoordvalue *evaluateallAStabcolumns(GtLinspaceManagement *space,
                                             GtUword vlen)
 {
   GtUword colindex;
+  GtWord gap_opening, gap_extension, *replacement;
   GtMaxcoordvalue *max;
   GtAffinealignDPentry *Atabcolumn;
   Starttabentry *Starttabcolumn;
@@ -963,11 +961,18 @@ static GtMaxcoordvalue *evaluateallAStabcolumns(GtLinspaceManagement *space,
   firstAStabcolumn(Atabcolumn, Starttabcolumn, scorehandler, ulen);
 
   max = gt_linspace_management_get_maxspace(space);
+  gap_opening = gt_scorehandler_get_gap_opening(scorehandler);
+  gap_extension = gt_scorehandler_get_gapscore(scorehandler);
+  replacement = gt_malloc(sizeof (*replacement) * (ulen + 1));
   for (colindex = 1UL; colindex <= vlen; colindex++)
   {
-    nextAStabcolumn(Atabcolumn, Starttabcolumn, scorehandler, useq, ustart,
-                    ulen, vseq[vstart+colindex-1], colindex, max);
+    gt_scorehandler_get_replacement_profile(scorehandler, replacement,
+                                            useq + ustart, ulen,
+                                            vseq[vstart+colindex-1]);
+    nextAStabcolumn(Atabcolumn, Starttabcolumn, gap_opening, gap_extension,
+                    replacement, ulen, colindex, max);
   }
+  gt_free(replacement);
   return max;
 }
 
@@ -18,6 +18,7 @@
 #include <ctype.h>
 #include <string.h>
 #include "core/ma_api.h"
+#include "core/thread_api.h"
 #include "extended/maxcoordvalue.h"
 #include "extended/linspace_management.h"
 
@@ -26,12 +27,14 @@ struct GtLinspaceManagement{
                    *rTabspace,
                    *crosspointTabspace;
   GtUword          ulen,
-                   timesquarefactor;
+                   timesquarefactor,
+                   maxthreads;
   size_t           valueTabsize,
                    rTabsize,
                    crosspointTabsize,
                    spacepeak; /*sum of space in bytes*/
   GtMaxcoordvalue *maxscoordvaluespace;
+  GtMutex         *threadmutex;
 };
 
 GtLinspaceManagement* gt_linspace_management_new()
@@ -48,6 +51,8 @@ GtLinspaceManagement* gt_linspace_management_new()
   spacemanager->timesquarefactor = 1;
   spacemanager->ulen = 0;
   spacemanager->spacepeak = 0;
+  spacemanager->maxthreads = (GtUword) gt_jobs;
+  spacemanager->threadmutex = gt_mutex_new();
   return spacemanager;
 }
 
@@ -60,6 +65,7 @@ void gt_linspace_management_delete(GtLinspaceManagement *spacemanager)
     if (spacemanager->crosspointTabspace != NULL)
       gt_free(spacemanager->crosspointTabspace);
     gt_maxcoordvalue_delete(spacemanager->maxscoordvaluespace);
+    gt_mutex_delete(spacemanager->threadmutex);
     gt_free(spacemanager);
   }
 }
@@ -282,3 +288,44 @@ void gt_linspace_management_set_TSfactor(GtLinspaceManagement *spacemanager,
   gt_assert(spacemanager != NULL);
   spacemanager->timesquarefactor = timesquarefactor;
 }
+
+bool gt_linspace_management_reserve_threads(GtLinspaceManagement *spacemanager,
+                                            GtUword *threadcount,
+                                            GtUword number)
+{
+  bool reserved = false;
+
+  gt_assert(spacemanager != NULL && threadcount != NULL);
+  gt_mutex_lock(spacemanager->threadmutex);
+  if (*threadcount + number <= spacemanager->maxthreads)
+  {
+    *threadcount += number;
+    reserved = true;
+  }
+  gt_mutex_unlock(spacemanager->threadmutex);
+  return reserved;
+}
+
+void gt_linspace_management_release_thread(GtLinspaceManagement *spacemanager,
+                                           GtUword *threadcount)
+{
+  gt_assert(spacemanager != NULL && threadcount != NULL);
+  gt_mutex_lock(spacemanager->threadmutex);
+  gt_assert(*threadcount > 0);
+  (*threadcount)--;
+  gt_mutex_unlock(spacemanager->threadmutex);
+}
+
+void gt_linspace_management_set_maxthreads(GtLinspaceManagement *spacemanager,
+                                           GtUword maxthreads)
+{
+  gt_assert(spacemanager != NULL && maxthreads > 0);
+  spacemanager->maxthreads = maxthreads;
+}
+
+GtUword gt_linspace_management_get_maxthreads(const GtLinspaceManagement
+                                              *spacemanager)
+{
+  gt_assert(spacemanager != NULL);
+  return spacemanager->maxthreads;
+}
@@ -112,6 +112,31 @@ void          gt_linspace_management_set_TSfactor(GtLinspaceManagement
                                                   *spacemanager,
                                                   GtUword timesquarefactor);
 
+/* Set the maximal number of threads used to compute one alignment with the
+   given <spacemanager> to <maxthreads>. The default is <gt_jobs>. */
+void          gt_linspace_management_set_maxthreads(GtLinspaceManagement
+                                                    *spacemanager,
+                                                    GtUword maxthreads);
+/* Return the maximal number of threads used to compute one alignment with
+   the given <spacemanager>. */
+GtUword       gt_linspace_management_get_maxthreads(const GtLinspaceManagement
+                                                    *spacemanager);
+/* Increase the number of running threads <threadcount> by <number> and
+   return true, if this does not exceed the maximal number of threads of the
+   given <spacemanager>. Otherwise return false
+   and leave <threadcount> unchanged. The access to <threadcount> is
+   synchronized by the given <spacemanager>, so that recursive calls running
+   in different threads can share the counter. */
+bool          gt_linspace_management_reserve_threads(GtLinspaceManagement
+                                                     *spacemanager,
+                                                     GtUword *threadcount,
+                                                     GtUword number);
+/* Decrease the number of running threads <threadcount> by one after a thread
+   reserved by <gt_linspace_management_reserve_threads> has been joined. */
+void          gt_linspace_management_release_thread(GtLinspaceManagement
+                                                    *spacemanager,
+                                                    GtUword *threadcount);
+
 #define add_safe(val1, val2, exception) (((val1) != (exception))\
                                            ? (val1) + (val2)\
                                            : (exception))
@@ -0,0 +1,420 @@
+/*
+  Copyright (c) 2026 agent <agent@local>
+
+  Permission to use, copy, modify, and distribute this software for any
+  purpose with or without fee is hereby granted, provided that the above
+  copyright notice and this permission notice appear in all copies.
+
+  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+
+#include <ctype.h>
+#include <stdio.h>
+#include <string.h>
+#include "md5.h"
+#include "core/assert_api.h"
+#include "core/bittab_api.h"
+#include "core/ensure_api.h"
+#include "core/fa_api.h"
+#include "core/log_api.h"
+#include "core/ma_api.h"
+#include "core/multithread_api.h"
+#include "core/safearith_api.h"
+#include "core/str_api.h"
+#include "core/thread_api.h"
+#include "core/xansi_api.h"
+#include "extended/md5diskset.h"
+#include "extended/reverse_api.h"
+
+/* the partition of a hash is given by its leading 8 bits */
+#define MD5DISKSET_NOFPARTS       256
+#define MD5DISKSET_PART(HASH)     ((HASH).h >> 56)
+/* size of a hash in a <GtMD5Set> at its maximal load factor */
+#define MD5DISKSET_BYTES_PER_HASH 20UL
+/* number of hashes read from a partition at once */
+#define MD5DISKSET_READBUFSIZE    1024UL
+/* number of sequences hashed by a thread before it fetches more work */
+#define MD5DISKSET_CHUNK_SIZE     256UL
+
+typedef struct {
+  uint64_t l, h;
+} GtMD5DiskSetHash;
+
+typedef struct {
+  FILE *hashfp,
+       *flagfp;
+  GtStr *hashfile,
+        *flagfile;
+  GtUword nofhashes;
+} GtMD5DiskSetPart;
+
+struct GtMD5DiskSet {
+  GtMD5DiskSetPart parts[MD5DISKSET_NOFPARTS];
+  FILE *orderfp; /* partition of each added sequence, one byte each */
+  GtStr *orderfile;
+  GtUword memlimit,
+          nofseqs;
+  bool both_strands,
+       finished;
+};
+
+GtMD5DiskSet* gt_md5diskset_new(GtUword memlimit, bool both_strands)
+{
+  GtMD5DiskSet *set;
+  GtUword i;
+  set = gt_calloc((size_t) 1, sizeof (*set));
+  set->memlimit = memlimit;
+  set->both_strands = both_strands;
+  for (i = 0; i < (GtUword) MD5DISKSET_NOFPARTS; i++) {
+    set->parts[i].hashfile = gt_str_new();
+    set->parts[i].hashfp = gt_xtmpfp_generic(set->parts[i].hashfile,
+                                             GT_TMPFP_OPENBINARY);
+  }
+  set->orderfile = gt_str_new();
+  set->orderfp = gt_xtmpfp_generic(set->orderfile, GT_TMPFP_OPENBINARY);
+  return set;
+}
+
+static void md5diskset_remove_file(FILE **fp, GtStr *filename)
+{
+  if (*fp != NULL) {
+    gt_fa_xfclose(*fp);
+    *fp = NULL;
+    gt_xremove(gt_str_get(filename));
+  }
+}
+
+void gt_md5diskset_delete(GtMD5DiskSet *set)
+{
+  GtUword i;
+  if (set == NULL)
+    return;
+  for (i = 0; i < (GtUword) MD5DISKSET_NOFPARTS; i++) {
+    md5diskset_remove_file(&set->parts[i].hashfp, set->parts[i].hashfile);
+    md5diskset_remove_file(&set->parts[i].flagfp, set->parts[i].flagfile);
+    gt_str_delete(set->parts[i].hashfile);
+    gt_str_delete(set->parts[i].flagfile);
+  }
+  md5diskset_remove_file(&set->orderfp, set->orderfile);
+  gt_str_delete(set->orderfile);
+  gt_free(set);
+}
+
+typedef struct {
+  const char * const *seqs;
+  const GtUword *seqlens;
+  GtMD5DiskSetHash *hashes;
+  GtUword nofseqs,
+          next;
+  bool both_strands;
+  GtMutex *mutex;
+  GtError *err;
+  bool had_err;
+} GtMD5DiskSetHashInfo;
+
+/* a sequence and its reverse complement get the same hash, the smaller one of
+   both strands */
+static inline bool md5diskset_hash_smaller(GtMD5DiskSetHash a,
+                                           GtMD5DiskSetHash b)
+{
+  return a.h < b.h || (a.h == b.h && a.l < b.l);
+}
+
+static void* md5diskset_hash_thread(void *data)
+{
+  GtMD5DiskSetHashInfo *info = data;
+  GtMD5DiskSetHash hash_rc;
+  GtError *err = gt_error_new();
+  char *buffer = NULL;
+  GtUword i, j, start, end, bufsize = 0;
+  bool had_err = false;
+
+  while (!had_err) {
+    gt_mutex_lock(info->mutex);
+    start = info->had_err ? info->nofseqs : info->next;
+    end = start + MD5DISKSET_CHUNK_SIZE < info->nofseqs
+            ? start + MD5DISKSET_CHUNK_SIZE
+            : info->nofseqs;
+    info->next = end;
+    gt_mutex_unlock(info->mutex);
+    if (start == end)
+      break;
+    for (i = start; !had_err && i < end; i++) {
+      GtUword seqlen = info->seqlens[i];
+      if (seqlen > bufsize) {
+        bufsize = seqlen;
+        buffer = gt_realloc(buffer, sizeof (*buffer) * bufsize);
+      }
+      for (j = 0; j < seqlen; j++)
+        buffer[j] = toupper(info->seqs[i][j]);
+      md5(buffer, gt_safe_cast2long(seqlen), (char*) (info->hashes + i));
+      if (info->both_strands) {
+        if (gt_reverse_complement(buffer, seqlen, err) != 0)
+          had_err = true;
+        else {
+          md5(buffer, gt_safe_cast2long(seqlen), (char*) &hash_rc);
+          if (md5diskset_hash_smaller(hash_rc, info->hashes[i]))
+            info->hashes[i] = hash_rc;
+        }
+      }
+    }
+  }
+  if (had_err) {
+    gt_mutex_lock(info->mutex);
+    if (!info->had_err) {
+      info->had_err = true;
+      gt_error_set(info->err, "%s", gt_error_get(err));
+    }
+    gt_mutex_unlock(info->mutex);
+  }
+  gt_free(buffer);
+  gt_error_delete(err);
+  return NULL;
+}
+
+int gt_md5diskset_add_sequences(GtMD5DiskSet *set,
+                                const char * const *seqs,
+                                const GtUword *seqlens,
+                                GtUword nofseqs,
+                                GtError *err)
+{
+  GtMD5DiskSetHashInfo info;
+  GtError *mt_err;
+  GtUword i;
+  int had_err = 0;
+
+  gt_assert(set != NULL && !set->finished);
+  gt_assert(nofseqs == 0 || (seqs != NULL && seqlens != NULL));
+  gt_error_check(err);
+  if (nofseqs == 0)
+    return 0;
+
+  info.seqs = seqs;
+  info.seqlens = seqlens;
+  info.hashes = gt_malloc(sizeof (*info.hashes) * nofseqs);
+  info.nofseqs = nofseqs;
+  info.next = 0;
+  info.both_strands = set->both_strands;
+  info.mutex = gt_mutex_new();
+  info.err = err;
+  info.had_err = false;
+  mt_err = gt_error_new();
+  if (gt_jobs <= 1U || nofseqs <= MD5DISKSET_CHUNK_SIZE ||
+      gt_multithread(md5diskset_hash_thread, &info, mt_err) != 0) {
+    /* hash the remaining sequences if no threads could be started */
+    (void) md5diskset_hash_thread(&info);
+  }
+  gt_error_delete(mt_err);
+  gt_mutex_delete(info.mutex);
+  if (info.had_err)
+    had_err = -1;
+
+  /* distribute the hashes in the order of the sequences */
+  for (i = 0; !had_err && i < nofseqs; i++) {
+    unsigned int partnum = (unsigned int) MD5DISKSET_PART(info.hashes[i]);
+    GtMD5DiskSetPart *part = set->parts + partnum;
+    gt_xfwrite(info.hashes + i, sizeof (*info.hashes), (size_t) 1,
+               part->hashfp);
+    part->nofhashes++;
+    gt_xfputc((int) partnum, set->orderfp);
+  }
+  if (!had_err)
+    set->nofseqs += nofseqs;
+  gt_free(info.hashes);
+  return had_err;
+}
+
+/* marks the repeated hashes of <part> in <repeated>, considering only hashes
+   whose low half is congruent to <subpart> modulo <nofsubparts> */
+static void md5diskset_process_part(GtMD5DiskSetPart *part,
+                                    GtBittab *repeated,
+                                    GtUword subpart,
+                                    GtUword nofsubparts,
+                                    GtMD5DiskSetHash *readbuf)
+{
+  GtMD5Set *md5set;
+  GtUword idx = 0, i, nofread;
+
+  md5set = gt_md5set_new(part->nofhashes / nofsubparts + 1);
+  rewind(part->hashfp);
+  while (idx < part->nofhashes) {
+    nofread = (GtUword) gt_xfread(readbuf, sizeof (*readbuf),
+                                  (size_t) MD5DISKSET_READBUFSIZE,
+                                  part->hashfp);
+    gt_assert(nofread > 0);
+    for (i = 0; i < nofread; i++, idx++) {
+      if (nofsubparts > 1UL && readbuf[i].l % nofsubparts != subpart)
+        continue;
+      if (gt_md5set_add_md5(md5set, (GtUint64) readbuf[i].l,
+                            (GtUint64) readbuf[i].h) == GT_MD5SET_FOUND)
+        gt_bittab_set_bit(repeated, idx);
+    }
+  }
+  gt_md5set_delete(md5set);
+}
+
+int gt_md5diskset_finish(GtMD5DiskSet *set, GtError *err)
+{
+  GtMD5DiskSetHash *readbuf;
+  GtUword i, idx, capacity;
+
+  gt_assert(set != NULL && !set->finished);
+  gt_error_check(err);
+  set->finished = true;
+  capacity = set->memlimit / MD5DISKSET_BYTES_PER_HASH;
+  if (capacity == 0)
+    capacity = 1UL;
+  readbuf = gt_malloc(sizeof (*readbuf) * MD5DISKSET_READBUFSIZE);
+  for (i = 0; i < (GtUword) MD5DISKSET_NOFPARTS; i++) {
+    GtMD5DiskSetPart *part = set->parts + i;
+    GtBittab *repeated = NULL;
+    GtUword subpart, nofsubparts;
+
+    if (part->nofhashes > 0) {
+      /* partitions with more distinct hashes than fit into memory are
+         processed in several passes, each one for a subset of the hashes */
+      nofsubparts = (part->nofhashes + capacity - 1) / capacity;
+      if (nofsubparts > 1UL)
+        gt_log_log("processing partition " GT_WU " with " GT_WU " hashes in "
+                   GT_WU " passes", i, part->nofhashes, nofsubparts);
+      repeated = gt_bittab_new(part->nofhashes);
+      for (subpart = 0; subpart < nofsubparts; subpart++)
+        md5diskset_process_part(part, repeated, subpart, nofsubparts, readbuf);
+      part->flagfile = gt_str_new();
+      part->flagfp = gt_xtmpfp_generic(part->flagfile, GT_TMPFP_OPENBINARY);
+      for (idx = 0; idx < part->nofhashes; idx++)
+        gt_xfputc(gt_bittab_bit_is_set(repeated, idx) ? 1 : 0, part->flagfp);
+      rewind(part->flagfp);
+      gt_bittab_delete(repeated);
+    }
+    md5diskset_remove_file(&part->hashfp, part->hashfile);
+  }
+  gt_free(readbuf);
+  rewind(set->orderfp);
+  return 0;
+}
+
+GtMD5SetStatus gt_md5diskset_next(GtMD5DiskSet *set, GtError *err)
+{
+  int partnum, flag = EOF;
+
+  gt_assert(set != NULL && set->finished);
+  gt_error_check(err);
+  partnum = fgetc(set->orderfp);
+  if (partnum != EOF && set->parts[partnum].flagfp != NULL)
+    flag = fgetc(set->parts[partnum].flagfp);
+  if (flag == EOF) {
+    gt_error_set(err, "no more sequences in MD5 disk set, or its temporary "
+                      "files could not be read");
+    return GT_MD5SET_ERROR;
+  }
+  return flag != 0 ? GT_MD5SET_FOUND : GT_MD5SET_NOT_FOUND;
+}
+
+#define MD5DISKSET_TEST_NOFSEQS 800UL
+#define MD5DISKSET_TEST_NOFDISTINCT 300UL
+
+/* compares the status of each sequence in <seqs> to the one reported by a
+   <GtMD5Set> */
+static int md5diskset_unit_test_compare(char **seqs, const GtUword *seqlens,
+                                        GtUword memlimit, bool both_strands,
+                                        GtError *err)
+{
+  GtMD5DiskSet *set;
+  GtMD5Set *md5set;
+  GtMD5SetStatus expected;
+  GtUword i, nofrepeated = 0;
+  int had_err = 0;
+
+  set = gt_md5diskset_new(memlimit, both_strands);
+  md5set = gt_md5set_new(MD5DISKSET_TEST_NOFSEQS);
+  /* add in two batches to cover appending to the temporary files */
+  had_err = gt_md5diskset_add_sequences(set, (const char * const *) seqs,
+                                        seqlens, MD5DISKSET_TEST_NOFSEQS / 2,
+                                        err);
+  if (!had_err)
+    had_err = gt_md5diskset_add_sequences(set, (const char * const *) seqs
+                                            + MD5DISKSET_TEST_NOFSEQS / 2,
+                                          seqlens
+                                            + MD5DISKSET_TEST_NOFSEQS / 2,
+                                          MD5DISKSET_TEST_NOFSEQS / 2, err);
+  if (!had_err)
+    had_err = gt_md5diskset_finish(set, err);
+  for (i = 0; !had_err && i < MD5DISKSET_TEST_NOFSEQS; i++) {
+    expected = gt_md5set_add_sequence(md5set, seqs[i], seqlens[i],
+                                      both_strands, err);
+    gt_ensure(expected != GT_MD5SET_ERROR);
+    /* repeated reverse complements are not distinguished */
+    if (expected == GT_MD5SET_RC_FOUND)
+      expected = GT_MD5SET_FOUND;
+    gt_ensure(gt_md5diskset_next(set, err) == expected);
+    if (expected == GT_MD5SET_FOUND)
+      nofrepeated++;
+  }
+  gt_ensure(nofrepeated >= MD5DISKSET_TEST_NOFSEQS
+                             - 2 * MD5DISKSET_TEST_NOFDISTINCT);
+  if (!had_err) {
+    gt_ensure(gt_md5diskset_next(set, err) == GT_MD5SET_ERROR);
+    gt_error_unset(err);
+  }
+  gt_md5set_delete(md5set);
+  gt_md5diskset_delete(set);
+  return had_err;
+}
+
+int gt_md5diskset_unit_test(GtError *err)
+{
+  char **seqs;
+  GtUword i, j, *seqlens, memlimits[] = {20UL, 1000UL, 1UL << 20};
+  uint32_t random = 42U;
+  int had_err = 0;
+  gt_error_check(err);
+
+  seqs = gt_malloc(sizeof (*seqs) * MD5DISKSET_TEST_NOFSEQS);
+  seqlens = gt_malloc(sizeof (*seqlens) * MD5DISKSET_TEST_NOFSEQS);
+  for (i = 0; i < MD5DISKSET_TEST_NOFSEQS; i++) {
+    if (i < MD5DISKSET_TEST_NOFDISTINCT) {
+      seqlens[i] = 8UL + i % 17;
+      seqs[i] = gt_malloc(sizeof (char) * seqlens[i]);
+      for (j = 0; j < seqlens[i]; j++) {
+        random = random * 1103515245U + 12345U;
+        seqs[i][j] = "acgtACGT"[(random >> 16) % 8];
+      }
+    }
+    else {
+      /* repeat an earlier sequence, in different case or reverse
+         complemented, or add a new one */
+      GtUword src = (i * 7) % MD5DISKSET_TEST_NOFDISTINCT;
+      seqlens[i] = seqlens[src];
+      seqs[i] = gt_malloc(sizeof (char) * seqlens[i]);
+      for (j = 0; j < seqlens[i]; j++)
+        seqs[i][j] = (i % 3 == 0) ? (char) toupper((int) seqs[src][j])
+                                  : seqs[src][j];
+      if (i % 3 == 1)
+        had_err = gt_reverse_complement(seqs[i], seqlens[i], err);
+      else if (i % 5 == 0)
+        seqs[i][0] = seqs[i][0] == 'a' ? 'c' : 'a';
+    }
+  }
+
+  for (i = 0; !had_err && i < sizeof (memlimits) / sizeof (memlimits[0]);
+       i++) {
+    had_err = md5diskset_unit_test_compare(seqs, seqlens, memlimits[i], false,
+                                           err);
+    if (!had_err)
+      had_err = md5diskset_unit_test_compare(seqs, seqlens, memlimits[i],
+                                             true, err);
+  }
+
+  for (i = 0; i < MD5DISKSET_TEST_NOFSEQS; i++)
+    gt_free(seqs[i]);
+  gt_free(seqs);
+  gt_free(seqlens);
+  return had_err;
+}
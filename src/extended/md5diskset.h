@@ -0,0 +1,67 @@
+/*
+  Copyright (c) 2026 agent <agent@local>
+
+  Permission to use, copy, modify, and distribute this software for any
+  purpose with or without fee is hereby granted, provided that the above
+  copyright notice and this permission notice appear in all copies.
+
+  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+
+#ifndef MD5DISKSET_H
+#define MD5DISKSET_H
+
+#include <stdbool.h>
+
+#include "core/types_api.h"
+#include "core/error_api.h"
+#include "extended/md5set.h"
+
+/* A set which finds the repeated sequences in a (possibly huge) stream of
+   sequences using a bounded amount of memory. Like <GtMD5Set>, only 128-bit
+   MD5 hashes are compared. The hashes of the added sequences are distributed
+   to temporary files by their leading bits. After all sequences have been
+   added, the files are processed one after another, each with an in-memory
+   <GtMD5Set> whose size is bounded by the memory limit. Finally, the status of
+   each sequence can be queried in the order the sequences were added. */
+typedef struct GtMD5DiskSet GtMD5DiskSet;
+
+/* Create a new <GtMD5DiskSet> whose hash tables use at most <memlimit> bytes.
+   If <both_strands> is true, a sequence also counts as repeated if its reverse
+   complement was added before. */
+GtMD5DiskSet*  gt_md5diskset_new(GtUword memlimit, bool both_strands);
+
+/* Adds the <nofseqs> sequences <seqs> of lengths <seqlens> to <set>. The MD5
+   hashes are computed by <gt_jobs> threads. Returns 0 on success and -1 on
+   error, <err> is set accordingly. */
+int            gt_md5diskset_add_sequences(GtMD5DiskSet *set,
+                                           const char * const *seqs,
+                                           const GtUword *seqlens,
+                                           GtUword nofseqs,
+                                           GtError *err);
+
+/* Determines the repeated sequences of all sequences added to <set>. No more
+   sequences can be added afterwards. Returns 0 on success and -1 on error,
+   <err> is set accordingly. */
+int            gt_md5diskset_finish(GtMD5DiskSet *set, GtError *err);
+
+/* Returns the status of the next sequence in the order they were added to
+   <set>, which must be finished: <GT_MD5SET_NOT_FOUND> if it is the first
+   occurrence of the sequence, <GT_MD5SET_FOUND> if it or its reverse
+   complement (for both strands) is repeated. Returns <GT_MD5SET_ERROR> if
+   there are no more sequences, <err> is set accordingly. */
+GtMD5SetStatus gt_md5diskset_next(GtMD5DiskSet *set, GtError *err);
+
+/* Deletes <set>, removes its temporary files and frees all associated
+   memory. */
+void           gt_md5diskset_delete(GtMD5DiskSet *set);
+
+int            gt_md5diskset_unit_test(GtError *err);
+
+#endif
@@ -276,3 +276,16 @@ GtMD5SetStatus gt_md5set_add_sequence(GtMD5Set *set, const char* seq,
 
   return GT_MD5SET_NOT_FOUND;
 }
+
+GtMD5SetStatus gt_md5set_add_md5(GtMD5Set *set, GtUint64 low, GtUint64 high)
+{
+  md5_t md5sum;
+
+  gt_assert(set != NULL);
+  gt_assert(set->table != NULL);
+
+  md5sum.l = (uint64_t) low;
+  md5sum.h = (uint64_t) high;
+  return md5set_search(set, md5sum, true) ? GT_MD5SET_FOUND
+                                          : GT_MD5SET_NOT_FOUND;
+}
@@ -57,4 +57,9 @@ GtMD5SetStatus gt_md5set_add_sequence(GtMD5Set *set, const char* seq,
                                       GtUword seqlen, bool both_strands,
                                       GtError *err);
 
+/* Adds the 128-bit MD5 hash given by its halves <low> and <high> to <set> if
+   not present. Returns <GT_MD5SET_FOUND> if it was already present and
+   <GT_MD5SET_NOT_FOUND> otherwise. */
+GtMD5SetStatus gt_md5set_add_md5(GtMD5Set *set, GtUint64 low, GtUint64 high);
+
 #endif
@@ -49,11 +49,16 @@ struct GtMergeStream {
 static int gt_merge_stream_item_compare(const void *a, const void *b)
 {
   GtMergeStreamItem *item1, *item2;
+  int rval;
   gt_assert(a && b);
   item1 = (GtMergeStreamItem*) a;
   item2 = (GtMergeStreamItem*) b;
   gt_assert(item1->gn && item2->gn);
-  return gt_genome_node_compare(&item1->gn, &item2->gn);
+  rval = gt_genome_node_compare(&item1->gn, &item2->gn);
+  /* equal nodes are delivered in the order of the input streams */
+  if (rval == 0 && item1->input_index != item2->input_index)
+    rval = item1->input_index < item2->input_index ? -1 : 1;
+  return rval;
 }
 
 static int merge_stream_next_in_order(GtNodeStream *ns, GtGenomeNode **gn,
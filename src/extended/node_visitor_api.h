@@ -48,6 +48,9 @@ int   gt_node_visitor_visit_region_node(GtNodeVisitor *node_visitor,
 int   gt_node_visitor_visit_sequence_node(GtNodeVisitor *node_visitor,
                                           GtSequenceNode *sequence_node,
                                           GtError *err);
+/* Return <true> if <node_visitor> can visit nodes of different top-level trees
+   concurrently, see <gt_node_visitor_class_set_thread_safe()>. */
+bool  gt_node_visitor_is_thread_safe(const GtNodeVisitor *node_visitor);
 /* Delete <node_visitor>. */
 void  gt_node_visitor_delete(GtNodeVisitor *node_visitor);
 
@@ -81,6 +84,13 @@ GtNodeVisitorClass* gt_node_visitor_class_new(size_t size,
                                               GtNodeVisitorEOFNodeFunc);
 void gt_node_visitor_class_set_meta_node_func(GtNodeVisitorClass*,
                                               GtNodeVisitorMetaNodeFunc);
+/* Declare that the visit functions of the given class can be called
+   concurrently by different threads for nodes of different top-level trees.
+   Such visit functions must neither modify the visitor nor objects which are
+   shared between trees (e.g., sequence IDs) without synchronization. Visitor
+   classes are not thread-safe by default. */
+void gt_node_visitor_class_set_thread_safe(GtNodeVisitorClass*,
+                                           bool thread_safe);
 GtNodeVisitor*      gt_node_visitor_create(const GtNodeVisitorClass*);
 void*               gt_node_visitor_cast(const GtNodeVisitorClass*,
                                          GtNodeVisitor*);
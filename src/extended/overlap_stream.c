@@ -0,0 +1,312 @@
+/*
+  Copyright (c) 2026 agent <agent@local>
+
+  Permission to use, copy, modify, and distribute this software for any
+  purpose with or without fee is hereby granted, provided that the above
+  copyright notice and this permission notice appear in all copies.
+
+  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+
+
+#include <stdio.h>
+#include "core/array_api.h"
+#include "core/assert_api.h"
+#include "core/class_alloc_lock.h"
+#include "core/cstr_api.h"
+#include "core/ma_api.h"
+#include "core/md5_seqid_api.h"
+#include "core/str_api.h"
+#include "extended/feature_node_api.h"
+#include "extended/feature_node_iterator_api.h"
+#include "extended/node_stream_api.h"
+#include "extended/overlap_stream.h"
+
+struct GtOverlapStream {
+  const GtNodeStream parent_instance;
+  GtNodeStream *in_stream,
+               *other_stream;
+  GtGenomeNode *next_other;    /* lookahead feature from <other_stream> */
+  GtArray *active;             /* features from <other_stream> which can still
+                                  overlap later features from <in_stream> */
+  GtStr *last_seqid,           /* position of the last feature of each */
+        *last_other_seqid;     /* stream, to check the sort order */
+  GtUword last_start,
+          last_other_start;
+  bool other_done;
+  char *count_attribute;
+  GtOverlapStreamFunc pair_func;
+  void *pair_data;
+};
+
+static int overlap_stream_cmp_seqids(GtGenomeNode *gn_a, GtGenomeNode *gn_b)
+{
+  return gt_md5_seqid_cmp_seqids(gt_str_get(gt_genome_node_get_seqid(gn_a)),
+                                 gt_str_get(gt_genome_node_get_seqid(gn_b)));
+}
+
+/* check that <gn> does not precede the last feature seen in the same stream,
+   and make it the last feature */
+static int overlap_stream_check_order(GtGenomeNode *gn, GtStr **last_seqid,
+                                      GtUword *last_start,
+                                      const char *streamname, GtError *err)
+{
+  GtStr *seqid = gt_genome_node_get_seqid(gn);
+  GtUword start = gt_genome_node_get_start(gn);
+  int rval;
+  gt_error_check(err);
+  if (*last_seqid) {
+    rval = gt_md5_seqid_cmp_seqids(gt_str_get(seqid), gt_str_get(*last_seqid));
+    if (rval < 0 || (rval == 0 && start < *last_start)) {
+      if (gt_genome_node_get_line_number(gn)) {
+        gt_error_set(err, "the %s input is not sorted (feature on line %u in "
+                     "file \"%s\" precedes an earlier feature)", streamname,
+                     gt_genome_node_get_line_number(gn),
+                     gt_genome_node_get_filename(gn));
+      }
+      else {
+        gt_error_set(err, "the %s input is not sorted (feature on sequence "
+                     "\"%s\" at position " GT_WU " precedes an earlier "
+                     "feature)", streamname, gt_str_get(seqid), start);
+      }
+      return -1;
+    }
+  }
+  if (*last_seqid != seqid) {
+    gt_str_delete(*last_seqid);
+    *last_seqid = gt_str_ref(seqid);
+  }
+  *last_start = start;
+  return 0;
+}
+
+/* the range of a pseudo-feature is not necessarily updated when parts are
+   added to it, therefore it is set to the range spanned by its children */
+static void overlap_stream_update_pseudo_range(GtGenomeNode *gn)
+{
+  GtFeatureNode *fn = gt_feature_node_cast(gn), *child;
+  GtFeatureNodeIterator *fni;
+  GtRange range, child_range;
+  if (gt_feature_node_is_pseudo(fn)) {
+    range = gt_genome_node_get_range(gn);
+    fni = gt_feature_node_iterator_new_direct(fn);
+    while ((child = gt_feature_node_iterator_next(fni))) {
+      child_range = gt_genome_node_get_range((GtGenomeNode*) child);
+      range = gt_range_join(&range, &child_range);
+    }
+    gt_feature_node_iterator_delete(fni);
+    gt_genome_node_set_range(gn, &range);
+  }
+}
+
+/* make sure that the lookahead holds the next feature from the other stream,
+   unless it is exhausted */
+static int overlap_stream_fill_next_other(GtOverlapStream *os, GtError *err)
+{
+  GtGenomeNode *gn = NULL;
+  int had_err = 0;
+  gt_error_check(err);
+  while (!had_err && !os->next_other && !os->other_done) {
+    had_err = gt_node_stream_next(os->other_stream, &gn, err);
+    if (!had_err) {
+      if (!gn)
+        os->other_done = true;
+      else if (!gt_feature_node_try_cast(gn))
+        gt_genome_node_delete(gn);
+      else {
+        had_err = overlap_stream_check_order(gn, &os->last_other_seqid,
+                                             &os->last_other_start, "second",
+                                             err);
+        if (had_err)
+          gt_genome_node_delete(gn);
+        else {
+          overlap_stream_update_pseudo_range(gn);
+          os->next_other = gn;
+        }
+      }
+    }
+  }
+  return had_err;
+}
+
+static void overlap_stream_clear_active(GtOverlapStream *os)
+{
+  GtUword i;
+  for (i = 0; i < gt_array_size(os->active); i++)
+    gt_genome_node_delete(*(GtGenomeNode**) gt_array_get(os->active, i));
+  gt_array_reset(os->active);
+}
+
+static void overlap_stream_set_count(GtOverlapStream *os, GtFeatureNode *fn,
+                                     GtUword count)
+{
+  char buf[32];
+  (void) snprintf(buf, sizeof buf, GT_WU, count);
+  if (gt_feature_node_is_pseudo(fn)) {
+    GtFeatureNodeIterator *fni = gt_feature_node_iterator_new_direct(fn);
+    GtFeatureNode *child;
+    while ((child = gt_feature_node_iterator_next(fni)))
+      gt_feature_node_set_attribute(child, os->count_attribute, buf);
+    gt_feature_node_iterator_delete(fni);
+  }
+  else
+    gt_feature_node_set_attribute(fn, os->count_attribute, buf);
+}
+
+static int overlap_stream_join(GtOverlapStream *os, GtFeatureNode *fn,
+                               GtError *err)
+{
+  GtGenomeNode *gn = (GtGenomeNode*) fn, **active;
+  GtRange range;
+  GtUword i, j, count = 0;
+  int had_err, rval;
+  gt_error_check(err);
+
+  had_err = overlap_stream_check_order(gn, &os->last_seqid, &os->last_start,
+                                       "first", err);
+  overlap_stream_update_pseudo_range(gn);
+  range = gt_genome_node_get_range(gn);
+
+  /* all active features lie on the sequence of the previous feature */
+  if (!had_err && gt_array_size(os->active) &&
+      overlap_stream_cmp_seqids(gn, *(GtGenomeNode**)
+                                    gt_array_get_first(os->active))) {
+    overlap_stream_clear_active(os);
+  }
+
+  /* move the features starting before the end of <fn> into the active list,
+     skipping the features on preceding sequences */
+  while (!had_err) {
+    if (!(had_err = overlap_stream_fill_next_other(os, err))) {
+      if (!os->next_other)
+        break;
+      rval = overlap_stream_cmp_seqids(os->next_other, gn);
+      if (rval > 0 ||
+          (rval == 0 && gt_genome_node_get_start(os->next_other) > range.end)) {
+        break;
+      }
+      if (rval < 0)
+        gt_genome_node_delete(os->next_other);
+      else
+        gt_array_add(os->active, os->next_other);
+      os->next_other = NULL;
+    }
+  }
+
+  /* drop the active features ending before the start of <fn> (they cannot
+     overlap later features, which start at least as far to the right) and
+     report the overlapping ones */
+  if (!had_err) {
+    active = gt_array_get_space(os->active);
+    for (i = 0, j = 0; i < gt_array_size(os->active); i++) {
+      GtRange other_range = gt_genome_node_get_range(active[i]);
+      if (other_range.end < range.start) {
+        gt_genome_node_delete(active[i]);
+        continue;
+      }
+      if (!had_err && other_range.start <= range.end) {
+        count++;
+        if (os->pair_func) {
+          had_err = os->pair_func(fn, (GtFeatureNode*) active[i], os->pair_data,
+                                  err);
+        }
+      }
+      active[j++] = active[i];
+    }
+    gt_array_set_size(os->active, j);
+  }
+
+  if (!had_err && os->count_attribute)
+    overlap_stream_set_count(os, fn, count);
+
+  return had_err;
+}
+
+static int overlap_stream_next(GtNodeStream *ns, GtGenomeNode **gn,
+                               GtError *err)
+{
+  GtOverlapStream *os;
+  GtFeatureNode *fn;
+  int had_err;
+  gt_error_check(err);
+  os = gt_overlap_stream_cast(ns);
+  had_err = gt_node_stream_next(os->in_stream, gn, err);
+  if (!had_err && *gn && (fn = gt_feature_node_try_cast(*gn))) {
+    if ((had_err = overlap_stream_join(os, fn, err))) {
+      gt_genome_node_delete(*gn);
+      *gn = NULL;
+    }
+  }
+  return had_err;
+}
+
+static void overlap_stream_free(GtNodeStream *ns)
+{
+  GtOverlapStream *os = gt_overlap_stream_cast(ns);
+  overlap_stream_clear_active(os);
+  gt_array_delete(os->active);
+  gt_genome_node_delete(os->next_other);
+  gt_str_delete(os->last_seqid);
+  gt_str_delete(os->last_other_seqid);
+  gt_free(os->count_attribute);
+  gt_node_stream_delete(os->other_stream);
+  gt_node_stream_delete(os->in_stream);
+}
+
+const GtNodeStreamClass* gt_overlap_stream_class(void)
+{
+  static const GtNodeStreamClass *nsc = NULL;
+  gt_class_alloc_lock_enter();
+  if (!nsc) {
+    nsc = gt_node_stream_class_new(sizeof (GtOverlapStream),
+                                   overlap_stream_free,
+                                   overlap_stream_next);
+  }
+  gt_class_alloc_lock_leave();
+  return nsc;
+}
+
+GtNodeStream* gt_overlap_stream_new(GtNodeStream *in_stream,
+                                    GtNodeStream *other_stream)
+{
+  GtNodeStream *ns;
+  GtOverlapStream *os;
+  gt_assert(in_stream && other_stream);
+  /* the order of <in_stream> is left unchanged */
+  ns = gt_node_stream_create(gt_overlap_stream_class(),
+                             gt_node_stream_is_sorted(in_stream));
+  os = gt_overlap_stream_cast(ns);
+  os->in_stream = gt_node_stream_ref(in_stream);
+  os->other_stream = gt_node_stream_ref(other_stream);
+  os->next_other = NULL;
+  os->active = gt_array_new(sizeof (GtGenomeNode*));
+  os->last_seqid = os->last_other_seqid = NULL;
+  os->last_start = os->last_other_start = 0;
+  os->other_done = false;
+  os->count_attribute = NULL;
+  os->pair_func = NULL;
+  os->pair_data = NULL;
+  return ns;
+}
+
+void gt_overlap_stream_set_count_attribute(GtOverlapStream *os,
+                                           const char *attr_name)
+{
+  gt_assert(os && attr_name && *attr_name);
+  gt_free(os->count_attribute);
+  os->count_attribute = gt_cstr_dup(attr_name);
+}
+
+void gt_overlap_stream_set_pair_func(GtOverlapStream *os,
+                                     GtOverlapStreamFunc func, void *data)
+{
+  gt_assert(os);
+  os->pair_func = func;
+  os->pair_data = data;
+}
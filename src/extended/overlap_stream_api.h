@@ -0,0 +1,62 @@
+/*
+  Copyright (c) 2026 agent <agent@local>
+
+  Permission to use, copy, modify, and distribute this software for any
+  purpose with or without fee is hereby granted, provided that the above
+  copyright notice and this permission notice appear in all copies.
+
+  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+
+
+#ifndef OVERLAP_STREAM_API_H
+#define OVERLAP_STREAM_API_H
+
+#include "core/error_api.h"
+#include "extended/feature_node_api.h"
+#include "extended/node_stream_api.h"
+
+/* Implements the <GtNodeStream> interface. A <GtOverlapStream> computes the
+   overlap join between the top-level features of two streams sorted by
+   sequence ID and start position. All nodes of the first stream are passed
+   through, the nodes of the second stream are consumed. The join is computed
+   in a single sweep over both streams, only the features of the second stream
+   which can still overlap a later feature of the first stream are kept in
+   memory. If one of the streams turns out not to be sorted, an error is
+   returned. */
+typedef struct GtOverlapStream GtOverlapStream;
+
+/* Function called for each pair of overlapping top-level features <a> (from
+   the first stream) and <b> (from the second stream) with the user supplied
+   <data>. For each <a> the overlapping <b> are reported in the order of the
+   second stream. Must return 0 on success and a negative value (with <err>
+   set) on error. */
+typedef int (*GtOverlapStreamFunc)(GtFeatureNode *a, GtFeatureNode *b,
+                                   void *data, GtError *err);
+
+/* Create a <GtOverlapStream*> which joins the features retrieved from
+   <in_stream> with the overlapping features retrieved from <other_stream>
+   and returns the nodes of <in_stream>. */
+GtNodeStream* gt_overlap_stream_new(GtNodeStream *in_stream,
+                                    GtNodeStream *other_stream);
+
+/* Add an attribute with name <attr_name> to each top-level feature returned
+   by <overlap_stream> (or to the direct children of a pseudo-feature), which
+   gives the number of overlapping features from the other stream. */
+void          gt_overlap_stream_set_count_attribute(GtOverlapStream
+                                                    *overlap_stream,
+                                                    const char *attr_name);
+
+/* Call <func> with <data> for each pair of overlapping features found by
+   <overlap_stream>. */
+void          gt_overlap_stream_set_pair_func(GtOverlapStream *overlap_stream,
+                                              GtOverlapStreamFunc func,
+                                              void *data);
+
+#endif
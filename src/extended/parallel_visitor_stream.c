@@ -0,0 +1,399 @@
+/*
+  Copyright (c) 2026 agent <agent@local>
+
+  Permission to use, copy, modify, and distribute this software for any
+  purpose with or without fee is hereby granted, provided that the above
+  copyright notice and this permission notice appear in all copies.
+
+  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+
+
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+#include "core/assert_api.h"
+#include "core/class_alloc_lock.h"
+#include "core/ensure_api.h"
+#include "core/ma_api.h"
+#include "core/multithread_api.h"
+#include "core/str_array_api.h"
+#include "core/thread_api.h"
+#include "core/unused_api.h"
+#include "core/warning_api.h"
+#include "extended/array_in_stream_api.h"
+#include "extended/array_out_stream_api.h"
+#include "extended/feature_node_api.h"
+#include "extended/node_stream_api.h"
+#include "extended/parallel_visitor_stream.h"
+
+/* number of nodes buffered per job */
+#define GT_PARALLEL_VISITOR_STREAM_NODES_PER_JOB 64
+
+struct GtParallelVisitorStream {
+  const GtNodeStream parent_instance;
+  GtNodeStream *in_stream;
+  GtNodeVisitor *visitor;
+  GtGenomeNode **batch;  /* NULL, if the nodes are visited one by one */
+  GtStrArray **warnings; /* warnings issued while visiting each node of
+                            <batch>, shown when the node is returned */
+  GtUword batchsize,
+          nof_nodes,     /* number of nodes in <batch> */
+          next_node,     /* next node of <batch> to be returned */
+          next_task,     /* next node of <batch> to be visited */
+          err_node;      /* position of the first error in <batch> */
+  GtError *batch_err;
+  GtMutex *mutex;
+  bool eof;
+};
+
+#define parallel_visitor_stream_cast(NS)\
+        gt_node_stream_cast(gt_parallel_visitor_stream_class(), NS)
+
+static GtUword parallel_visitor_stream_get_task(GtParallelVisitorStream *pvs)
+{
+  GtUword task = GT_UWORD_MAX;
+  gt_mutex_lock(pvs->mutex);
+  /* nodes after an error are not visited, as in a <GtVisitorStream> */
+  if (pvs->next_task < pvs->nof_nodes && pvs->next_task < pvs->err_node)
+    task = pvs->next_task++;
+  gt_mutex_unlock(pvs->mutex);
+  return task;
+}
+
+/* keeps a warning in the <GtStrArray> given by <data> */
+static void parallel_visitor_stream_warning_handler(void *data,
+                                                    const char *format,
+                                                    va_list ap)
+{
+  GtStrArray *warnings = data;
+  char *warning;
+  va_list aq;
+  int len;
+  va_copy(aq, ap);
+  len = vsnprintf(NULL, 0, format, aq);
+  va_end(aq);
+  if (len < 0)
+    return;
+  warning = gt_malloc(sizeof (char) * (len + 1));
+  (void) vsnprintf(warning, (size_t) len + 1, format, ap);
+  gt_str_array_add_cstr(warnings, warning);
+  gt_free(warning);
+}
+
+static void* parallel_visitor_stream_thread_func(void *data)
+{
+  GtParallelVisitorStream *pvs = data;
+  GtError *err = gt_error_new();
+  GtUword task;
+
+  while ((task = parallel_visitor_stream_get_task(pvs)) != GT_UWORD_MAX) {
+    /* the warnings are shown in stream order, not in the order in which the
+       nodes are visited */
+    gt_warning_set_thread_handler(parallel_visitor_stream_warning_handler,
+                                  pvs->warnings[task]);
+    if (gt_genome_node_accept(pvs->batch[task], pvs->visitor, err)) {
+      /* keep the error of the first node in stream order */
+      gt_mutex_lock(pvs->mutex);
+      if (task < pvs->err_node) {
+        pvs->err_node = task;
+        gt_error_set(pvs->batch_err, "%s", gt_error_get(err));
+      }
+      gt_mutex_unlock(pvs->mutex);
+      gt_error_unset(err);
+    }
+  }
+  gt_warning_set_thread_handler(NULL, NULL);
+  gt_error_delete(err);
+  return NULL;
+}
+
+/* read the next batch of nodes from the input stream and visit them */
+static int parallel_visitor_stream_fill_batch(GtParallelVisitorStream *pvs,
+                                              GtError *err)
+{
+  GtGenomeNode *gn;
+  int had_err = 0;
+  gt_error_check(err);
+  pvs->nof_nodes = pvs->next_node = pvs->next_task = 0;
+  pvs->err_node = GT_UWORD_MAX;
+  gt_error_unset(pvs->batch_err);
+  while (pvs->nof_nodes < pvs->batchsize) {
+    if (gt_node_stream_next(pvs->in_stream, &gn, pvs->batch_err)) {
+      /* report the error after the nodes read before */
+      pvs->err_node = pvs->nof_nodes;
+      pvs->eof = true;
+      break;
+    }
+    if (!gn) {
+      pvs->eof = true;
+      break;
+    }
+    gt_str_array_reset(pvs->warnings[pvs->nof_nodes]);
+    pvs->batch[pvs->nof_nodes++] = gn;
+  }
+  if (pvs->nof_nodes)
+    had_err = gt_multithread(parallel_visitor_stream_thread_func, pvs, err);
+  return had_err;
+}
+
+static int parallel_visitor_stream_next(GtNodeStream *ns, GtGenomeNode **gn,
+                                        GtError *err)
+{
+  GtParallelVisitorStream *pvs;
+  int had_err = 0;
+  gt_error_check(err);
+  pvs = parallel_visitor_stream_cast(ns);
+
+  if (!pvs->batch) {
+    had_err = gt_node_stream_next(pvs->in_stream, gn, err);
+    if (!had_err && *gn)
+      had_err = gt_genome_node_accept(*gn, pvs->visitor, err);
+    if (had_err) {
+      /* we own the node -> delete it */
+      gt_genome_node_delete(*gn);
+      *gn = NULL;
+    }
+    return had_err;
+  }
+
+  *gn = NULL;
+  if (pvs->next_node == pvs->nof_nodes && !pvs->eof)
+    had_err = parallel_visitor_stream_fill_batch(pvs, err);
+  if (!had_err && pvs->next_node < pvs->nof_nodes &&
+      pvs->next_node <= pvs->err_node) {
+    GtStrArray *warnings = pvs->warnings[pvs->next_node];
+    GtUword i;
+    for (i = 0; i < gt_str_array_size(warnings); i++)
+      gt_warning("%s", gt_str_array_get(warnings, i));
+  }
+  if (!had_err && pvs->next_node == pvs->err_node) {
+    gt_error_set(err, "%s", gt_error_get(pvs->batch_err));
+    had_err = -1;
+    /* the remaining nodes are deleted with the stream */
+    if (pvs->next_node < pvs->nof_nodes)
+      gt_genome_node_delete(pvs->batch[pvs->next_node++]);
+    pvs->err_node = GT_UWORD_MAX;
+    pvs->eof = true;
+  }
+  if (!had_err && pvs->next_node < pvs->nof_nodes)
+    *gn = pvs->batch[pvs->next_node++];
+  return had_err;
+}
+
+static void parallel_visitor_stream_free(GtNodeStream *ns)
+{
+  GtParallelVisitorStream *pvs = parallel_visitor_stream_cast(ns);
+  GtUword i;
+  for (i = pvs->next_node; i < pvs->nof_nodes; i++)
+    gt_genome_node_delete(pvs->batch[i]);
+  for (i = 0; pvs->warnings && i < pvs->batchsize; i++)
+    gt_str_array_delete(pvs->warnings[i]);
+  gt_free(pvs->warnings);
+  gt_free(pvs->batch);
+  gt_error_delete(pvs->batch_err);
+  gt_mutex_delete(pvs->mutex);
+  gt_node_visitor_delete(pvs->visitor);
+  gt_node_stream_delete(pvs->in_stream);
+}
+
+const GtNodeStreamClass* gt_parallel_visitor_stream_class(void)
+{
+  static const GtNodeStreamClass *nsc = NULL;
+  gt_class_alloc_lock_enter();
+  if (!nsc) {
+    nsc = gt_node_stream_class_new(sizeof (GtParallelVisitorStream),
+                                   parallel_visitor_stream_free,
+                                   parallel_visitor_stream_next);
+  }
+  gt_class_alloc_lock_leave();
+  return nsc;
+}
+
+GtNodeStream* gt_parallel_visitor_stream_new(GtNodeStream *in_stream,
+                                             GtNodeVisitor *node_visitor)
+{
+  GtParallelVisitorStream *pvs;
+  GtNodeStream *ns;
+  gt_assert(in_stream && node_visitor);
+  ns = gt_node_stream_create(gt_parallel_visitor_stream_class(),
+                             gt_node_stream_is_sorted(in_stream));
+  pvs = parallel_visitor_stream_cast(ns);
+  pvs->in_stream = gt_node_stream_ref(in_stream);
+  pvs->visitor = node_visitor;
+  pvs->batch = NULL;
+  pvs->warnings = NULL;
+  pvs->batch_err = NULL;
+  pvs->mutex = NULL;
+  pvs->batchsize = pvs->nof_nodes = pvs->next_node = pvs->next_task = 0;
+  pvs->err_node = GT_UWORD_MAX;
+  pvs->eof = false;
+  if (gt_jobs > 1 && gt_node_visitor_is_thread_safe(node_visitor)) {
+    GtUword i;
+    pvs->batchsize = (GtUword) gt_jobs *
+                     GT_PARALLEL_VISITOR_STREAM_NODES_PER_JOB;
+    pvs->batch = gt_malloc(sizeof *pvs->batch * pvs->batchsize);
+    pvs->warnings = gt_malloc(sizeof *pvs->warnings * pvs->batchsize);
+    for (i = 0; i < pvs->batchsize; i++)
+      pvs->warnings[i] = gt_str_array_new();
+    pvs->batch_err = gt_error_new();
+    pvs->mutex = gt_mutex_new();
+  }
+  return ns;
+}
+
+/* a thread-safe visitor for the unit test, which sets the score of each feature
+   to its start position, warns about it, and fails on the feature starting at
+   <fail_start> */
+typedef struct {
+  const GtNodeVisitor parent_instance;
+  GtUword fail_start;
+} GtParallelVisitorStreamTestVisitor;
+
+static int parallel_visitor_stream_test_feature_node(GtNodeVisitor *nv,
+                                                     GtFeatureNode *fn,
+                                                     GtError *err)
+{
+  GtParallelVisitorStreamTestVisitor *tv =
+    (GtParallelVisitorStreamTestVisitor*) nv;
+  GtUword start = gt_genome_node_get_start((GtGenomeNode*) fn);
+  gt_error_check(err);
+  if (start == tv->fail_start) {
+    gt_error_set(err, "feature at " GT_WU, start);
+    return -1;
+  }
+  gt_feature_node_set_score(fn, (float) start);
+  gt_warning("feature at " GT_WU, start);
+  return 0;
+}
+
+static GtNodeVisitor* parallel_visitor_stream_test_visitor_new(GtUword
+                                                               fail_start)
+{
+  static GtNodeVisitorClass *nvc = NULL;
+  GtNodeVisitor *nv;
+  gt_class_alloc_lock_enter();
+  if (!nvc) {
+    nvc = gt_node_visitor_class_new(sizeof
+                                    (GtParallelVisitorStreamTestVisitor),
+                                    NULL,
+                                    NULL,
+                                    parallel_visitor_stream_test_feature_node,
+                                    NULL,
+                                    NULL,
+                                    NULL);
+    gt_node_visitor_class_set_thread_safe(nvc, true);
+  }
+  gt_class_alloc_lock_leave();
+  nv = gt_node_visitor_create(nvc);
+  ((GtParallelVisitorStreamTestVisitor*) nv)->fail_start = fail_start;
+  return nv;
+}
+
+static int parallel_visitor_stream_test_run(GtUword numofnodes,
+                                            GtUword fail_start, GtError *err)
+{
+  GtNodeStream *in_stream, *pv_stream, *out_stream;
+  GtWarningHandler warning_handler = gt_warning_get_handler();
+  void *warning_data = gt_warning_get_data();
+  GtArray *nodes, *result;
+  GtStrArray *warnings;
+  GtStr *seqid;
+  GtUword idx, progress = 0;
+  GtError *pull_err;
+  int had_err = 0, pull_had_err;
+  gt_error_check(err);
+
+  seqid = gt_str_new_cstr("seq");
+  nodes = gt_array_new(sizeof (GtGenomeNode*));
+  result = gt_array_new(sizeof (GtGenomeNode*));
+  for (idx = 0; idx < numofnodes; idx++) {
+    GtGenomeNode *gn = gt_feature_node_new(seqid, "gene", idx + 1, idx + 10,
+                                           GT_STRAND_FORWARD);
+    gt_array_add(nodes, gn);
+  }
+  /* collect the warnings shown while the nodes are pulled */
+  warnings = gt_str_array_new();
+  gt_warning_set_handler(parallel_visitor_stream_warning_handler, warnings);
+  in_stream = gt_array_in_stream_new(nodes, &progress, err);
+  pv_stream = gt_parallel_visitor_stream_new(in_stream,
+                               parallel_visitor_stream_test_visitor_new(
+                                                                   fail_start));
+  out_stream = gt_array_out_stream_new(pv_stream, result, err);
+  pull_err = gt_error_new();
+  pull_had_err = gt_node_stream_pull(out_stream, pull_err);
+  gt_node_stream_delete(out_stream);
+  gt_node_stream_delete(pv_stream);
+  gt_node_stream_delete(in_stream);
+  gt_warning_set_handler(warning_handler, warning_data);
+
+  if (fail_start <= numofnodes) {
+    /* the error of the failing node is reported, the nodes before it are
+       returned (except for those buffered by the streams) */
+    char expected[32];
+    (void) snprintf(expected, sizeof expected, "feature at " GT_WU,
+                    fail_start);
+    gt_ensure(pull_had_err);
+    gt_ensure(!strcmp(gt_error_get(pull_err), expected));
+    gt_ensure(gt_array_size(result) < fail_start);
+  }
+  else {
+    gt_ensure(!pull_had_err);
+    gt_ensure(gt_array_size(result) == numofnodes);
+  }
+  /* the nodes are returned in order and have been visited */
+  for (idx = 0; !had_err && idx < gt_array_size(result); idx++) {
+    GtGenomeNode *gn = *(GtGenomeNode**) gt_array_get(result, idx);
+    gt_ensure(gn == *(GtGenomeNode**) gt_array_get(nodes, idx));
+    gt_ensure(gt_feature_node_score_is_defined((GtFeatureNode*) gn));
+    gt_ensure(gt_feature_node_get_score((GtFeatureNode*) gn) ==
+              (float) (idx + 1));
+  }
+  /* the warnings of the returned nodes are shown in stream order, before the
+     node is returned */
+  gt_ensure(gt_str_array_size(warnings) >= gt_array_size(result));
+  gt_ensure(fail_start > numofnodes ||
+            gt_str_array_size(warnings) < fail_start);
+  for (idx = 0; !had_err && idx < gt_str_array_size(warnings); idx++) {
+    char expected[32];
+    (void) snprintf(expected, sizeof expected, "feature at " GT_WU, idx + 1);
+    gt_ensure(!strcmp(gt_str_array_get(warnings, idx), expected));
+  }
+
+  for (idx = 0; idx < gt_array_size(result); idx++)
+    gt_genome_node_delete(*(GtGenomeNode**) gt_array_get(result, idx));
+  /* nodes not read from the input stream are still owned by us */
+  for (idx = progress; idx < numofnodes; idx++)
+    gt_genome_node_delete(*(GtGenomeNode**) gt_array_get(nodes, idx));
+  gt_error_delete(pull_err);
+  gt_str_array_delete(warnings);
+  gt_array_delete(result);
+  gt_array_delete(nodes);
+  gt_str_delete(seqid);
+  return had_err;
+}
+
+int gt_parallel_visitor_stream_unit_test(GtError *err)
+{
+  const GtUword numofnodes = 1000;
+  int had_err = 0;
+  gt_error_check(err);
+
+  /* the number of jobs is set with the -j option of gt -test */
+  had_err = parallel_visitor_stream_test_run(numofnodes, GT_UWORD_MAX, err);
+  if (!had_err)
+    had_err = parallel_visitor_stream_test_run(numofnodes, 1, err);
+  if (!had_err)
+    had_err = parallel_visitor_stream_test_run(numofnodes, 500, err);
+  if (!had_err)
+    had_err = parallel_visitor_stream_test_run(numofnodes, numofnodes, err);
+  if (!had_err)
+    had_err = parallel_visitor_stream_test_run(0, GT_UWORD_MAX, err);
+  return had_err;
+}
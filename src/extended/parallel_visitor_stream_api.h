@@ -0,0 +1,39 @@
+/*
+  Copyright (c) 2026 agent <agent@local>
+
+  Permission to use, copy, modify, and distribute this software for any
+  purpose with or without fee is hereby granted, provided that the above
+  copyright notice and this permission notice appear in all copies.
+
+  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+
+
+#ifndef PARALLEL_VISITOR_STREAM_API_H
+#define PARALLEL_VISITOR_STREAM_API_H
+
+#include "extended/node_stream_api.h"
+#include "extended/node_visitor_api.h"
+
+/* Implements the <GtNodeStream> interface. Like a <GtVisitorStream>, a
+   <GtParallelVisitorStream> applies a node visitor to each node which passes
+   through it. If the visitor is thread-safe (see
+   <gt_node_visitor_is_thread_safe()>) and more than one job is requested (see
+   <gt_jobs>), the nodes are read in batches of a bounded size and the
+   top-level trees of a batch are visited by <gt_jobs> threads. The nodes are
+   returned in their original order. Otherwise, the nodes are visited one after
+   the other as by a <GtVisitorStream>. */
+typedef struct GtParallelVisitorStream GtParallelVisitorStream;
+
+/* Create a new <GtParallelVisitorStream*> which applies <node_visitor> to the
+   nodes retrieved from <in_stream>. Takes ownership of <node_visitor>. */
+GtNodeStream* gt_parallel_visitor_stream_new(GtNodeStream *in_stream,
+                                             GtNodeVisitor *node_visitor);
+
+#endif
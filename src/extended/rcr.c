@@ -1981,7 +1981,7 @@ static int rcr_write_decoding_to_file(GtRcrDecoder *rcr_dec, GtError *err)
     gt_str_reset(qname);
     /* read read name */
     if (!had_err && rcr_dec->encdesc != NULL) {
-      if (gt_encdesc_decode(rcr_dec->encdesc, cur_read, qname, err) != 1) {
+      if (gt_encdesc_decode(rcr_dec->encdesc, cur_read, qname, err) != 0) {
         had_err = -1;
       }
     }
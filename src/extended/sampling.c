@@ -30,6 +30,7 @@
 typedef enum {
   GT_SAMPLING_REGULAR,
   GT_SAMPLING_PAGES,
+  GT_SAMPLING_BLOCKS,
 } GtSamplingMethod;
 
 struct GtSampling
@@ -85,6 +86,21 @@ GtSampling *gt_sampling_new_page(GtUword rate, off_t first_offset)
   return sampling;
 }
 
+GtSampling *gt_sampling_new_block(GtUword rate, GtUint64 first_bitpos)
+{
+  GtSampling *sampling = gt_malloc(sizeof (*sampling));
+  sampling->method = GT_SAMPLING_BLOCKS;
+  gt_assert(rate != 0);
+
+  gt_sampling_init_sampling(sampling, rate);
+
+  sampling->page_sampling = NULL;
+  sampling->samplingtab = gt_malloc((size_t) sampling->arraysize *
+                                    sizeof (*sampling->samplingtab));
+  gt_safe_assign(sampling->samplingtab[0], first_bitpos);
+  return sampling;
+}
+
 static inline void gt_sampling_xfwrite(void *ptr,
                                        size_t size,
                                        size_t nmemb,
@@ -159,7 +175,8 @@ static void gt_sampling_io_header_samplingtab(GtSampling *sampling,
 {
   gt_sampling_io_header(sampling, fp, io_func);
   gt_assert(sampling->method == GT_SAMPLING_REGULAR ||
-            sampling->method == GT_SAMPLING_PAGES);
+            sampling->method == GT_SAMPLING_PAGES ||
+            sampling->method == GT_SAMPLING_BLOCKS);
 
   if (sampling->samplingtab == NULL) {
     sampling->arraysize = sampling->numofsamples;
@@ -219,26 +236,25 @@ static void get_pagewise_page(GtSampling *sampling,
                               GtUword *sampled_element,
                               size_t *position)
 {
-  GtWord start = (GtWord) -1,
+  GtWord start = 0,
          end, middle;
 
   gt_assert(sampling->numofsamples != 0);
+  gt_assert(sampling->page_sampling[0] == 0);
   /* should not overflow, because this is a small table indexing into a larger
      one. */
   gt_safe_assign(end, sampling->numofsamples);
-  middle = GT_DIV2(end);
+  /* invariant: page_sampling[start] <= element_num < page_sampling[end] */
   while (end - start > (GtWord) 1) {
+    middle = start + GT_DIV2(end - start);
     if (element_num < sampling->page_sampling[middle]) {
-      start = middle;
+      end = middle;
     }
     else {
-      end = middle;
+      start = middle;
     }
-    middle = start + GT_DIV2(end - start);
-  }
-  if (middle < 0) {
-    middle = 0;
   }
+  middle = start;
   *sampled_element =
     sampling->current_sample_elementnum =
     sampling->page_sampling[middle];
@@ -259,6 +275,7 @@ void gt_sampling_get_page(GtSampling *sampling,
 
   switch (sampling->method) {
     case GT_SAMPLING_REGULAR:
+    case GT_SAMPLING_BLOCKS:
       get_regular_page(sampling, element_num, sampled_element, position);
       break;
 
@@ -282,6 +299,7 @@ GtUword gt_sampling_get_next_elementnum(GtSampling *sampling)
   gt_assert((sampling->current_sample_num + 1) < sampling->arraysize);
   switch (sampling->method) {
     case GT_SAMPLING_REGULAR:
+    case GT_SAMPLING_BLOCKS:
       return sampling->current_sample_elementnum + sampling->sampling_rate;
     case GT_SAMPLING_PAGES:
       return sampling->page_sampling[sampling->current_sample_num + 1];
@@ -310,6 +328,7 @@ int gt_sampling_get_next_sample(GtSampling *sampling,
     sampling->current_sample_num++;
     switch (sampling->method) {
       case GT_SAMPLING_REGULAR:
+      case GT_SAMPLING_BLOCKS:
         *sampled_element =
           sampling->current_sample_elementnum += sampling->sampling_rate;
         break;
@@ -332,6 +351,12 @@ bool gt_sampling_is_regular(GtSampling *sampling)
   return sampling->method == GT_SAMPLING_REGULAR;
 }
 
+bool gt_sampling_is_block(GtSampling *sampling)
+{
+  gt_assert(sampling);
+  return sampling->method == GT_SAMPLING_BLOCKS;
+}
+
 GtUword gt_sampling_get_rate(GtSampling *sampling)
 {
   gt_assert(sampling);
@@ -372,7 +397,7 @@ bool gt_sampling_is_next_element_sample(GtSampling *sampling,
                                         GtUword elem_bit_size,
                                         GtUword free_pagespace_bitsize)
 {
-  if (sampling->method == GT_SAMPLING_REGULAR)
+  if (sampling->method != GT_SAMPLING_PAGES)
     return elements_written >= sampling->sampling_rate;
   else {
     if (pages_written >= sampling->sampling_rate) {
@@ -45,6 +45,13 @@ GtSampling*   gt_sampling_new_regular(GtUword rate, off_t first_offset);
    pagesize. */
 GtSampling*   gt_sampling_new_page(GtUword rate, off_t first_offset);
 
+/* Returns a new <GtSampling> object which uses regular sampling like
+   <gt_sampling_new_regular()>, but the stored positions are bit positions in
+   the file, so samples do not need to start at a page border. This keeps the
+   overhead of small sampling rates low. <rate> sets the sampling rate and
+   <first_bitpos> is the position of the first sample in bits. */
+GtSampling*   gt_sampling_new_block(GtUword rate, GtUint64 first_bitpos);
+
 /* Writes <sampling> to <FILE> <fp>. */
 void          gt_sampling_write(GtSampling *sampling, FILE *fp);
 
@@ -54,7 +61,8 @@ void          gt_sampling_write(GtSampling *sampling, FILE *fp);
 GtSampling*   gt_sampling_read(FILE *fp);
 
 /* sets <*sampled_element> to the largest sampled element <= <element_num>, and
-   sets <*position> to the offset where that sample starts. */
+   sets <*position> to the offset where that sample starts (a bit position for
+   block sampling). */
 void          gt_sampling_get_page(GtSampling *sampling,
                                    GtUword element_num,
                                    GtUword *sampled_element,
@@ -82,6 +90,10 @@ GtUword gt_sampling_get_rate(GtSampling *sampling);
 /* Returns true if <sampling> uses regular sampling. */
 bool          gt_sampling_is_regular(GtSampling *sampling);
 
+/* Returns true if <sampling> uses block sampling, that is the positions
+   returned by <sampling> are bit positions. */
+bool          gt_sampling_is_block(GtSampling *sampling);
+
 /* Tells <sampling> to store a new sample with element number <element_num>
    and file offset <position>, where position is expected to be a multiple of
    pagesize. */
@@ -126,6 +126,67 @@ GtWord gt_scorehandler_get_replacement(const GtScoreHandler *scorehandler,
   return gt_score_matrix_get_score(scorehandler->scorematrix,a,b);
 }
 
+void gt_scorehandler_get_replacement_profile(const GtScoreHandler
+                                               *scorehandler,
+                                             GtWord *profile,
+                                             const GtUchar *useq,
+                                             GtUword ulen,
+                                             GtUchar b)
+{
+  GtUword idx;
+
+  gt_assert(scorehandler != NULL && (ulen == 0 || profile != NULL));
+  if (scorehandler->scorematrix != NULL)
+  {
+    gt_assert(scorehandler->mappedsequence);
+    for (idx = 0; idx < ulen; idx++)
+    {
+      profile[idx] = gt_score_matrix_get_score(scorehandler->scorematrix,
+                                               useq[idx],b);
+    }
+  } else
+  {
+    const GtWord matchscore = scorehandler->matchscore,
+                 mismatchscore = scorehandler->mismatchscore;
+
+    if (scorehandler->mappedsequence)
+    {
+      if (GT_ISSPECIAL(b))
+      {
+        for (idx = 0; idx < ulen; idx++)
+        {
+          profile[idx] = mismatchscore;
+        }
+      } else
+      {
+        /* a special character never equals <b>, so no extra test is
+           required and the loop is free of branches */
+        for (idx = 0; idx < ulen; idx++)
+        {
+          profile[idx] = useq[idx] == b ? matchscore : mismatchscore;
+        }
+      }
+    } else
+    {
+      if (scorehandler->downcase)
+      {
+        b = tolower((int) b);
+        for (idx = 0; idx < ulen; idx++)
+        {
+          profile[idx] = tolower((int) useq[idx]) == (int) b ? matchscore
+                                                             : mismatchscore;
+        }
+      } else
+      {
+        for (idx = 0; idx < ulen; idx++)
+        {
+          profile[idx] = useq[idx] == b ? matchscore : mismatchscore;
+        }
+      }
+    }
+  }
+}
+
 GtScoreHandler *gt_scorehandler2costhandler(const GtScoreHandler *scorehandler)
 {
   GtScoreHandler *costhandler;
@@ -57,6 +57,15 @@ GtWord          gt_scorehandler_get_replacement(const GtScoreHandler
                                                 *scorehandler,
                                                 GtUchar a,
                                                 GtUchar b);
+/* Store in <profile>[i] the replacement score value for the characters
+   <useq>[i] and <b> for all i from 0 to <ulen>-1. This gives the
+   replacement values of a complete DP column at once. */
+void            gt_scorehandler_get_replacement_profile(const GtScoreHandler
+                                                          *scorehandler,
+                                                        GtWord *profile,
+                                                        const GtUchar *useq,
+                                                        GtUword ulen,
+                                                        GtUchar b);
 /* Return a <GtScoreHandler> object, which is generated by transforming score
    values of the given <scorehandler> to cost values. */
 GtScoreHandler *gt_scorehandler2costhandler(const GtScoreHandler *scorehandler);
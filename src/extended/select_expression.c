@@ -0,0 +1,670 @@
+/*
+  Copyright (c) 2026 agent <agent@local>
+
+  Permission to use, copy, modify, and distribute this software for any
+  purpose with or without fee is hereby granted, provided that the above
+  copyright notice and this permission notice appear in all copies.
+
+  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+
+
+#include <ctype.h>
+#include <string.h>
+#include "core/assert_api.h"
+#include "core/cstr_api.h"
+#include "core/ensure_api.h"
+#include "core/ma_api.h"
+#include "core/parseutils_api.h"
+#include "core/str_api.h"
+#include "core/strand_api.h"
+#include "extended/feature_node_api.h"
+#include "extended/feature_node_iterator_api.h"
+#include "extended/select_expression.h"
+
+#define GT_SELECT_EXPRESSION_ATTR_PREFIX "attr."
+
+typedef enum {
+  GT_SELECT_EXPRESSION_AND,
+  GT_SELECT_EXPRESSION_OR,
+  GT_SELECT_EXPRESSION_NOT,
+  GT_SELECT_EXPRESSION_ANY,
+  GT_SELECT_EXPRESSION_ALL,
+  GT_SELECT_EXPRESSION_COMPARE,
+  GT_SELECT_EXPRESSION_EXISTS
+} GtSelectExpressionKind;
+
+typedef enum {
+  GT_SELECT_EXPRESSION_TYPE,
+  GT_SELECT_EXPRESSION_SEQID,
+  GT_SELECT_EXPRESSION_SOURCE,
+  GT_SELECT_EXPRESSION_START,
+  GT_SELECT_EXPRESSION_END,
+  GT_SELECT_EXPRESSION_LENGTH,
+  GT_SELECT_EXPRESSION_SCORE,
+  GT_SELECT_EXPRESSION_STRAND,
+  GT_SELECT_EXPRESSION_ATTRIBUTE
+} GtSelectExpressionField;
+
+typedef enum {
+  GT_SELECT_EXPRESSION_EQ,
+  GT_SELECT_EXPRESSION_NE,
+  GT_SELECT_EXPRESSION_LT,
+  GT_SELECT_EXPRESSION_LE,
+  GT_SELECT_EXPRESSION_GT,
+  GT_SELECT_EXPRESSION_GE
+} GtSelectExpressionOp;
+
+typedef struct GtSelectExpressionNode GtSelectExpressionNode;
+
+struct GtSelectExpressionNode {
+  GtSelectExpressionKind kind;
+  GtSelectExpressionField field;
+  GtSelectExpressionOp op;
+  char *attribute,             /* attribute name */
+       *string;                /* value for string comparisons */
+  double number;               /* value for numerical comparisons */
+  GtStrand strand;             /* value for strand comparisons */
+  GtSelectExpressionNode *left,
+                         *right;
+};
+
+struct GtSelectExpression {
+  GtSelectExpressionNode *root;
+  unsigned int reference_count;
+};
+
+static const char *gt_select_expression_fields[] = {
+  "type", "seqid", "source", "start", "end", "length", "score", "strand"
+};
+
+typedef enum {
+  GT_SELECT_EXPRESSION_TOKEN_END,
+  GT_SELECT_EXPRESSION_TOKEN_LPAREN,
+  GT_SELECT_EXPRESSION_TOKEN_RPAREN,
+  GT_SELECT_EXPRESSION_TOKEN_OP,
+  GT_SELECT_EXPRESSION_TOKEN_AND,
+  GT_SELECT_EXPRESSION_TOKEN_OR,
+  GT_SELECT_EXPRESSION_TOKEN_NOT,
+  GT_SELECT_EXPRESSION_TOKEN_WORD,
+  GT_SELECT_EXPRESSION_TOKEN_STRING
+} GtSelectExpressionTokenType;
+
+typedef struct {
+  const char *expression,
+             *pos;
+  GtSelectExpressionTokenType token;
+  GtSelectExpressionOp op;      /* for operator tokens */
+  GtStr *value;                 /* for word and string tokens */
+  GtUword tokenpos;
+  GtError *err;
+} GtSelectExpressionParser;
+
+static GtSelectExpressionNode* select_expression_node_new(
+                                                  GtSelectExpressionKind kind)
+{
+  GtSelectExpressionNode *node = gt_calloc(1, sizeof *node);
+  node->kind = kind;
+  return node;
+}
+
+static void select_expression_node_delete(GtSelectExpressionNode *node)
+{
+  if (!node) return;
+  select_expression_node_delete(node->left);
+  select_expression_node_delete(node->right);
+  gt_free(node->attribute);
+  gt_free(node->string);
+  gt_free(node);
+}
+
+static int select_expression_error(GtSelectExpressionParser *p,
+                                   const char *msg)
+{
+  gt_error_set(p->err, "invalid select expression \"%s\": %s at position "
+               GT_WU, p->expression, msg, p->tokenpos + 1);
+  return -1;
+}
+
+static bool select_expression_is_word_char(char c)
+{
+  return c != '\0' && !isspace((unsigned char) c) && !strchr("()!=<>&|\"", c);
+}
+
+/* read the next token of the expression */
+static int select_expression_next_token(GtSelectExpressionParser *p)
+{
+  const char *s = p->pos;
+  while (isspace((unsigned char) *s))
+    s++;
+  p->tokenpos = (GtUword) (s - p->expression);
+  gt_str_reset(p->value);
+  switch (*s) {
+    case '\0':
+      p->token = GT_SELECT_EXPRESSION_TOKEN_END;
+      break;
+    case '(':
+      p->token = GT_SELECT_EXPRESSION_TOKEN_LPAREN;
+      s++;
+      break;
+    case ')':
+      p->token = GT_SELECT_EXPRESSION_TOKEN_RPAREN;
+      s++;
+      break;
+    case '=':
+      if (s[1] != '=')
+        return select_expression_error(p, "'=' is not an operator, use '=='");
+      p->token = GT_SELECT_EXPRESSION_TOKEN_OP;
+      p->op = GT_SELECT_EXPRESSION_EQ;
+      s += 2;
+      break;
+    case '!':
+      if (s[1] == '=') {
+        p->token = GT_SELECT_EXPRESSION_TOKEN_OP;
+        p->op = GT_SELECT_EXPRESSION_NE;
+        s += 2;
+      }
+      else {
+        p->token = GT_SELECT_EXPRESSION_TOKEN_NOT;
+        s++;
+      }
+      break;
+    case '<':
+    case '>':
+      p->token = GT_SELECT_EXPRESSION_TOKEN_OP;
+      if (s[1] == '=') {
+        p->op = *s == '<' ? GT_SELECT_EXPRESSION_LE : GT_SELECT_EXPRESSION_GE;
+        s += 2;
+      }
+      else {
+        p->op = *s == '<' ? GT_SELECT_EXPRESSION_LT : GT_SELECT_EXPRESSION_GT;
+        s++;
+      }
+      break;
+    case '&':
+    case '|':
+      if (s[1] != *s)
+        return select_expression_error(p, "unknown operator");
+      p->token = *s == '&' ? GT_SELECT_EXPRESSION_TOKEN_AND
+                           : GT_SELECT_EXPRESSION_TOKEN_OR;
+      s += 2;
+      break;
+    case '"':
+      s++;
+      while (*s != '"') {
+        if (*s == '\0')
+          return select_expression_error(p, "unterminated string");
+        if (*s == '\\' && (s[1] == '"' || s[1] == '\\'))
+          s++;
+        gt_str_append_char(p->value, *s++);
+      }
+      s++;
+      p->token = GT_SELECT_EXPRESSION_TOKEN_STRING;
+      break;
+    default:
+      while (select_expression_is_word_char(*s))
+        gt_str_append_char(p->value, *s++);
+      p->token = GT_SELECT_EXPRESSION_TOKEN_WORD;
+      if (!strcmp(gt_str_get(p->value), "and"))
+        p->token = GT_SELECT_EXPRESSION_TOKEN_AND;
+      else if (!strcmp(gt_str_get(p->value), "or"))
+        p->token = GT_SELECT_EXPRESSION_TOKEN_OR;
+      else if (!strcmp(gt_str_get(p->value), "not"))
+        p->token = GT_SELECT_EXPRESSION_TOKEN_NOT;
+  }
+  p->pos = s;
+  return 0;
+}
+
+static int select_expression_parse_or(GtSelectExpressionParser *p,
+                                      GtSelectExpressionNode **node);
+
+/* parse the value of the comparison <node> */
+static int select_expression_parse_value(GtSelectExpressionParser *p,
+                                         GtSelectExpressionNode *node)
+{
+  const char *value;
+  bool equality = node->op == GT_SELECT_EXPRESSION_EQ ||
+                  node->op == GT_SELECT_EXPRESSION_NE;
+  if (p->token != GT_SELECT_EXPRESSION_TOKEN_WORD &&
+      p->token != GT_SELECT_EXPRESSION_TOKEN_STRING) {
+    return select_expression_error(p, "expected value");
+  }
+  value = gt_str_get(p->value);
+  switch (node->field) {
+    case GT_SELECT_EXPRESSION_TYPE:
+    case GT_SELECT_EXPRESSION_SEQID:
+    case GT_SELECT_EXPRESSION_SOURCE:
+      if (!equality) {
+        return select_expression_error(p, "only '==' and '!=' can be used "
+                                       "with this field");
+      }
+      node->string = gt_cstr_dup(value);
+      break;
+    case GT_SELECT_EXPRESSION_STRAND:
+      if (!equality) {
+        return select_expression_error(p, "only '==' and '!=' can be used "
+                                       "with this field");
+      }
+      if (strlen(value) != 1 ||
+          (node->strand = gt_strand_get(value[0])) == GT_NUM_OF_STRAND_TYPES) {
+        return select_expression_error(p, "strand must be one of '"
+                                       GT_STRAND_CHARS "'");
+      }
+      break;
+    case GT_SELECT_EXPRESSION_ATTRIBUTE:
+      if (equality) {
+        node->string = gt_cstr_dup(value);
+        break;
+      }
+      /* fall through, ordering comparisons of attributes are numerical */
+    default:
+      if (gt_parse_double(&node->number, value))
+        return select_expression_error(p, "expected number");
+  }
+  return select_expression_next_token(p);
+}
+
+/* parse a comparison or an attribute test */
+static int select_expression_parse_comparison(GtSelectExpressionParser *p,
+                                              GtSelectExpressionNode **node)
+{
+  const char *name = gt_str_get(p->value);
+  const size_t prefixlen = strlen(GT_SELECT_EXPRESSION_ATTR_PREFIX);
+  GtSelectExpressionNode *n;
+  GtUword i, nof_fields = sizeof gt_select_expression_fields /
+                          sizeof gt_select_expression_fields[0];
+  int had_err;
+
+  n = select_expression_node_new(GT_SELECT_EXPRESSION_COMPARE);
+  if (!strncmp(name, GT_SELECT_EXPRESSION_ATTR_PREFIX, prefixlen) &&
+      name[prefixlen] != '\0') {
+    n->field = GT_SELECT_EXPRESSION_ATTRIBUTE;
+    n->attribute = gt_cstr_dup(name + prefixlen);
+  }
+  else {
+    for (i = 0; i < nof_fields; i++) {
+      if (!strcmp(name, gt_select_expression_fields[i]))
+        break;
+    }
+    if (i == nof_fields) {
+      select_expression_node_delete(n);
+      return select_expression_error(p, "unknown field");
+    }
+    n->field = (GtSelectExpressionField) i;
+  }
+  had_err = select_expression_next_token(p);
+  if (!had_err) {
+    if (p->token == GT_SELECT_EXPRESSION_TOKEN_OP) {
+      n->op = p->op;
+      had_err = select_expression_next_token(p);
+      if (!had_err)
+        had_err = select_expression_parse_value(p, n);
+    }
+    else if (n->field == GT_SELECT_EXPRESSION_ATTRIBUTE)
+      n->kind = GT_SELECT_EXPRESSION_EXISTS;
+    else
+      had_err = select_expression_error(p, "expected comparison operator");
+  }
+  if (had_err) {
+    select_expression_node_delete(n);
+    return had_err;
+  }
+  *node = n;
+  return 0;
+}
+
+static int select_expression_parse_primary(GtSelectExpressionParser *p,
+                                           GtSelectExpressionNode **node)
+{
+  GtSelectExpressionKind kind;
+  int had_err;
+  if (p->token == GT_SELECT_EXPRESSION_TOKEN_LPAREN) {
+    if ((had_err = select_expression_next_token(p)))
+      return had_err;
+    if ((had_err = select_expression_parse_or(p, node)))
+      return had_err;
+    if (p->token != GT_SELECT_EXPRESSION_TOKEN_RPAREN)
+      had_err = select_expression_error(p, "expected ')'");
+    if (!had_err)
+      had_err = select_expression_next_token(p);
+    if (had_err) {
+      select_expression_node_delete(*node);
+      *node = NULL;
+    }
+    return had_err;
+  }
+  if (p->token != GT_SELECT_EXPRESSION_TOKEN_WORD)
+    return select_expression_error(p, "expected field name");
+  if (!strcmp(gt_str_get(p->value), "any") ||
+      !strcmp(gt_str_get(p->value), "all")) {
+    kind = !strcmp(gt_str_get(p->value), "any") ? GT_SELECT_EXPRESSION_ANY
+                                                : GT_SELECT_EXPRESSION_ALL;
+    if ((had_err = select_expression_next_token(p)))
+      return had_err;
+    if (p->token != GT_SELECT_EXPRESSION_TOKEN_LPAREN)
+      return select_expression_error(p, "expected '('");
+    *node = select_expression_node_new(kind);
+    had_err = select_expression_parse_primary(p, &(*node)->left);
+    if (had_err) {
+      select_expression_node_delete(*node);
+      *node = NULL;
+    }
+    return had_err;
+  }
+  return select_expression_parse_comparison(p, node);
+}
+
+static int select_expression_parse_not(GtSelectExpressionParser *p,
+                                       GtSelectExpressionNode **node)
+{
+  int had_err;
+  if (p->token == GT_SELECT_EXPRESSION_TOKEN_NOT) {
+    if ((had_err = select_expression_next_token(p)))
+      return had_err;
+    *node = select_expression_node_new(GT_SELECT_EXPRESSION_NOT);
+    had_err = select_expression_parse_not(p, &(*node)->left);
+    if (had_err) {
+      select_expression_node_delete(*node);
+      *node = NULL;
+    }
+    return had_err;
+  }
+  return select_expression_parse_primary(p, node);
+}
+
+/* parse a sequence of operands combined by the binary <kind> */
+static int select_expression_parse_binary(GtSelectExpressionParser *p,
+                                          GtSelectExpressionNode **node,
+                                          GtSelectExpressionTokenType token,
+                                          GtSelectExpressionKind kind)
+{
+  GtSelectExpressionNode *left = NULL, *right = NULL, *n;
+  int had_err;
+  if (kind == GT_SELECT_EXPRESSION_OR)
+    had_err = select_expression_parse_binary(p, &left,
+                                             GT_SELECT_EXPRESSION_TOKEN_AND,
+                                             GT_SELECT_EXPRESSION_AND);
+  else
+    had_err = select_expression_parse_not(p, &left);
+  while (!had_err && p->token == token) {
+    had_err = select_expression_next_token(p);
+    if (!had_err) {
+      if (kind == GT_SELECT_EXPRESSION_OR)
+        had_err = select_expression_parse_binary(p, &right,
+                                                 GT_SELECT_EXPRESSION_TOKEN_AND,
+                                                 GT_SELECT_EXPRESSION_AND);
+      else
+        had_err = select_expression_parse_not(p, &right);
+    }
+    if (!had_err) {
+      n = select_expression_node_new(kind);
+      n->left = left;
+      n->right = right;
+      left = n;
+      right = NULL;
+    }
+  }
+  if (had_err) {
+    select_expression_node_delete(left);
+    return had_err;
+  }
+  *node = left;
+  return 0;
+}
+
+static int select_expression_parse_or(GtSelectExpressionParser *p,
+                                      GtSelectExpressionNode **node)
+{
+  return select_expression_parse_binary(p, node, GT_SELECT_EXPRESSION_TOKEN_OR,
+                                        GT_SELECT_EXPRESSION_OR);
+}
+
+GtSelectExpression* gt_select_expression_new(const char *expression,
+                                             GtError *err)
+{
+  GtSelectExpressionParser p;
+  GtSelectExpressionNode *root = NULL;
+  GtSelectExpression *se;
+  int had_err;
+  gt_error_check(err);
+  gt_assert(expression);
+  p.expression = p.pos = expression;
+  p.value = gt_str_new();
+  p.err = err;
+  had_err = select_expression_next_token(&p);
+  if (!had_err)
+    had_err = select_expression_parse_or(&p, &root);
+  if (!had_err && p.token != GT_SELECT_EXPRESSION_TOKEN_END) {
+    select_expression_node_delete(root);
+    had_err = select_expression_error(&p, "unexpected token");
+  }
+  gt_str_delete(p.value);
+  if (had_err)
+    return NULL;
+  se = gt_malloc(sizeof *se);
+  se->root = root;
+  se->reference_count = 0;
+  return se;
+}
+
+GtSelectExpression* gt_select_expression_ref(GtSelectExpression *se)
+{
+  gt_assert(se);
+  se->reference_count++;
+  return se;
+}
+
+static bool select_expression_compare_numbers(GtSelectExpressionOp op,
+                                              double a, double b)
+{
+  switch (op) {
+    case GT_SELECT_EXPRESSION_EQ: return a == b;
+    case GT_SELECT_EXPRESSION_NE: return a != b;
+    case GT_SELECT_EXPRESSION_LT: return a < b;
+    case GT_SELECT_EXPRESSION_LE: return a <= b;
+    case GT_SELECT_EXPRESSION_GT: return a > b;
+    case GT_SELECT_EXPRESSION_GE: return a >= b;
+  }
+  return false;
+}
+
+static bool select_expression_compare_strings(GtSelectExpressionOp op,
+                                              const char *a, const char *b)
+{
+  gt_assert(op == GT_SELECT_EXPRESSION_EQ || op == GT_SELECT_EXPRESSION_NE);
+  return (strcmp(a, b) == 0) == (op == GT_SELECT_EXPRESSION_EQ);
+}
+
+static bool select_expression_compare(const GtSelectExpressionNode *node,
+                                      GtFeatureNode *fn)
+{
+  GtGenomeNode *gn = (GtGenomeNode*) fn;
+  const char *value;
+  double number;
+  switch (node->field) {
+    case GT_SELECT_EXPRESSION_TYPE:
+      return select_expression_compare_strings(node->op,
+                                               gt_feature_node_get_type(fn),
+                                               node->string);
+    case GT_SELECT_EXPRESSION_SEQID:
+      return select_expression_compare_strings(node->op,
+                                   gt_str_get(gt_genome_node_get_seqid(gn)),
+                                   node->string);
+    case GT_SELECT_EXPRESSION_SOURCE:
+      return select_expression_compare_strings(node->op,
+                                               gt_feature_node_get_source(fn),
+                                               node->string);
+    case GT_SELECT_EXPRESSION_START:
+      number = (double) gt_genome_node_get_start(gn);
+      break;
+    case GT_SELECT_EXPRESSION_END:
+      number = (double) gt_genome_node_get_end(gn);
+      break;
+    case GT_SELECT_EXPRESSION_LENGTH:
+      number = (double) gt_genome_node_get_length(gn);
+      break;
+    case GT_SELECT_EXPRESSION_SCORE:
+      if (!gt_feature_node_score_is_defined(fn))
+        return false;
+      number = (double) gt_feature_node_get_score(fn);
+      break;
+    case GT_SELECT_EXPRESSION_STRAND:
+      return (gt_feature_node_get_strand(fn) == node->strand) ==
+             (node->op == GT_SELECT_EXPRESSION_EQ);
+    case GT_SELECT_EXPRESSION_ATTRIBUTE:
+      if (!(value = gt_feature_node_get_attribute(fn, node->attribute)))
+        return false;
+      if (node->string)
+        return select_expression_compare_strings(node->op, value,
+                                                 node->string);
+      if (gt_parse_double(&number, value))
+        return false;
+      break;
+  }
+  return select_expression_compare_numbers(node->op, number, node->number);
+}
+
+static bool select_expression_eval(const GtSelectExpressionNode *node,
+                                   GtFeatureNode *fn)
+{
+  GtFeatureNodeIterator *fni;
+  GtFeatureNode *child;
+  bool result;
+  switch (node->kind) {
+    case GT_SELECT_EXPRESSION_AND:
+      return select_expression_eval(node->left, fn) &&
+             select_expression_eval(node->right, fn);
+    case GT_SELECT_EXPRESSION_OR:
+      return select_expression_eval(node->left, fn) ||
+             select_expression_eval(node->right, fn);
+    case GT_SELECT_EXPRESSION_NOT:
+      return !select_expression_eval(node->left, fn);
+    case GT_SELECT_EXPRESSION_ANY:
+    case GT_SELECT_EXPRESSION_ALL:
+      /* for <any> stop at the first match, for <all> at the first mismatch */
+      result = node->kind == GT_SELECT_EXPRESSION_ALL;
+      fni = gt_feature_node_iterator_new(fn);
+      while ((child = gt_feature_node_iterator_next(fni))) {
+        if (select_expression_eval(node->left, child) != result) {
+          result = !result;
+          break;
+        }
+      }
+      gt_feature_node_iterator_delete(fni);
+      return result;
+    default:
+      break;
+  }
+  /* the fields of a multi-feature are those of its first part */
+  if (gt_feature_node_is_pseudo(fn)) {
+    fni = gt_feature_node_iterator_new_direct(fn);
+    child = gt_feature_node_iterator_next(fni);
+    gt_feature_node_iterator_delete(fni);
+    gt_assert(child);
+    fn = child;
+  }
+  if (node->kind == GT_SELECT_EXPRESSION_EXISTS)
+    return gt_feature_node_get_attribute(fn, node->attribute) != NULL;
+  return select_expression_compare(node, fn);
+}
+
+bool gt_select_expression_matches(const GtSelectExpression *se,
+                                  GtFeatureNode *fn)
+{
+  gt_assert(se && fn);
+  return select_expression_eval(se->root, fn);
+}
+
+void gt_select_expression_delete(GtSelectExpression *se)
+{
+  if (!se) return;
+  if (se->reference_count) {
+    se->reference_count--;
+    return;
+  }
+  select_expression_node_delete(se->root);
+  gt_free(se);
+}
+
+int gt_select_expression_unit_test(GtError *err)
+{
+  static const struct {
+    const char *expression;
+    bool matches;
+  } tests[] = {
+    { "type == gene", true },
+    { "type != gene", false },
+    { "type == gene and length > 1000", true },
+    { "type == gene && length <= 1000", false },
+    { "start >= 100 and end < 2001 and length == 1901", true },
+    { "seqid == ctg1 and source == \"my source\"", true },
+    { "score > 0.25 and strand == +", true },
+    { "strand == - or not attr.Name", false },
+    { "attr.Name == \"gene 1\"", true },
+    { "attr.Note", false },
+    { "attr.Note != x", false },
+    { "attr.support >= 3.5", true },
+    { "attr.Name > 3", false },
+    { "any(type == CDS)", true },
+    { "any(type == CDS and score > 0)", false },
+    { "all(strand == +)", true },
+    { "all(type == gene)", false },
+    { "!(type == exon) && (any(attr.ID == mrna1) || type == exon)", true },
+    { "type==gene&&!any(type==intron)", true },
+  };
+  static const char *invalid[] = {
+    "", "type", "type = gene", "type < gene", "strand == x", "length > big",
+    "attr. == x", "foo == 1", "type == gene and", "(type == gene",
+    "type == gene)", "any type == gene", "attr.Name == \"x", "start & 1",
+  };
+  GtSelectExpression *se;
+  GtGenomeNode *gene, *mrna, *cds;
+  GtStr *seqid, *source;
+  GtUword i;
+  int had_err = 0;
+  gt_error_check(err);
+
+  seqid = gt_str_new_cstr("ctg1");
+  gene = gt_feature_node_new(seqid, "gene", 100, 2000, GT_STRAND_FORWARD);
+  mrna = gt_feature_node_new(seqid, "mRNA", 100, 2000, GT_STRAND_FORWARD);
+  cds = gt_feature_node_new(seqid, "CDS", 200, 1800, GT_STRAND_FORWARD);
+  gt_str_delete(seqid);
+  source = gt_str_new_cstr("my source");
+  gt_feature_node_set_source((GtFeatureNode*) gene, source);
+  gt_str_delete(source);
+  gt_feature_node_set_score((GtFeatureNode*) gene, 0.5);
+  gt_feature_node_add_attribute((GtFeatureNode*) gene, "Name", "gene 1");
+  gt_feature_node_add_attribute((GtFeatureNode*) gene, "support", "4");
+  gt_feature_node_add_attribute((GtFeatureNode*) mrna, "ID", "mrna1");
+  gt_feature_node_add_child((GtFeatureNode*) gene, (GtFeatureNode*) mrna);
+  gt_feature_node_add_child((GtFeatureNode*) mrna, (GtFeatureNode*) cds);
+
+  for (i = 0; !had_err && i < sizeof tests / sizeof tests[0]; i++) {
+    se = gt_select_expression_new(tests[i].expression, err);
+    gt_ensure(se != NULL);
+    if (se) {
+      gt_ensure(gt_select_expression_matches(se, (GtFeatureNode*) gene)
+                == tests[i].matches);
+    }
+    gt_select_expression_delete(se);
+  }
+  for (i = 0; !had_err && i < sizeof invalid / sizeof invalid[0]; i++) {
+    gt_error_unset(err);
+    se = gt_select_expression_new(invalid[i], err);
+    gt_ensure(se == NULL);
+    gt_ensure(gt_error_is_set(err));
+    gt_select_expression_delete(se);
+  }
+  if (!had_err)
+    gt_error_unset(err);
+
+  gt_genome_node_delete(gene);
+  return had_err;
+}
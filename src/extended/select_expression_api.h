@@ -0,0 +1,62 @@
+/*
+  Copyright (c) 2026 agent <agent@local>
+
+  Permission to use, copy, modify, and distribute this software for any
+  purpose with or without fee is hereby granted, provided that the above
+  copyright notice and this permission notice appear in all copies.
+
+  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+
+
+#ifndef SELECT_EXPRESSION_API_H
+#define SELECT_EXPRESSION_API_H
+
+#include "core/error_api.h"
+#include "extended/feature_node_api.h"
+
+/* A <GtSelectExpression> is a filter expression over the fields of a feature
+   node tree, which is compiled once into a predicate tree. Evaluating it does
+   not modify the expression, therefore one expression can be evaluated by
+   several threads at the same time.
+
+   An expression is built from comparisons of the form <field op value>, where
+   <op> is one of <==>, <!=>, <<>, <<=>, <>> and <>=>, and <field> is one of
+   <type>, <seqid>, <source>, <start>, <end>, <length>, <score>, <strand> and
+   <attr.NAME> (the value of attribute NAME). The fields <type>, <seqid>,
+   <source> and <strand> can only be tested for (in)equality, an attribute
+   value can only be compared with the ordering operators if the given value is
+   a number. Values are numbers, bare words or strings in double quotes.
+   <attr.NAME> on its own is true if the attribute is set. Comparisons with an
+   undefined score or a missing attribute are false.
+   Comparisons are combined with <and>, <or>, <not> (or <&&>, <||>, <!>) and
+   parentheses. By default, the fields refer to the top-level feature (the
+   first part for multi-features). <any(expr)> is true if <expr> holds for at
+   least one node of the feature tree, <all(expr)> if it holds for all nodes.
+
+   Example: type == gene and length > 1000 and any(type == CDS) */
+typedef struct GtSelectExpression GtSelectExpression;
+
+/* Return a new <GtSelectExpression> compiled from <expression>. Returns NULL
+   and sets <err> if <expression> is not valid. */
+GtSelectExpression* gt_select_expression_new(const char *expression,
+                                             GtError *err);
+/* Return a new reference to <select_expression>. */
+GtSelectExpression* gt_select_expression_ref(GtSelectExpression
+                                             *select_expression);
+/* Return <true> if <select_expression> holds for the feature node tree with
+   root <feature_node>. */
+bool                gt_select_expression_matches(const GtSelectExpression
+                                                 *select_expression,
+                                                 GtFeatureNode *feature_node);
+/* Delete <select_expression>. */
+void                gt_select_expression_delete(GtSelectExpression
+                                                *select_expression);
+
+#endif
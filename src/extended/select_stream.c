@@ -137,3 +137,10 @@ void gt_select_stream_set_drophandler(GtSelectStream *fs,
   fv = gt_node_visitor_cast(gt_select_visitor_class(), fs->select_visitor);
   gt_select_visitor_set_drophandler(fv, fp, data);
 }
+
+void gt_select_stream_set_expression(GtSelectStream *fs,
+                                     GtSelectExpression *expression)
+{
+  gt_assert(fs && expression);
+  gt_select_visitor_set_expression(fs->select_visitor, expression);
+}
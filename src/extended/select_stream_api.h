@@ -20,6 +20,7 @@
 
 #include "core/strand_api.h"
 #include "extended/node_stream_api.h"
+#include "extended/select_expression_api.h"
 
 /* Implements the <GtNodeStream> interface. A <GtSelectStream> selects certain
    nodes it retrieves from its node source and passes them along. */
@@ -87,4 +88,9 @@ void          gt_select_stream_set_drophandler(GtSelectStream *sstr,
                                                GtSelectNodeFunc fp,
                                                void *data);
 
+/* Only passes feature nodes for which <expression> holds, in addition to the
+   other criteria of <sstr>. Stores a new reference to <expression>. */
+void          gt_select_stream_set_expression(GtSelectStream *sstr,
+                                              GtSelectExpression *expression);
+
 #endif
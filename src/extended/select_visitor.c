@@ -27,6 +27,7 @@
 #include "extended/gff3_parser.h"
 #include "extended/node_visitor_api.h"
 #include "extended/script_filter.h"
+#include "extended/select_expression.h"
 #include "extended/select_visitor.h"
 
 typedef enum {
@@ -57,6 +58,7 @@ struct GtSelectVisitor {
   GtSelectLogic select_logic;
   bool is_lua;
   GtArray *script_filters;
+  GtSelectExpression *expression;
   GtSelectNodeFunc drophandler;
   void *data;
 };
@@ -78,6 +80,7 @@ static void select_visitor_free(GtNodeVisitor *nv)
     }
   }
   gt_array_delete(select_visitor->script_filters);
+  gt_select_expression_delete(select_visitor->expression);
   gt_queue_delete(select_visitor->node_buffer);
 }
 
@@ -274,6 +277,9 @@ static int select_visitor_feature_node(GtNodeVisitor *nv,
                                          fv->single_intron_factor);
   }
 
+  if (fv->expression && !select_node)
+    select_node = !gt_select_expression_matches(fv->expression, fn);
+
   if (fv->is_lua && !select_node)
     had_err = filter_lua(fv->script_filters, fn, fv->select_logic,
                          &select_node, err);
@@ -414,6 +420,7 @@ GtNodeVisitor* gt_select_visitor_new(GtStr *seqid,
   select_visitor->feature_num = feature_num;
   select_visitor->select_files = select_files;
   select_visitor->is_lua = false;
+  select_visitor->expression = NULL;
 
   if (gt_str_array_size(select_visitor->select_files) > 0) {
     int i;
@@ -450,6 +457,15 @@ void gt_select_visitor_set_single_intron_factor(GtNodeVisitor *nv,
   select_visitor->single_intron_factor = single_intron_factor;
 }
 
+void gt_select_visitor_set_expression(GtNodeVisitor *nv,
+                                      GtSelectExpression *expression)
+{
+  GtSelectVisitor *select_visitor = select_visitor_cast(nv);
+  gt_assert(expression);
+  gt_select_expression_delete(select_visitor->expression);
+  select_visitor->expression = gt_select_expression_ref(expression);
+}
+
 GtUword gt_select_visitor_node_buffer_size(GtNodeVisitor *nv)
 {
   GtSelectVisitor *select_visitor = select_visitor_cast(nv);
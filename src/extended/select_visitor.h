@@ -22,6 +22,7 @@
 typedef struct GtSelectVisitor GtSelectVisitor;
 
 #include "extended/node_visitor.h"
+#include "extended/select_expression_api.h"
 #include "extended/select_stream_api.h"
 
 const GtNodeVisitorClass* gt_select_visitor_class(void);
@@ -45,6 +46,10 @@ GtNodeVisitor* gt_select_visitor_new(GtStr *seqid,
                                      GtError *err);
 void           gt_select_visitor_set_single_intron_factor(GtNodeVisitor*,
                                                           double);
+/* Only features for which <expression> holds pass. Stores a new reference to
+   <expression>. */
+void           gt_select_visitor_set_expression(GtNodeVisitor*,
+                                                GtSelectExpression *expression);
 GtUword  gt_select_visitor_node_buffer_size(GtNodeVisitor*);
 GtGenomeNode*  gt_select_visitor_get_node(GtNodeVisitor*);
 void           gt_select_visitor_set_drophandler(GtSelectVisitor *fv,
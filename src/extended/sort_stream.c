@@ -18,22 +18,296 @@
 #include "core/array.h"
 #include "core/assert_api.h"
 #include "core/class_alloc_lock.h"
+#include "core/cstr_api.h"
+#include "core/fa_api.h"
+#include "core/file_api.h"
+#include "core/hashmap_api.h"
+#include "core/ma_api.h"
+#include "core/minmax_api.h"
+#include "core/xansi_api.h"
+#include "extended/binary_in_stream.h"
+#include "extended/binary_visitor.h"
 #include "extended/eof_node_api.h"
+#include "extended/feature_node_iterator_api.h"
 #include "extended/genome_node.h"
+#include "extended/genome_node_sort.h"
+#include "extended/merge_stream.h"
 #include "extended/node_stream_api.h"
+#include "extended/region_node_api.h"
 #include "extended/sort_stream.h"
 
+/* maximum number of runs merged at the same time, which limits the number of
+   open files */
+#define GT_SORT_STREAM_MAX_MERGE_RUNS 64
+
 struct GtSortStream {
   const GtNodeStream parent_instance;
-  GtNodeStream *in_stream;
-  GtUword idx;
-  GtArray *nodes;
+  GtNodeStream *in_stream,
+               *merge_stream;
+  GtUword idx,
+          maxnodes,
+          numofnodes;
+  GtArray *nodes,
+          *runfiles;
+  GtHashmap *region_ranges;
   bool sorted;
 };
 
 #define gt_sort_stream_cast(GS)\
         gt_node_stream_cast(gt_sort_stream_class(), GS);
 
+/* returns the number of nodes in the tree rooted at <gn> */
+static GtUword gt_sort_stream_tree_size(GtGenomeNode *gn)
+{
+  GtFeatureNode *fn = gt_feature_node_try_cast(gn);
+  GtUword size = 0;
+
+  if (fn != NULL) {
+    GtFeatureNodeIterator *fni = gt_feature_node_iterator_new(fn);
+    while (gt_feature_node_iterator_next(fni))
+      size++;
+    gt_feature_node_iterator_delete(fni);
+  }
+  else
+    size = 1;
+  return size;
+}
+
+/* returns the next node of the sorted node array or NULL if all nodes have
+   been delivered */
+static GtGenomeNode* gt_sort_stream_next_sorted(GtSortStream *sort_stream)
+{
+  GtGenomeNode *gn, *node;
+
+  if (sort_stream->idx >= gt_array_size(sort_stream->nodes))
+    return NULL;
+  gn = *(GtGenomeNode**) gt_array_get(sort_stream->nodes, sort_stream->idx);
+  sort_stream->idx++;
+  /* join region nodes with the same sequence ID */
+  if (gt_region_node_try_cast(gn)) {
+    GtRange range_a, range_b;
+    while (sort_stream->idx < gt_array_size(sort_stream->nodes)) {
+      node = *(GtGenomeNode**) gt_array_get(sort_stream->nodes,
+                                            sort_stream->idx);
+      if (!gt_region_node_try_cast(node) ||
+          gt_str_cmp(gt_genome_node_get_seqid(gn),
+                     gt_genome_node_get_seqid(node))) {
+        /* the next node is not a region node with the same ID */
+        break;
+      }
+      range_a = gt_genome_node_get_range(gn);
+      range_b = gt_genome_node_get_range(node);
+      range_a = gt_range_join(&range_a, &range_b);
+      gt_genome_node_set_range(gn, &range_a);
+      gt_genome_node_delete(node);
+      sort_stream->idx++;
+    }
+  }
+  return gn;
+}
+
+/* stores the range of region node <gn> such that it can be added to later
+   runs */
+static void gt_sort_stream_store_region_range(GtSortStream *sort_stream,
+                                              GtGenomeNode *gn)
+{
+  const char *seqid = gt_str_get(gt_genome_node_get_seqid(gn));
+  GtRange *stored, range = gt_genome_node_get_range(gn);
+
+  if ((stored = gt_hashmap_get(sort_stream->region_ranges, seqid)))
+    *stored = gt_range_join(stored, &range);
+  else {
+    stored = gt_malloc(sizeof *stored);
+    *stored = range;
+    gt_hashmap_add(sort_stream->region_ranges, gt_cstr_dup(seqid), stored);
+  }
+}
+
+/* A sorted stream must introduce each sequence ID by a region before it is
+   used. Hence for each sequence ID of the features of a run, a region node is
+   added. It gets the range of the region node seen in the input or, if there
+   is none so far, the range covering the features of the run. It is
+   consolidated with the original region node (which may be stored in a
+   different run) when merging. */
+static void gt_sort_stream_add_run_regions(GtSortStream *sort_stream)
+{
+  GtHashmap *regions = gt_hashmap_new(GT_HASH_STRING, NULL, NULL);
+  GtUword i, numofnodes = gt_array_size(sort_stream->nodes);
+
+  for (i = 0; i < numofnodes; i++) {
+    GtGenomeNode *gn = *(GtGenomeNode**) gt_array_get(sort_stream->nodes, i),
+                 *rn;
+    GtFeatureNode *fn, *child;
+    GtFeatureNodeIterator *fni;
+    GtRange range;
+
+    GtRange *region_range;
+
+    if (!(fn = gt_feature_node_try_cast(gn)))
+      continue;
+    rn = gt_hashmap_get(regions, gt_str_get(gt_genome_node_get_seqid(gn)));
+    region_range = gt_hashmap_get(sort_stream->region_ranges,
+                                  gt_str_get(gt_genome_node_get_seqid(gn)));
+    if (rn != NULL && region_range != NULL)
+      continue;
+    /* the children are not necessarily contained in their parent */
+    range = gt_genome_node_get_range(gn);
+    fni = gt_feature_node_iterator_new(fn);
+    while ((child = gt_feature_node_iterator_next(fni))) {
+      GtRange child_range = gt_genome_node_get_range((GtGenomeNode*) child);
+      range = gt_range_join(&range, &child_range);
+    }
+    gt_feature_node_iterator_delete(fni);
+    if (rn == NULL) {
+      if (region_range != NULL)
+        range = *region_range;
+      rn = gt_region_node_new(gt_genome_node_get_seqid(gn), range.start,
+                              range.end);
+      gt_hashmap_add(regions, gt_str_get(gt_genome_node_get_seqid(rn)), rn);
+      gt_array_add(sort_stream->nodes, rn);
+    }
+    else {
+      GtRange region_range = gt_genome_node_get_range(rn);
+      region_range = gt_range_join(&region_range, &range);
+      gt_genome_node_set_range(rn, &region_range);
+    }
+  }
+  gt_hashmap_delete(regions);
+}
+
+/* sorts the nodes currently held in memory and writes them in the binary
+   format to a new temporary file (a run). Unlike GFF3, the binary format
+   keeps every node as it is (e.g., sequence IDs containing blanks and
+   non-unique IDs). */
+static int gt_sort_stream_write_run(GtSortStream *sort_stream, GtError *err)
+{
+  GtNodeVisitor *binary_visitor;
+  GtGenomeNode *gn;
+  GtStr *runfile;
+  GtFile *outfp;
+  int had_err = 0;
+  gt_error_check(err);
+
+  gt_sort_stream_add_run_regions(sort_stream);
+  if ((had_err = gt_genome_nodes_sort_stable_parallel(sort_stream->nodes,
+                                                      err)))
+    return had_err;
+  runfile = gt_str_new();
+  outfp = gt_file_new_from_fileptr(gt_xtmpfp(runfile));
+  gt_array_add(sort_stream->runfiles, runfile);
+  binary_visitor = gt_binary_visitor_new(outfp);
+  while (!had_err && (gn = gt_sort_stream_next_sorted(sort_stream))) {
+    had_err = gt_genome_node_accept(gn, binary_visitor, err);
+    gt_genome_node_delete(gn);
+  }
+  gt_node_visitor_delete(binary_visitor);
+  gt_file_delete(outfp);
+  if (!had_err) {
+    gt_array_reset(sort_stream->nodes);
+    sort_stream->idx = 0;
+    sort_stream->numofnodes = 0;
+  }
+  return had_err;
+}
+
+/* returns a stream merging the runs <from> to <to> - 1 */
+static GtNodeStream* gt_sort_stream_merge_stream_new(GtSortStream *sort_stream,
+                                                     GtUword from, GtUword to)
+{
+  GtArray *run_streams = gt_array_new(sizeof (GtNodeStream*));
+  GtNodeStream *merge_stream;
+  GtUword i;
+
+  for (i = from; i < to; i++) {
+    GtStr *runfile = *(GtStr**) gt_array_get(sort_stream->runfiles, i);
+    GtNodeStream *run_stream
+      = gt_binary_in_stream_new_sorted(gt_str_get(runfile));
+    gt_array_add(run_streams, run_stream);
+  }
+  merge_stream = gt_merge_stream_new(run_streams);
+  for (i = 0; i < gt_array_size(run_streams); i++)
+    gt_node_stream_delete(*(GtNodeStream**) gt_array_get(run_streams, i));
+  gt_array_delete(run_streams);
+  return merge_stream;
+}
+
+/* merges the runs <from> to <to> - 1 into a new run, which is added to
+   <merged> */
+static int gt_sort_stream_write_merged_run(GtSortStream *sort_stream,
+                                           GtUword from, GtUword to,
+                                           GtArray *merged, GtError *err)
+{
+  GtNodeStream *merge_stream;
+  GtNodeVisitor *binary_visitor;
+  GtGenomeNode *gn;
+  GtStr *runfile;
+  GtFile *outfp;
+  int had_err = 0;
+  gt_error_check(err);
+
+  runfile = gt_str_new();
+  outfp = gt_file_new_from_fileptr(gt_xtmpfp(runfile));
+  gt_array_add(merged, runfile);
+  binary_visitor = gt_binary_visitor_new(outfp);
+  merge_stream = gt_sort_stream_merge_stream_new(sort_stream, from, to);
+  while (!(had_err = gt_node_stream_next(merge_stream, &gn, err)) && gn) {
+    had_err = gt_genome_node_accept(gn, binary_visitor, err);
+    gt_genome_node_delete(gn);
+    if (had_err)
+      break;
+  }
+  gt_node_stream_delete(merge_stream);
+  gt_node_visitor_delete(binary_visitor);
+  gt_file_delete(outfp);
+  return had_err;
+}
+
+/* merges the runs written by <gt_sort_stream_write_run()>. At most
+   GT_SORT_STREAM_MAX_MERGE_RUNS runs are opened at the same time: as long as
+   there are more runs, consecutive runs are merged into longer ones. */
+static int gt_sort_stream_merge_runs(GtSortStream *sort_stream, GtError *err)
+{
+  int had_err = 0;
+  gt_error_check(err);
+
+  while (!had_err && gt_array_size(sort_stream->runfiles) >
+                     GT_SORT_STREAM_MAX_MERGE_RUNS) {
+    GtArray *merged = gt_array_new(sizeof (GtStr*));
+    GtUword i, from = 0, to, numofruns = gt_array_size(sort_stream->runfiles);
+
+    while (!had_err && from < numofruns) {
+      to = GT_MIN(from + GT_SORT_STREAM_MAX_MERGE_RUNS, numofruns);
+      if (to - from == 1) {
+        gt_array_add(merged, *(GtStr**) gt_array_get(sort_stream->runfiles,
+                                                     from));
+      }
+      else {
+        if ((had_err = gt_sort_stream_write_merged_run(sort_stream, from, to,
+                                                       merged, err))) {
+          break;
+        }
+        for (i = from; i < to; i++) {
+          GtStr *runfile = *(GtStr**) gt_array_get(sort_stream->runfiles, i);
+          gt_xremove(gt_str_get(runfile));
+          gt_str_delete(runfile);
+        }
+      }
+      from = to;
+    }
+    /* the runs not merged after an error are removed with the stream */
+    if (from > 0)
+      gt_array_rem_span(sort_stream->runfiles, 0, from - 1);
+    gt_array_prepend_array(sort_stream->runfiles, merged);
+    gt_array_delete(merged);
+  }
+  if (!had_err) {
+    sort_stream->merge_stream =
+      gt_sort_stream_merge_stream_new(sort_stream, 0,
+                                      gt_array_size(sort_stream->runfiles));
+  }
+  return had_err;
+}
+
 static int gt_sort_stream_next(GtNodeStream *ns, GtGenomeNode **gn,
                                GtError *err)
 {
@@ -49,43 +323,38 @@ static int gt_sort_stream_next(GtNodeStream *ns, GtGenomeNode **gn,
                                            err)) && node) {
       if ((eofn = gt_eof_node_try_cast(node)))
         gt_genome_node_delete(node); /* get rid of EOF nodes */
-      else
+      else {
         gt_array_add(sort_stream->nodes, node);
+        if (sort_stream->maxnodes > 0) {
+          if (gt_region_node_try_cast(node))
+            gt_sort_stream_store_region_range(sort_stream, node);
+          sort_stream->numofnodes += gt_sort_stream_tree_size(node);
+          if (sort_stream->numofnodes >= sort_stream->maxnodes &&
+              (had_err = gt_sort_stream_write_run(sort_stream, err))) {
+            break;
+          }
+        }
+      }
     }
-    if (!had_err) {
-      gt_genome_nodes_sort_stable(sort_stream->nodes);
-      sort_stream->sorted = true;
+    if (!had_err && gt_array_size(sort_stream->runfiles) > 0) {
+      if (gt_array_size(sort_stream->nodes) > 0)
+        had_err = gt_sort_stream_write_run(sort_stream, err);
+      if (!had_err)
+        had_err = gt_sort_stream_merge_runs(sort_stream, err);
     }
+    if (!had_err && sort_stream->merge_stream == NULL)
+      had_err = gt_genome_nodes_sort_stable_parallel(sort_stream->nodes, err);
+    if (!had_err)
+      sort_stream->sorted = true;
   }
 
+  if (!had_err && sort_stream->merge_stream != NULL)
+    return gt_node_stream_next(sort_stream->merge_stream, gn, err);
+
   if (!had_err) {
     gt_assert(sort_stream->sorted);
-    if (sort_stream->idx < gt_array_size(sort_stream->nodes)) {
-      *gn = *(GtGenomeNode**) gt_array_get(sort_stream->nodes,
-                                           sort_stream->idx);
-      sort_stream->idx++;
-      /* join region nodes with the same sequence ID */
-      if (gt_region_node_try_cast(*gn)) {
-        GtRange range_a, range_b;
-        while (sort_stream->idx < gt_array_size(sort_stream->nodes)) {
-          node = *(GtGenomeNode**) gt_array_get(sort_stream->nodes,
-                                                sort_stream->idx);
-          if (!gt_region_node_try_cast(node) ||
-              gt_str_cmp(gt_genome_node_get_seqid(*gn),
-                         gt_genome_node_get_seqid(node))) {
-            /* the next node is not a region node with the same ID */
-            break;
-          }
-          range_a = gt_genome_node_get_range(*gn);
-          range_b = gt_genome_node_get_range(node);
-          range_a = gt_range_join(&range_a, &range_b);
-          gt_genome_node_set_range(*gn, &range_a);
-          gt_genome_node_delete(node);
-          sort_stream->idx++;
-        }
-      }
+    if ((*gn = gt_sort_stream_next_sorted(sort_stream)))
       return 0;
-    }
   }
 
   if (!had_err) {
@@ -105,6 +374,14 @@ static void gt_sort_stream_free(GtNodeStream *ns)
                           gt_array_get(sort_stream->nodes, i));
   }
   gt_array_delete(sort_stream->nodes);
+  gt_node_stream_delete(sort_stream->merge_stream);
+  for (i = 0; i < gt_array_size(sort_stream->runfiles); i++) {
+    GtStr *runfile = *(GtStr**) gt_array_get(sort_stream->runfiles, i);
+    gt_xremove(gt_str_get(runfile));
+    gt_str_delete(runfile);
+  }
+  gt_array_delete(sort_stream->runfiles);
+  gt_hashmap_delete(sort_stream->region_ranges);
   gt_node_stream_delete(sort_stream->in_stream);
 }
 
@@ -127,8 +404,20 @@ GtNodeStream* gt_sort_stream_new(GtNodeStream *in_stream)
   GtSortStream *sort_stream = gt_sort_stream_cast(ns);
   gt_assert(in_stream);
   sort_stream->in_stream = gt_node_stream_ref(in_stream);
+  sort_stream->merge_stream = NULL;
   sort_stream->sorted = false;
   sort_stream->idx = 0;
+  sort_stream->maxnodes = 0;
+  sort_stream->numofnodes = 0;
   sort_stream->nodes = gt_array_new(sizeof (GtGenomeNode*));
+  sort_stream->runfiles = gt_array_new(sizeof (GtStr*));
+  sort_stream->region_ranges = gt_hashmap_new(GT_HASH_STRING, gt_free_func,
+                                              gt_free_func);
   return ns;
 }
+
+void gt_sort_stream_set_max_nodes(GtSortStream *sort_stream, GtUword maxnodes)
+{
+  gt_assert(sort_stream && !sort_stream->sorted);
+  sort_stream->maxnodes = maxnodes;
+}
@@ -25,7 +25,16 @@
 typedef struct GtSortStream GtSortStream;
 
 /* Create a <GtSortStream*> which sorts the genome nodes it retrieves from
-   <in_stream> and returns them unmodified, but in sorted order. */
+   <in_stream> and returns them unmodified, but in sorted order. The nodes are
+   sorted using <gt_jobs> threads. */
 GtNodeStream* gt_sort_stream_new(GtNodeStream *in_stream);
 
+/* Limit the number of genome nodes (counting all nodes of a feature tree)
+   which <sort_stream> keeps in memory to <maxnodes>. If the input contains
+   more nodes, they are sorted in runs of at most <maxnodes> nodes which are
+   stored as GFF3 in temporary files and merged afterwards. A value of 0 (the
+   default) means that all nodes are sorted in memory. */
+void          gt_sort_stream_set_max_nodes(GtSortStream *sort_stream,
+                                           GtUword maxnodes);
+
 #endif
@@ -107,6 +107,7 @@ extern "C" {
 #include "extended/extract_feature_stream_api.h"
 #include "extended/feature_index_api.h"
 #include "extended/feature_index_memory_api.h"
+#include "extended/feature_index_mmap_api.h"
 #include "extended/feature_in_stream_api.h"
 #include "extended/feature_node_api.h"
 #include "extended/feature_node_iterator_api.h"
@@ -133,6 +134,8 @@ extern "C" {
 #include "extended/node_stream_api.h"
 #include "extended/node_visitor_api.h"
 #include "extended/orf_iterator_api.h"
+#include "extended/overlap_stream_api.h"
+#include "extended/parallel_visitor_stream_api.h"
 #include "extended/rdb_api.h"
 #include "extended/rdb_sqlite_api.h"
 #ifdef HAVE_MYSQL
@@ -143,6 +146,7 @@ extern "C" {
 #include "extended/region_node_api.h"
 #include "extended/reverse_api.h"
 #include "extended/script_filter_api.h"
+#include "extended/select_expression_api.h"
 #include "extended/select_stream_api.h"
 #include "extended/sequence_node_api.h"
 #include "extended/set_source_visitor_api.h"
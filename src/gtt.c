@@ -45,6 +45,7 @@
 #include "core/interval_tree.h"
 #include "core/mathsupport_api.h"
 #include "core/md5_seqid_api.h"
+#include "core/md5_tab_api.h"
 #include "core/quality.h"
 #include "core/queue.h"
 #include "core/sequence_buffer.h"
@@ -55,6 +56,7 @@
 #include "core/translator.h"
 #include "extended/alignment.h"
 #include "extended/anno_db_gfflike_api.h"
+#include "extended/attribute_map.h"
 #include "extended/compressed_bitsequence.h"
 #include "extended/editscript.h"
 #include "extended/elias_gamma.h"
@@ -63,9 +65,11 @@
 #include "extended/feature_in_stream.h"
 #include "extended/feature_index.h"
 #include "extended/feature_index_memory.h"
+#include "extended/feature_index_mmap.h"
 #include "extended/feature_node.h"
 #include "extended/feature_node_iterator_api.h"
 #include "extended/genome_node.h"
+#include "extended/genome_node_sort.h"
 #include "extended/gff3_escaping_api.h"
 #include "extended/golomb.h"
 #include "extended/hmm.h"
@@ -73,12 +77,15 @@
 #include "extended/intset.h"
 #include "extended/kmer_database.h"
 #include "extended/luaserialize.h"
+#include "extended/md5diskset.h"
 #include "extended/multieoplist.h"
+#include "extended/parallel_visitor_stream.h"
 #include "extended/popcount_tab.h"
 #include "extended/priority_queue.h"
 #include "extended/ranked_list.h"
 #include "extended/rbtree_api.h"
 #include "extended/rmq.h"
+#include "extended/select_expression.h"
 #include "extended/splicedseq.h"
 #include "extended/string_matching.h"
 #include "extended/tag_value_map.h"
@@ -135,6 +142,7 @@
 #include "tools/gt_mkfmindex.h"
 #include "tools/gt_mmapandread.h"
 #include "tools/gt_orffinder.h"
+#include "tools/gt_overlap.h"
 #include "tools/gt_packedindex.h"
 #include "tools/gt_prebwt.h"
 #include "tools/gt_readjoiner.h"
@@ -210,6 +218,7 @@ GtToolbox* gtt_tools(void)
   gt_toolbox_add_tool(tools, "extractfeat", gt_extractfeat());
   gt_toolbox_add_tool(tools, "extractseq", gt_extractseq());
   gt_toolbox_add_tool(tools, "fastq_sample", gt_fastq_sample());
+  gt_toolbox_add_tool(tools, "featureindex", gt_featureindex());
   gt_toolbox_add_tool(tools, "fingerprint", gt_fingerprint());
   gt_toolbox_add_tool(tools, "genomediff", gt_genomediff());
   gt_toolbox_add_tool(tools, "gff3", gt_gff3());
@@ -230,8 +239,10 @@ GtToolbox* gtt_tools(void)
   gt_toolbox_add_tool(tools, "md5_to_id", gt_md5_to_id());
   gt_toolbox_add_tool(tools, "merge", gt_merge());
   gt_toolbox_add_tool(tools, "mergefeat", gt_mergefeat());
+  gt_toolbox_add_tool(tools, "mkfeatureindex", gt_mkfeatureindex());
   gt_toolbox_add_tool(tools, "mmapandread", gt_mmapandread());
   gt_toolbox_add_tool(tools, "orffinder", gt_orffinder());
+  gt_toolbox_add_tool(tools, "overlap", gt_overlap());
   gt_toolbox_add_tool(tools, "packedindex", gt_packedindex());
   gt_toolbox_add_tool(tools, "prebwt", gt_prebwt());
   gt_toolbox_add_tool(tools, "readjoiner", gt_readjoiner());
@@ -266,10 +277,6 @@ GtToolbox* gtt_tools(void)
   gt_toolbox_add_tool(tools, "sketch", gt_sketch());
   gt_toolbox_add_tool(tools, "sketch_page", gt_sketch_page());
 #endif
-#if defined (HAVE_MYSQL) || defined (HAVE_SQLITE)
-  gt_toolbox_add_tool(tools, "featureindex", gt_featureindex());
-  gt_toolbox_add_tool(tools, "mkfeatureindex", gt_mkfeatureindex());
-#endif
 
   return tools;
 }
@@ -288,6 +295,7 @@ GtHashmap* gtt_unit_tests(void)
   gt_hashmap_add(unit_tests, "array2dim sparse example",
                                                    gt_array2dim_sparse_example);
   gt_hashmap_add(unit_tests, "array3dim example", gt_array3dim_example);
+  gt_hashmap_add(unit_tests, "attribute map class", gt_attribute_map_unit_test);
   gt_hashmap_add(unit_tests, "basename module", gt_basename_unit_test);
   gt_hashmap_add(unit_tests, "bit pack array class", gt_bitpackarray_unit_test);
   gt_hashmap_add(unit_tests, "bit pack string module",
@@ -328,6 +336,8 @@ GtHashmap* gtt_unit_tests(void)
   gt_hashmap_add(unit_tests, "feature in stream class",
                                                 gt_feature_in_stream_unit_test);
   gt_hashmap_add(unit_tests, "genome node class", gt_genome_node_unit_test);
+  gt_hashmap_add(unit_tests, "genome node sorting",
+                                              gt_genome_nodes_sort_unit_test);
   gt_hashmap_add(unit_tests, "gff3 escaping module",
                                                     gt_gff3_escaping_unit_test);
   gt_hashmap_add(unit_tests, "grep module", gt_grep_unit_test);
@@ -337,6 +347,8 @@ GtHashmap* gtt_unit_tests(void)
   gt_hashmap_add(unit_tests, "hmm class", gt_hmm_unit_test);
   gt_hashmap_add(unit_tests, "huffman coding class", gt_huffman_unit_test);
   gt_hashmap_add(unit_tests, "interval tree class", gt_interval_tree_unit_test);
+  gt_hashmap_add(unit_tests, "static interval tree class",
+                                             gt_interval_tree_static_unit_test);
   gt_hashmap_add(unit_tests, "intset classes", gt_intset_unit_test);
   gt_hashmap_add(unit_tests, "karlin altschul class",
                                              gt_karlin_altschul_stat_unit_test);
@@ -345,10 +357,16 @@ GtHashmap* gtt_unit_tests(void)
                                                    gt_lua_serializer_unit_test);
   gt_hashmap_add(unit_tests, "mathsupport module", gt_mathsupport_unit_test);
   gt_hashmap_add(unit_tests, "memory allocator module", gt_ma_unit_test);
+  gt_hashmap_add(unit_tests, "mmap feature index class",
+                                               gt_feature_index_mmap_unit_test);
   gt_hashmap_add(unit_tests, "multieoplist", gt_multieoplist_unit_test);
   gt_hashmap_add(unit_tests, "MD5 seqid module", gt_md5_seqid_unit_test);
+  gt_hashmap_add(unit_tests, "MD5 table class", gt_md5_tab_unit_test);
+  gt_hashmap_add(unit_tests, "MD5 disk set class", gt_md5diskset_unit_test);
   gt_hashmap_add(unit_tests, "rdj: suffix-prefix matches list module",
                                                           gt_spmlist_unit_test);
+  gt_hashmap_add(unit_tests, "parallel visitor stream class",
+                                         gt_parallel_visitor_stream_unit_test);
   gt_hashmap_add(unit_tests, "PBS finder module",
                                             gt_ltrdigest_pbs_visitor_unit_test);
   gt_hashmap_add(unit_tests, "popcount sorted tab", gt_popcount_tab_unit_test);
@@ -363,6 +381,8 @@ GtHashmap* gtt_unit_tests(void)
                              gt_priority_queue_unit_test);
   gt_hashmap_add(unit_tests, "safearith example", gt_safearith_example);
   gt_hashmap_add(unit_tests, "safearith module", gt_safearith_unit_test);
+  gt_hashmap_add(unit_tests, "select expression class",
+                                                gt_select_expression_unit_test);
   gt_hashmap_add(unit_tests, "sequence buffer class",
                                                   gt_sequence_buffer_unit_test);
   gt_hashmap_add(unit_tests, "splicedseq class", gt_splicedseq_unit_test);
@@ -165,6 +165,20 @@ void gt_chain_matchtable_empty(GtChain2Dimmatchtable *matchtable)
   matchtable->nextfree = 0;
 }
 
+void gt_chain_matchtable_reset(GtChain2Dimmatchtable *matchtable,
+                               GtUword numberofmatches)
+{
+  gt_assert(matchtable != NULL);
+  if (matchtable->allocated < numberofmatches)
+  {
+    matchtable->matches = gt_realloc(matchtable->matches,
+                                     sizeof (*matchtable->matches) *
+                                     numberofmatches);
+    matchtable->allocated = numberofmatches;
+  }
+  gt_chain_matchtable_empty(matchtable);
+}
+
 void gt_chain_matchtable_add(GtChain2Dimmatchtable *matchtable,
                              const GtChain2Dimmatchvalues *inmatch)
 {
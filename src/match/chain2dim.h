@@ -90,6 +90,13 @@ void gt_chain_matchtable_delete(GtChain2Dimmatchtable *matchtable);
 
 void gt_chain_matchtable_empty(GtChain2Dimmatchtable *matchtable);
 
+/* the function for emptying a table of matches, such that it can store
+   at least <numberofmatches> matches. This allows to reuse the table
+   for many small chaining problems without reallocating the space. */
+
+void gt_chain_matchtable_reset(GtChain2Dimmatchtable *matchtable,
+                               GtUword numberofmatches);
+
 /* the following function adds the relevant values describing a match */
 
 void gt_chain_matchtable_add(GtChain2Dimmatchtable *matchtable,
@@ -135,6 +135,7 @@ struct GtDiagbandseedInfo
        debug_seedpair,
        use_kmerfile,
        trimstat_on;
+  GtDiagbandseedKmerCache *kmer_cache;
 };
 
 struct GtDiagbandseedExtendParams
@@ -155,6 +156,8 @@ struct GtDiagbandseedExtendParams
   double matchscore_bias;
   GtUword use_apos;
   GtAniAccumulate *ani_accumulate;
+  GtDiagbandseedProcessMatchFunc process_match;
+  void *process_match_data;
   bool extendgreedy,
        extendxdrop,
        weakends,
@@ -298,9 +301,18 @@ GtDiagbandseedInfo *gt_diagbandseed_info_new(const GtEncseq *aencseq,
   info->chainarguments = chainarguments;
   info->diagband_statistics_arg = diagband_statistics_arg;
   info->extp = extp;
+  info->kmer_cache = NULL;
   return info;
 }
 
+void gt_diagbandseed_info_kmer_cache_set(GtDiagbandseedInfo *info,
+                                         GtDiagbandseedKmerCache *kmer_cache)
+{
+  gt_assert(info != NULL && !info->use_kmerfile &&
+            info->aencseq != info->bencseq);
+  info->kmer_cache = kmer_cache;
+}
+
 void gt_diagbandseed_info_delete(GtDiagbandseedInfo *info)
 {
   if (info != NULL) {
@@ -360,9 +372,21 @@ GtDiagbandseedExtendParams *gt_diagbandseed_extend_params_new(
   extp->verify_alignment = verify_alignment;
   extp->only_selected_seqpairs = only_selected_seqpairs;
   extp->ani_accumulate = ani_accumulate;
+  extp->process_match = NULL;
+  extp->process_match_data = NULL;
   return extp;
 }
 
+void gt_diagbandseed_extend_params_set_process_match(
+                                GtDiagbandseedExtendParams *extp,
+                                GtDiagbandseedProcessMatchFunc process_match,
+                                void *process_match_data)
+{
+  gt_assert(extp != NULL && extp->ani_accumulate == NULL);
+  extp->process_match = process_match;
+  extp->process_match_data = process_match_data;
+}
+
 void gt_diagbandseed_extend_params_delete(GtDiagbandseedExtendParams *extp)
 {
   if (extp != NULL) {
@@ -504,7 +528,9 @@ static void gt_kmerpos_list_reduce_size(GtKmerPosList *kmerpos_list)
 {
   gt_assert(kmerpos_list != NULL &&
             kmerpos_list->nextfree <= kmerpos_list->allocated);
-  if (kmerpos_list->nextfree < kmerpos_list->allocated)
+  /* an empty list, e.g. of a short query sequence, keeps its space */
+  if (kmerpos_list->nextfree > 0 &&
+      kmerpos_list->nextfree < kmerpos_list->allocated)
   {
     if (kmerpos_list->encode_info != NULL)
     {
@@ -748,6 +774,47 @@ static void gt_kmerpos_encode_info_delete(GtKmerPosListEncodeInfo *encode_info)
   }
 }
 
+/* The k-mer lists of the first sequence set only depend on the first
+   sequence set and the seed parameters. So if the same database is
+   matched against a sequence of different query sets, the lists and
+   their encoding information can be kept from one run to the next. */
+struct GtDiagbandseedKmerCache
+{
+  GtUword numofparts;
+  GtKmerPosList **kmerpos_lists;
+  GtKmerPosListEncodeInfo **encode_infos;
+};
+
+GtDiagbandseedKmerCache *gt_diagbandseed_kmer_cache_new(GtUword numofparts)
+{
+  GtDiagbandseedKmerCache *kmer_cache = gt_malloc(sizeof *kmer_cache);
+
+  gt_assert(numofparts > 0);
+  kmer_cache->numofparts = numofparts;
+  kmer_cache->kmerpos_lists
+    = gt_calloc((size_t) numofparts,sizeof *kmer_cache->kmerpos_lists);
+  kmer_cache->encode_infos
+    = gt_calloc((size_t) numofparts,sizeof *kmer_cache->encode_infos);
+  return kmer_cache;
+}
+
+void gt_diagbandseed_kmer_cache_delete(GtDiagbandseedKmerCache *kmer_cache)
+{
+  if (kmer_cache != NULL)
+  {
+    GtUword idx;
+
+    for (idx = 0; idx < kmer_cache->numofparts; idx++)
+    {
+      gt_kmerpos_list_delete(kmer_cache->kmerpos_lists[idx]);
+      gt_kmerpos_encode_info_delete(kmer_cache->encode_infos[idx]);
+    }
+    gt_free(kmer_cache->kmerpos_lists);
+    gt_free(kmer_cache->encode_infos);
+    gt_free(kmer_cache);
+  }
+}
+
 typedef GtUword GtLongestCodeRunType;
 
 static GtUword gt_diagbandseed_longest_code_run(const GtKmerPosList
@@ -844,9 +911,11 @@ static GtKmerPosList *gt_diagbandseed_get_kmers(
   {
     kmerpos_list_len = gt_seed_extend_numofkmers(encseq, seedlength,
                                                  seqrange_start, seqrange_end);
-    gt_assert(kmerpos_list_len > 0);
   }
-  kmerpos_list = gt_kmerpos_list_new(kmerpos_list_len,encode_info);
+  /* a batch of query sequences shorter than the seed has no k-mers, but the
+     list is never allocated with size 0 */
+  kmerpos_list = gt_kmerpos_list_new(GT_MAX(kmerpos_list_len, 1),
+                                     encode_info);
   if (verbose) {
     GtBitcount_type bits_kmerpos;
 
@@ -2653,6 +2722,8 @@ typedef struct
   const GtSeedExtendDisplayFlag *out_display_flag;
   bool benchmark;
   GtAniAccumulate *ani_accumulate;
+  GtDiagbandseedProcessMatchFunc process_match;
+  void *process_match_data;
   GtDiagbandseedState *dbs_state;
 } GtDiagbandseedExtendSegmentInfo;
 
@@ -2779,7 +2850,11 @@ static int gt_diagbandseed_possibly_extend(const GtArrayGtDiagbandseedRectangle
                                       esi->errorpercentage,
                                       esi->evalue_threshold))
         {
-          if (!esi->benchmark) {
+          if (esi->process_match != NULL)
+          {
+            esi->process_match(esi->process_match_data,querymatch,evalue,
+                               bit_score);
+          } else if (!esi->benchmark) {
             if (gt_querymatch_gfa2_display(esi->out_display_flag))
             {
               gt_assert(esi->dbs_state != NULL);
@@ -2830,8 +2905,53 @@ typedef struct
 {
   GtDiagbandseedSeqnum aseqnum,
                        bseqnum;
+  FILE *fpout;
 } GtDiagbandseedSequencePair;
 
+/* The resources for chaining the maximal matches of one sequence pair.
+   Each thread has its own instance, so that the chains are computed
+   directly after the maximal matches of a sequence pair are found and
+   the space is reused from one sequence pair to the next. */
+typedef struct
+{
+  GtChain2Dimmode *chainmode;
+  GtChain2Dimmatchtable *matchtable;
+  GtChain2Dim *chain;
+} GtDiagbandseedChaining;
+
+static GtDiagbandseedChaining *gt_diagbandseed_chaining_new(
+                                             const char *chainarguments,
+                                             GtError *err)
+{
+  GtDiagbandseedChaining *chaining;
+  GtChain2Dimmode *chainmode = gt_chain_chainmode_new(GT_UWORD_MAX,
+                                                      false,
+                                                      NULL,
+                                                      true,
+                                                      chainarguments,
+                                                      err);
+  if (chainmode == NULL)
+  {
+    return NULL;
+  }
+  chaining = gt_malloc(sizeof *chaining);
+  chaining->chainmode = chainmode;
+  chaining->matchtable = gt_chain_matchtable_new(32UL);
+  chaining->chain = gt_chain_chain_new();
+  return chaining;
+}
+
+static void gt_diagbandseed_chaining_delete(GtDiagbandseedChaining *chaining)
+{
+  if (chaining != NULL)
+  {
+    gt_chain_chainmode_delete(chaining->chainmode);
+    gt_chain_matchtable_delete(chaining->matchtable);
+    gt_chain_chain_delete(chaining->chain);
+    gt_free(chaining);
+  }
+}
+
 static void gt_diagbandseed_chain_out(void *data,
                                       const GtChain2Dimmatchtable *matchtable,
                                       const GtChain2Dim *chain)
@@ -2842,8 +2962,9 @@ static void gt_diagbandseed_chain_out(void *data,
 
   gt_assert(chain != NULL);
   chainlength = gt_chain_chainlength(chain);
-  printf("# chain of length " GT_WU " with score " GT_WD "\n",
-         chainlength,gt_chain_chainscore(chain));
+  fprintf(sequencepair->fpout,
+          "# chain of length " GT_WU " with score " GT_WD "\n",
+          chainlength,gt_chain_chainscore(chain));
 
   gt_assert(!gt_chain_storedinreverseorder(chain));
   for (idx = 0; idx < chainlength; idx++)
@@ -2859,7 +2980,7 @@ static void gt_diagbandseed_chain_out(void *data,
               value.endpos[1] - value.startpos[1] + 1
                         == (GtUword) value.weight);
 
-    gt_diagbandseed_printchainelem(stdout,
+    gt_diagbandseed_printchainelem(sequencepair->fpout,
                                    sequencepair->aseqnum,
                                    value.startpos[0],
                                    sequencepair->bseqnum,
@@ -2973,13 +3094,13 @@ static void gt_diagbandseed_segment2maxmatches(
              GtDiagbandseedState *dbs_state,
              GtSegmentRejectFunc segment_reject_func,
              GtSegmentRejectInfo *segment_reject_info,
-             const GtChain2Dimmode *chainmode,
+             GtDiagbandseedChaining *chaining,
              FILE *fpout)
 {
   GtUword previous_matchlength = seedlength, localmatchcount = 0;
   const GtSeedpairPositions *current;
   GtSeedpairPositions previous;
-  GtDiagbandseedSequencePair sequencepair = {aseqnum,bseqnum};
+  GtDiagbandseedSequencePair sequencepair;
   const bool anchor_pairs = false;
   bool rejected = false;
 #ifndef NDEBUG
@@ -2987,6 +3108,9 @@ static void gt_diagbandseed_segment2maxmatches(
 #endif
 
   gt_assert(segment_length > 0 && seedlength <= userdefinedleastlength);
+  sequencepair.aseqnum = aseqnum;
+  sequencepair.bseqnum = bseqnum;
+  sequencepair.fpout = fpout;
 #ifndef NDEBUG
   for (idx = 1; idx < segment_length; idx++)
   {
@@ -3094,17 +3218,18 @@ static void gt_diagbandseed_segment2maxmatches(
             sizeof *memstore->spaceGtDiagbandseedMaximalmatch,
             gt_diagbandseed_bstart_ldesc_compare_mems);
     }
-    if (chainmode != NULL)
+    if (chaining != NULL)
     {
       const GtUword presortdim = 1;
 #ifndef NDEBUG
       GtUword previous_start_b = GT_UWORD_MAX;
 #endif
       GtChain2Dimmatchvalues inmatch;
-      GtChain2Dim *localchain = gt_chain_chain_new();
       GtDiagbandseedMaximalmatch *mmptr;
-      GtChain2Dimmatchtable *chainmatchtable
-        = gt_chain_matchtable_new(memstore->nextfreeGtDiagbandseedMaximalmatch);
+      GtChain2Dimmatchtable *chainmatchtable = chaining->matchtable;
+
+      gt_chain_matchtable_reset(chainmatchtable,
+                                memstore->nextfreeGtDiagbandseedMaximalmatch);
 
       for (mmptr = memstore->spaceGtDiagbandseedMaximalmatch;
            mmptr < memstore->spaceGtDiagbandseedMaximalmatch +
@@ -3123,8 +3248,9 @@ static void gt_diagbandseed_segment2maxmatches(
         previous_start_b = inmatch.startpos[1];
 #endif
       }
-      gt_chain_fastchaining(chainmode,
-                            localchain,
+      gt_chain_fillthegapvalues(chainmatchtable);
+      gt_chain_fastchaining(chaining->chainmode,
+                            chaining->chain,
                             chainmatchtable,
                             false,
                             presortdim,
@@ -3132,8 +3258,6 @@ static void gt_diagbandseed_segment2maxmatches(
                             gt_diagbandseed_chain_out,
                             &sequencepair,
                             NULL);
-      gt_chain_matchtable_delete(chainmatchtable);
-      gt_chain_chain_delete(localchain);
     }
   }
 }
@@ -3308,7 +3432,7 @@ static void gt_diagbandseed_segment2matches(
                                                dbs_state,\
                                                segment_reject_func,\
                                                segment_reject_info,\
-                                               chainmode,\
+                                               chaining,\
                                                stream);\
             if (memstore != NULL)\
             {\
@@ -3534,6 +3658,8 @@ static GtDiagbandseedExtendSegmentInfo *gt_diagbandseed_extendSI_new(
   esi->karlin_altschul_stat = karlin_altschul_stat;
   esi->out_display_flag = extp->out_display_flag;
   esi->benchmark = extp->benchmark;
+  esi->process_match = extp->process_match;
+  esi->process_match_data = extp->process_match_data;
   if (extp->ani_accumulate != NULL)
   {
     if (GT_ISDIRREVERSE(query_readmode))
@@ -3588,7 +3714,7 @@ static void gt_diagbandseed_process_seeds(GtSeedpairlist *seedpairlist,
                                             *karlin_altschul_stat,
                                           GtArrayGtDiagbandseedMaximalmatch
                                             *memstore,
-                                          const GtChain2Dimmode *chainmode,
+                                          GtDiagbandseedChaining *chaining,
                                           unsigned int spacedseedweight,
                                           unsigned int seedlength,
                                           GtReadmode query_readmode,
@@ -4047,7 +4173,7 @@ static int gt_diagbandseed_algorithm(const GtDiagbandseedInfo *arg,
                 bnumseqranges = gt_sequence_parts_info_number(bseqranges),
                 amaxlen = gt_encseq_max_seq_length(aencseq);
   GtArrayGtDiagbandseedMaximalmatch *memstore = NULL;
-  GtChain2Dimmode *chainmode = NULL;
+  GtDiagbandseedChaining *chaining = NULL;
   GtKmerPosListEncodeInfo *aencode_info, *bencode_info;
 
   gt_assert(arg != NULL);
@@ -4195,13 +4321,9 @@ static int gt_diagbandseed_algorithm(const GtDiagbandseedInfo *arg,
     GT_INITARRAY(memstore,GtDiagbandseedMaximalmatch);
     if (gt_str_length(arg->chainarguments) > 0)
     {
-      chainmode = gt_chain_chainmode_new(GT_UWORD_MAX,
-                                         false,
-                                         NULL,
-                                         true,
-                                         gt_str_get(arg->chainarguments),
-                                         err);
-      if (chainmode == NULL)
+      chaining = gt_diagbandseed_chaining_new(gt_str_get(arg->chainarguments),
+                                              err);
+      if (chaining == NULL)
       {
         had_err = -1;
       }
@@ -4345,7 +4467,7 @@ static int gt_diagbandseed_algorithm(const GtDiagbandseedInfo *arg,
                                   bencseq,bseqranges,bidx,
                                   karlin_altschul_stat,
                                   memstore,
-                                  chainmode,
+                                  chaining,
                                   arg->spacedseedweight,
                                   arg->seedlength,
                                   arg->nofwd ? GT_READMODE_REVCOMPL
@@ -4475,7 +4597,7 @@ static int gt_diagbandseed_algorithm(const GtDiagbandseedInfo *arg,
                                   bencseq,bseqranges,bidx,
                                   karlin_altschul_stat,
                                   memstore,
-                                  chainmode,
+                                  chaining,
                                   arg->spacedseedweight,
                                   arg->seedlength,
                                   GT_READMODE_REVCOMPL,
@@ -4491,10 +4613,7 @@ static int gt_diagbandseed_algorithm(const GtDiagbandseedInfo *arg,
   if (memstore != NULL)
   {
     GT_FREEARRAY(memstore,GtDiagbandseedMaximalmatch);
-    if (chainmode != NULL)
-    {
-      gt_chain_chainmode_delete(chainmode);
-    }
+    gt_diagbandseed_chaining_delete(chaining);
     gt_free(memstore);
   }
   if (extp->extendgreedy)
@@ -4824,47 +4943,69 @@ int gt_diagbandseed_run(const GtDiagbandseedInfo *arg,
     {
       continue;
     }
-    aencode_info = gt_kmerpos_encode_info_new(arg->kmplt,
-                                              arg->aencseq,
-                                              arg->spacedseedweight,
-                                              aseqranges,
-                                              aidx);
-    if (arg->use_kmerfile) {
-      path = gt_diagbandseed_kmer_filename(arg->aencseq,
-                                           arg->spacedseedweight,
-                                           arg->seedlength,
-                                           true,
-                                           anumseqranges,
-                                           aidx,
-                                           gt_diagbandseed_kmplt(
-                                              aencode_info));
-    }
-    if (!arg->use_kmerfile || gt_create_or_update_file(path,arg->aencseq))
+    if (arg->kmer_cache != NULL &&
+        arg->kmer_cache->kmerpos_lists[aidx] != NULL)
     {
+      gt_assert(aidx < arg->kmer_cache->numofparts);
+      alist = arg->kmer_cache->kmerpos_lists[aidx];
+      aencode_info = arg->kmer_cache->encode_infos[aidx];
       use_alist = true;
-      alist = gt_diagbandseed_get_kmers(
-                              arg->aencseq,
-                              arg->spacedseedweight,
-                              arg->seedlength,
-                              arg->spaced_seed_spec,
-                              GT_READMODE_FORWARD,
-                              gt_sequence_parts_info_start_get(aseqranges,aidx),
-                              gt_sequence_parts_info_end_get(aseqranges,aidx),
-                              aencode_info,
-                              arg->debug_kmer,
-                              arg->verbose,
-                              0,
-                              stdout);
-      if (arg->use_kmerfile)
+    } else
+    {
+      aencode_info = gt_kmerpos_encode_info_new(arg->kmplt,
+                                                arg->aencseq,
+                                                arg->spacedseedweight,
+                                                aseqranges,
+                                                aidx);
+    }
+    if (!use_alist) /* otherwise reuse k-mer list of previous run */
+    {
+      if (arg->use_kmerfile) {
+        path = gt_diagbandseed_kmer_filename(arg->aencseq,
+                                             arg->spacedseedweight,
+                                             arg->seedlength,
+                                             true,
+                                             anumseqranges,
+                                             aidx,
+                                             gt_diagbandseed_kmplt(
+                                                aencode_info));
+      }
+      if (!arg->use_kmerfile || gt_create_or_update_file(path,arg->aencseq))
       {
-        had_err = gt_diagbandseed_write_kmers(alist, path,
-                                              arg->spacedseedweight,
-                                              arg->seedlength,
-                                              arg->verbose, err);
+        use_alist = true;
+        alist = gt_diagbandseed_get_kmers(
+                                arg->aencseq,
+                                arg->spacedseedweight,
+                                arg->seedlength,
+                                arg->spaced_seed_spec,
+                                GT_READMODE_FORWARD,
+                                gt_sequence_parts_info_start_get(aseqranges,
+                                                                 aidx),
+                                gt_sequence_parts_info_end_get(aseqranges,
+                                                               aidx),
+                                aencode_info,
+                                arg->debug_kmer,
+                                arg->verbose,
+                                0,
+                                stdout);
+        if (arg->use_kmerfile)
+        {
+          had_err = gt_diagbandseed_write_kmers(alist, path,
+                                                arg->spacedseedweight,
+                                                arg->seedlength,
+                                                arg->verbose, err);
+        }
+      }
+      if (arg->use_kmerfile) {
+        gt_free(path);
       }
     }
-    if (arg->use_kmerfile) {
-      gt_free(path);
+    if (arg->kmer_cache != NULL && use_alist &&
+        arg->kmer_cache->kmerpos_lists[aidx] == NULL)
+    {
+      gt_assert(!self && aidx < arg->kmer_cache->numofparts);
+      arg->kmer_cache->kmerpos_lists[aidx] = alist;
+      arg->kmer_cache->encode_infos[aidx] = aencode_info;
     }
     bidx = self ? aidx : 0;
 
@@ -4971,10 +5112,13 @@ int gt_diagbandseed_run(const GtDiagbandseedInfo *arg,
       gt_array_delete(combinations);
     }
 #endif
-    if (use_alist) {
-      gt_kmerpos_list_delete(alist);
+    if (arg->kmer_cache == NULL)
+    {
+      if (use_alist) {
+        gt_kmerpos_list_delete(alist);
+      }
+      gt_kmerpos_encode_info_delete(aencode_info);
     }
-    gt_kmerpos_encode_info_delete(aencode_info);
   }
 #ifdef GT_THREADS_ENABLED
   if (gt_jobs > 1 && arg->use_kmerfile) {
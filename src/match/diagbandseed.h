@@ -25,11 +25,13 @@
 #include "core/types_api.h"
 #include "match/ft-front-prune.h"
 #include "match/seed_extend_parts.h"
+#include "match/querymatch.h"
 #include "match/querymatch-display.h"
 #include "match/xdrop.h"
 
 typedef struct GtDiagbandseedInfo GtDiagbandseedInfo;
 typedef struct GtDiagbandseedExtendParams GtDiagbandseedExtendParams;
+typedef struct GtDiagbandseedKmerCache GtDiagbandseedKmerCache;
 
 typedef enum
 { /* keep the order consistent with gt_base_list_arguments */
@@ -71,6 +73,19 @@ GtDiagbandseedInfo *gt_diagbandseed_info_new(const GtEncseq *aencseq,
                                              const GtDiagbandseedExtendParams
                                                *extp);
 
+/* Let <info> keep the k-mer lists of the first sequence set in <kmer_cache>,
+   so that further runs with the same first sequence set, but a different
+   second sequence set, do not recompute them. Not available in combination
+   with k-mer files or if both sequence sets are identical. */
+void gt_diagbandseed_info_kmer_cache_set(GtDiagbandseedInfo *info,
+                                         GtDiagbandseedKmerCache *kmer_cache);
+
+/* The constructor for a GtDiagbandseedKmerCache for the given number of
+   parts of the first sequence set. */
+GtDiagbandseedKmerCache *gt_diagbandseed_kmer_cache_new(GtUword numofparts);
+
+void gt_diagbandseed_kmer_cache_delete(GtDiagbandseedKmerCache *kmer_cache);
+
 const char *gt_diagbandseed_splt_comment(void);
 
 const char *gt_diagbandseed_kmplt_comment(void);
@@ -112,6 +127,22 @@ GtDiagbandseedExtendParams *gt_diagbandseed_extend_params_new(
                                 bool only_selected_seqpairs,
                                 GtAniAccumulate *ani_accumulate);
 
+/* Function type to process a match of the extension phase, which satisfies
+   the length, similarity and evalue constraints. */
+typedef void (*GtDiagbandseedProcessMatchFunc)(void *data,
+                                               const GtQuerymatch *querymatch,
+                                               double evalue,
+                                               double bit_score);
+
+/* Let all final matches be passed to <process_match> together with <data>,
+   instead of printing them. As the extension may be performed by several
+   threads, <process_match> has to be thread safe. Not available in
+   combination with a GtAniAccumulate. */
+void gt_diagbandseed_extend_params_set_process_match(
+                                GtDiagbandseedExtendParams *extp,
+                                GtDiagbandseedProcessMatchFunc process_match,
+                                void *process_match_data);
+
 /* The destructors */
 void gt_diagbandseed_info_delete(GtDiagbandseedInfo *info);
 
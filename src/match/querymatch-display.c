@@ -33,7 +33,7 @@ struct GtSeedExtendDisplayFlag
 {
   uint64_t flags;
   unsigned int order[GT_DISPLAY_LARGEST_FLAG+1];
-  GtUword alignmentwidth, trace_delta, nextfree;
+  GtUword alignmentwidth, trace_delta, nextfree, queryseqnum_offset;
 };
 
 static uint64_t gt_display_mask(GtSeedExtendDisplay_enum flag)
@@ -171,6 +171,20 @@ GtUword gt_querymatch_trace_delta_display(const GtSeedExtendDisplayFlag
   return (display_flag == NULL) ? 0 : display_flag->trace_delta;
 }
 
+GtUword gt_querymatch_display_queryseqnum_offset(const GtSeedExtendDisplayFlag
+                                                   *display_flag)
+{
+  return (display_flag == NULL) ? 0 : display_flag->queryseqnum_offset;
+}
+
+void gt_querymatch_display_queryseqnum_offset_set(GtSeedExtendDisplayFlag
+                                                    *display_flag,
+                                                  GtUword queryseqnum_offset)
+{
+  gt_assert(display_flag != NULL);
+  display_flag->queryseqnum_offset = queryseqnum_offset;
+}
+
 bool gt_querymatch_alignment_display(const GtSeedExtendDisplayFlag
                                      *display_flag)
 {
@@ -357,6 +371,7 @@ GtSeedExtendDisplayFlag *gt_querymatch_display_flag_new(
   */
   display_flag->alignmentwidth = 0;
   display_flag->trace_delta = 0;
+  display_flag->queryseqnum_offset = 0;
   display_flag->nextfree = 0;
   display_flag->flags = 0;
   if (setmode != GT_SEED_EXTEND_DISPLAY_SET_NO)
@@ -56,6 +56,15 @@ GtUword gt_querymatch_display_alignmentwidth(const GtSeedExtendDisplayFlag *);
 
 GtUword gt_querymatch_trace_delta_display(const GtSeedExtendDisplayFlag *);
 
+/* The offset added to the query sequence numbers when displaying a match.
+   It is used if the queries are processed in consecutive batches. */
+GtUword gt_querymatch_display_queryseqnum_offset(
+                                        const GtSeedExtendDisplayFlag *);
+
+void gt_querymatch_display_queryseqnum_offset_set(
+                                        GtSeedExtendDisplayFlag *display_flag,
+                                        GtUword queryseqnum_offset);
+
 #include "match/se-display-fwd.inc"
 
 const char *gt_querymatch_flag2name(GtSeedExtendDisplay_enum flag);
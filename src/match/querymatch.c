@@ -127,6 +127,11 @@ GtUword gt_querymatch_querystart(const GtQuerymatch *querymatch)
   return querymatch->querystart;
 }
 
+GtUword gt_querymatch_querystart_fwdstrand(const GtQuerymatch *querymatch)
+{
+  return querymatch->querystart_fwdstrand;
+}
+
 static GtUword gt_querymatch_queryend_relative(const GtQuerymatch *querymatch)
 {
   return querymatch->querystart + querymatch->querylen - 1;
@@ -242,7 +247,7 @@ static GtUword gt_querymatch_indels(const GtQuerymatch *querymatch)
                   = (aligned_len - indels)/2
 */
 
-static GtUword gt_querymatch_alignment_length(const GtQuerymatch *querymatch)
+GtUword gt_querymatch_alignment_length(const GtQuerymatch *querymatch)
 {
   return (gt_querymatch_aligned_len(querymatch) -
           gt_querymatch_indels(querymatch))/2;
@@ -532,7 +537,8 @@ void gt_querymatch_prettyprint(double evalue,double bit_score,
         {
           fputc(querymatch->selfmatch ? 'S' : 'Q',querymatch->fp);
         }
-        fprintf(querymatch->fp,GT_WU,querymatch->queryseqnum);
+        fprintf(querymatch->fp,GT_WU,querymatch->queryseqnum +
+                gt_querymatch_display_queryseqnum_offset(out_display_flag));
         if (gfa2_display)
         {
           fputc(GT_ISDIRREVERSE(querymatch->query_readmode) ? '-' : '+',
@@ -698,7 +704,8 @@ void gt_querymatch_show_failed_seed(const GtSeedExtendDisplayFlag
             separator,
             gt_seed_extend_outflag[querymatch->query_readmode],
             separator,
-            querymatch->queryseqnum,
+            querymatch->queryseqnum +
+            gt_querymatch_display_queryseqnum_offset(out_display_flag),
             separator,
             querymatch->query_seedpos_rel);
   }
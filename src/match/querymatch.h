@@ -104,6 +104,10 @@ GtUword gt_querymatch_dbstart_relative(const GtQuerymatch *querymatch);
 
 GtUword gt_querymatch_querystart(const GtQuerymatch *querymatch);
 
+GtUword gt_querymatch_querystart_fwdstrand(const GtQuerymatch *querymatch);
+
+GtUword gt_querymatch_alignment_length(const GtQuerymatch *querymatch);
+
 void gt_querymatch_db_coordinates(GtUword *db_seqnum,GtUword *db_seqstart,
                                   GtUword *db_seqlen,
                                   const GtQuerymatch *querymatch);
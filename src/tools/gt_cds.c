@@ -19,6 +19,7 @@
 #include "core/option_api.h"
 #include "core/output_file_api.h"
 #include "core/unused_api.h"
+#include "extended/binary_out_stream.h"
 #include "extended/cds_stream_api.h"
 #include "extended/genome_node.h"
 #include "extended/gff3_in_stream.h"
@@ -34,6 +35,7 @@ typedef struct {
   bool start_codon,
        final_stop_codon,
        generic_start_codons,
+       binary,
        verbose;
   GtSeqid2FileInfo *s2fi;
   GtOutputFileInfo *ofi;
@@ -97,6 +99,12 @@ static GtOptionParser* gt_cds_option_parser_new(void *tool_arguments)
   /* -seqfile, -matchdesc, -usedesc and -regionmapping */
   gt_seqid2file_register_options(op, arguments->s2fi);
 
+  /* -binary */
+  option = gt_option_new_bool("binary", "show output in the compact binary "
+                              "format instead of GFF3",
+                              &arguments->binary, false);
+  gt_option_parser_add_option(op, option);
+
   /* -v */
   option = gt_option_new_verbose(&arguments->verbose);
   gt_option_parser_add_option(op, option);
@@ -139,8 +147,11 @@ static int gt_cds_runner(GT_UNUSED int argc, const char **argv, int parsed_args,
                                    arguments->final_stop_codon,
                                    arguments->generic_start_codons);
 
-    /* create gff3 output stream */
-    gff3_out_stream = gt_gff3_out_stream_new(cds_stream, arguments->outfp);
+    /* create gff3 (or binary) output stream */
+    if (arguments->binary)
+      gff3_out_stream = gt_binary_out_stream_new(cds_stream, arguments->outfp);
+    else
+      gff3_out_stream = gt_gff3_out_stream_new(cds_stream, arguments->outfp);
 
     /* pull the features through the stream and free them afterwards */
     had_err = gt_node_stream_pull(gff3_out_stream, err);
@@ -37,6 +37,7 @@
 typedef struct {
   bool descs,
        pagewise,
+       qcontext,
        regular;
   GtStr  *smap,
          *method,
@@ -114,6 +115,13 @@ gt_compreads_compress_option_parser_new(void *tool_arguments)
                                &arguments->arg_range, NULL);
   gt_option_parser_add_option(op, option);
 
+  option = gt_option_new_bool("qcontext", "encode every base and quality value"
+                              " with a code depending on the previous quality"
+                              " value and the position in the read, this"
+                              " usually gives a smaller encoding",
+                              &arguments->qcontext, false);
+  gt_option_parser_add_option(op, option);
+
   option = gt_option_new_uword("srate", "sampling rate, set to sensible default"
                                " depending on sampling method",
                                &arguments->srate, GT_UNDEF_UWORD);
@@ -269,7 +277,8 @@ static int gt_compreads_compress_runner(GT_UNUSED int argc,
     if (timer != NULL)
       gt_timer_show_progress(timer, "encoding", stdout);
     hcre = gt_hcr_encoder_new(arguments->files, alpha, arguments->descs,
-                              arguments->qrng, timer, err);
+                              arguments->qcontext, arguments->qrng, timer,
+                              err);
     if (!hcre)
       had_err = 1;
     else {
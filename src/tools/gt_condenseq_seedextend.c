@@ -0,0 +1,655 @@
+/*
+  Copyright (c) 2026 agent <agent@local>
+
+  Permission to use, copy, modify, and distribute this software for any
+  purpose with or without fee is hereby granted, provided that the above
+  copyright notice and this permission notice appear in all copies.
+
+  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+
+#include <ctype.h>
+#include <float.h>
+#include <string.h>
+
+#include "core/alphabet_api.h"
+#include "core/array_api.h"
+#include "core/encseq_api.h"
+#include "core/log_api.h"
+#include "core/logger.h"
+#include "core/ma_api.h"
+#include "core/minmax_api.h"
+#include "core/output_file_api.h"
+#include "core/range_api.h"
+#include "core/seq_iterator_sequence_buffer_api.h"
+#include "core/showtime.h"
+#include "core/str_array_api.h"
+#include "core/thread_api.h"
+#include "core/undef_api.h"
+#include "core/unused_api.h"
+#include "extended/condenseq.h"
+#include "match/diagbandseed.h"
+#include "match/initbasepower.h"
+#include "match/querymatch.h"
+#include "match/querymatch-display.h"
+#include "match/seed-extend.h"
+#include "match/seed_extend_parts.h"
+
+#include "extended/condenseq_search_arguments.h"
+#include "tools/gt_condenseq_seedextend.h"
+
+typedef struct {
+  GtFile                     *outfp;
+  GtOutputFileInfo           *ofi;
+  GtCondenseqSearchArguments *csa;
+  GtStr                      *querypath;
+  GtUword                     alignlength,
+                              cminidentity,
+                              minidentity;
+  unsigned int                seedlength;
+  bool                        norev;
+} GtCondenseqSeedextendArguments;
+
+/* coarse hit on a unique, <range> is relative to the start of the unique */
+typedef struct {
+  GtRange range;
+  GtUword uid,
+          extend;
+} CesSeCoarseHit;
+
+/* range of the original sequence collection, which is searched in the fine
+   search */
+typedef struct {
+  GtRange range;
+  GtUword seqnum;
+} CesSeFineRange;
+
+typedef struct {
+  double  bit_score,
+          evalue,
+          identity;
+  GtUword alignlength,
+          fragment,
+          queryseqnum,
+          querystart,
+          queryend,
+          subjectstart,
+          subjectend;
+  bool    reverse;
+} CesSeFineHit;
+
+/* collects the matches reported by the possibly multithreaded extension */
+typedef struct {
+  GtArray *hits;
+  GtMutex *mutex;
+} CesSeMatchCollector;
+
+static void* gt_condenseq_seedextend_arguments_new(void)
+{
+  GtCondenseqSeedextendArguments *arguments =
+    gt_calloc((size_t) 1, sizeof *arguments);
+  arguments->csa = gt_condenseq_search_arguments_new();
+  arguments->ofi = gt_output_file_info_new();
+  arguments->querypath = gt_str_new();
+  return arguments;
+}
+
+static void gt_condenseq_seedextend_arguments_delete(void *tool_arguments)
+{
+  GtCondenseqSeedextendArguments *arguments = tool_arguments;
+  if (arguments != NULL) {
+    gt_condenseq_search_arguments_delete(arguments->csa);
+    gt_file_delete(arguments->outfp);
+    gt_output_file_info_delete(arguments->ofi);
+    gt_str_delete(arguments->querypath);
+    gt_free(arguments);
+  }
+}
+
+static GtOptionParser*
+gt_condenseq_seedextend_option_parser_new(void *tool_arguments)
+{
+  GtCondenseqSeedextendArguments *arguments = tool_arguments;
+  GtOptionParser *op;
+  GtOption *option;
+  gt_assert(arguments);
+
+  /* init */
+  op = gt_option_parser_new("[option ...] -db <archive> -query <query>",
+                            "Search the given compressed database with the "
+                            "seed and extend method of gt seed_extend. Output "
+                            "similar to blast -outfmt 6.");
+
+  gt_condenseq_search_register_options(arguments->csa, op);
+
+  /* -query */
+  option = gt_option_new_filename("query", "path of fasta query file",
+                                  arguments->querypath);
+  gt_option_is_mandatory(option);
+  gt_option_parser_add_option(op, option);
+
+  /* -seedlength */
+  option = gt_option_new_uint_min_max("seedlength", "length of the k-mer "
+                                      "seeds, reduced to the length of the "
+                                      "longest sequence if necessary",
+                                      &arguments->seedlength, 14U, 2U, 32U);
+  gt_option_parser_add_option(op, option);
+
+  /* -l */
+  option = gt_option_new_uword_min("l", "minimum length of aligned sequences "
+                                   "in the fine search\n"
+                                   "default: 2.5 x seedlength",
+                                   &arguments->alignlength,
+                                   GT_UWORD_MAX, 1UL);
+  gt_option_hide_default(option);
+  gt_option_parser_add_option(op, option);
+
+  /* -minidentity */
+  option = gt_option_new_uword_min_max("minidentity",
+                                       "minimum identity of matches in the "
+                                       "fine search",
+                                       &arguments->minidentity, 80UL,
+                                       (GtUword)
+                                       GT_EXTEND_MIN_IDENTITY_PERCENTAGE,
+                                       99UL);
+  gt_option_parser_add_option(op, option);
+
+  /* -cminidentity */
+  option = gt_option_new_uword_min_max("cminidentity",
+                                       "minimum identity of matches in the "
+                                       "coarse search on the unique sequences",
+                                       &arguments->cminidentity,
+                                       (GtUword)
+                                       GT_EXTEND_MIN_IDENTITY_PERCENTAGE,
+                                       (GtUword)
+                                       GT_EXTEND_MIN_IDENTITY_PERCENTAGE,
+                                       99UL);
+  gt_option_parser_add_option(op, option);
+
+  /* -no-reverse */
+  option = gt_option_new_bool("no-reverse", "do not search the reverse "
+                              "complemented strand", &arguments->norev, false);
+  gt_option_parser_add_option(op, option);
+
+  gt_output_file_info_register_options(arguments->ofi, op, &arguments->outfp);
+
+  return op;
+}
+
+static void ces_se_collect_coarse(void *data,
+                                  const GtQuerymatch *querymatch,
+                                  GT_UNUSED double evalue,
+                                  GT_UNUSED double bit_score)
+{
+  CesSeMatchCollector *collector = data;
+  CesSeCoarseHit hit;
+  GtUword seqstart, seqlen, queryseqnum, queryseqstart, queryseqlen;
+
+  gt_querymatch_db_coordinates(&hit.uid, &seqstart, &seqlen, querymatch);
+  gt_querymatch_query_coordinates(&queryseqnum, &queryseqstart, &queryseqlen,
+                                  querymatch);
+  hit.range.start = gt_querymatch_dbstart_relative(querymatch);
+  hit.range.end = hit.range.start + gt_querymatch_dblen(querymatch) - 1;
+  /* the parts of the query not covered by the match might align to the
+     neighbourhood of the hit, as the strand is not known to the redundant
+     ranges, both sides are extended by the uncovered length */
+  hit.extend = queryseqlen - gt_querymatch_querylen(querymatch);
+  gt_mutex_lock(collector->mutex);
+  gt_array_add(collector->hits, hit);
+  gt_mutex_unlock(collector->mutex);
+}
+
+static void ces_se_collect_fine(void *data,
+                                const GtQuerymatch *querymatch,
+                                double evalue,
+                                double bit_score)
+{
+  CesSeMatchCollector *collector = data;
+  CesSeFineHit hit;
+  GtUword seqstart, seqlen, queryseqstart, queryseqlen, aligned_len;
+
+  gt_querymatch_db_coordinates(&hit.fragment, &seqstart, &seqlen, querymatch);
+  gt_querymatch_query_coordinates(&hit.queryseqnum, &queryseqstart,
+                                  &queryseqlen, querymatch);
+  hit.subjectstart = gt_querymatch_dbstart_relative(querymatch);
+  hit.subjectend = hit.subjectstart + gt_querymatch_dblen(querymatch) - 1;
+  hit.querystart = gt_querymatch_querystart_fwdstrand(querymatch);
+  hit.queryend = hit.querystart + gt_querymatch_querylen(querymatch) - 1;
+  hit.reverse =
+    GT_ISDIRREVERSE(gt_querymatch_query_readmode(querymatch)) ? true : false;
+  aligned_len = gt_querymatch_dblen(querymatch) +
+                gt_querymatch_querylen(querymatch);
+  hit.identity = 100.0 - gt_querymatch_error_rate(
+                                         gt_querymatch_distance(querymatch),
+                                         aligned_len);
+  hit.alignlength = gt_querymatch_alignment_length(querymatch);
+  hit.evalue = evalue;
+  hit.bit_score = bit_score;
+  gt_mutex_lock(collector->mutex);
+  gt_array_add(collector->hits, hit);
+  gt_mutex_unlock(collector->mutex);
+}
+
+/* run the seed and extend algorithm of gt seed_extend with <aencseq> as
+   database and <bencseq> as query, passing each match to <process_match>. */
+static int ces_se_seed_extend(const GtEncseq *aencseq,
+                              const GtEncseq *bencseq,
+                              const GtCondenseqSeedextendArguments *arguments,
+                              GtUword minidentity,
+                              GtUword alignlength,
+                              const GtSeedExtendDisplayFlag *display_flag,
+                              GtDiagbandseedProcessMatchFunc process_match,
+                              void *process_match_data,
+                              GtLogger *logger,
+                              GtError *err)
+{
+  int had_err = 0;
+  unsigned int nchars, maxseedlength, seedlength;
+  GtUword maxseqlength, mincoverage;
+  GtDiagbandseedBaseListType splt, kmplt;
+  GtUwordPair pick = {GT_UWORD_MAX, GT_UWORD_MAX};
+  GtRange seedpairdistance;
+  bool norev = arguments->norev;
+
+  nchars = gt_alphabet_num_of_chars(gt_encseq_alphabet(aencseq));
+  if (gt_encseq_has_twobitencoding(aencseq) &&
+      gt_encseq_wildcards(aencseq) == 0 &&
+      gt_encseq_has_twobitencoding(bencseq) &&
+      gt_encseq_wildcards(bencseq) == 0) {
+    maxseedlength = 32U;
+  }
+  else {
+    maxseedlength = gt_maxbasepower(nchars) - 1;
+  }
+  maxseqlength = GT_MIN(gt_encseq_max_seq_length(aencseq),
+                        gt_encseq_max_seq_length(bencseq));
+  seedlength = GT_MIN(arguments->seedlength, maxseedlength);
+  if ((GtUword) seedlength > maxseqlength)
+    seedlength = (unsigned int) maxseqlength;
+  if (seedlength < 2U) {
+    gt_logger_log(logger, "sequences too short for k-mer seeds");
+    return 0;
+  }
+  if (!gt_alphabet_is_dna(gt_encseq_alphabet(aencseq)))
+    norev = true;
+  mincoverage = (GtUword) (2.5 * seedlength);
+  if (alignlength == GT_UWORD_MAX)
+    alignlength = mincoverage;
+  seedpairdistance.start = (GtUword) seedlength;
+  seedpairdistance.end = GT_UWORD_MAX - gt_encseq_max_seq_length(aencseq);
+
+  splt = gt_diagbandseed_base_list_get(true, "", err);
+  kmplt = gt_diagbandseed_base_list_get(false, "", err);
+  if ((int) splt == -1 || (int) kmplt == -1)
+    had_err = -1;
+
+  if (!had_err) {
+    GtDiagbandseedExtendParams *extp;
+    GtDiagbandseedInfo *info;
+    GtSequencePartsInfo *aseqranges, *bseqranges;
+    GtStr *empty = gt_str_new();
+
+    aseqranges =
+      gt_sequence_parts_info_new(aencseq, gt_encseq_num_of_sequences(aencseq),
+                                 (GtUword) 1);
+    bseqranges =
+      gt_sequence_parts_info_new(bencseq, gt_encseq_num_of_sequences(bencseq),
+                                 (GtUword) 1);
+    extp = gt_diagbandseed_extend_params_new(alignlength,
+                                             100UL - minidentity,
+                                             DBL_MAX,
+                                             6UL,
+                                             mincoverage,
+                                             display_flag,
+                                             0,
+                                             0,
+                                             true,
+                                             false,
+                                             0,
+                                             60UL,
+                                             0,
+                                             GT_EXTEND_CHAR_ACCESS_ANY,
+                                             GT_EXTEND_CHAR_ACCESS_ANY,
+                                             false,
+                                             97UL,
+                                             GT_DEFAULT_MATCHSCORE_BIAS,
+                                             false,
+                                             false,
+                                             true,
+                                             false,
+                                             false,
+                                             NULL);
+    gt_diagbandseed_extend_params_set_process_match(extp, process_match,
+                                                    process_match_data);
+    info = gt_diagbandseed_info_new(aencseq,
+                                    bencseq,
+                                    GT_UWORD_MAX,
+                                    GT_UWORD_MAX,
+                                    0,
+                                    seedlength,
+                                    norev,
+                                    false,
+                                    &seedpairdistance,
+                                    splt,
+                                    kmplt,
+                                    false,
+                                    false,
+                                    false,
+                                    false,
+                                    false,
+                                    false,
+                                    0,
+                                    empty,
+                                    empty,
+                                    extp);
+    had_err = gt_diagbandseed_run(info, aseqranges, bseqranges, &pick, err);
+    gt_diagbandseed_info_delete(info);
+    gt_diagbandseed_extend_params_delete(extp);
+    gt_sequence_parts_info_delete(aseqranges);
+    gt_sequence_parts_info_delete(bseqranges);
+    gt_str_delete(empty);
+  }
+  return had_err;
+}
+
+static GtEncseq *ces_se_read_queries(const char *querypath,
+                                     GtAlphabet *alphabet,
+                                     GtError *err)
+{
+  GtEncseq *queries = NULL;
+  GtEncseqBuilder *eb;
+  GtSeqIterator *seqit;
+  GtStrArray *files = gt_str_array_new();
+  GtUword numofsequences = 0;
+  int retval;
+
+  gt_str_array_add_cstr(files, querypath);
+  seqit = gt_seq_iterator_sequence_buffer_new(files, err);
+  if (seqit == NULL) {
+    gt_str_array_delete(files);
+    return NULL;
+  }
+  gt_seq_iterator_set_symbolmap(seqit, gt_alphabet_symbolmap(alphabet));
+  eb = gt_encseq_builder_new(alphabet);
+  gt_encseq_builder_enable_multiseq_support(eb);
+  gt_encseq_builder_enable_description_support(eb);
+  while (true) {
+    const GtUchar *sequence;
+    GtUword len;
+    char *desc;
+    retval = gt_seq_iterator_next(seqit, &sequence, &len, &desc, err);
+    if (retval <= 0)
+      break;
+    if (len > 0) {
+      gt_encseq_builder_add_encoded_own(eb, sequence, len, desc);
+      numofsequences++;
+    }
+  }
+  if (retval == 0) {
+    if (numofsequences == 0)
+      gt_error_set(err, "query file %s contains no sequences", querypath);
+    else
+      queries = gt_encseq_builder_build(eb, err);
+  }
+  gt_encseq_builder_delete(eb);
+  gt_seq_iterator_delete(seqit);
+  gt_str_array_delete(files);
+  return queries;
+}
+
+static int ces_se_add_range(void *data,
+                            GtUword seqid,
+                            GtRange seqrange,
+                            GT_UNUSED GtError *err)
+{
+  GtArray *ranges = data;
+  CesSeFineRange range;
+  range.range = seqrange;
+  range.seqnum = seqid;
+  gt_array_add(ranges, range);
+  return 0;
+}
+
+static int ces_se_range_compare(const void *a, const void *b)
+{
+  const CesSeFineRange *range_a = a,
+                       *range_b = b;
+  if (range_a->seqnum != range_b->seqnum)
+    return range_a->seqnum < range_b->seqnum ? -1 : 1;
+  return gt_range_compare(&range_a->range, &range_b->range);
+}
+
+static int ces_se_fine_hit_compare(const void *a, const void *b)
+{
+  const CesSeFineHit *hit_a = a,
+                     *hit_b = b;
+  if (hit_a->queryseqnum != hit_b->queryseqnum)
+    return hit_a->queryseqnum < hit_b->queryseqnum ? -1 : 1;
+  if (hit_a->fragment != hit_b->fragment)
+    return hit_a->fragment < hit_b->fragment ? -1 : 1;
+  if (hit_a->subjectstart != hit_b->subjectstart)
+    return hit_a->subjectstart < hit_b->subjectstart ? -1 : 1;
+  if (hit_a->querystart != hit_b->querystart)
+    return hit_a->querystart < hit_b->querystart ? -1 : 1;
+  if (hit_a->reverse != hit_b->reverse)
+    return hit_a->reverse ? 1 : -1;
+  return 0;
+}
+
+/* sort the redundant ranges and join overlapping or adjacent ones */
+static void ces_se_join_ranges(GtArray *ranges)
+{
+  GtUword idx, nextfree = 0;
+  CesSeFineRange *space = gt_array_get_space(ranges);
+
+  gt_array_sort(ranges, ces_se_range_compare);
+  for (idx = 0; idx < gt_array_size(ranges); idx++) {
+    if (nextfree > 0 &&
+        space[nextfree - 1].seqnum == space[idx].seqnum &&
+        space[nextfree - 1].range.end + 1 >= space[idx].range.start) {
+      space[nextfree - 1].range.end = GT_MAX(space[nextfree - 1].range.end,
+                                             space[idx].range.end);
+    }
+    else {
+      space[nextfree++] = space[idx];
+    }
+  }
+  gt_array_set_size(ranges, nextfree);
+}
+
+static void ces_se_show_fine_hits(GtCondenseq *ces,
+                                  const GtEncseq *queries,
+                                  GtArray *ranges,
+                                  GtArray *hits,
+                                  GtFile *outfp)
+{
+  GtUword idx;
+
+  gt_array_sort(hits, ces_se_fine_hit_compare);
+  for (idx = 0; idx < gt_array_size(hits); idx++) {
+    const CesSeFineHit *hit = gt_array_get(hits, idx);
+    const CesSeFineRange *fragment = gt_array_get(ranges, hit->fragment);
+    const char *querydesc, *subjectdesc;
+    GtUword querydesclen, subjectdesclen, querylen = 0, offset;
+
+    querydesc = gt_encseq_description(queries, &querydesclen,
+                                      hit->queryseqnum);
+    while (querylen < querydesclen && !isspace((int) querydesc[querylen]))
+      querylen++;
+    subjectdesc = gt_condenseq_description(ces, &subjectdesclen,
+                                           fragment->seqnum);
+    /* 1-based coordinates relative to the original sequence */
+    offset = fragment->range.start -
+             gt_condenseq_seqstartpos(ces, fragment->seqnum) + 1;
+    gt_file_xprintf(outfp,
+                    "%.*s\t%.*s\t%.2f\t" GT_WU "\t" GT_WU "\t" GT_WU "\t"
+                    GT_WU "\t" GT_WU "\t%g\t%.3f\n",
+                    (int) querylen, querydesc,
+                    (int) subjectdesclen, subjectdesc,
+                    hit->identity,
+                    hit->alignlength,
+                    hit->querystart + 1,
+                    hit->queryend + 1,
+                    (hit->reverse ? hit->subjectend : hit->subjectstart)
+                      + offset,
+                    (hit->reverse ? hit->subjectstart : hit->subjectend)
+                      + offset,
+                    hit->evalue,
+                    hit->bit_score);
+  }
+}
+
+static int gt_condenseq_seedextend_runner(GT_UNUSED int argc,
+                                          GT_UNUSED const char **argv,
+                                          GT_UNUSED int parsed_args,
+                                          void *tool_arguments,
+                                          GtError *err)
+{
+  GtCondenseqSeedextendArguments *arguments = tool_arguments;
+  GtCondenseq *ces = NULL;
+  GtEncseq *queries = NULL,
+           *fine_es = NULL;
+  GtAlphabet *alphabet = NULL;
+  GtArray *ranges = gt_array_new(sizeof (CesSeFineRange));
+  CesSeMatchCollector collector;
+  GtSeedExtendDisplayFlag *display_flag = NULL;
+  GtLogger *logger;
+  GtTimer *timer = NULL;
+  int had_err = 0;
+
+  gt_error_check(err);
+  gt_assert(arguments != NULL);
+
+  collector.hits = NULL;
+  collector.mutex = gt_mutex_new();
+  logger =
+    gt_logger_new(gt_condenseq_search_arguments_verbose(arguments->csa),
+                  GT_LOGGER_DEFLT_PREFIX, stderr);
+
+  if (gt_showtime_enabled()) {
+    timer = gt_timer_new_with_progress_description("initialization");
+    gt_timer_start(timer);
+  }
+
+  ces = gt_condenseq_search_arguments_read_condenseq(arguments->csa, logger,
+                                                     err);
+  if (ces == NULL)
+    had_err = -1;
+  if (!had_err) {
+    alphabet = gt_condenseq_alphabet(ces);
+    queries = ces_se_read_queries(gt_str_get(arguments->querypath), alphabet,
+                                  err);
+    if (queries == NULL)
+      had_err = -1;
+  }
+  if (!had_err) {
+    GtStrArray *display_args = gt_str_array_new();
+    gt_str_array_add_cstr(display_args, "evalue");
+    gt_str_array_add_cstr(display_args, "bitscore");
+    display_flag =
+      gt_querymatch_display_flag_new(display_args,
+                                     GT_SEED_EXTEND_DISPLAY_SET_NO, err);
+    gt_str_array_delete(display_args);
+    if (display_flag == NULL)
+      had_err = -1;
+  }
+
+  /* coarse search on the unique sequences */
+  if (!had_err) {
+    if (timer != NULL)
+      gt_timer_show_progress(timer, "coarse search", stderr);
+    collector.hits = gt_array_new(sizeof (CesSeCoarseHit));
+    had_err = ces_se_seed_extend(gt_condenseq_unique_encseq(ces), queries,
+                                 arguments, arguments->cminidentity,
+                                 GT_UWORD_MAX, NULL, ces_se_collect_coarse,
+                                 &collector, logger, err);
+    gt_logger_log(logger, GT_WU " coarse hits",
+                  gt_array_size(collector.hits));
+  }
+
+  /* expand coarse hits to all redundant ranges */
+  if (!had_err) {
+    GtUword idx;
+    if (timer != NULL)
+      gt_timer_show_progress(timer, "identify ranges", stderr);
+    for (idx = 0; !had_err && idx < gt_array_size(collector.hits); idx++) {
+      const CesSeCoarseHit *hit = gt_array_get(collector.hits, idx);
+      if (gt_condenseq_each_redundant_range(ces, hit->uid, hit->range,
+                                            hit->extend, hit->extend,
+                                            ces_se_add_range, ranges,
+                                            err) == 0)
+        had_err = -1;
+    }
+    ces_se_join_ranges(ranges);
+    gt_logger_log(logger, GT_WU " ranges to search", gt_array_size(ranges));
+    gt_array_delete(collector.hits);
+    collector.hits = NULL;
+  }
+
+  /* fine search on the decompressed ranges */
+  if (!had_err && gt_array_size(ranges) > 0) {
+    GtEncseqBuilder *eb = gt_encseq_builder_new(alphabet);
+    GtUword idx;
+    if (timer != NULL)
+      gt_timer_show_progress(timer, "extract ranges", stderr);
+    gt_encseq_builder_enable_multiseq_support(eb);
+    for (idx = 0; idx < gt_array_size(ranges); idx++) {
+      const CesSeFineRange *range = gt_array_get(ranges, idx);
+      gt_encseq_builder_add_encoded_own(eb,
+                                        gt_condenseq_extract_encoded_range(
+                                                                ces,
+                                                                range->range),
+                                        gt_range_length(&range->range),
+                                        NULL);
+    }
+    fine_es = gt_encseq_builder_build(eb, err);
+    if (fine_es == NULL)
+      had_err = -1;
+    gt_encseq_builder_delete(eb);
+    if (!had_err) {
+      if (timer != NULL)
+        gt_timer_show_progress(timer, "fine search", stderr);
+      collector.hits = gt_array_new(sizeof (CesSeFineHit));
+      had_err = ces_se_seed_extend(fine_es, queries, arguments,
+                                   arguments->minidentity,
+                                   arguments->alignlength, display_flag,
+                                   ces_se_collect_fine, &collector, logger,
+                                   err);
+    }
+    if (!had_err) {
+      gt_logger_log(logger, GT_WU " hits found",
+                    gt_array_size(collector.hits));
+      ces_se_show_fine_hits(ces, queries, ranges, collector.hits,
+                            arguments->outfp);
+    }
+  }
+
+  if (!had_err && timer != NULL)
+    gt_timer_show_progress_final(timer, stderr);
+  gt_timer_delete(timer);
+  gt_array_delete(collector.hits);
+  gt_mutex_delete(collector.mutex);
+  gt_array_delete(ranges);
+  gt_querymatch_display_flag_delete(display_flag);
+  gt_encseq_delete(fine_es);
+  gt_encseq_delete(queries);
+  gt_alphabet_delete(alphabet);
+  gt_condenseq_delete(ces);
+  gt_logger_delete(logger);
+  return had_err;
+}
+
+GtTool* gt_condenseq_seedextend(void)
+{
+  return gt_tool_new(gt_condenseq_seedextend_arguments_new,
+                     gt_condenseq_seedextend_arguments_delete,
+                     gt_condenseq_seedextend_option_parser_new,
+                     NULL,
+                     gt_condenseq_seedextend_runner);
+}
@@ -18,10 +18,15 @@
 #include "core/encseq.h"
 #include "core/ma_api.h"
 #include "core/md5_fingerprint_api.h"
+#include "core/multithread_api.h"
 #include "core/output_file_api.h"
+#include "core/thread_api.h"
 #include "core/unused_api.h"
 #include "tools/gt_encseq_md5.h"
 
+/* number of sequences fingerprinted by a thread before it fetches more work */
+#define GT_ENCSEQ_MD5_CHUNK_SIZE 64UL
+
 typedef struct {
   GtOutputFileInfo *ofi;
   GtFile *outfp;
@@ -67,6 +72,54 @@ static GtOptionParser* gt_encseq_md5_option_parser_new(void *tool_arguments)
   return op;
 }
 
+typedef struct {
+  const GtEncseq *encseq;
+  char **md5strs;
+  GtUword numofseqs,
+          nextseq;
+  GtMutex *mutex;
+} GtEncseqMD5ThreadInfo;
+
+static void *gt_encseq_md5_thread_func(void *data)
+{
+  GtEncseqMD5ThreadInfo *info = data;
+  GtEncseqReader *esr = NULL;
+  char *seq = NULL;
+  GtUword i, start, end, len, allocated = 0;
+
+  while (true) {
+    gt_mutex_lock(info->mutex);
+    start = info->nextseq;
+    end = start + GT_ENCSEQ_MD5_CHUNK_SIZE < info->numofseqs
+            ? start + GT_ENCSEQ_MD5_CHUNK_SIZE
+            : info->numofseqs;
+    info->nextseq = end;
+    gt_mutex_unlock(info->mutex);
+    if (start == end)
+      break;
+    for (i = start; i < end; i++) {
+      len = gt_encseq_seqlength(info->encseq, i);
+      if (len > allocated) {
+        allocated = len;
+        seq = gt_realloc(seq, allocated * sizeof (char));
+      }
+      if (len > 0) {
+        GtUword seqstart = gt_encseq_seqstartpos(info->encseq, i);
+        if (esr == NULL)
+          esr = gt_encseq_create_reader_with_readmode(info->encseq,
+                                                      GT_READMODE_FORWARD,
+                                                      seqstart);
+        gt_encseq_extract_decoded_with_reader(esr, info->encseq, seq,
+                                              seqstart, seqstart + len - 1);
+      }
+      info->md5strs[i] = gt_md5_fingerprint(seq, len);
+    }
+  }
+  gt_encseq_reader_delete(esr);
+  gt_free(seq);
+  return NULL;
+}
+
 static int gt_encseq_md5_runner(GT_UNUSED int argc, const char **argv,
                            int parsed_args, void *tool_arguments,
                            GtError *err)
@@ -105,20 +158,25 @@ static int gt_encseq_md5_runner(GT_UNUSED int argc, const char **argv,
         } else had_err = -1;
       }
     } else {
-      char *seq,
-           *md5str;
-      for (i = 0; i < gt_encseq_num_of_sequences(encseq); i++) {
-        GtUword len, start, end;
-        len = gt_encseq_seqlength(encseq, i);
-        start = gt_encseq_seqstartpos(encseq, i);
-        end = len + start -1;
-        seq = gt_malloc(len * sizeof (char));
-        gt_encseq_extract_decoded(encseq, seq, start, end);
-        md5str = gt_md5_fingerprint(seq, len);
-        gt_file_xprintf(arguments->outfp, ""GT_WU": %s\n", i, md5str);
-        gt_free(seq);
-        gt_free(md5str);
+      GtEncseqMD5ThreadInfo info;
+
+      /* the sequences are fingerprinted by gt_jobs threads, the output is
+         written afterwards in order */
+      info.encseq = encseq;
+      info.numofseqs = gt_encseq_num_of_sequences(encseq);
+      info.nextseq = 0;
+      info.md5strs = gt_calloc((size_t) info.numofseqs,
+                               sizeof (*info.md5strs));
+      info.mutex = gt_mutex_new();
+      had_err = gt_multithread(gt_encseq_md5_thread_func, &info, err);
+      for (i = 0; i < info.numofseqs; i++) {
+        if (!had_err)
+          gt_file_xprintf(arguments->outfp, ""GT_WU": %s\n", i,
+                          info.md5strs[i]);
+        gt_free(info.md5strs[i]);
       }
+      gt_mutex_delete(info.mutex);
+      gt_free(info.md5strs);
     }
   }
   gt_encseq_delete(encseq);
@@ -24,6 +24,7 @@
 #include "extended/anno_db_gfflike_api.h"
 #include "extended/anno_db_schema_api.h"
 #include "extended/feature_index_api.h"
+#include "extended/feature_index_mmap_api.h"
 #include "extended/feature_node.h"
 #include "extended/feature_stream_api.h"
 #include "extended/gff3_visitor.h"
@@ -38,6 +39,7 @@
 
 #define GT_SQLITE_BACKEND_STRING "sqlite"
 #define GT_MYSQL_BACKEND_STRING  "mysql"
+#define GT_MMAP_BACKEND_STRING   "mmap"
 
 typedef struct {
   GtRange qry_rng;
@@ -95,6 +97,7 @@ static GtOptionParser* gt_featureindex_option_parser_new(void *tool_arguments)
 #ifdef HAVE_MYSQL
     GT_MYSQL_BACKEND_STRING,
 #endif
+    GT_MMAP_BACKEND_STRING,
     NULL
   };
   gt_assert(arguments);
@@ -121,12 +124,12 @@ static GtOptionParser* gt_featureindex_option_parser_new(void *tool_arguments)
   backend_option = gt_option_new_choice("backend", "database backend to use\n"
                                         "choose from ["
 #ifdef HAVE_SQLITE
-                                         GT_SQLITE_BACKEND_STRING
+                                        GT_SQLITE_BACKEND_STRING "|"
 #endif
 #ifdef HAVE_MYSQL
-                                        "|" GT_MYSQL_BACKEND_STRING
+                                        GT_MYSQL_BACKEND_STRING "|"
 #endif
-                                        "]",
+                                        GT_MMAP_BACKEND_STRING "]",
                                         arguments->backend, backends[0],
                                         backends);
   gt_option_parser_add_option(op, backend_option);
@@ -134,7 +137,7 @@ static GtOptionParser* gt_featureindex_option_parser_new(void *tool_arguments)
   /* -filename */
   filenameoption = gt_option_new_string("filename",
                                         "filename for feature database "
-                                        "(sqlite backend only)",
+                                        "(sqlite and mmap backends only)",
                                         arguments->filename, NULL);
   gt_option_parser_add_option(op, filenameoption);
 
@@ -209,11 +212,19 @@ static int gt_featureindex_runner(GT_UNUSED int argc,
   GtNodeVisitor *gff3visitor = NULL;
   GtGenomeNode *regn = NULL;
   GtUword i = 0;
+  bool mmap_backend;
   int had_err = 0;
 
   gt_error_check(err);
   gt_assert(arguments);
 
+  mmap_backend = strcmp(gt_str_get(arguments->backend),
+                        GT_MMAP_BACKEND_STRING) == 0;
+  if (mmap_backend) {
+    fi = gt_feature_index_mmap_open(gt_str_get(arguments->filename), err);
+    if (!fi)
+      had_err = -1;
+  }
 #ifdef HAVE_SQLITE
   if (!had_err) {
     if (strcmp(gt_str_get(arguments->backend),
@@ -247,13 +258,13 @@ static int gt_featureindex_runner(GT_UNUSED int argc,
     }
   }
 #endif
-  if (!had_err)
+  if (!had_err && !mmap_backend)
     adbs = gt_anno_db_gfflike_new();
 
-  if (!had_err && !adbs)
+  if (!had_err && !mmap_backend && !adbs)
     had_err = -1;
 
-  if (!had_err) {
+  if (!had_err && !mmap_backend) {
     fi = gt_anno_db_schema_get_feature_index(adbs, rdb, err);
     had_err = fi ? 0 : -1;
   }
@@ -316,7 +327,9 @@ static int gt_featureindex_runner(GT_UNUSED int argc,
         }
       }
       gt_genome_node_accept(gn, gff3visitor, err);
-      gt_genome_node_delete(gn);
+      /* the mmap backend keeps the nodes it returns */
+      if (!mmap_backend)
+        gt_genome_node_delete(gn);
     }
   }
 
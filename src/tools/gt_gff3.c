@@ -22,6 +22,7 @@
 #include "core/undef_api.h"
 #include "core/versionfunc_api.h"
 #include "extended/add_introns_stream_api.h"
+#include "extended/binary_out_stream.h"
 #include "extended/genome_node.h"
 #include "extended/gff3_defines.h"
 #include "extended/gff3_in_stream.h"
@@ -53,10 +54,12 @@ typedef struct {
        strict,
        tidy,
        show,
+       binary,
        fixboundaries;
   GtWord offset;
   GtStr *offsetfile, *newsource;
-  GtUword width;
+  GtUword width,
+          sortmaxnodes;
   GtTypecheckInfo *tci;
   GtXRFCheckInfo *xci;
   GtOutputFileInfo *ofi;
@@ -92,9 +95,10 @@ static GtOptionParser* gt_gff3_option_parser_new(void *tool_arguments)
   GFF3Arguments *arguments = tool_arguments;
   GtOptionParser *op;
   GtOption *sort_option, *load_option, *strict_option, *tidy_option,
+           *sortmaxnodes_option,
            *mergefeat_option, *addintrons_option, *offset_option,
            *offsetfile_option, *setsource_option, *sortlines_option,
-           *sortnum_option, *option;
+           *sortnum_option, *binary_option, *option;
   gt_assert(arguments);
 
   /* init */
@@ -123,6 +127,18 @@ static GtOptionParser* gt_gff3_option_parser_new(void *tool_arguments)
   gt_option_parser_add_option(op, sortnum_option);
   gt_option_exclude(sortlines_option, sortnum_option);
 
+  /* -sortmaxnodes */
+  sortmaxnodes_option = gt_option_new_uword("sortmaxnodes", "when sorting, "
+                                            "keep at most the given number of "
+                                            "nodes in memory and sort larger "
+                                            "inputs in runs which are stored "
+                                            "in temporary files and merged "
+                                            "(0 = sort in memory)",
+                                            &arguments->sortmaxnodes, 0);
+  gt_option_parser_add_option(op, sortmaxnodes_option);
+  gt_option_imply_either_3(sortmaxnodes_option, sort_option, sortlines_option,
+                           sortnum_option);
+
   /* -strict */
   strict_option = gt_option_new_bool("strict", "be very strict during GFF3 "
                                      "parsing (stricter than the specification "
@@ -226,6 +242,15 @@ static GtOptionParser* gt_gff3_option_parser_new(void *tool_arguments)
                               true);
   gt_option_parser_add_option(op, option);
 
+  /* -binary */
+  binary_option = gt_option_new_bool("binary", "show output in the compact "
+                                     "binary format instead of GFF3 (can be "
+                                     "read back by all tools which read GFF3)",
+                                     &arguments->binary, false);
+  gt_option_parser_add_option(op, binary_option);
+  gt_option_exclude(binary_option, sortlines_option);
+  gt_option_exclude(binary_option, sortnum_option);
+
   /* -v */
   option = gt_option_new_verbose(&arguments->verbose);
   gt_option_parser_add_option(op, option);
@@ -322,6 +347,8 @@ static int gt_gff3_runner(int argc, const char **argv, int parsed_args,
   if (!had_err && (arguments->sort || arguments->sortlines ||
                    arguments->sortnum)) {
     sort_stream = gt_sort_stream_new(last_stream);
+    gt_sort_stream_set_max_nodes((GtSortStream*) sort_stream,
+                                 arguments->sortmaxnodes);
     last_stream = sort_stream;
   }
 
@@ -349,7 +376,10 @@ static int gt_gff3_runner(int argc, const char **argv, int parsed_args,
 
   /* create gff3 output stream */
   if (!had_err && arguments->show) {
-    if (arguments->sortlines) {
+    if (arguments->binary) {
+      gff3_out_stream = gt_binary_out_stream_new(last_stream,
+                                                 arguments->outfp);
+    } else if (arguments->sortlines) {
       gff3_out_stream = gt_gff3_linesorted_out_stream_new(last_stream,
                                                           arguments->outfp);
       gt_gff3_linesorted_out_stream_set_fasta_width(
@@ -34,6 +34,7 @@
 #include "core/timer_api.h"
 #include "core/types_api.h"
 #include "core/unused_api.h"
+#include "extended/alignment_batch.h"
 #include "extended/diagonalbandalign.h"
 #include "extended/diagonalbandalign_affinegapcost.h"
 #include "extended/linearalign.h"
@@ -69,7 +70,8 @@ typedef struct{
              showsequences,
              scoreonly, /* dev option generate alignment, but do not show it*/
              wildcardshow, /* show symbol wildcards in output*/
-             spacetime; /* write space peak and time overall on stdout*/
+             spacetime, /* write space peak and time overall on stdout*/
+             batch; /* align i-th sequences of both files in parallel */
   GtUword timesquarefactor; /*factor to specified termination of recursion
                               and call 2dim algorithm */
 } GtLinspaceArguments;
@@ -139,7 +141,7 @@ static GtOptionParser* gt_linspace_align_option_parser_new(void *tool_arguments)
            *optionaffinecosts, *optionoutputfile, *optionshowscore,
            *optionshowsequences, *optiondiagonal, *optiondiagonalbonds,
            *optionsimilarity, *optiontsfactor, *optionspacetime,
-           *optionscoreonly, *optionwildcardsymbol;
+           *optionscoreonly, *optionwildcardsymbol, *optionbatch;
 
   gt_assert(arguments);
 
@@ -207,6 +209,13 @@ static GtOptionParser* gt_linspace_align_option_parser_new(void *tool_arguments)
                                        &arguments->spacetime, false);
   gt_option_parser_add_option(op, optionspacetime);
 
+  optionbatch = gt_option_new_bool("batch", "align the i-th sequence of the "
+                                   "first file with the i-th sequence of the "
+                                   "second file instead of all against all, "
+                                   "distributing the pairs over all threads",
+                                   &arguments->batch, false);
+  gt_option_parser_add_option(op, optionbatch);
+
   /* -str */
   optionstrings = gt_option_new_string_array("ss", "input, use two strings",
                                              arguments->strings);
@@ -277,6 +286,8 @@ static GtOptionParser* gt_linspace_align_option_parser_new(void *tool_arguments)
   gt_option_imply(optiondiagonalbonds, optiondiagonal);
   gt_option_imply(optionsimilarity, optiondiagonal);
   gt_option_imply(optioncostmatrix, optionprotein);
+  gt_option_imply(optionbatch, optionfiles);
+  gt_option_exclude(optionbatch, optiondiagonal);
 
   /* extended options */
   gt_option_is_extended_option(optiontsfactor);
@@ -613,6 +624,91 @@ static int gt_all_against_all_alignment_check(bool affine,
   return had_err;
 }
 
+/* align the i-th sequence of <sequence_table1> with the i-th sequence of
+   <sequence_table2> for all i, using all threads (-batch) */
+static int gt_pairwise_batch_alignment(bool affine,
+                                       const GtLinspaceArguments *arguments,
+                                       const GtScoreHandler *scorehandler,
+                                       const GtUchar *characters,
+                                       GtUchar wildcardshow,
+                                       const GtSequenceTable *sequence_table1,
+                                       const GtSequenceTable *sequence_table2,
+                                       size_t *spacepeak,
+                                       GtTimer *linspacetimer,
+                                       GtError *err)
+{
+  int had_err = 0;
+  GtUword idx;
+  GtAlignmentBatch *batch;
+  FILE *fp = stdout;
+
+  gt_error_check(err);
+  if (sequence_table1->size != sequence_table2->size)
+  {
+    gt_error_set(err, "option -batch requires the same number of sequences "
+                      "in both files, but the files contain " GT_WU " and "
+                      GT_WU " sequences", sequence_table1->size,
+                      sequence_table2->size);
+    return -1;
+  }
+  if (linspacetimer != NULL)
+  {
+    gt_timer_start(linspacetimer);
+  }
+  batch = gt_alignment_batch_new(scorehandler, arguments->global, affine,
+                                 arguments->timesquarefactor);
+  for (idx = 0; idx < sequence_table1->size; idx++)
+  {
+    gt_alignment_batch_add(batch,
+                           (const GtUchar *)
+                           gt_str_get(sequence_table1->seqarray[idx]),
+                           gt_str_length(sequence_table1->seqarray[idx]),
+                           (const GtUchar *)
+                           gt_str_get(sequence_table2->seqarray[idx]),
+                           gt_str_length(sequence_table2->seqarray[idx]));
+  }
+  had_err = gt_alignment_batch_run(batch, err);
+  if (linspacetimer != NULL)
+  {
+    gt_timer_stop(linspacetimer);
+  }
+  if (!had_err && strcmp(gt_str_get(arguments->outputfile),"stdout") != 0)
+  {
+    fp = gt_fa_fopen_func(gt_str_get(arguments->outputfile), "a",
+                          __FILE__,__LINE__,err);
+    if (fp == NULL)
+    {
+      had_err = -1;
+    }
+  }
+  for (idx = 0; !had_err && idx < sequence_table1->size; idx++)
+  {
+    alignment_show_with_sequences((const GtUchar *)
+                                  gt_str_get(sequence_table1->seqarray[idx]),
+                                  gt_str_length(sequence_table1->seqarray[idx]),
+                                  (const GtUchar *)
+                                  gt_str_get(sequence_table2->seqarray[idx]),
+                                  gt_str_length(sequence_table2->seqarray[idx]),
+                                  gt_alignment_batch_get(batch, idx),
+                                  characters, wildcardshow,
+                                  arguments->showscore,
+                                  !arguments->scoreonly,
+                                  arguments->showsequences,
+                                  arguments->global, scorehandler, fp);
+  }
+  if (fp != stdout)
+  {
+    gt_fa_fclose(fp);
+  }
+  if (!had_err && arguments->wildcardshow)
+  {
+    printf("# wildcards are represented by %c\n", wildcardshow);
+  }
+  *spacepeak = gt_alignment_batch_get_spacepeak(batch);
+  gt_alignment_batch_delete(batch);
+  return had_err;
+}
+
 /* handle score and cost values */
 static GtScoreHandler *gt_arguments2scorehandler(
                              const GtLinspaceArguments *arguments,
@@ -747,6 +843,7 @@ static int gt_linspace_align_runner(GT_UNUSED int argc,
   GtScoreHandler *scorehandler = NULL;
   GtTimer *linspacetimer = NULL;
   GtAlphabet *alphabet = NULL;
+  size_t spacepeak = 0;
 
   gt_error_check(err);
   gt_assert(arguments);
@@ -834,23 +931,37 @@ static int gt_linspace_align_runner(GT_UNUSED int argc,
       gt_assert(gt_str_array_size(arguments->affinecosts) > 0);
       affine = true;
     }
-    had_err = gt_all_against_all_alignment_check (
-                            affine, align, arguments,
-                            spacemanager,
-                            scorehandler,
-                            gt_alphabet_characters(alphabet),
-                            gt_alphabet_wildcard_show(alphabet),
-                            sequence_table1,
-                            sequence_table2,
-                            left_dist,
-                            right_dist,
-                            linspacetimer,err);
+    if (arguments->batch)
+    {
+      had_err = gt_pairwise_batch_alignment(affine, arguments,
+                                            scorehandler,
+                                            gt_alphabet_characters(alphabet),
+                                            gt_alphabet_wildcard_show(alphabet),
+                                            sequence_table1,
+                                            sequence_table2,
+                                            &spacepeak,
+                                            linspacetimer, err);
+    } else
+    {
+      had_err = gt_all_against_all_alignment_check (
+                              affine, align, arguments,
+                              spacemanager,
+                              scorehandler,
+                              gt_alphabet_characters(alphabet),
+                              gt_alphabet_wildcard_show(alphabet),
+                              sequence_table1,
+                              sequence_table2,
+                              left_dist,
+                              right_dist,
+                              linspacetimer,err);
+      spacepeak = gt_linspace_management_get_spacepeak(spacemanager);
+    }
   }
   /*spacetime option*/
   if (!had_err && arguments->spacetime)
   {
     printf("# combined space peak in kilobytes: %f\n",
-           GT_KILOBYTES(gt_linspace_management_get_spacepeak(spacemanager)));
+           GT_KILOBYTES(spacepeak));
     gt_timer_show_formatted(linspacetimer,"# TIME overall " GT_WD ".%02ld\n",
                             stdout);
   }
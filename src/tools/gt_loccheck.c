@@ -18,7 +18,7 @@
 #include "core/unused_api.h"
 #include "extended/check_boundaries_visitor_api.h"
 #include "extended/gff3_in_stream.h"
-#include "extended/visitor_stream.h"
+#include "extended/parallel_visitor_stream_api.h"
 #include "tools/gt_loccheck.h"
 
 typedef struct {
@@ -46,8 +46,8 @@ static int gt_loccheck_runner(int argc, const char **argv, int parsed_args,
   gff3_in_stream = gt_gff3_in_stream_new_unsorted(argc - parsed_args,
                                                   argv + parsed_args);
 
-  checker_stream = gt_visitor_stream_new(gff3_in_stream,
-                                         gt_check_boundaries_visitor_new());
+  checker_stream = gt_parallel_visitor_stream_new(gff3_in_stream,
+                                             gt_check_boundaries_visitor_new());
   gt_assert(checker_stream);
 
   /* pull the features through the stream and free them afterwards */
@@ -24,6 +24,7 @@
 #include "extended/anno_db_gfflike_api.h"
 #include "extended/bed_in_stream.h"
 #include "extended/feature_index_api.h"
+#include "extended/feature_index_mmap_api.h"
 #include "extended/feature_stream_api.h"
 #include "extended/gff3_in_stream.h"
 #include "extended/gtf_in_stream.h"
@@ -37,6 +38,7 @@
 
 #define GT_SQLITE_BACKEND_STRING "sqlite"
 #define GT_MYSQL_BACKEND_STRING  "mysql"
+#define GT_MMAP_BACKEND_STRING   "mmap"
 
 typedef struct {
   GtStr *backend,
@@ -84,10 +86,13 @@ static GtOptionParser* gt_mkfeatureindex_option_parser_new(void *tool_arguments)
   GtOptionParser *op;
   GtOption *option, *backend_option, *filenameoption;
   static const char *backends[] = {
+#ifdef HAVE_SQLITE
     GT_SQLITE_BACKEND_STRING,
+#endif
 #ifdef HAVE_MYSQL
     GT_MYSQL_BACKEND_STRING,
 #endif
+    GT_MMAP_BACKEND_STRING,
     NULL
   };
   static const char *inputs[] = {
@@ -111,12 +116,12 @@ static GtOptionParser* gt_mkfeatureindex_option_parser_new(void *tool_arguments)
   backend_option = gt_option_new_choice("backend", "database backend to use\n"
                                         "choose from ["
 #ifdef HAVE_SQLITE
-                                        GT_SQLITE_BACKEND_STRING
+                                        GT_SQLITE_BACKEND_STRING "|"
 #endif
 #ifdef HAVE_MYSQL
-                                        "|" GT_MYSQL_BACKEND_STRING
+                                        GT_MYSQL_BACKEND_STRING "|"
 #endif
-                                        "]",
+                                        GT_MMAP_BACKEND_STRING "]",
                                         arguments->backend, backends[0],
                                         backends);
   gt_option_parser_add_option(op, backend_option);
@@ -130,7 +135,7 @@ static GtOptionParser* gt_mkfeatureindex_option_parser_new(void *tool_arguments)
   /* -filename */
   filenameoption = gt_option_new_string("filename",
                                         "filename for feature database "
-                                        "(sqlite backend only)",
+                                        "(sqlite and mmap backends only)",
                                         arguments->filename, NULL);
   gt_option_parser_add_option(op, filenameoption);
 
@@ -190,11 +195,23 @@ static int gt_mkfeatureindex_runner(int argc,
   GtRDB *rdb = NULL;
   GtAnnoDBSchema *adb = NULL;
   GtFeatureIndex *fis = NULL;
+  bool mmap_backend;
   int had_err = 0;
 
   gt_error_check(err);
   gt_assert(arguments);
 
+  mmap_backend = strcmp(gt_str_get(arguments->backend),
+                        GT_MMAP_BACKEND_STRING) == 0;
+  if (mmap_backend) {
+    if (gt_file_exists(gt_str_get(arguments->filename)) && !arguments->force) {
+      gt_error_set(err, "file \"%s\" exists already. use option -force to "
+                   "overwrite", gt_str_get(arguments->filename));
+      had_err = -1;
+    }
+    if (!had_err)
+      fis = gt_feature_index_mmap_new(gt_str_get(arguments->filename));
+  }
 #ifdef HAVE_SQLITE
   if (strcmp(gt_str_get(arguments->backend),
              GT_SQLITE_BACKEND_STRING) == 0) {
@@ -229,11 +246,13 @@ static int gt_mkfeatureindex_runner(int argc,
   }
 #endif
 
-  adb = gt_anno_db_gfflike_new();
-  if (!had_err && !adb)
-    had_err = -1;
+  if (!had_err && !mmap_backend) {
+    adb = gt_anno_db_gfflike_new();
+    if (!adb)
+      had_err = -1;
+  }
 
-  if (!had_err) {
+  if (!had_err && !mmap_backend) {
     fis = gt_anno_db_schema_get_feature_index(adb, rdb, err);
     if (!fis)
       had_err = -1;
@@ -264,6 +283,8 @@ static int gt_mkfeatureindex_runner(int argc,
     feature_stream = gt_feature_stream_new(in_stream, fis);
     had_err = gt_node_stream_pull(feature_stream, err);
   }
+  if (!had_err && mmap_backend)
+    had_err = gt_feature_index_save(fis, err);
   gt_node_stream_delete(feature_stream);
   gt_node_stream_delete(in_stream);
   gt_feature_index_delete(fis);
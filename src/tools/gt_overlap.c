@@ -0,0 +1,275 @@
+/*
+  Copyright (c) 2026 agent <agent@local>
+
+  Permission to use, copy, modify, and distribute this software for any
+  purpose with or without fee is hereby granted, provided that the above
+  copyright notice and this permission notice appear in all copies.
+
+  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+
+
+#include <string.h>
+#include "core/ma_api.h"
+#include "core/option_api.h"
+#include "core/output_file_api.h"
+#include "core/strand_api.h"
+#include "core/unused_api.h"
+#include "extended/bed_in_stream_api.h"
+#include "extended/feature_node_iterator_api.h"
+#include "extended/gff3_defines.h"
+#include "extended/gff3_in_stream_api.h"
+#include "extended/gff3_out_stream_api.h"
+#include "extended/overlap_stream_api.h"
+#include "extended/sort_stream_api.h"
+#include "tools/gt_overlap.h"
+
+#define GT_OVERLAP_MODE_COUNT "count"
+#define GT_OVERLAP_MODE_JOIN  "join"
+#define GT_OVERLAP_FORMAT_GFF "gff"
+#define GT_OVERLAP_FORMAT_BED "bed"
+
+typedef struct {
+  GtStr *mode,
+        *attribute,
+        *format_a,
+        *format_b;
+  bool sort,
+       retain_ids;
+  GtOutputFileInfo *ofi;
+  GtFile *outfp;
+} OverlapArguments;
+
+static void* gt_overlap_arguments_new(void)
+{
+  OverlapArguments *arguments = gt_calloc(1, sizeof *arguments);
+  arguments->mode = gt_str_new();
+  arguments->attribute = gt_str_new();
+  arguments->format_a = gt_str_new();
+  arguments->format_b = gt_str_new();
+  arguments->ofi = gt_output_file_info_new();
+  return arguments;
+}
+
+static void gt_overlap_arguments_delete(void *tool_arguments)
+{
+  OverlapArguments *arguments = tool_arguments;
+  if (!arguments) return;
+  gt_file_delete(arguments->outfp);
+  gt_output_file_info_delete(arguments->ofi);
+  gt_str_delete(arguments->format_b);
+  gt_str_delete(arguments->format_a);
+  gt_str_delete(arguments->attribute);
+  gt_str_delete(arguments->mode);
+  gt_free(arguments);
+}
+
+static GtOptionParser* gt_overlap_option_parser_new(void *tool_arguments)
+{
+  OverlapArguments *arguments = tool_arguments;
+  GtOptionParser *op;
+  GtOption *option;
+  static const char *modes[] = {
+    GT_OVERLAP_MODE_COUNT,
+    GT_OVERLAP_MODE_JOIN,
+    NULL
+  },
+                    *formats[] = {
+    GT_OVERLAP_FORMAT_GFF,
+    GT_OVERLAP_FORMAT_BED,
+    NULL
+  };
+  gt_assert(arguments);
+
+  /* init */
+  op = gt_option_parser_new("[option ...] file_A file_B",
+                            "Join the features in file_A with the "
+                            "overlapping features in file_B.\n"
+                            "Both files must be sorted (see option -sort).");
+
+  /* -mode */
+  option = gt_option_new_choice("mode", "output mode\n"
+                                "count: output the features of file_A as "
+                                "GFF3, annotated with the number of "
+                                "overlapping features of file_B\n"
+                                "join: output each pair of overlapping "
+                                "features as a tab separated line\n"
+                                "choose from [" GT_OVERLAP_MODE_COUNT "|"
+                                GT_OVERLAP_MODE_JOIN "]",
+                                arguments->mode, modes[0], modes);
+  gt_option_parser_add_option(op, option);
+
+  /* -attribute */
+  option = gt_option_new_string("attribute", "attribute name used in count "
+                                "mode", arguments->attribute, "overlaps");
+  gt_option_parser_add_option(op, option);
+
+  /* -aformat */
+  option = gt_option_new_choice("aformat", "format of file_A\n"
+                                "choose from [" GT_OVERLAP_FORMAT_GFF "|"
+                                GT_OVERLAP_FORMAT_BED "]",
+                                arguments->format_a, formats[0], formats);
+  gt_option_parser_add_option(op, option);
+
+  /* -bformat */
+  option = gt_option_new_choice("bformat", "format of file_B\n"
+                                "choose from [" GT_OVERLAP_FORMAT_GFF "|"
+                                GT_OVERLAP_FORMAT_BED "]",
+                                arguments->format_b, formats[0], formats);
+  gt_option_parser_add_option(op, option);
+
+  /* -sort */
+  option = gt_option_new_bool("sort", "sort the input files in memory before "
+                              "joining them", &arguments->sort, false);
+  gt_option_parser_add_option(op, option);
+
+  /* -retainids */
+  option = gt_option_new_bool("retainids", "when available, use the original "
+                              "IDs provided in the source file in count mode",
+                              &arguments->retain_ids, false);
+  gt_option_parser_add_option(op, option);
+
+  /* output file options */
+  gt_output_file_info_register_options(arguments->ofi, op, &arguments->outfp);
+
+  gt_option_parser_set_min_max_args(op, 2, 2);
+
+  return op;
+}
+
+static int gt_overlap_arguments_check(GT_UNUSED int rest_argc,
+                                      void *tool_arguments, GtError *err)
+{
+  OverlapArguments *arguments = tool_arguments;
+  gt_error_check(err);
+  gt_assert(arguments);
+  if (!gt_str_length(arguments->attribute)) {
+    gt_error_set(err, "argument to option -attribute must not be empty");
+    return -1;
+  }
+  return 0;
+}
+
+static GtNodeStream* gt_overlap_in_stream_new(const char *filename,
+                                              GtStr *format, bool sort)
+{
+  GtNodeStream *in_stream, *sort_stream;
+  if (!strcmp(gt_str_get(format), GT_OVERLAP_FORMAT_BED))
+    in_stream = gt_bed_in_stream_new(filename);
+  else if (sort)
+    in_stream = gt_gff3_in_stream_new_unsorted(1, &filename);
+  else
+    return gt_gff3_in_stream_new_sorted(filename);
+  if (!sort)
+    return in_stream;
+  sort_stream = gt_sort_stream_new(in_stream);
+  gt_node_stream_delete(in_stream);
+  return sort_stream;
+}
+
+/* pseudo-features are represented by their first child */
+static GtFeatureNode* gt_overlap_representative(GtFeatureNode *fn)
+{
+  GtFeatureNodeIterator *fni;
+  GtFeatureNode *child;
+  if (!gt_feature_node_is_pseudo(fn))
+    return fn;
+  fni = gt_feature_node_iterator_new_direct(fn);
+  child = gt_feature_node_iterator_next(fni);
+  gt_feature_node_iterator_delete(fni);
+  gt_assert(child);
+  return child;
+}
+
+static void gt_overlap_show_feature(GtFeatureNode *fn, GtFile *outfp)
+{
+  GtGenomeNode *gn = (GtGenomeNode*) fn;
+  GtFeatureNode *rep = gt_overlap_representative(fn);
+  const char *id = gt_feature_node_get_attribute(rep, GT_GFF_ID);
+  if (!id)
+    id = gt_feature_node_get_attribute(rep, GT_GFF_NAME);
+  gt_file_xprintf(outfp, GT_WU "\t" GT_WU "\t%c\t%s\t%s",
+                  gt_genome_node_get_start(gn), gt_genome_node_get_end(gn),
+                  GT_STRAND_CHARS[gt_feature_node_get_strand(fn)],
+                  gt_feature_node_get_type(rep), id ? id : ".");
+}
+
+static int gt_overlap_show_pair(GtFeatureNode *a, GtFeatureNode *b,
+                                void *data, GT_UNUSED GtError *err)
+{
+  GtFile *outfp = data;
+  gt_error_check(err);
+  gt_file_xprintf(outfp, "%s\t",
+                  gt_str_get(gt_genome_node_get_seqid((GtGenomeNode*) a)));
+  gt_overlap_show_feature(a, outfp);
+  gt_file_xfputc('\t', outfp);
+  gt_overlap_show_feature(b, outfp);
+  gt_file_xfputc('\n', outfp);
+  return 0;
+}
+
+static int gt_overlap_runner(GT_UNUSED int argc, const char **argv,
+                             int parsed_args, void *tool_arguments,
+                             GtError *err)
+{
+  OverlapArguments *arguments = tool_arguments;
+  GtNodeStream *in_stream_a,
+               *in_stream_b,
+               *overlap_stream,
+               *gff3_out_stream = NULL;
+  int had_err;
+
+  gt_error_check(err);
+  gt_assert(arguments);
+
+  /* create the input streams */
+  in_stream_a = gt_overlap_in_stream_new(argv[parsed_args],
+                                         arguments->format_a, arguments->sort);
+  in_stream_b = gt_overlap_in_stream_new(argv[parsed_args + 1],
+                                         arguments->format_b, arguments->sort);
+
+  /* create overlap stream */
+  overlap_stream = gt_overlap_stream_new(in_stream_a, in_stream_b);
+
+  if (!strcmp(gt_str_get(arguments->mode), GT_OVERLAP_MODE_JOIN)) {
+    gt_overlap_stream_set_pair_func((GtOverlapStream*) overlap_stream,
+                                    gt_overlap_show_pair, arguments->outfp);
+    /* pull the features through the stream and free them afterwards */
+    had_err = gt_node_stream_pull(overlap_stream, err);
+  }
+  else {
+    gt_overlap_stream_set_count_attribute((GtOverlapStream*) overlap_stream,
+                                          gt_str_get(arguments->attribute));
+    /* create gff3 output stream */
+    gff3_out_stream = gt_gff3_out_stream_new(overlap_stream, arguments->outfp);
+    if (arguments->retain_ids) {
+      gt_gff3_out_stream_retain_id_attributes((GtGFF3OutStream*)
+                                              gff3_out_stream);
+    }
+    /* pull the features through the stream and free them afterwards */
+    had_err = gt_node_stream_pull(gff3_out_stream, err);
+  }
+
+  /* free */
+  gt_node_stream_delete(gff3_out_stream);
+  gt_node_stream_delete(overlap_stream);
+  gt_node_stream_delete(in_stream_b);
+  gt_node_stream_delete(in_stream_a);
+
+  return had_err;
+}
+
+GtTool* gt_overlap(void)
+{
+  return gt_tool_new(gt_overlap_arguments_new,
+                     gt_overlap_arguments_delete,
+                     gt_overlap_option_parser_new,
+                     gt_overlap_arguments_check,
+                     gt_overlap_runner);
+}
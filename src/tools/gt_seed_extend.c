@@ -30,8 +30,10 @@
 #include "core/minmax_api.h"
 #include "core/parseutils_api.h"
 #include "core/range_api.h"
+#include "core/seq_iterator_sequence_buffer_api.h"
 #include "core/showtime.h"
 #include "core/str_api.h"
+#include "core/str_array_api.h"
 #include "match/diagbandseed.h"
 #include "match/seed-extend.h"
 #include "match/xdrop.h"
@@ -48,6 +50,8 @@ typedef struct {
   /* diagbandseed options */
   GtStr *dbs_indexname;
   GtStr *dbs_queryname;
+  GtStrArray *dbs_queryfiles;
+  GtUword dbs_querybatchsize;
   unsigned int dbs_spacedseedweight;
   unsigned int dbs_seedlength;
   GtUword dbs_logdiagbandwidth;
@@ -108,6 +112,7 @@ static void* gt_seed_extend_arguments_new(void)
   GtSeedExtendArguments *arguments = gt_calloc((size_t) 1, sizeof *arguments);
   arguments->dbs_indexname = gt_str_new();
   arguments->dbs_queryname = gt_str_new();
+  arguments->dbs_queryfiles = gt_str_array_new();
   arguments->dbs_pick_str = gt_str_new();
   arguments->chainarguments = gt_str_new();
   arguments->diagband_statistics_arg = gt_str_new();
@@ -125,6 +130,7 @@ static void gt_seed_extend_arguments_delete(void *tool_arguments)
   if (arguments != NULL) {
     gt_str_delete(arguments->dbs_indexname);
     gt_str_delete(arguments->dbs_queryname);
+    gt_str_array_delete(arguments->dbs_queryfiles);
     gt_str_delete(arguments->dbs_pick_str);
     gt_str_delete(arguments->chainarguments);
     gt_str_delete(arguments->diagband_statistics_arg);
@@ -147,7 +153,8 @@ static GtOptionParser* gt_seed_extend_option_parser_new(void *tool_arguments)
 {
   GtSeedExtendArguments *arguments = tool_arguments;
   GtOptionParser *op;
-  GtOption *option, *op_gre, *op_xdr, *op_cam, *op_splt, *op_kmplt,
+  GtOption *option, *op_qii, *op_qfile, *op_qbatchsize, *op_gre, *op_xdr,
+    *op_cam, *op_splt, *op_kmplt,
     *op_his, *op_dif, *op_pmh,
     *op_seedlength, *op_spacedseed, *op_minlen, *op_minid, *op_evalue, *op_xbe,
     *op_sup, *op_frq,
@@ -181,12 +188,31 @@ static GtOptionParser* gt_seed_extend_option_parser_new(void *tool_arguments)
   gt_option_parser_add_option(op, option);
 
   /* -qii */
-  option = gt_option_new_string("qii",
+  op_qii = gt_option_new_string("qii",
                                 "Query input index (encseq)",
                                 arguments->dbs_queryname,
                                 "");
-  gt_option_hide_default(option);
-  gt_option_parser_add_option(op, option);
+  gt_option_hide_default(op_qii);
+  gt_option_parser_add_option(op, op_qii);
+
+  /* -qfile */
+  op_qfile = gt_option_new_filename_array("qfile",
+                                          "Query sequence files in FASTA or "
+                                          "FASTQ format, processed in batches "
+                                          "without creating an encseq index",
+                                          arguments->dbs_queryfiles);
+  gt_option_exclude(op_qfile, op_qii);
+  gt_option_parser_add_option(op, op_qfile);
+
+  /* -qbatchsize */
+  op_qbatchsize = gt_option_new_uword_min("qbatchsize",
+                                          "Number of query sequences read "
+                                          "from the files given by option "
+                                          "-qfile and matched in one batch",
+                                          &arguments->dbs_querybatchsize,
+                                          100000UL, 1UL);
+  gt_option_imply(op_qbatchsize, op_qfile);
+  gt_option_parser_add_option(op, op_qbatchsize);
 
   /* -seedlength */
   op_seedlength = gt_option_new_uint_min_max("seedlength",
@@ -619,6 +645,7 @@ static GtOptionParser* gt_seed_extend_option_parser_new(void *tool_arguments)
                                  arguments->dbs_pick_str,
                                  "use all combinations successively");
   gt_option_imply(op_pick, op_part);
+  gt_option_exclude(op_pick, op_qfile);
   gt_option_is_development_option(op_pick);
   gt_option_parser_add_option(op, op_pick);
 
@@ -706,9 +733,17 @@ static int gt_seed_extend_arguments_check(int rest_argc, void *tool_arguments,
   }
 #endif
 
+  /* k-mers of the query batches are never stored; those of the database
+     are kept in memory over all batches */
+  if (gt_str_array_size(arguments->dbs_queryfiles) > 0)
+  {
+    arguments->use_kmerfile = false;
+  }
+
   /* minimum maxfreq value for 1 input file */
   if (!had_err && arguments->dbs_maxfreq == 1 &&
-      strcmp(gt_str_get(arguments->dbs_queryname), "") == 0) {
+      strcmp(gt_str_get(arguments->dbs_queryname), "") == 0 &&
+      gt_str_array_size(arguments->dbs_queryfiles) == 0) {
     if (arguments->dbs_suppress == GT_UWORD_MAX) {
       gt_error_set(err, "argument to option \"-maxfreq\" must be >= 2 to "
                    "find matching k-mers");
@@ -748,211 +783,124 @@ static double gt_seed_extend_ani_evaluate(GtUword sum_of_aligned_len,
              : 0.0;
 }
 
-static int gt_seed_extend_runner(int argc,
-                                 const char **argv,
-                                 GT_UNUSED int parsed_args,
-                                 void *tool_arguments,
-                                 GtError *err)
+/* The properties of the complete set of query sequences, from which the
+   parameters not given by the user are derived. */
+typedef struct
 {
-  GtSeedExtendArguments *arguments = tool_arguments;
-  GtEncseq *aencseq = NULL, *bencseq = NULL;
-  GtTimer *seedextendtimer = NULL;
-  GtExtendCharAccess cam_a = GT_EXTEND_CHAR_ACCESS_ANY,
-                     cam_b = GT_EXTEND_CHAR_ACCESS_ANY;
-  GtDiagbandseedBaseListType splt = GT_DIAGBANDSEED_BASE_LIST_UNDEFINED,
-                             kmplt = GT_DIAGBANDSEED_BASE_LIST_UNDEFINED;
-  GtUword errorpercentage = 0UL;
-  double matchscore_bias = GT_DEFAULT_MATCHSCORE_BIAS;
-  bool extendxdrop, extendgreedy = true;
-  unsigned int maxseedlength = 0, nchars = 0;
-  GtUwordPair pick = {GT_UWORD_MAX, GT_UWORD_MAX};
-  GtUword maxseqlength = 0, a_numofsequences, b_numofsequences;
-  GtSeedExtendDisplayFlag *out_display_flag = NULL;
-  int had_err = 0;
-  const GtSeedExtendDisplaySetMode setmode
-    = GT_SEED_EXTEND_DISPLAY_SET_STANDARD;
-  GtAniAccumulate ani_accumulate[2];
-
-  gt_error_check(err);
-  gt_assert(arguments != NULL);
-  ani_accumulate[0].sum_of_aligned_len = 0;
-  ani_accumulate[0].sum_of_distance = 0;
-  ani_accumulate[1].sum_of_aligned_len = 0;
-  ani_accumulate[1].sum_of_distance = 0;
-  /* Define, whether greedy extension will be performed */
-  extendxdrop = gt_option_is_set(arguments->se_ref_op_xdr);
-  if (arguments->onlyseeds || extendxdrop) {
-    extendgreedy = false;
-  }
+  unsigned int numofchars;
+  GtUword numofsequences,
+          totallength,
+          maxseqlength;
+  bool twobitencoding_nowildcards,
+       isdna;
+} GtSeedExtendQueryInfo;
+
+static void gt_seed_extend_query_info_from_encseq(GtSeedExtendQueryInfo *qinfo,
+                                                  const GtEncseq *bencseq)
+{
+  const GtAlphabet *alphabet = gt_encseq_alphabet(bencseq);
+
+  qinfo->numofchars = gt_alphabet_num_of_chars(alphabet);
+  qinfo->numofsequences = gt_encseq_num_of_sequences(bencseq);
+  qinfo->totallength = gt_encseq_total_length(bencseq);
+  qinfo->maxseqlength = gt_encseq_max_seq_length(bencseq);
+  qinfo->twobitencoding_nowildcards
+    = gt_encseq_has_twobitencoding(bencseq) &&
+      gt_encseq_wildcards(bencseq) == 0 ? true : false;
+  qinfo->isdna = gt_alphabet_is_dna(alphabet);
+}
 
-  /* Calculate error percentage from minidentity */
-  gt_assert(arguments->se_minidentity >= GT_EXTEND_MIN_IDENTITY_PERCENTAGE &&
-            arguments->se_minidentity <= 100UL);
-  errorpercentage = 100UL - arguments->se_minidentity;
+/* Read all sequences of the files given by option -qfile once to determine
+   the same properties an encseq index of these files would have. Empty
+   sequences are skipped, as in <gt_seed_extend_query_batch_next>. */
+static int gt_seed_extend_query_info_from_files(GtSeedExtendQueryInfo *qinfo,
+                                                GtStrArray *queryfiles,
+                                                const GtAlphabet *alphabet,
+                                                GtError *err)
+{
+  GtSeqIterator *seqit;
+  int had_err = 0;
 
-  /* Measure whole running time */
-  if (arguments->benchmark || arguments->verbose)
-  {
-    gt_showtime_enable();
-  }
-  if (gt_showtime_enabled())
+  qinfo->numofchars = gt_alphabet_num_of_chars(alphabet);
+  qinfo->numofsequences = 0;
+  qinfo->totallength = 0;
+  qinfo->maxseqlength = 0;
+  /* the batches are encoded in memory without two bit encoding */
+  qinfo->twobitencoding_nowildcards = false;
+  qinfo->isdna = gt_alphabet_is_dna(alphabet);
+  seqit = gt_seq_iterator_sequence_buffer_new(queryfiles, err);
+  if (seqit == NULL)
   {
-    seedextendtimer = gt_timer_new();
-    gt_timer_start(seedextendtimer);
+    return -1;
   }
-  if (!arguments->compute_ani)
+  while (true)
   {
-    out_display_flag = gt_querymatch_display_flag_new(arguments->display_args,
-                                                      setmode,err);
-    if (out_display_flag == NULL)
+    const GtUchar *sequence;
+    GtUword len;
+    char *desc;
+    const int retval = gt_seq_iterator_next(seqit, &sequence, &len, &desc,
+                                            err);
+    if (retval <= 0)
     {
-      had_err = -1;
-    }
-  }
-
-  if (!had_err)
-  {
-    if (!gt_querymatch_gfa2_display(out_display_flag))
-    {
-      const bool idhistout
-        = (arguments->maxmat != 1 &&
-           gt_str_length(arguments->diagband_statistics_arg) == 0)
-          ? true : false;
-      gt_querymatch_Options_output(stdout,argc,argv,idhistout,
-                                   arguments->se_minidentity,
-                                   arguments->se_historysize);
-      if (!arguments->compute_ani  && !arguments->onlyseeds)
+      if (retval < 0)
       {
-        gt_querymatch_Fields_output(stdout,out_display_flag);
-      }
-    } else
-    {
-      printf("H\tVN:Z:2.0");
-      if (gt_querymatch_trace_display(out_display_flag))
-      {
-        printf("\tTS:i:" GT_WU "\n",
-               gt_querymatch_trace_delta_display(out_display_flag));
-      } else
-      {
-        fputc('\n',stdout);
+        had_err = -1;
       }
+      break;
     }
-  }
-  /* Set character access method */
-  if (!had_err && !arguments->onlyseeds)
-  {
-    if (gt_greedy_extend_char_access(&cam_a,&cam_b,
-                                     gt_str_get(arguments->char_access_mode),
-                                     err) != 0)
+    if (len > 0)
     {
-      had_err = -1;
+      qinfo->numofsequences++;
+      qinfo->totallength += len;
+      qinfo->maxseqlength = GT_MAX(qinfo->maxseqlength, len);
     }
   }
-  if (!had_err)
+  gt_seq_iterator_delete(seqit);
+  /* include the separators */
+  if (qinfo->numofsequences > 0)
   {
-    splt = gt_diagbandseed_base_list_get(true,
-                                         gt_str_get(arguments->splt_string),
-                                         err);
-    if ((int) splt == -1) {
-      had_err = -1;
-    }
+    qinfo->totallength += qinfo->numofsequences - 1;
   }
-  if (!had_err)
-  {
-    kmplt = gt_diagbandseed_base_list_get(false,
-                                          gt_str_get(arguments->kmplt_string),
-                                          err);
-    if ((int) kmplt == -1) {
-      had_err = -1;
-    }
-  }
-  if (!had_err) {
-    GtEncseqLoader *encseq_loader = gt_encseq_loader_new();
-    gt_encseq_loader_require_multiseq_support(encseq_loader);
-    gt_encseq_loader_require_ssp_tab(encseq_loader);
-    if (out_display_flag != NULL &&
-        gt_querymatch_subjectid_display(out_display_flag))
-    {
-      gt_encseq_loader_require_des_tab(encseq_loader);
-      gt_encseq_loader_require_sds_tab(encseq_loader);
-    }
+  return had_err;
+}
 
-    /* Load encseq A */
-    aencseq = gt_encseq_loader_load(encseq_loader,
-                                    gt_str_get(arguments->dbs_indexname),
-                                    err);
-    if (aencseq == NULL) {
-      had_err = -1;
-    }
-    gt_encseq_loader_delete(encseq_loader);
-  }
-  if (!had_err)
-  {
-    /* If there is a 2nd read set: Load encseq B */
-    if (gt_str_length(arguments->dbs_queryname) == 0) {
-      bencseq = gt_encseq_ref(aencseq);
-    } else
-    {
-      GtEncseqLoader *encseq_loader = gt_encseq_loader_new();
-      gt_encseq_loader_require_multiseq_support(encseq_loader);
-      gt_encseq_loader_require_ssp_tab(encseq_loader);
-      if (out_display_flag != NULL &&
-          gt_querymatch_queryid_display(out_display_flag))
-      {
-        gt_encseq_loader_require_des_tab(encseq_loader);
-        gt_encseq_loader_require_sds_tab(encseq_loader);
-      }
-      bencseq = gt_encseq_loader_load(encseq_loader,
-                                      gt_str_get(arguments->dbs_queryname),
-                                      err);
-      if (bencseq == NULL)
-      {
-        had_err = -1;
-      }
-      gt_encseq_loader_delete(encseq_loader);
-    }
-    if (bencseq == NULL) {
-      had_err = -1;
-      gt_encseq_delete(aencseq);
-    }
-  }
+/* Derive the parameters not given by the user from the properties of
+   <aencseq> and of the query sequences, given by <qinfo>, and check the
+   parameters given by the user. This is done once before matching. */
+static int gt_seed_extend_parameters_set(GtSeedExtendArguments *arguments,
+                                         const GtEncseq *aencseq,
+                                         const GtSeedExtendQueryInfo *qinfo,
+                                         bool selfcomparison,
+                                         bool extendgreedy,
+                                         GtUword errorpercentage,
+                                         GtUwordPair *pick,
+                                         double *matchscore_bias,
+                                         GtError *err)
+{
+  unsigned int maxseedlength = 0, nchars;
+  GtUword maxseqlength = 0, a_numofsequences;
+  int had_err = 0;
 
   /* Check alphabet sizes */
-  if (!had_err) {
-    unsigned int nchars_b;
-    nchars = gt_alphabet_num_of_chars(gt_encseq_alphabet(aencseq));
-    nchars_b = gt_alphabet_num_of_chars(gt_encseq_alphabet(bencseq));
-    if (nchars != nchars_b) {
-      gt_error_set(err,"encoded sequences have different alphabet "
-                   "sizes %u and %u", nchars, nchars_b);
-      gt_encseq_delete(aencseq);
-      gt_encseq_delete(bencseq);
-      had_err = -1;
-    }
-  }
-
-  if (had_err) {
-    if (gt_showtime_enabled()) {
-      gt_timer_delete(seedextendtimer);
-    }
-    gt_querymatch_display_flag_delete(out_display_flag);
-    return had_err;
+  nchars = gt_alphabet_num_of_chars(gt_encseq_alphabet(aencseq));
+  if (nchars != qinfo->numofchars) {
+    gt_error_set(err,"encoded sequences have different alphabet "
+                 "sizes %u and %u", nchars, qinfo->numofchars);
+    return -1;
   }
 
   /* Set seedlength */
-  gt_assert(aencseq != NULL && bencseq != NULL);
+  gt_assert(aencseq != NULL);
   a_numofsequences = gt_encseq_num_of_sequences(aencseq);
-  b_numofsequences = gt_encseq_num_of_sequences(bencseq);
   if (gt_encseq_has_twobitencoding(aencseq) &&
       gt_encseq_wildcards(aencseq) == 0 &&
-      gt_encseq_has_twobitencoding(bencseq) &&
-      gt_encseq_wildcards(bencseq) == 0) {
+      qinfo->twobitencoding_nowildcards) {
     maxseedlength = 32;
   } else {
     maxseedlength = gt_maxbasepower(nchars) - 1;
   }
   maxseqlength = GT_MIN(gt_encseq_max_seq_length(aencseq),
-                     gt_encseq_max_seq_length(bencseq));
+                        qinfo->maxseqlength);
 
   if (arguments->dbs_seedlength == UINT_MAX)
   {
@@ -963,7 +911,7 @@ static int gt_seed_extend_runner(int argc,
     {
       unsigned int local_seedlength, log_avg_totallength;
       double avg_totallength = 0.5 * (gt_encseq_total_length(aencseq) +
-                                      gt_encseq_total_length(bencseq));
+                                      qinfo->totallength);
       gt_assert(nchars > 0);
       log_avg_totallength
         = (unsigned int) gt_round_to_long(gt_log_base(avg_totallength,
@@ -1066,7 +1014,7 @@ static int gt_seed_extend_runner(int argc,
   }
 
   /* Check alphabet and direction compatibility */
-  if (!had_err && !gt_alphabet_is_dna(gt_encseq_alphabet(bencseq))) {
+  if (!had_err && !qinfo->isdna) {
     if (arguments->nofwd) {
       gt_error_set(err, "option -no-forward is only allowed for DNA sequences");
       had_err = -1;
@@ -1097,27 +1045,27 @@ static int gt_seed_extend_runner(int argc,
                    " " GT_WU ", which is the number of sequences in the first "
                    "set", a_numofsequences);
       had_err = -1;
-    } else if (bpick > b_numofsequences) {
+    } else if (bpick > qinfo->numofsequences) {
       gt_error_set(err, "second argument to option -pick must not be larger "
                    "than " GT_WU ", which is the number of sequences in the "
-                   "second set", b_numofsequences);
+                   "second set", qinfo->numofsequences);
       had_err = -1;
-    } else if (aencseq == bencseq && apick > bpick) {
-      pick.a = bpick - 1;
-      pick.b = apick - 1;
+    } else if (selfcomparison && apick > bpick) {
+      pick->a = bpick - 1;
+      pick->b = apick - 1;
     } else {
-      pick.a = apick - 1;
-      pick.b = bpick - 1;
+      pick->a = apick - 1;
+      pick->b = bpick - 1;
     }
     gt_cstr_array_delete(items);
   }
 
   /* Use bias dependent parameters, adapted from E. Myers' DALIGNER */
   if (!had_err && extendgreedy && arguments->bias_parameters) {
-    matchscore_bias = gt_greedy_dna_sequence_bias_get(aencseq);
+    *matchscore_bias = gt_greedy_dna_sequence_bias_get(aencseq);
     arguments->se_maxalilendiff = 30;
     arguments->se_perc_match_hist = (GtUword) (100.0 - errorpercentage *
-                                               matchscore_bias);
+                                               *matchscore_bias);
   }
 
   /* Set SeedPair distance according to overlappingseeds flag */
@@ -1128,120 +1076,503 @@ static int gt_seed_extend_runner(int argc,
       arguments->seedpairdistance.start = (GtUword) arguments->dbs_seedlength;
     }
   }
+  return had_err;
+}
 
-  /* Fill struct of algorithm arguments */
-  if (!had_err) {
-    GtDiagbandseedExtendParams *extp = NULL;
-    GtDiagbandseedInfo *info = NULL;
-    GtUword sensitivity = 0;
-    GtSequencePartsInfo *aseqranges, *bseqranges;
-    GtUword use_apos_local = 0;
-
-    if (extendgreedy) {
-      sensitivity = arguments->se_extendgreedy;
-    } else if (extendxdrop) {
-      sensitivity = arguments->se_extendxdrop;
+/* Match the sequences of <bencseq> against the sequences of <aencseq>,
+   whose parts are given by <aseqranges>. This is done once, if the query
+   is given as an encseq index, and once for each batch of query sequences,
+   if the query sequences are read from files. The parameters must have been
+   set by <gt_seed_extend_parameters_set> before. */
+static int gt_seed_extend_process(GtSeedExtendArguments *arguments,
+                                  const GtEncseq *aencseq,
+                                  const GtSequencePartsInfo *aseqranges,
+                                  const GtEncseq *bencseq,
+                                  GtDiagbandseedKmerCache *kmer_cache,
+                                  bool extendgreedy,
+                                  bool extendxdrop,
+                                  GtUword errorpercentage,
+                                  double matchscore_bias,
+                                  const GtUwordPair *pick,
+                                  GtExtendCharAccess cam_a,
+                                  GtExtendCharAccess cam_b,
+                                  GtDiagbandseedBaseListType splt,
+                                  GtDiagbandseedBaseListType kmplt,
+                                  const GtSeedExtendDisplayFlag
+                                    *out_display_flag,
+                                  GtAniAccumulate *ani_accumulate,
+                                  GtError *err)
+{
+  GtDiagbandseedExtendParams *extp = NULL;
+  GtDiagbandseedInfo *info = NULL;
+  GtUword sensitivity = 0;
+  const GtSequencePartsInfo *bseqranges;
+  GtUword use_apos_local = 0;
+  int had_err = 0;
+
+  gt_assert(aencseq != NULL && bencseq != NULL);
+
+  if (extendgreedy) {
+    sensitivity = arguments->se_extendgreedy;
+  } else if (extendxdrop) {
+    sensitivity = arguments->se_extendxdrop;
+  }
+
+  /* Get sequence ranges */
+  if (aencseq == bencseq)
+  {
+    bseqranges = aseqranges;
+  } else
+  {
+    GtSequencePartsInfo *local_bseqranges
+      = gt_sequence_parts_info_new(bencseq,
+                                   gt_encseq_num_of_sequences(bencseq),
+                                   arguments->dbs_parts);
+    if (arguments->verbose &&
+        gt_sequence_parts_info_number(local_bseqranges) > 1)
+    {
+      gt_sequence_parts_info_variance_show(local_bseqranges);
     }
+    bseqranges = local_bseqranges;
+  }
+  gt_assert(pick->a < gt_sequence_parts_info_number(aseqranges) ||
+            pick->a == GT_UWORD_MAX);
+  gt_assert(pick->b < gt_sequence_parts_info_number(bseqranges) ||
+            pick->b == GT_UWORD_MAX);
 
-    /* Get sequence ranges */
-    aseqranges = gt_sequence_parts_info_new(aencseq,a_numofsequences,
-                                            arguments->dbs_parts);
-    if (arguments->verbose && gt_sequence_parts_info_number(aseqranges) > 1)
+  if (arguments->use_apos)
+  {
+    gt_assert(!arguments->use_apos_track_all);
+    use_apos_local = 1;
+  } else
+  {
+    if (arguments->use_apos_track_all)
     {
-      gt_sequence_parts_info_variance_show(aseqranges);
+      use_apos_local = 2;
+    }
+  }
+  extp = gt_diagbandseed_extend_params_new(arguments->se_alignlength,
+                                           errorpercentage,
+                                           arguments->se_evalue_threshold,
+                                           arguments->dbs_logdiagbandwidth,
+                                           arguments->dbs_mincoverage,
+                                           out_display_flag,
+                                           use_apos_local,
+                                           arguments->se_xdropbelowscore,
+                                           extendgreedy,
+                                           extendxdrop,
+                                           arguments->se_maxalilendiff,
+                                           arguments->se_historysize,
+                                           arguments->se_perc_match_hist,
+                                           cam_a,
+                                           cam_b,
+                                           arguments->cam_generic,
+                                           sensitivity,
+                                           matchscore_bias,
+                                           arguments->weakends,
+                                           arguments->benchmark,
+                                           !arguments->relax_polish,
+                                           arguments->verify_alignment,
+                                           arguments->only_selected_seqpairs,
+                                           ani_accumulate);
+
+  info = gt_diagbandseed_info_new(aencseq,
+                                  bencseq,
+                                  arguments->dbs_maxfreq,
+                                  arguments->dbs_memlimit,
+                                  arguments->dbs_spacedseedweight,
+                                  arguments->dbs_seedlength,
+                                  arguments->norev,
+                                  arguments->nofwd,
+                                  &arguments->seedpairdistance,
+                                  splt,
+                                  kmplt,
+                                  arguments->dbs_verify,
+                                  arguments->verbose,
+                                  arguments->dbs_debug_kmer,
+                                  arguments->dbs_debug_seedpair,
+                                  arguments->use_kmerfile,
+                                  arguments->trimstat_on,
+                                  arguments->maxmat,
+                                  arguments->chainarguments,
+                                  arguments->diagband_statistics_arg,
+                                  extp);
+  if (kmer_cache != NULL)
+  {
+    gt_diagbandseed_info_kmer_cache_set(info,kmer_cache);
+  }
+
+  /* Start algorithm */
+  had_err = gt_diagbandseed_run(info,
+                                aseqranges,
+                                bseqranges,
+                                pick,
+                                err);
+
+  /* clean up */
+  if (bseqranges != aseqranges)
+  {
+    gt_sequence_parts_info_delete((GtSequencePartsInfo *) bseqranges);
+  }
+  gt_diagbandseed_extend_params_delete(extp);
+  gt_diagbandseed_info_delete(info);
+  return had_err;
+}
+
+/* Read the next at most <batchsize> sequences from <seqit> and encode them
+   in memory. Returns 1 and sets <bencseq> if at least one sequence was read,
+   0 if all sequences have been read, and -1 on error. Empty sequences cannot
+   be encoded and are skipped, but they are counted to keep the query sequence
+   numbers: <skipped_before> is the number of empty sequences read before the
+   first sequence of the batch and <skipped_after> the number of those read
+   after its last sequence. An empty sequence ends the batch. */
+static int gt_seed_extend_query_batch_next(GtEncseq **bencseq,
+                                           GtUword *skipped_before,
+                                           GtUword *skipped_after,
+                                           GtSeqIterator *seqit,
+                                           GtEncseqBuilder *eb,
+                                           GtUword batchsize,
+                                           GtError *err)
+{
+  GtUword numofsequences = 0;
+  int retval = 0;
+
+  *bencseq = NULL;
+  *skipped_before = *skipped_after = 0;
+  while (numofsequences < batchsize)
+  {
+    const GtUchar *sequence;
+    GtUword len;
+    char *desc;
+
+    retval = gt_seq_iterator_next(seqit, &sequence, &len, &desc, err);
+    if (retval <= 0)
+    {
+      break;
     }
-    if (aencseq == bencseq)
+    if (len > 0)
     {
-      bseqranges = aseqranges;
+      gt_encseq_builder_add_encoded_own(eb, sequence, len, desc);
+      numofsequences++;
     } else
     {
-      bseqranges = gt_sequence_parts_info_new(bencseq,b_numofsequences,
-                                              arguments->dbs_parts);
-      if (arguments->verbose && gt_sequence_parts_info_number(bseqranges) > 1)
+      if (numofsequences > 0)
       {
-        gt_sequence_parts_info_variance_show(bseqranges);
+        *skipped_after = 1;
+        break;
       }
+      (*skipped_before)++;
+    }
+  }
+  if (retval < 0)
+  {
+    gt_encseq_builder_reset(eb);
+    return -1;
+  }
+  if (numofsequences == 0)
+  {
+    return 0;
+  }
+  *bencseq = gt_encseq_builder_build(eb, err);
+  return *bencseq == NULL ? -1 : 1;
+}
+
+static int gt_seed_extend_runner(int argc,
+                                 const char **argv,
+                                 GT_UNUSED int parsed_args,
+                                 void *tool_arguments,
+                                 GtError *err)
+{
+  GtSeedExtendArguments *arguments = tool_arguments;
+  GtEncseq *aencseq = NULL, *bencseq = NULL;
+  GtTimer *seedextendtimer = NULL;
+  GtExtendCharAccess cam_a = GT_EXTEND_CHAR_ACCESS_ANY,
+                     cam_b = GT_EXTEND_CHAR_ACCESS_ANY;
+  GtDiagbandseedBaseListType splt = GT_DIAGBANDSEED_BASE_LIST_UNDEFINED,
+                             kmplt = GT_DIAGBANDSEED_BASE_LIST_UNDEFINED;
+  GtUword errorpercentage = 0UL;
+  bool extendxdrop, extendgreedy = true;
+  GtSeedExtendDisplayFlag *out_display_flag = NULL;
+  int had_err = 0;
+  const GtSeedExtendDisplaySetMode setmode
+    = GT_SEED_EXTEND_DISPLAY_SET_STANDARD;
+  GtAniAccumulate ani_accumulate[2];
+
+  gt_error_check(err);
+  gt_assert(arguments != NULL);
+  ani_accumulate[0].sum_of_aligned_len = 0;
+  ani_accumulate[0].sum_of_distance = 0;
+  ani_accumulate[1].sum_of_aligned_len = 0;
+  ani_accumulate[1].sum_of_distance = 0;
+  /* Define, whether greedy extension will be performed */
+  extendxdrop = gt_option_is_set(arguments->se_ref_op_xdr);
+  if (arguments->onlyseeds || extendxdrop) {
+    extendgreedy = false;
+  }
+
+  /* Calculate error percentage from minidentity */
+  gt_assert(arguments->se_minidentity >= GT_EXTEND_MIN_IDENTITY_PERCENTAGE &&
+            arguments->se_minidentity <= 100UL);
+  errorpercentage = 100UL - arguments->se_minidentity;
+
+  /* Measure whole running time */
+  if (arguments->benchmark || arguments->verbose)
+  {
+    gt_showtime_enable();
+  }
+  if (gt_showtime_enabled())
+  {
+    seedextendtimer = gt_timer_new();
+    gt_timer_start(seedextendtimer);
+  }
+  if (!arguments->compute_ani)
+  {
+    out_display_flag = gt_querymatch_display_flag_new(arguments->display_args,
+                                                      setmode,err);
+    if (out_display_flag == NULL)
+    {
+      had_err = -1;
     }
-    gt_assert(pick.a < gt_sequence_parts_info_number(aseqranges) ||
-              pick.a == GT_UWORD_MAX);
-    gt_assert(pick.b < gt_sequence_parts_info_number(bseqranges) ||
-              pick.b == GT_UWORD_MAX);
+  }
 
-    if (arguments->use_apos)
+  if (!had_err)
+  {
+    if (!gt_querymatch_gfa2_display(out_display_flag))
     {
-      gt_assert(!arguments->use_apos_track_all);
-      use_apos_local = 1;
+      const bool idhistout
+        = (arguments->maxmat != 1 &&
+           gt_str_length(arguments->diagband_statistics_arg) == 0)
+          ? true : false;
+      gt_querymatch_Options_output(stdout,argc,argv,idhistout,
+                                   arguments->se_minidentity,
+                                   arguments->se_historysize);
+      if (!arguments->compute_ani  && !arguments->onlyseeds)
+      {
+        gt_querymatch_Fields_output(stdout,out_display_flag);
+      }
     } else
     {
-      if (arguments->use_apos_track_all)
+      printf("H\tVN:Z:2.0");
+      if (gt_querymatch_trace_display(out_display_flag))
+      {
+        printf("\tTS:i:" GT_WU "\n",
+               gt_querymatch_trace_delta_display(out_display_flag));
+      } else
       {
-        use_apos_local = 2;
+        fputc('\n',stdout);
       }
     }
-    extp = gt_diagbandseed_extend_params_new(arguments->se_alignlength,
-                                             errorpercentage,
-                                             arguments->se_evalue_threshold,
-                                             arguments->dbs_logdiagbandwidth,
-                                             arguments->dbs_mincoverage,
-                                             out_display_flag,
-                                             use_apos_local,
-                                             arguments->se_xdropbelowscore,
-                                             extendgreedy,
-                                             extendxdrop,
-                                             arguments->se_maxalilendiff,
-                                             arguments->se_historysize,
-                                             arguments->se_perc_match_hist,
-                                             cam_a,
-                                             cam_b,
-                                             arguments->cam_generic,
-                                             sensitivity,
-                                             matchscore_bias,
-                                             arguments->weakends,
-                                             arguments->benchmark,
-                                             !arguments->relax_polish,
-                                             arguments->verify_alignment,
-                                             arguments->only_selected_seqpairs,
-                                             arguments->compute_ani
-                                               ? &ani_accumulate[0]
-                                               : NULL);
-
-    info = gt_diagbandseed_info_new(aencseq,
-                                    bencseq,
-                                    arguments->dbs_maxfreq,
-                                    arguments->dbs_memlimit,
-                                    arguments->dbs_spacedseedweight,
-                                    arguments->dbs_seedlength,
-                                    arguments->norev,
-                                    arguments->nofwd,
-                                    &arguments->seedpairdistance,
-                                    splt,
-                                    kmplt,
-                                    arguments->dbs_verify,
-                                    arguments->verbose,
-                                    arguments->dbs_debug_kmer,
-                                    arguments->dbs_debug_seedpair,
-                                    arguments->use_kmerfile,
-                                    arguments->trimstat_on,
-                                    arguments->maxmat,
-                                    arguments->chainarguments,
-                                    arguments->diagband_statistics_arg,
-                                    extp);
-
-    /* Start algorithm */
-    had_err = gt_diagbandseed_run(info,
-                                  aseqranges,
-                                  bseqranges,
-                                  &pick,
-                                  err);
-
-    /* clean up */
-    if (bseqranges != aseqranges)
+  }
+  /* Set character access method */
+  if (!had_err && !arguments->onlyseeds)
+  {
+    if (gt_greedy_extend_char_access(&cam_a,&cam_b,
+                                     gt_str_get(arguments->char_access_mode),
+                                     err) != 0)
+    {
+      had_err = -1;
+    }
+  }
+  if (!had_err)
+  {
+    splt = gt_diagbandseed_base_list_get(true,
+                                         gt_str_get(arguments->splt_string),
+                                         err);
+    if ((int) splt == -1) {
+      had_err = -1;
+    }
+  }
+  if (!had_err)
+  {
+    kmplt = gt_diagbandseed_base_list_get(false,
+                                          gt_str_get(arguments->kmplt_string),
+                                          err);
+    if ((int) kmplt == -1) {
+      had_err = -1;
+    }
+  }
+  if (!had_err) {
+    GtEncseqLoader *encseq_loader = gt_encseq_loader_new();
+    gt_encseq_loader_require_multiseq_support(encseq_loader);
+    gt_encseq_loader_require_ssp_tab(encseq_loader);
+    if (out_display_flag != NULL &&
+        gt_querymatch_subjectid_display(out_display_flag))
+    {
+      gt_encseq_loader_require_des_tab(encseq_loader);
+      gt_encseq_loader_require_sds_tab(encseq_loader);
+    }
+
+    /* Load encseq A */
+    aencseq = gt_encseq_loader_load(encseq_loader,
+                                    gt_str_get(arguments->dbs_indexname),
+                                    err);
+    if (aencseq == NULL) {
+      had_err = -1;
+    }
+    gt_encseq_loader_delete(encseq_loader);
+  }
+  if (!had_err && gt_str_array_size(arguments->dbs_queryfiles) == 0)
+  {
+    /* If there is a 2nd read set: Load encseq B */
+    if (gt_str_length(arguments->dbs_queryname) == 0) {
+      bencseq = gt_encseq_ref(aencseq);
+    } else
     {
-      gt_sequence_parts_info_delete(bseqranges);
+      GtEncseqLoader *encseq_loader = gt_encseq_loader_new();
+      gt_encseq_loader_require_multiseq_support(encseq_loader);
+      gt_encseq_loader_require_ssp_tab(encseq_loader);
+      if (out_display_flag != NULL &&
+          gt_querymatch_queryid_display(out_display_flag))
+      {
+        gt_encseq_loader_require_des_tab(encseq_loader);
+        gt_encseq_loader_require_sds_tab(encseq_loader);
+      }
+      bencseq = gt_encseq_loader_load(encseq_loader,
+                                      gt_str_get(arguments->dbs_queryname),
+                                      err);
+      if (bencseq == NULL)
+      {
+        had_err = -1;
+      }
+      gt_encseq_loader_delete(encseq_loader);
+    }
+  }
+
+  if (!had_err) {
+    GtSequencePartsInfo *aseqranges;
+    GtAniAccumulate *ani_accumulate_ptr
+      = arguments->compute_ani ? &ani_accumulate[0] : NULL;
+    GtSeedExtendQueryInfo qinfo;
+    GtUwordPair pick = {GT_UWORD_MAX, GT_UWORD_MAX};
+    double matchscore_bias = GT_DEFAULT_MATCHSCORE_BIAS;
+
+    aseqranges = gt_sequence_parts_info_new(aencseq,
+                                            gt_encseq_num_of_sequences(aencseq),
+                                            arguments->dbs_parts);
+    if (arguments->verbose && gt_sequence_parts_info_number(aseqranges) > 1)
+    {
+      gt_sequence_parts_info_variance_show(aseqranges);
+    }
+    /* the parameters are derived once from the complete set of query
+       sequences, so they do not depend on the batches of option -qfile */
+    if (bencseq != NULL)
+    {
+      gt_seed_extend_query_info_from_encseq(&qinfo, bencseq);
+    } else
+    {
+      had_err = gt_seed_extend_query_info_from_files(&qinfo,
+                                                   arguments->dbs_queryfiles,
+                                                   gt_encseq_alphabet(aencseq),
+                                                   err);
+    }
+    if (!had_err && qinfo.numofsequences > 0)
+    {
+      had_err = gt_seed_extend_parameters_set(arguments,
+                                              aencseq,
+                                              &qinfo,
+                                              aencseq == bencseq,
+                                              extendgreedy,
+                                              errorpercentage,
+                                              &pick,
+                                              &matchscore_bias,
+                                              err);
+    }
+    if (!had_err && qinfo.numofsequences > 0 && bencseq != NULL)
+    {
+      had_err = gt_seed_extend_process(arguments,
+                                       aencseq,
+                                       aseqranges,
+                                       bencseq,
+                                       NULL,
+                                       extendgreedy,
+                                       extendxdrop,
+                                       errorpercentage,
+                                       matchscore_bias,
+                                       &pick,
+                                       cam_a,
+                                       cam_b,
+                                       splt,
+                                       kmplt,
+                                       out_display_flag,
+                                       ani_accumulate_ptr,
+                                       err);
+    } else if (!had_err && qinfo.numofsequences > 0)
+    {
+      /* Stream the query sequences in batches: each batch is encoded in
+         memory and matched against the k-mers of encseq A, which are
+         computed only once */
+      GtSeqIterator *seqit
+        = gt_seq_iterator_sequence_buffer_new(arguments->dbs_queryfiles,err);
+
+      if (seqit == NULL)
+      {
+        had_err = -1;
+      } else
+      {
+        GtAlphabet *alphabet = gt_encseq_alphabet(aencseq);
+        GtEncseqBuilder *eb = gt_encseq_builder_new(alphabet);
+        GtDiagbandseedKmerCache *kmer_cache
+          = gt_diagbandseed_kmer_cache_new(
+                               gt_sequence_parts_info_number(aseqranges));
+        GtUword queryseqnum_offset = 0;
+
+        gt_seq_iterator_set_symbolmap(seqit,gt_alphabet_symbolmap(alphabet));
+        gt_encseq_builder_enable_multiseq_support(eb);
+        if (out_display_flag != NULL &&
+            gt_querymatch_queryid_display(out_display_flag))
+        {
+          gt_encseq_builder_enable_description_support(eb);
+        }
+        while (!had_err)
+        {
+          GtUword skipped_before, skipped_after;
+          const int retval
+            = gt_seed_extend_query_batch_next(&bencseq,
+                                              &skipped_before,
+                                              &skipped_after,
+                                              seqit,
+                                              eb,
+                                              arguments->dbs_querybatchsize,
+                                              err);
+          if (retval <= 0)
+          {
+            had_err = retval;
+            break;
+          }
+          queryseqnum_offset += skipped_before;
+          if (out_display_flag != NULL)
+          {
+            gt_querymatch_display_queryseqnum_offset_set(out_display_flag,
+                                                         queryseqnum_offset);
+          }
+          had_err = gt_seed_extend_process(arguments,
+                                           aencseq,
+                                           aseqranges,
+                                           bencseq,
+                                           kmer_cache,
+                                           extendgreedy,
+                                           extendxdrop,
+                                           errorpercentage,
+                                           matchscore_bias,
+                                           &pick,
+                                           cam_a,
+                                           cam_b,
+                                           splt,
+                                           kmplt,
+                                           out_display_flag,
+                                           ani_accumulate_ptr,
+                                           err);
+          queryseqnum_offset += gt_encseq_num_of_sequences(bencseq) +
+                                skipped_after;
+          gt_encseq_delete(bencseq);
+          bencseq = NULL;
+        }
+        gt_diagbandseed_kmer_cache_delete(kmer_cache);
+        gt_encseq_builder_delete(eb);
+        gt_seq_iterator_delete(seqit);
+      }
     }
     gt_sequence_parts_info_delete(aseqranges);
-    gt_diagbandseed_extend_params_delete(extp);
-    gt_diagbandseed_info_delete(info);
   }
   gt_encseq_delete(aencseq);
   gt_encseq_delete(bencseq);
@@ -1272,9 +1603,11 @@ static int gt_seed_extend_runner(int argc,
     int idx;
 
     printf("ANI %s %s",gt_str_get(arguments->dbs_indexname),
-                       gt_str_length(arguments->dbs_queryname) > 0
-                         ? gt_str_get(arguments->dbs_queryname)
-                         : gt_str_get(arguments->dbs_indexname));
+                       gt_str_array_size(arguments->dbs_queryfiles) > 0
+                         ? gt_str_array_get(arguments->dbs_queryfiles,0)
+                         : (gt_str_length(arguments->dbs_queryname) > 0
+                              ? gt_str_get(arguments->dbs_queryname)
+                              : gt_str_get(arguments->dbs_indexname)));
     for (idx = 0; idx < 2; idx++)
     {
       printf(" %.4f",gt_seed_extend_ani_evaluate(
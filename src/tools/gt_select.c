@@ -21,6 +21,7 @@
 #include "core/output_file_api.h"
 #include "core/undef_api.h"
 #include "core/unused_api.h"
+#include "extended/binary_out_stream.h"
 #include "extended/genome_node.h"
 #include "extended/gff3_defines.h"
 #include "extended/gff3_in_stream.h"
@@ -40,7 +41,8 @@ typedef struct {
   bool verbose,
        has_CDS,
        targetbest,
-       retainids;
+       retainids,
+       binary;
   GtStr *seqid,
         *source,
         *gt_strand_char,
@@ -60,6 +62,8 @@ typedef struct {
   GtFile *outfp;
   GtStrArray  *filter_files;
   GtStr *filter_logic;
+  GtStr *expression_str;
+  GtSelectExpression *expression;
   GtStr *dropped_file;
 } SelectArguments;
 
@@ -75,6 +79,7 @@ static void* gt_select_arguments_new(void)
   arguments->ofi = gt_output_file_info_new();
   arguments->filter_files = gt_str_array_new();
   arguments->filter_logic = gt_str_new();
+  arguments->expression_str = gt_str_new();
   arguments->dropped_file = gt_str_new();
   return arguments;
 }
@@ -91,6 +96,8 @@ static void gt_select_arguments_delete(void *tool_arguments)
   gt_str_delete(arguments->seqid);
   gt_str_array_delete(arguments->filter_files);
   gt_str_delete(arguments->filter_logic);
+  gt_str_delete(arguments->expression_str);
+  gt_select_expression_delete(arguments->expression);
   gt_str_delete(arguments->dropped_file);
   gt_free(arguments);
 }
@@ -249,6 +256,16 @@ static GtOptionParser* gt_select_option_parser_new(void *tool_arguments)
                                 filter_logic);
   gt_option_parser_add_option(op, option);
 
+  /* -expression */
+  option = gt_option_new_string("expression", "select features for which the "
+                                "given filter expression holds, e.g.\n"
+                                "'type == gene and length > 1000 and "
+                                "any(type == CDS)'\n(see the "
+                                "GtSelectExpression API documentation for "
+                                "the syntax)",
+                                arguments->expression_str, NULL);
+  gt_option_parser_add_option(op, option);
+
   /* -nh_file */
   optiondroppedfile = gt_option_new_filename("dropped_file",
                                              "save non-selected features to "
@@ -256,6 +273,12 @@ static GtOptionParser* gt_select_option_parser_new(void *tool_arguments)
                                              arguments->dropped_file);
   gt_option_parser_add_option(op, optiondroppedfile);
 
+  /* -binary */
+  option = gt_option_new_bool("binary", "show output in the compact binary "
+                              "format instead of GFF3",
+                              &arguments->binary, false);
+  gt_option_parser_add_option(op, option);
+
   /* -v */
   option = gt_option_new_verbose(&arguments->verbose);
   gt_option_parser_add_option(op, option);
@@ -307,6 +330,12 @@ static int gt_select_arguments_check(GT_UNUSED int rest_argc,
                                     &arguments->targetstrand,
                                     TARGETGT_STRAND_OPT, err);
   }
+  if (!had_err && gt_str_length(arguments->expression_str)) {
+    arguments->expression =
+      gt_select_expression_new(gt_str_get(arguments->expression_str), err);
+    if (!arguments->expression)
+      had_err = -1;
+  }
 
   return had_err;
 }
@@ -378,16 +407,27 @@ static int gt_select_runner(int argc, const char **argv, int parsed_args,
     gt_select_stream_set_single_intron_factor(select_stream,
                                               arguments->single_intron_factor);
 
+    if (arguments->expression)
+      gt_select_stream_set_expression(fs, arguments->expression);
+
     if (arguments->targetbest)
       targetbest_select_stream = gt_targetbest_select_stream_new(select_stream);
 
-    /* create a gff3 output stream */
-    gff3_out_stream = gt_gff3_out_stream_new(arguments->targetbest
-                                             ? targetbest_select_stream
-                                             : select_stream,
-                                             arguments->outfp);
+    /* create a gff3 (or binary) output stream */
+    if (arguments->binary) {
+      gff3_out_stream = gt_binary_out_stream_new(arguments->targetbest
+                                                 ? targetbest_select_stream
+                                                 : select_stream,
+                                                 arguments->outfp);
+    }
+    else {
+      gff3_out_stream = gt_gff3_out_stream_new(arguments->targetbest
+                                               ? targetbest_select_stream
+                                               : select_stream,
+                                               arguments->outfp);
+    }
 
-    if (arguments->retainids)
+    if (arguments->retainids && !arguments->binary)
       gt_gff3_out_stream_retain_id_attributes((GtGFF3OutStream*)
                                                                gff3_out_stream);
 
@@ -16,6 +16,7 @@
   OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
 */
 
+#include <string.h>
 #include "core/bioseq_api.h"
 #include "core/fasta_api.h"
 #include "core/fileutils_api.h"
@@ -27,12 +28,18 @@
 #include "core/string_distri.h"
 #include "core/unused_api.h"
 #include "extended/gtdatahelp.h"
+#include "extended/md5diskset.h"
 #include "extended/md5set.h"
 #include "tools/gt_sequniq.h"
 
+/* maximal number of sequences hashed at once with -memlimit */
+#define GT_SEQUNIQ_BATCH_NOFSEQS 4096UL
+
 typedef struct {
   bool seqit, verbose, rev;
-  GtUword width, nofseqs;
+  GtUword width, nofseqs, memlimit;
+  GtStr *memlimitarg;
+  GtOption *refoptionmemlimit;
   GtOutputFileInfo *ofi;
   GtFile *outfp;
 } GtSequniqArguments;
@@ -40,6 +47,7 @@ typedef struct {
 static void* gt_sequniq_arguments_new(void)
 {
   GtSequniqArguments *arguments = gt_calloc((size_t)1, sizeof *arguments);
+  arguments->memlimitarg = gt_str_new();
   arguments->ofi = gt_output_file_info_new();
   return arguments;
 }
@@ -50,6 +58,8 @@ static void gt_sequniq_arguments_delete(void *tool_arguments)
   if (!arguments) return;
   gt_file_delete(arguments->outfp);
   gt_output_file_info_delete(arguments->ofi);
+  gt_option_delete(arguments->refoptionmemlimit);
+  gt_str_delete(arguments->memlimitarg);
   gt_free(arguments);
 }
 
@@ -58,7 +68,7 @@ static GtOptionParser* gt_sequniq_option_parser_new(void *tool_arguments)
   GtSequniqArguments *arguments = tool_arguments;
   GtOptionParser *op;
   GtOption *seqit_option, *verbose_option, *width_option, *rev_option,
-           *nofseqs_option;
+           *nofseqs_option, *memlimit_option;
   gt_assert(arguments);
 
   op = gt_option_parser_new("[option ...] sequence_file [...] ",
@@ -85,6 +95,15 @@ static GtOptionParser* gt_sequniq_option_parser_new(void *tool_arguments)
       &arguments->rev, false);
   gt_option_parser_add_option(op, rev_option);
 
+  /* -memlimit */
+  memlimit_option = gt_option_new_string("memlimit", "bound the memory used "
+      "for finding repeated sequences (in bytes, the keywords 'MB' and 'GB' "
+      "are allowed); the MD5 hashes are stored in temporary files and the "
+      "sequence files are read twice, so they cannot be read from stdin",
+      arguments->memlimitarg, NULL);
+  gt_option_parser_add_option(op, memlimit_option);
+  arguments->refoptionmemlimit = gt_option_ref(memlimit_option);
+
   /* -v */
   verbose_option = gt_option_new_verbose(&arguments->verbose);
   gt_option_parser_add_option(op, verbose_option);
@@ -97,27 +116,140 @@ static GtOptionParser* gt_sequniq_option_parser_new(void *tool_arguments)
 
   /* option implications */
   gt_option_imply(verbose_option, seqit_option);
+  gt_option_exclude(memlimit_option, nofseqs_option);
+  gt_option_exclude(memlimit_option, seqit_option);
 
   gt_option_parser_set_comment_func(op, gt_gtdata_show_help, NULL);
   gt_option_parser_set_min_args(op, 1U);
   return op;
 }
 
+static int gt_sequniq_arguments_check(GT_UNUSED int rest_argc,
+                                      void *tool_arguments, GtError *err)
+{
+  GtSequniqArguments *arguments = tool_arguments;
+  int had_err = 0;
+  gt_error_check(err);
+  gt_assert(arguments);
+  if (gt_option_is_set(arguments->refoptionmemlimit)) {
+    had_err = gt_option_parse_spacespec(&arguments->memlimit, "memlimit",
+                                        arguments->memlimitarg, err);
+  }
+  return had_err;
+}
+
+/* hashes the sequences of <files> with a <GtMD5DiskSet> in batches of at most
+   a quarter of the memory limit, then reads <files> again to output the first
+   occurrence of each sequence */
+static int gt_sequniq_memlimit(GtSequniqArguments *arguments,
+                               GtStrArray *files,
+                               GtUint64 *duplicates,
+                               GtUint64 *num_of_sequences,
+                               GtError *err)
+{
+  GtMD5DiskSet *md5diskset;
+  GtSeqIterator *seqit;
+  const GtUchar *sequence;
+  const char **seqs;
+  char *desc, *batch = NULL;
+  GtUword len, i, batchsize, batchlen = 0, batchalloc = 0, nofbatchseqs = 0,
+          *offsets, *lens;
+  int had_err = 0, retval;
+
+  batchsize = arguments->memlimit / 4;
+  md5diskset = gt_md5diskset_new(arguments->memlimit - batchsize,
+                                 arguments->rev);
+  seqs = gt_malloc(sizeof (*seqs) * GT_SEQUNIQ_BATCH_NOFSEQS);
+  offsets = gt_malloc(sizeof (*offsets) * GT_SEQUNIQ_BATCH_NOFSEQS);
+  lens = gt_malloc(sizeof (*lens) * GT_SEQUNIQ_BATCH_NOFSEQS);
+
+  /* first pass: hash all sequences */
+  if (!(seqit = gt_seq_iterator_sequence_buffer_new(files, err)))
+    had_err = -1;
+  while (!had_err) {
+    retval = gt_seq_iterator_next(seqit, &sequence, &len, &desc, err);
+    if (retval < 0)
+      had_err = -1;
+    if (nofbatchseqs > 0 &&
+        (retval != 1 || batchlen + len > batchsize ||
+         nofbatchseqs == GT_SEQUNIQ_BATCH_NOFSEQS)) {
+      for (i = 0; i < nofbatchseqs; i++)
+        seqs[i] = batch + offsets[i];
+      if (!had_err)
+        had_err = gt_md5diskset_add_sequences(md5diskset,
+                                              (const char * const *) seqs,
+                                              lens, nofbatchseqs, err);
+      batchlen = nofbatchseqs = 0;
+    }
+    if (had_err || retval != 1)
+      break;
+    if (batchlen + len > batchalloc) {
+      batchalloc = batchlen + len;
+      batch = gt_realloc(batch, sizeof (*batch) * batchalloc);
+    }
+    memcpy(batch + batchlen, sequence, (size_t) len);
+    offsets[nofbatchseqs] = batchlen;
+    lens[nofbatchseqs++] = len;
+    batchlen += len;
+  }
+  gt_seq_iterator_delete(seqit);
+  gt_free(batch);
+  gt_free(seqs);
+  gt_free(offsets);
+  gt_free(lens);
+  if (!had_err)
+    had_err = gt_md5diskset_finish(md5diskset, err);
+
+  /* second pass: output the sequences which are not repeated */
+  seqit = NULL;
+  if (!had_err && !(seqit = gt_seq_iterator_sequence_buffer_new(files, err)))
+    had_err = -1;
+  while (!had_err) {
+    GtMD5SetStatus status;
+    retval = gt_seq_iterator_next(seqit, &sequence, &len, &desc, err);
+    if (retval != 1) {
+      if (retval < 0)
+        had_err = -1;
+      break;
+    }
+    status = gt_md5diskset_next(md5diskset, err);
+    if (status == GT_MD5SET_NOT_FOUND)
+      gt_fasta_show_entry(desc, (const char*) sequence, len,
+                          arguments->width, arguments->outfp);
+    else if (status != GT_MD5SET_ERROR)
+      (*duplicates)++;
+    else
+      had_err = -1;
+    (*num_of_sequences)++;
+  }
+  gt_seq_iterator_delete(seqit);
+  gt_md5diskset_delete(md5diskset);
+  return had_err;
+}
+
 static int gt_sequniq_runner(int argc, const char **argv, int parsed_args,
                              void *tool_arguments, GtError *err)
 {
   GtSequniqArguments *arguments = tool_arguments;
   GtUint64 duplicates = 0, num_of_sequences = 0;
   int i, had_err = 0;
-  GtMD5Set *md5set;
+  GtMD5Set *md5set = NULL;
 
   gt_error_check(err);
   gt_assert(arguments);
-  md5set = gt_md5set_new(arguments->nofseqs);
-  if (!arguments->seqit) {
+  if (gt_option_is_set(arguments->refoptionmemlimit)) {
+    GtStrArray *files = gt_str_array_new();
+    for (i = parsed_args; i < argc; i++)
+      gt_str_array_add_cstr(files, argv[i]);
+    had_err = gt_sequniq_memlimit(arguments, files, &duplicates,
+                                  &num_of_sequences, err);
+    gt_str_array_delete(files);
+  }
+  else if (!arguments->seqit) {
     GtUword j;
     GtBioseq *bs;
 
+    md5set = gt_md5set_new(arguments->nofseqs);
     for (i = parsed_args; !had_err && i < argc; i++) {
       if (!(bs = gt_bioseq_new(argv[i], err)))
         had_err = -1;
@@ -151,6 +283,7 @@ static int gt_sequniq_runner(int argc, const char **argv, int parsed_args,
     char *desc;
     GtUword len;
 
+    md5set = gt_md5set_new(arguments->nofseqs);
     files = gt_str_array_new();
     for (i = parsed_args; i < argc; i++)
       gt_str_array_add_cstr(files, argv[i]);
@@ -204,6 +337,6 @@ GtTool* gt_sequniq(void)
   return gt_tool_new(gt_sequniq_arguments_new,
                      gt_sequniq_arguments_delete,
                      gt_sequniq_option_parser_new,
-                     NULL,
+                     gt_sequniq_arguments_check,
                      gt_sequniq_runner);
 }
@@ -91,6 +91,32 @@ opt_arr.each do |opt|
   end
 end
 
+opt_arr.each do |opt|
+  Name "gt condenseq compress multiple threads #{opt}"
+  Keywords "gt_condenseq compress threads"
+  Test do
+    files.each_pair do |file, info|
+      basename = File.basename(file)
+      run_test "#{$bin}gt encseq encode -clipdesc -indexname #{basename} " \
+        "-md5 no #{file}"
+      ["1", "4"].each do |jobs|
+        run_test "#{$bin}gt -j #{jobs} condenseq compress #{opt} " \
+          "-indexname #{basename}_j#{jobs} " \
+          "-cutoff 0 " \
+          "-alignlength #{info[0]} " \
+          "#{info[3] > 0 ? "-windowsize #{info[3]}" : ""} " \
+          "#{info[4] > 0 ? "-kmersize #{info[4]}" : ""} " \
+          "#{basename} ",
+          :maxtime => 600
+        run_test "#{$bin}gt condenseq extract " \
+          "#{basename}_j#{jobs} > #{basename}_j#{jobs}.fas"
+      end
+      run_test "cmp #{basename}_j1.cse #{basename}_j4.cse"
+      run_test "cmp #{basename}_j1.fas #{basename}_j4.fas"
+    end
+  end
+end
+
 makeblastdb = system("which makeblastdb")
 if makeblastdb
   makeblastdb = $?
@@ -154,6 +180,37 @@ opt_arr.each do |opt|
   end
 end
 
+opt_arr.each do |opt|
+  Name "gt condenseq compress + seedextend search #{opt}"
+  Keywords "gt_condenseq compress search seedextend"
+  Test do
+    searchfiles.each_pair do |file, info|
+      basename = File.basename(file)
+      queries = File.join(File.dirname(file), File.basename(file,'.fas'))
+      run_test "#{$bin}gt encseq encode -clipdesc -indexname #{basename} " \
+        "-md5 no " \
+        "#{file}"
+      run_test "#{$bin}gt condenseq compress " \
+        "#{opt} " \
+        "-indexname #{basename}_nr " \
+        "-cutoff 0 " \
+        "-alignlength #{info[0]} " \
+        "#{info[4] > 0 ? "-kmersize #{info[4]}" : ""} " \
+        "#{basename}",
+        :maxtime => 600
+      run_test "#{$bin}gt condenseq search seedextend " \
+        "-query #{queries}_queries_300_2x.fas " \
+        "-db #{basename}_nr -verbose",
+        :maxtime => 600
+      grep(last_stderr, /[1-9]+[0-9]* hits found/)
+      run_ruby "#$scriptsdir/condenseq_blastsearch_stats.rb " \
+        "#{queries}_queries_300_2x_blastn_result #{last_stdout}"
+      grep(last_stdout, /^## TP: [1-9]+[0-9]*$/)
+      grep(last_stdout, /^## FP: 0$/)
+    end
+  end
+end
+
 opt_arr.each do |opt|
   range_ext = Proc.new do |file, info|
     basename = File.basename(file)
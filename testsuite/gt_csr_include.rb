@@ -70,7 +70,8 @@ end
 # it would be nice to test -pagewise, but that would maybe require larger files
 # file used contains 100 reads trying with -srate 1 for default pagewise
 # sampling
-hcr_testcases = ["-stype regular -srate 10", "-stype none", "-srate 1"]
+hcr_testcases = ["-stype regular -srate 10", "-stype regular -srate 3",
+                 "-stype none", "-srate 1"]
 Name "gt hcr sampling"
 Keywords "gt_csr hcr sampling"
 Test do
@@ -83,6 +84,50 @@ Test do
              " -file test_#{hcr_testfiles[0]}", :maxtime => 300
     run_test "diff test_#{hcr_testfiles[0]}.fastq " \
              "#$testdata/#{hcr_testfiles[0]}"
+    run_test "#$bin/gt compreads decompress -descs -range 13 57 " \
+             "-file test_#{hcr_testfiles[0]} -name range"
+    `sed -n '53,232p' #$testdata/#{hcr_testfiles[0]} > range_original`
+    run_test "diff range.fastq range_original"
+  end
+end
+
+Name "gt hcr multiple threads"
+Keywords "gt_csr hcr sampling hcrparallel"
+Test do
+  hcr_testcases.each do |testcase|
+    ["single", "multi"].each do |mode|
+      jobs = (mode == "multi" ? "-j 4 " : "")
+      run_test "#$bin/gt #{jobs}compreads compress -descs #{testcase} " \
+               "-files #$testdata/#{hcr_testfiles[0]} -name test_#{mode}"
+      run_test "#$bin/gt #{jobs}compreads decompress -descs " \
+               "-file test_#{mode}"
+      run_test "diff test_#{mode}.fastq #$testdata/#{hcr_testfiles[0]}"
+      run_test "#$bin/gt #{jobs}compreads decompress -descs -range 13 57 " \
+               "-width 7 -file test_#{mode} -name range_#{mode}"
+    end
+    run_test "cmp test_single.hcr test_multi.hcr"
+    run_test "diff range_single.fastq range_multi.fastq"
+  end
+end
+
+Name "gt hcr quality contexts"
+Keywords "gt_csr hcr sampling qcontext"
+Test do
+  hcr_testcases.each do |testcase|
+    run_test "#$bin/gt compreads compress -descs #{testcase} " \
+             "-files #$testdata/#{hcr_testfiles[0]} -name test_plain"
+    run_test "#$bin/gt compreads compress -descs -qcontext #{testcase} " \
+             "-files #$testdata/#{hcr_testfiles[0]} -name test_context"
+    ["", "-j 4 "].each do |jobs|
+      run_test "#$bin/gt #{jobs}compreads decompress -descs " \
+               "-file test_context"
+      run_test "diff test_context.fastq #$testdata/#{hcr_testfiles[0]}"
+    end
+    ["plain", "context"].each do |mode|
+      run_test "#$bin/gt compreads decompress -descs -range 13 57 " \
+               "-width 7 -file test_#{mode} -name range_#{mode}"
+    end
+    run_test "diff range_plain.fastq range_context.fastq"
   end
 end
 
@@ -409,6 +409,8 @@ end
       run_test "#{$bin}gt encseq md5 -force -o out1 idx"
       run_test "#{$bin}gt encseq md5 -force -fromindex no -o out2 idx"
       run "diff out1 out2"
+      run_test "#{$bin}gt -j 4 encseq md5 -force -fromindex no -o out3 idx"
+      run "diff out1 out3"
     end
   end
 end
@@ -442,3 +444,25 @@ Test do
     end
   end
 end
+
+Name "gt encseq encode multiple files (multiple threads)"
+Keywords "encseq gt_encseq_encode encseqparallel"
+Test do
+  [["Atinsert.fna", "RandomN.fna", "wildcardatend.fna", "Duplicate.fna"],
+   ["wildcardatend.fna", "nowildcardatend.fna", "RandomN.fna"],
+   ["sw100K1.fsa", "sw100K2.fsa"]].each do |files|
+    infiles = files.map { |file| "#{$testdata}#{file}" }.join(" ")
+    run_test "#{$bin}gt encseq encode -md5 yes -des yes -sds yes " +
+             "-indexname seq #{infiles}"
+    run_test "#{$bin}gt -j 3 encseq encode -md5 yes -des yes -sds yes " +
+             "-indexname par #{infiles}"
+    ["esq", "ssp", "des", "sds", "md5"].each do |suffix|
+      if File.exist?("seq.#{suffix}")
+        run "cmp seq.#{suffix} par.#{suffix}"
+      end
+    end
+  end
+  run_test "#{$bin}gt -j 3 encseq encode -indexname par " +
+           "#{$testdata}Atinsert.fna #{$testdata}Atinsert.embl", :retval => 1
+  grep last_stderr, /illegal character 'I'/
+end
@@ -66,3 +66,78 @@ if not $arguments["nordb"] then
   end
 
 end
+
+Name "gt featureindex mmap (empty region)"
+Keywords "gt_featureindex mmap"
+Test do
+  run "#{$bin}gt mkfeatureindex -backend mmap -filename tmp.idx " +
+      "#{$testdata}/gt_view_prob_2.gff3"
+  run "#{$bin}gt featureindex -backend mmap -filename tmp.idx"
+  run "diff #{last_stdout} #{$testdata}/gt_view_prob_2.gff3"
+end
+
+Name "gt featureindex mmap (existing file)"
+Keywords "gt_featureindex mmap"
+Test do
+  run "#{$bin}gt mkfeatureindex -backend mmap -filename tmp.idx " +
+      "#{$testdata}/eden.gff3"
+  run "#{$bin}gt mkfeatureindex -backend mmap -filename tmp.idx " +
+      "#{$testdata}/eden.gff3", :retval => 1
+  grep(last_stderr, /exists already/)
+  run "#{$bin}gt mkfeatureindex -force -backend mmap -filename tmp.idx " +
+      "#{$testdata}/eden.gff3"
+end
+
+Name "gt featureindex mmap (corrupt file)"
+Keywords "gt_featureindex mmap"
+Test do
+  File.open("corrupt.idx", "w") do |file|
+    file.write("sdfnhsnl")
+  end
+  run "#{$bin}gt featureindex -backend mmap -filename corrupt.idx", :retval => 1
+  grep(last_stderr, /not a feature index/)
+  run "#{$bin}gt mkfeatureindex -backend mmap -filename tmp.idx " +
+      "#{$testdata}/eden.gff3"
+  run "head -c 200 tmp.idx > truncated.idx"
+  run "#{$bin}gt featureindex -backend mmap -filename truncated.idx",
+      :retval => 1
+  grep(last_stderr, /is corrupt/)
+end
+
+Name "gt featureindex mmap (range query)"
+Keywords "gt_featureindex mmap"
+Test do
+  run "#{$bin}gt mkfeatureindex -backend mmap -filename tmp.idx " +
+      "#{$testdata}/encode_known_genes_Mar07.gff3"
+  run "#{$bin}gt featureindex -backend mmap -seqid chr1 " +
+      "-range 148325854 148330000 -retain no -filename tmp.idx"
+  run "grep -v '^#' #{last_stdout} > out.gff3"
+  run "#{$bin}gt gff3 -retainids no " +
+      "#{$testdata}/encode_known_genes_Mar07.gff3 | " +
+      "#{$bin}gt select -seqid chr1 -overlap 148325854 148330000 | " +
+      "grep -v '^#'"
+  run "diff out.gff3 #{last_stdout}"
+end
+
+FEATUREINDEX_MMAP_TEST_FILES = ["#{$testdata}/eden.gff3",
+                                "#{$testdata}/standard_gene_as_tree.gff3",
+                                "#{$testdata}/standard_gene_with_introns_as_tree.gff3",
+                                "#{$testdata}/encode_known_genes_Mar07.gff3"]
+
+FEATUREINDEX_MMAP_TEST_FILES.each do |file|
+  Name "gt featureindex mmap vs. parser (#{File.basename(file)})"
+  Keywords "gt_featureindex mmap"
+  Test do
+    run "#{$bin}gt seqids #{file}"
+    seqids = File.open(last_stdout).readlines
+    run "#{$bin}gt mkfeatureindex -backend mmap -filename tmp.idx #{file}"
+    seqids.each do |seqid|
+      seqid.chomp!
+      run "#{$bin}gt featureindex -backend mmap -seqid #{seqid} -retain no " +
+          "-filename tmp.idx > out.gff3"
+      run "#{$bin}gt gff3 -retainids no #{file} | " +
+          "#{$bin}gt select -seqid #{seqid}"
+      run "diff out.gff3 #{last_stdout}"
+    end
+  end
+end
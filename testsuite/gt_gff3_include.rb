@@ -1028,6 +1028,87 @@ Test do
   run "diff #{last_stdout} #{$testdata}sequence_region_joined.gff3"
 end
 
+Name "gt gff3 join sequence regions with same ID (-sortmaxnodes)"
+Keywords "gt_gff3 sortmaxnodes"
+Test do
+  run_test "#{$bin}gt gff3 -sort -sortmaxnodes 2 " +
+           "#{$testdata}sequence_region_1.gff3 " +
+           "#{$testdata}sequence_region_2.gff3 "
+  run "diff #{last_stdout} #{$testdata}sequence_region_joined.gff3"
+end
+
+Name "gt gff3 -sortmaxnodes"
+Keywords "gt_gff3 sortmaxnodes"
+Test do
+  ["eden.gff3", "standard_gene_as_dag.gff3", "encode_known_genes_Mar07.gff3",
+   "multi_feature_with_different_parent_2_tidy.gff3", "dynbuf.gff3",
+   "two_fasta_seqs_without_sequence_regions.gff3"].each do |file|
+    run_test "#{$bin}gt gff3 -sort #{$testdata}#{file}"
+    run "mv #{last_stdout} sorted.gff3"
+    [1, 7, 50].each do |maxnodes|
+      run_test "#{$bin}gt gff3 -sort -sortmaxnodes #{maxnodes} " +
+               "#{$testdata}#{file}"
+      run "diff #{last_stdout} sorted.gff3"
+    end
+  end
+  run_test "#{$bin}gt gff3 -sort -retainids #{$testdata}eden.gff3"
+  run "mv #{last_stdout} sorted.gff3"
+  run_test "#{$bin}gt gff3 -sort -retainids -sortmaxnodes 3 " +
+           "#{$testdata}eden.gff3"
+  run "diff #{last_stdout} sorted.gff3"
+  run_test "#{$bin}gt gff3 -sortmaxnodes 3 #{$testdata}eden.gff3",
+           :retval => 1
+  grep last_stderr, /requires/
+end
+
+Name "gt gff3 -sortmaxnodes (seqid with blanks)"
+Keywords "gt_gff3 sortmaxnodes"
+Test do
+  run_test "#{$bin}gt gff3 -sort #{$testdata}linesort_test_3.gff3"
+  run "mv #{last_stdout} sorted.gff3"
+  [1, 3].each do |maxnodes|
+    run_test "#{$bin}gt gff3 -sort -sortmaxnodes #{maxnodes} " +
+             "#{$testdata}linesort_test_3.gff3"
+    run "diff #{last_stdout} sorted.gff3"
+  end
+end
+
+Name "gt gff3 -sortmaxnodes (more runs than open files)"
+Keywords "gt_gff3 sortmaxnodes"
+Test do
+  run_test "#{$bin}gt gff3 -sort #{$testdata}encode_known_genes_Mar07.gff3"
+  run "mv #{last_stdout} sorted.gff3"
+  # about 700 runs are merged, at most 64 at a time
+  run_test "sh -c 'ulimit -n 100 && #{$bin}gt gff3 -sort -sortmaxnodes 50 " +
+           "#{$testdata}encode_known_genes_Mar07.gff3'"
+  run "diff #{last_stdout} sorted.gff3"
+end
+
+Name "gt gff3 -sort (multiple threads)"
+Keywords "gt_gff3 sortparallel"
+Test do
+  ["encode_known_genes_Mar07.gff3", "standard_gene_as_dag.gff3"].each do |file|
+    run_test "#{$bin}gt gff3 -sort #{$testdata}#{file}"
+    run "mv #{last_stdout} sorted.gff3"
+    run_test "#{$bin}gt -j 4 gff3 -sort #{$testdata}#{file}"
+    run "diff #{last_stdout} sorted.gff3"
+    run_test "#{$bin}gt -j 3 gff3 -sort -sortmaxnodes 5000 " +
+             "#{$testdata}#{file}"
+    run "diff #{last_stdout} sorted.gff3"
+  end
+  [2, 3, 4].each do |jobs|
+    run_test "#{$bin}gt -j #{jobs} -test -only 'genome node sorting'"
+  end
+end
+
+Name "gt gff3 attributes (multiple threads)"
+Keywords "gt_gff3 sortparallel"
+Test do
+  ["symbol module", "attribute map class"].each do |unit_test|
+    run_test "#{$bin}gt -j 4 -test -only '#{unit_test}'"
+  end
+end
+
 Name "gt gff3 print very long attributes"
 Keywords "gt_gff3"
 Test do
@@ -1623,3 +1704,61 @@ if $gttestdata then
     run      "diff #{last_stdout} #{$gttestdata}gff3testruns/ensembl.gff3"
   end
 end
+
+Name "gt gff3 -binary"
+Keywords "gt_gff3 binary"
+Test do
+  ["eden.gff3", "standard_gene_as_dag.gff3", "encode_known_genes_Mar07.gff3",
+   "multi_feature_simple.gff3", "all_node_types.gff3",
+   "two_fasta_seqs_without_sequence_regions.gff3"].each do |file|
+    run_test "#{$bin}gt gff3 -retainids #{$testdata}#{file}"
+    run "mv #{last_stdout} expected.gff3"
+    run_test "#{$bin}gt gff3 -binary #{$testdata}#{file}"
+    run "mv #{last_stdout} out.bin"
+    run_test "#{$bin}gt gff3 -retainids out.bin"
+    run "diff #{last_stdout} expected.gff3"
+    run_test "#{$bin}gt gff3 -binary out.bin"
+    run "cmp #{last_stdout} out.bin"
+  end
+  # binary and GFF3 input can be mixed
+  run_test "#{$bin}gt gff3 -binary #{$testdata}eden.gff3"
+  run "mv #{last_stdout} eden.bin"
+  run_test "#{$bin}gt gff3 -sort #{$testdata}addintrons.gff3 eden.bin"
+  run "mv #{last_stdout} mixed.gff3"
+  run_test "#{$bin}gt gff3 -sort #{$testdata}addintrons.gff3 " +
+           "#{$testdata}eden.gff3"
+  run "diff #{last_stdout} mixed.gff3"
+end
+
+Name "gt gff3 -binary (truncated file)"
+Keywords "gt_gff3 binary"
+Test do
+  run_test "#{$bin}gt gff3 -binary #{$testdata}eden.gff3"
+  run "head -c 300 #{last_stdout} > truncated.bin"
+  run_test "#{$bin}gt gff3 truncated.bin", :retval => 1
+  grep last_stderr, /unexpected end of binary file/
+end
+
+Name "gt gff3 -binary (cyclic links)"
+Keywords "gt_gff3 binary"
+Test do
+  File.open("dag.gff3", "w") do |f|
+    f.puts "##gff-version 3"
+    f.puts "##sequence-region ctg1 1 100"
+    f.puts "ctg1\t.\tgene\t1\t100\t.\t+\t.\tID=g1"
+    f.puts "ctg1\t.\tmRNA\t1\t100\t.\t+\t.\tID=m1;Parent=g1"
+    f.puts "ctg1\t.\texon\t1\t50\t.\t+\t.\tParent=g1,m1"
+  end
+  run_test "#{$bin}gt gff3 -binary dag.gff3"
+  run "mv #{last_stdout} dag.bin"
+  run_test "#{$bin}gt gff3 dag.bin"
+  # the file ends with the links (0,1) (0,2) (2,1) and the EOF tag,
+  # turn them into (0,1) (1,2) (2,1) and (0,1) (0,2) (1,1)
+  { "cycle" => -5, "selflink" => -3 }.each do |name, pos|
+    data = File.binread("dag.bin")
+    data.setbyte(pos, 1)
+    File.binwrite("#{name}.bin", data)
+    run_test "#{$bin}gt gff3 #{name}.bin", :retval => 1, :maxtime => 10
+    grep last_stderr, /corrupt record/
+  end
+end
@@ -54,6 +54,32 @@ Test do
   end
 end
 
+Name "gt linspace_align batch of pairs"
+Keywords "gt_linspace_align batch"
+Test do
+  f1 = "#{$testdata}nGASP/protein_10.fas"
+  f2 = "#{$testdata}nGASP/protein_10th.fas"
+  ["-global -l #{$testdata}BLOSUM62 \" -1\"",
+   "-local -a #{$testdata}BLOSUM62 \" -3\" \" -1\""].each do |mode|
+    run_test "#{$bin}gt dev linspace_align -ff #{f1} #{f2} -protein #{mode} "\
+             "-showonlyscore", :maxtime => 180
+    allscores = File.readlines(last_stdout).grep(/^(distance|score)/)
+    diagonal = (0...10).map {|i| allscores[i * 10 + i]}
+    [1, 3].each do |jobs|
+      run_test "#{$bin}gt -j #{jobs} dev linspace_align -ff #{f1} #{f2} "\
+               "-protein #{mode} -showonlyscore -batch", :maxtime => 180
+      batchscores = File.readlines(last_stdout).grep(/^(distance|score)/)
+      if batchscores != diagonal
+        raise TestFailedError
+      end
+    end
+  end
+  run_test "#{$bin}gt dev linspace_align -ff #{f1} "\
+           "#{$testdata}nGASP/protein_short.fas -protein -global "\
+           "-l #{$testdata}BLOSUM62 \" -1\" -batch", :retval => 1
+  grep last_stderr, "same number of sequences"
+end
+
 1.upto(3) do |i|
   Name "gt linspace_align local lin gap test #{i}"
   Keywords "gt_linspace_align"
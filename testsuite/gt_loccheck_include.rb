@@ -9,4 +9,32 @@ Name "gt loccheck test (ok)"
 Keywords "gt_loccheck"
 Test do
   run_test "#{$bin}gt loccheck < #{$testdata}standard_gene_as_dag.gff3"
-end
\ No newline at end of file
+end
+Name "gt loccheck test (multiple threads)"
+Keywords "gt_loccheck"
+Test do
+  File.open("loccheck.gff3", "w") do |f|
+    f.puts "##gff-version 3"
+    f.puts "##sequence-region seq1 1 1000000"
+    1.upto(2000) do |i|
+      start = i * 100
+      f.puts "seq1\t.\tgene\t#{start}\t#{start + 50}\t.\t+\t.\tID=gene#{i}"
+      f.puts "seq1\t.\tmRNA\t#{start}\t#{start + 50 + i % 2}\t.\t+\t.\t" +
+             "Parent=gene#{i}"
+    end
+  end
+  run_test "#{$bin}gt loccheck loccheck.gff3"
+  stderr = last_stderr
+  run "mv #{last_stdout} loccheck.out"
+  run "mv #{stderr} loccheck.err"
+  run "grep -c 'not contained in gene parent' loccheck.err"
+  grep last_stdout, /^1000$/
+  [2, 4].each do |jobs|
+    run_test "#{$bin}gt -j #{jobs} loccheck loccheck.gff3"
+    stderr = last_stderr
+    run "diff #{last_stdout} loccheck.out"
+    run "diff #{stderr} loccheck.err"
+  end
+  # the warnings are shown in stream order by the parallel visitor stream
+  run_test "#{$bin}gt -j 4 -test -only 'parallel visitor stream class'"
+end
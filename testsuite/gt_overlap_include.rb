@@ -0,0 +1,60 @@
+Name "gt overlap count mode"
+Keywords "gt_overlap"
+Test do
+  run_test "#{$bin}gt overlap -retainids -bformat bed " +
+           "#{$testdata}overlap_a.gff3 #{$testdata}overlap_b.bed"
+  run "diff #{last_stdout} #{$testdata}overlap_count.out"
+end
+
+Name "gt overlap join mode"
+Keywords "gt_overlap"
+Test do
+  run_test "#{$bin}gt overlap -mode join -bformat bed " +
+           "#{$testdata}overlap_a.gff3 #{$testdata}overlap_b.bed"
+  run "diff #{last_stdout} #{$testdata}overlap_join.out"
+end
+
+Name "gt overlap join mode (swapped inputs)"
+Keywords "gt_overlap"
+Test do
+  run_test "#{$bin}gt overlap -mode join -aformat bed " +
+           "#{$testdata}overlap_b.bed #{$testdata}overlap_a.gff3"
+  run "diff #{last_stdout} #{$testdata}overlap_join_swapped.out"
+end
+
+Name "gt overlap join mode (self join)"
+Keywords "gt_overlap"
+Test do
+  run_test "#{$bin}gt overlap -mode join " +
+           "#{$testdata}standard_gene_as_tree.gff3 " +
+           "#{$testdata}standard_gene_as_tree.gff3"
+  grep last_stdout, /^ctg123\t1000\t9000\t\+\tgene\tgene1\t1000\t9000/
+end
+
+Name "gt overlap unsorted input"
+Keywords "gt_overlap"
+Test do
+  run_test("#{$bin}gt overlap -bformat bed #{$testdata}overlap_a.gff3 " +
+           "#{$testdata}overlap_unsorted.bed", :retval => 1)
+  grep last_stderr, /the second input is not sorted/
+  run_test("#{$bin}gt overlap #{$testdata}not_sorted.gff3 " +
+           "#{$testdata}overlap_a.gff3", :retval => 1)
+  grep last_stderr, /is not sorted/
+end
+
+Name "gt overlap unsorted input (-sort)"
+Keywords "gt_overlap"
+Test do
+  run_test "#{$bin}gt overlap -sort -retainids -attribute unsorted_overlaps " +
+           "-bformat bed #{$testdata}overlap_a.gff3 " +
+           "#{$testdata}overlap_unsorted.bed"
+  run "diff #{last_stdout} #{$testdata}overlap_sort.out"
+end
+
+Name "gt overlap empty attribute"
+Keywords "gt_overlap"
+Test do
+  run_test("#{$bin}gt overlap -attribute '' #{$testdata}overlap_a.gff3 " +
+           "#{$testdata}overlap_a.gff3", :retval => 1)
+  grep last_stderr, /must not be empty/
+end
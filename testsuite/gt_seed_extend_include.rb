@@ -374,6 +374,28 @@ Test do
   end
 end
 
+Name "gt seed_extend: chaining with threads"
+Keywords "gt_seed_extend thread gt_seed_extend_thread chain"
+Test do
+  run_test build_encseq("at1MB", "#{$testdata}at1MB")
+  run_test build_encseq("U89959_genomic", "#{$testdata}U89959_genomic.fas")
+  # one line per chain, such that chains can be compared regardless of the
+  # order in which the threads output them
+  chains = "awk '/^# chain/ {if (c != \"\") print c; c = $0; next} " +
+           "/^#/ || NF != 6 {next} {c = c \" | \" $0} " +
+           "END {if (c != \"\") print c}'"
+  ["1b", "50p"].each do |chainarg|
+    args = "-ii at1MB -qii U89959_genomic -maxmat 2 -l 30 -chain #{chainarg}"
+    run_test "#{$bin}gt seed_extend #{args}"
+    run "#{chains} #{last_stdout} | sort > chains.out"
+    run "test -s chains.out"
+    ["-j 4 seed_extend -parts 4", "-j 2 seed_extend"].each do |jobs|
+      run_test "#{$bin}gt #{jobs} #{args}"
+      run "#{chains} #{last_stdout} | sort | diff - chains.out"
+    end
+  end
+end
+
 # KmerPos and SeedPair verification
 Name "gt seed_extend: small_poly, no extension, verify lists"
 Keywords "gt_seed_extend only-seeds verify debug-kmer debug-seedpair small_poly"
@@ -556,6 +578,53 @@ Test do
   end
 end
 
+# Query sequences from file
+Name "gt seed_extend: query sequences from file in batches"
+Keywords "gt_seed_extend query qfile"
+Test do
+  run_test build_encseq("at1MB", "#{$testdata}at1MB")
+  run_test build_encseq("Atinsert", "#{$testdata}Atinsert.fna")
+  options = "-ii at1MB -seedlength 14 -l 100 -outfmt queryid"
+  run_test "#{$bin}gt seed_extend #{options} -qii Atinsert"
+  run "grep -v '^#' #{last_stdout}"
+  run "sort #{last_stdout}"
+  run "mv #{last_stdout} qii.matches"
+  ["1","5","100"].each do |batchsize|
+    run_test "#{$bin}gt seed_extend #{options} " +
+             "-qfile #{$testdata}Atinsert.fna -qbatchsize #{batchsize}"
+    run "grep -v '^#' #{last_stdout}"
+    run "sort #{last_stdout}"
+    run "diff qii.matches #{last_stdout}"
+  end
+  run_test "#{$bin}gt seed_extend -ii at1MB -qii Atinsert " +
+           "-qfile #{$testdata}Atinsert.fna", :retval => 1
+end
+
+Name "gt seed_extend: query files with short sequence"
+Keywords "gt_seed_extend query qfile"
+Test do
+  run_test build_encseq("at1MB", "#{$testdata}at1MB")
+  File.open("query.fna", "w") do |f|
+    f.puts ">short"
+    f.puts "ACGTACGT"
+    f.write File.read("#{$testdata}Atinsert.fna")
+  end
+  run_test build_encseq("query", "query.fna")
+  ["-seedlength 14 -l 50", "-l 50"].each do |options|
+    run_test "#{$bin}gt seed_extend -ii at1MB #{options} -qii query"
+    run "grep -v '^#' #{last_stdout}"
+    run "sort #{last_stdout}"
+    run "mv #{last_stdout} qii.matches"
+    ["1","2"].each do |batchsize|
+      run_test "#{$bin}gt seed_extend -ii at1MB #{options} " +
+               "-qfile query.fna -qbatchsize #{batchsize}"
+      run "grep -v '^#' #{last_stdout}"
+      run "sort #{last_stdout}"
+      run "diff qii.matches #{last_stdout}"
+    end
+  end
+end
+
 # Part of encseq
 Name "gt seed_extend: parts"
 Keywords "gt_seed_extend parts pick"
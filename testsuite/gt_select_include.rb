@@ -12,6 +12,16 @@ Test do
   run "diff #{last_stdout} #{$testdata}standard_gene_as_tree.gff3"
 end
 
+Name "gt select test (-binary)"
+Keywords "gt_select binary"
+Test do
+  run_test "#{$bin}gt select -binary -seqid ctg123 " +
+           "#{$testdata}standard_gene_as_tree.gff3"
+  run "mv #{last_stdout} out.bin"
+  run_test "#{$bin}gt gff3 out.bin"
+  run "diff #{last_stdout} #{$testdata}standard_gene_as_tree.gff3"
+end
+
 Name "gt select test (-seqid undef)"
 Keywords "gt_select"
 Test do
@@ -285,6 +295,51 @@ Test do
   grep last_stderr, /error/
 end
 
+Name "gt select test (-expression, node type in gff3)"
+Keywords "gt_select expression"
+Test do
+  run_test "#{$bin}gt select -expression 'any(type == exon)' " +
+           "#{$testdata}standard_gene_as_tree.gff3"
+  run "diff #{last_stdout} #{$testdata}standard_gene_as_tree.gff3"
+end
+
+Name "gt select test (-expression, node type not in gff3)"
+Keywords "gt_select expression"
+Test do
+  run_test "#{$bin}gt select -expression 'any(type == xon)' " +
+           "#{$testdata}standard_gene_as_tree.gff3"
+  run "diff #{last_stdout} #{$testdata}gt_select_test.out"
+end
+
+Name "gt select test (-expression, top-level fields)"
+Keywords "gt_select expression"
+Test do
+  run_test "#{$bin}gt select -expression " +
+           "'type == gene and strand == + and length > 8000 and " +
+           "not attr.Note' #{$testdata}standard_gene_as_tree.gff3"
+  run "diff #{last_stdout} #{$testdata}standard_gene_as_tree.gff3"
+  run_test "#{$bin}gt select -expression 'type == gene and end < 9000' " +
+           "#{$testdata}standard_gene_as_tree.gff3"
+  run "diff #{last_stdout} #{$testdata}gt_select_test.out"
+end
+
+Name "gt select test (-expression and -rule_files)"
+Keywords "gt_select expression"
+Test do
+  run_test "#{$bin}gt select -expression 'type == gene' -rule_files " +
+           "#{$testdata}gtscripts/filter_test_wrong_nodetype.lua -- " +
+           "#{$testdata}standard_gene_as_tree.gff3"
+  run "diff #{last_stdout} #{$testdata}gt_select_test.out"
+end
+
+Name "gt select test (-expression, syntax error)"
+Keywords "gt_select expression"
+Test do
+  run_test "#{$bin}gt select -expression 'type = gene' " +
+           "#{$testdata}standard_gene_as_tree.gff3", :retval => 1
+  grep last_stderr, /invalid select expression "type = gene": '=' is not an operator, use '==' at position 6/
+end
+
 Name "gt select test (reading_frame_length % 3 != 0)"
 Keywords "gt_select"
 Test do
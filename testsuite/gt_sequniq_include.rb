@@ -1,6 +1,7 @@
 require "fileutils"
 
-["", " -rev", " -seqit", " -seqit -rev"].each do |opt|
+["", " -rev", " -seqit", " -seqit -rev", " -memlimit 1MB",
+ " -memlimit 1MB -rev"].each do |opt|
   Name "gt sequniq#{opt} 2xfoo test"
   Keywords "gt_sequniq"
   Test do
@@ -18,7 +19,7 @@ require "fileutils"
   end
 end
 
-["", " -seqit"].each do |opt|
+["", " -seqit", " -memlimit 1MB"].each do |opt|
   Name "gt sequniq#{opt} foo + rc(foo) test "
   Keywords "gt_sequniq"
   Test do
@@ -67,3 +68,26 @@ Test do
   run_test "#{$bin}gt sequniq -rev gt_sequniq_rev_bug.fas"
   run "diff #{last_stdout} #{$testdata}gt_sequniq_rev_bug.out"
 end
+
+["", " -rev"].each do |opt|
+  Name "gt sequniq#{opt} -memlimit (multiple files)"
+  Keywords "gt_sequniq memlimit"
+  Test do
+    files = ["U89959_ests.fas", "U89959_ests.fas", "foorcfoofoo.fas",
+             "gt_sequniq_rev_bug.fas"].collect{|f| "#{$testdata}#{f}"}
+    run_test "#{$bin}gt sequniq#{opt} #{files.join(' ')}"
+    FileUtils.copy(last_stdout, "inmemory.fas")
+    ["", "-j 4 "].each do |jobs|
+      run_test "#{$bin}gt #{jobs}sequniq#{opt} -memlimit 1MB " \
+               "#{files.join(' ')}"
+      run "diff #{last_stdout} inmemory.fas"
+    end
+  end
+end
+
+Name "gt sequniq -memlimit (stdin)"
+Keywords "gt_sequniq memlimit"
+Test do
+  run_test "#{$bin}gt sequniq -memlimit 1MB - < #{$testdata}foofoo.fas",
+           :retval => 1
+end
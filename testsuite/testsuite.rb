@@ -198,6 +198,7 @@ require 'gt_mergefeat_include'
 require 'gt_mgth_include'
 require 'gt_mmapandread_include'
 require 'gt_orffinder_include'
+require 'gt_overlap_include'
 if python_tests_runnable? then
   require 'gt_python_include'
 end